@@ -121,7 +121,8 @@ Database::Database(storage::Config config, std::function<storage::DatabaseProtec
                                  }},
       streams_(
           std::make_unique<query::stream::Streams>(config.durability.storage_directory / "streams", db_arena_.get())),
-      plan_cache_{FLAGS_query_plan_cache_max_size} {
+      plan_cache_{FLAGS_query_plan_cache_max_size},
+      result_cache_{FLAGS_query_result_cache_max_memory_mb * 1024 * 1024} {
   // Route all constructor-body allocations (storage init, recovery, index structures) to this DB's arena.
   const memory::DbArenaScope db_arena_scope{this};
 
@@ -152,6 +153,9 @@ Database::Database(storage::Config config, std::function<storage::DatabaseProtec
                                            db_arena_.get(),
                                            &db_embedding_memory_tracker_);
   }
+
+  // Cached results outlive the commits which changed none of the labels they read
+  if (result_cache_.Lock()->enabled()) storage_->label_change_log_.Enable();
 }
 
 DatabaseInfo Database::GetInfo() const {
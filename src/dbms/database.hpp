@@ -19,6 +19,7 @@
 
 #include "memory/db_arena_fwd.hpp"
 #include "query/cypher_query_interpreter.hpp"
+#include "query/result_cache.hpp"
 #include "storage/v2/access_type.hpp"
 #include "storage/v2/config.hpp"
 #include "storage/v2/database_protector.hpp"
@@ -177,6 +178,13 @@ class Database {
    */
   query::PlanCacheLRU *plan_cache() { return &plan_cache_; }
 
+  /**
+   * @brief Returns the cache of read-only query results
+   *
+   * @return query::ResultCacheLRU*
+   */
+  query::ResultCacheLRU *result_cache() { return &result_cache_; }
+
   storage::ttl::TTL &ttl();
 
   /**
@@ -261,6 +269,7 @@ class Database {
   utils::ThreadPool after_commit_trigger_pool_{1};      //!< Thread pool for after commit triggers
   std::unique_ptr<query::stream::Streams> streams_;     //!< Streams associated with the storage
   query::PlanCacheLRU plan_cache_;                      //!< Plan cache associated with the storage
+  query::ResultCacheLRU result_cache_;                  //!< Results of read-only queries on the storage
 };
 
 }  // namespace memgraph::dbms
@@ -588,8 +588,16 @@ void InMemoryReplicationHandlers::FinalizeCommitHandler(dbms::DbmsHandler *dbms_
   }
 
   two_pc_cache_.commit_accessor_.reset();
-  if (mem_storage->wal_file_) {
-    mem_storage->FinalizeWalFile();
+  std::optional<uint64_t> wal_group_commit_ticket;
+  {
+    // The WAL group commit flusher reads wal_file_ under the engine lock
+    auto guard = std::lock_guard{mem_storage->engine_lock_};
+    if (mem_storage->wal_file_) {
+      wal_group_commit_ticket = mem_storage->FinalizeWalFile();
+    }
+  }
+  if (wal_group_commit_ticket) {
+    mem_storage->WaitForWalSync(*wal_group_commit_ticket);
   }
 
   storage::replication::FinalizeCommitRes const res(true);
@@ -739,6 +747,7 @@ void InMemoryReplicationHandlers::SnapshotHandler(rpc::FileReplicationHandler co
       storage::CommitTsInfo const new_info{.ldt_ = snapshot_info.durable_timestamp,
                                            .num_committed_txns_ = snapshot_info.num_committed_txns};
       storage->repl_storage_state_.commit_ts_info_.store(new_info, std::memory_order_release);
+      storage->label_change_log_.Clear();
       spdlog::trace("Set num committed txns to {} after loading snapshot.", snapshot_info.num_committed_txns);
       // We are the only active transaction, so mark everything up to the next timestamp
       if (storage->timestamp_ > 0) storage->commit_log_->MarkFinishedInRange(0, storage->timestamp_ - 1);
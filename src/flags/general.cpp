@@ -104,6 +104,13 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24UL * 3600));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_thread_count, memgraph::storage::Config::Gc().thread_count,
+                        "The number of threads used by the storage garbage collector.", FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_max_unlink_ms, memgraph::storage::Config::Gc().max_unlink_time.count(),
+              "Upper bound (in milliseconds) on the time a garbage collection run spends unlinking deltas; the rest is "
+              "left for the next run. 0 means no bound.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_python_gc_cycle_sec, 180,
                         "Storage python full garbage collection interval (in seconds).", FLAG_IN_RANGE(1, 24UL * 3600));
 
@@ -118,6 +125,12 @@ DEFINE_bool(storage_wal_enabled, false,
 DEFINE_VALIDATED_uint64(storage_snapshot_retention_count, 3, "The number of snapshots that should always be kept.",
                         FLAG_IN_RANGE(1, 1'000'000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_snapshot_incremental_chain_length,
+              memgraph::storage::Config::Durability().snapshot_incremental_chain_length,
+              "The number of incremental snapshots written after a full one before the next full snapshot. An "
+              "incremental snapshot only contains the vertices and edges changed since the previous snapshot. Requires "
+              "storage_wal_enabled. Set to 0 to always write full snapshots.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, memgraph::storage::Config::Durability().wal_file_size_kibibytes,
                         "Minimum file size of each WAL file.",
                         FLAG_IN_RANGE(1, static_cast<unsigned long>(1000) * 1024));
@@ -128,6 +141,10 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1'000'000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit, memgraph::storage::Config::Durability().wal_group_commit,
+            "Acknowledge a commit only once its WAL records are synced to disk, sharing one 'fdatasync' between all "
+            "concurrently committing transactions. When enabled, storage_wal_file_flush_every_n_tx is ignored.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -179,6 +196,13 @@ DEFINE_uint64(storage_recovery_thread_count,
                        memgraph::storage::Config::Durability().recovery_thread_count),
               "The number of threads used to recover persisted data from disk.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_index_population_thread_count,
+                        memgraph::storage::Config::Durability().index_population_thread_count,
+                        "The number of threads used to populate an index created on a running database, by CREATE "
+                        "INDEX or automatic index creation. 1 populates on the creating thread.",
+                        FLAG_IN_RANGE(1, 1024));
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_enable_schema_metadata, false,
             "Controls whether metadata should be collected about the resident labels and edge types.");
@@ -199,6 +223,18 @@ DEFINE_bool(storage_light_edge, false,
             "Controls whether edges are stored as lightweight objects in order to reduce memory footprint; implies "
             "--storage-properties-on-edges.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_edge_type_grouped_adjacency, false,
+            "Controls whether vertex adjacency lists are kept grouped by edge type, so expansions filtered by edge "
+            "type only visit the matching edges. Makes edge creation and deletion on high-degree vertices more "
+            "expensive.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_skiplist_node_pool_enabled, false,
+            "Controls whether vertices and edges are allocated from per-CPU pools of slabs, which speeds up bulk "
+            "creation on many cores. Pooled memory is reused for new objects but only released when the database "
+            "is cleared or dropped.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_delta_on_identical_property_update, true,
             "Controls whether updating a property with the same value should create a delta object.");
@@ -273,6 +309,11 @@ DEFINE_string(query_callable_mappings_path, "",
               "pairs in a json file. With this option query module procedures that do not exist in memgraph can be "
               "mapped to ones that exist.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_spill_to_disk, true,
+            "When a query with a memory limit gets close to it, ORDER BY, aggregations, DISTINCT and hash joins move "
+            "the rows they collected to temporary files under data_directory instead of failing the query.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_HIDDEN_string(license_key, "", "License key for Memgraph Enterprise.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
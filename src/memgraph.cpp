@@ -529,20 +529,25 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .thread_count = FLAGS_storage_gc_thread_count,
+             .max_unlink_time = std::chrono::milliseconds(FLAGS_storage_gc_max_unlink_ms)},
 
       .durability = {.storage_directory = FLAGS_data_directory,
                      .root_data_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_data_recovery_on_startup,
                      .allow_recovery_failure = FLAGS_storage_allow_recovery_failure,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
+                     .snapshot_incremental_chain_length = FLAGS_storage_snapshot_incremental_chain_length,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .snapshot_thread_count = FLAGS_storage_snapshot_thread_count,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
+                     .index_population_thread_count = FLAGS_storage_index_population_thread_count,
                      .snapshot_writeback_window_mib = FLAGS_storage_snapshot_writeback_window_mib,
                      .release_recovered_snapshot_page_cache = FLAGS_storage_release_recovered_snapshot_page_cache,
                      .release_sent_snapshot_page_cache = FLAGS_storage_release_sent_snapshot_page_cache,
@@ -567,10 +572,12 @@ int main(int argc, char **argv) {
                             FLAGS_storage_automatic_edge_type_index_creation_enabled,  // NOLINT(misc-include-cleaner)
                         .storage_light_edge = FLAGS_storage_light_edge,
                         .delta_on_identical_property_update = FLAGS_storage_delta_on_identical_property_update,
-                        .property_store_compression_enabled = FLAGS_storage_property_store_compression_enabled},
+                        .property_store_compression_enabled = FLAGS_storage_property_store_compression_enabled,
+                        .edge_type_grouped_adjacency = FLAGS_storage_edge_type_grouped_adjacency},
       .salient.storage_mode = memgraph::flags::ParseStorageMode(),
       .salient.property_store_compression_level = memgraph::flags::ParseCompressionLevel(),
-      .track_label_counts = FLAGS_telemetry_enabled};
+      .track_label_counts = FLAGS_telemetry_enabled,
+      .enable_skiplist_node_pool = FLAGS_storage_skiplist_node_pool_enabled};
   // Light edges require properties on edges: coerce BEFORE any check that
   // depends on properties_on_edges (the edge-type auto-index fatal below and
   // the edges-metadata warning) so they all observe the effective value.
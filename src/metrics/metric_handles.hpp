@@ -206,6 +206,13 @@ struct DatabaseMetricHandles {
   // Counts individual indexes swept, not collection cycles, because what a cycle costs depends on
   // how many indexes it had any reason to look through.
   CounterHandle gc_index_sweeps;
+  // Committed transactions whose deltas a GC pass could not unlink yet, and time spent per GC phase
+  GaugeHandle gc_backlog_transactions;
+  HistogramHandle gc_unlink_latency_seconds;
+  HistogramHandle gc_retire_latency_seconds;
+  // WAL group commit: transactions made durable by one sync, and how long that sync took
+  HistogramHandle wal_group_commit_batch_size;
+  HistogramHandle wal_group_commit_latency_seconds;
 };
 
 }  // namespace memgraph::metrics
@@ -77,6 +77,10 @@ prometheus::Histogram::BucketBoundaries const kLatencyBuckets{
 
 inline prometheus::Histogram::BucketBoundaries const kThroughputBuckets{1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
 
+// Transactions per WAL group commit sync, 1 to 4096
+inline prometheus::Histogram::BucketBoundaries const kBatchSizeBuckets{
+    1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+
 void RemoveDurabilityThroughput(std::string_view instance_name,
                                 prometheus::Family<prometheus::Histogram> &throughput_family,
                                 DurabilityThroughput &throughput) {
@@ -796,6 +800,26 @@ PrometheusMetrics::PrometheusMetrics()
                                   .Name("memgraph_gc_index_sweeps_total")
                                   .Help("Individual indexes swept by GC index cleanup")
                                   .Register(registry_)},
+      gc_backlog_transactions_family_{prometheus::BuildGauge()
+                                          .Name("memgraph_gc_backlog_transactions")
+                                          .Help("Committed transactions whose deltas are waiting to be unlinked by GC")
+                                          .Register(registry_)},
+      gc_unlink_latency_family_{prometheus::BuildHistogram()
+                                    .Name("memgraph_gc_unlink_latency_seconds")
+                                    .Help("Time a GC run spends unlinking deltas in seconds")
+                                    .Register(registry_)},
+      gc_retire_latency_family_{prometheus::BuildHistogram()
+                                    .Name("memgraph_gc_retire_latency_seconds")
+                                    .Help("Time a GC run spends removing deleted objects from storage in seconds")
+                                    .Register(registry_)},
+      wal_group_commit_batch_size_family_{prometheus::BuildHistogram()
+                                              .Name("memgraph_wal_group_commit_batch_size")
+                                              .Help("Transactions made durable by a single WAL group commit sync")
+                                              .Register(registry_)},
+      wal_group_commit_latency_family_{prometheus::BuildHistogram()
+                                           .Name("memgraph_wal_group_commit_latency_seconds")
+                                           .Help("Latency of a WAL group commit sync in seconds")
+                                           .Register(registry_)},
       snapshot_throughput_family_{prometheus::BuildHistogram()
                                       .Name("memgraph_snapshot_throughput_bytes_per_second")
                                       .Help("Throughput of snapshot sent to each replica during recovery, in bytes/s")
@@ -1067,6 +1091,13 @@ PrometheusMetrics::Registration PrometheusMetrics::AddDatabase(utils::UUID const
                   .gc_skiplist_cleanup_latency_seconds = {&gc_skiplist_cleanup_latency_family_.Add(labels,
                                                                                                    kLatencyBuckets)},
                   .gc_index_sweeps = {&gc_index_sweeps_family_.Add(labels)},
+                  .gc_backlog_transactions = {&gc_backlog_transactions_family_.Add(labels)},
+                  .gc_unlink_latency_seconds = {&gc_unlink_latency_family_.Add(labels, kLatencyBuckets)},
+                  .gc_retire_latency_seconds = {&gc_retire_latency_family_.Add(labels, kLatencyBuckets)},
+                  .wal_group_commit_batch_size = {&wal_group_commit_batch_size_family_.Add(labels,
+                                                                                           kBatchSizeBuckets)},
+                  .wal_group_commit_latency_seconds = {&wal_group_commit_latency_family_.Add(labels,
+                                                                                             kLatencyBuckets)},
               },
       });
   return Registration{this, entry_id, databases_.entries.back().handles};
@@ -1203,6 +1234,11 @@ void PrometheusMetrics::ReleaseRegistration(uint64_t entry_id) {
   gc_latency_family_.Remove(h.gc_latency_seconds.get());
   gc_skiplist_cleanup_latency_family_.Remove(h.gc_skiplist_cleanup_latency_seconds.get());
   gc_index_sweeps_family_.Remove(h.gc_index_sweeps.get());
+  gc_backlog_transactions_family_.Remove(h.gc_backlog_transactions.get());
+  gc_unlink_latency_family_.Remove(h.gc_unlink_latency_seconds.get());
+  gc_retire_latency_family_.Remove(h.gc_retire_latency_seconds.get());
+  wal_group_commit_batch_size_family_.Remove(h.wal_group_commit_batch_size.get());
+  wal_group_commit_latency_family_.Remove(h.wal_group_commit_latency_seconds.get());
   if (default_db_uuid_ && *default_db_uuid_ == it->uuid) {
     default_db_uuid_.reset();
   }
@@ -494,6 +494,13 @@ class PrometheusMetrics {
   prometheus::Family<prometheus::Histogram> &gc_latency_family_;
   prometheus::Family<prometheus::Histogram> &gc_skiplist_cleanup_latency_family_;
   prometheus::Family<prometheus::Counter> &gc_index_sweeps_family_;
+  prometheus::Family<prometheus::Gauge> &gc_backlog_transactions_family_;
+  prometheus::Family<prometheus::Histogram> &gc_unlink_latency_family_;
+  prometheus::Family<prometheus::Histogram> &gc_retire_latency_family_;
+
+  // Per-database metric families — WAL group commit histograms
+  prometheus::Family<prometheus::Histogram> &wal_group_commit_batch_size_family_;
+  prometheus::Family<prometheus::Histogram> &wal_group_commit_latency_family_;
 
   // Global metric family — per-instance snapshot throughput (bytes/s)
   prometheus::Family<prometheus::Histogram> &snapshot_throughput_family_;
@@ -22,6 +22,8 @@
 #include "plan_v2/frontend/egraph_converter.hpp"
 #include "query/frontend/ast/cypher_main_visitor.hpp"
 #include "query/frontend/opencypher/parser.hpp"
+#include "query/interpret/awesome_memgraph_functions.hpp"
+#include "query/plan/expression_compiler.hpp"
 #include "query/plan/planner.hpp"
 #include "query/plan/rewrite/pruning_bfs.hpp"
 #include "query/plan/rule_based_planner.hpp"
@@ -45,6 +47,10 @@ DEFINE_VALIDATED_int32(query_plan_cache_max_size, 1000, "Maximum number of query
 DEFINE_VALIDATED_int32(query_ast_cache_max_size, 1000,
                        "Maximum number of parsed query ASTs to cache (0 disables the cache).",
                        FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_result_cache_max_memory_mb, 0,
+              "Maximum memory in MiB taken by cached results of read-only queries, per database (0 disables the "
+              "cache).");
 
 namespace memgraph::query {
 namespace {
@@ -56,6 +62,19 @@ bool IsFresh(AstStorage const &ast_storage, uint64_t stamped_generation, uint64_
   return !ast_storage.DependsOnModules() || stamped_generation == current_generation;
 }
 
+/// A query reading files, calling procedures or impure functions can return different rows on the same data.
+bool IsDeterministic(AstStorage const &ast_storage) {
+  if (ast_storage.DependsOnModules()) return false;
+  return std::ranges::none_of(ast_storage.storage_, [](auto const &tree) {
+    if (utils::IsSubtype(*tree, LoadCsv::kType) || utils::IsSubtype(*tree, LoadParquet::kType) ||
+        utils::IsSubtype(*tree, LoadJsonl::kType)) {
+      return true;
+    }
+    auto const *function = utils::Downcast<Function>(tree.get());
+    return function && !IsFunctionPure(function->function_name_);
+  });
+}
+
 }  // namespace
 
 PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan, uint64_t module_generation)
@@ -65,6 +84,9 @@ PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan, uint64_t module_gene
   //          ATM to work with a const visitor. This maybe addressed when the planner is redone.
   const_cast<plan::LogicalOperator &>(plan_->GetRoot()).Accept(checker);
   required_indices_ = std::move(checker.required_indices_);
+  // The plan is final here and is only read from now on, also by every execution of it served from the cache
+  plan::CompileExpressions(const_cast<plan::LogicalOperator &>(plan_->GetRoot()), plan_->GetSymbolTable());
+  is_deterministic_ = IsDeterministic(plan_->GetAstStorage());
 }
 
 auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserParameters const &user_parameters,
@@ -35,6 +35,8 @@ DECLARE_bool(query_cost_planner);
 DECLARE_int32(query_plan_cache_max_size);
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(query_ast_cache_max_size);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_result_cache_max_memory_mb);
 
 namespace memgraph::query {
 
@@ -95,10 +97,15 @@ class PlanWrapper {
   /// readiness check every time this plan is served.
   auto required_indices() const -> storage::IndicesCollection const & { return required_indices_; }
 
+  /// Whether the plan returns the same rows every time it is run with the same parameters on the same data, so its
+  /// results may be cached. Like required_indices, it is derived once at construction.
+  bool is_deterministic() const { return is_deterministic_; }
+
  private:
   std::unique_ptr<LogicalPlan> plan_;
   uint64_t module_generation_;
   storage::IndicesCollection required_indices_;
+  bool is_deterministic_{false};
 };
 
 struct CachedQuery {
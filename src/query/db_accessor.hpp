@@ -141,6 +141,14 @@ class VerticesIterable final {
       return std::visit([](auto &it_) { return VertexAccessor(*it_); }, it_);
     }
 
+    /// The indexed values of the current vertex when it comes from a label-property index, in index order.
+    std::optional<storage::IndexOrderedValuesView> IndexValues() const {
+      if (auto const *it = std::get_if<storage::VerticesIterable::Iterator>(&it_)) {
+        return it->IndexValues();
+      }
+      return std::nullopt;
+    }
+
     Iterator &operator++() {
       std::visit([](auto &it_) { ++it_; }, it_);
       return *this;
@@ -157,6 +165,11 @@ class VerticesIterable final {
                                                utils::Allocator<VertexAccessor>> *vertices)
       : iterable_(vertices) {}
 
+  /// Makes `Iterator::IndexValues` hold the visible values of the current vertex. Call before `begin`.
+  void DecodeIndexValues() {
+    if (auto *iterable = std::get_if<storage::VerticesIterable>(&iterable_)) iterable->DecodeIndexValues();
+  }
+
   Iterator begin() {
     return std::visit(
         memgraph::utils::Overloaded{[](storage::VerticesIterable &iterable_) { return Iterator(iterable_.begin()); },
@@ -394,6 +407,16 @@ class DbAccessor final {
 
   void SetParallelExecution() { accessor_->GetTransaction()->SetParallelExecution(); }
 
+  /// Timestamp of the last commit the transaction sees, as long as it sees nothing committed after it started.
+  std::optional<uint64_t> SnapshotCommitTimestamp() const {
+    auto const *transaction = accessor_->GetTransaction();
+    if (transaction->storage_mode != storage::StorageMode::IN_MEMORY_TRANSACTIONAL ||
+        transaction->isolation_level != storage::IsolationLevel::SNAPSHOT_ISOLATION) {
+      return std::nullopt;
+    }
+    return transaction->last_durable_ts_;
+  }
+
   bool CheckIndicesAreReady(storage::IndicesCollection const &required_indices) const {
     return accessor_->CheckIndicesAreReady(required_indices);
   }
@@ -440,6 +463,10 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, view));
   }
 
+  VerticesIterable Vertices(storage::View view, std::span<storage::LabelId const> labels) {
+    return VerticesIterable(accessor_->Vertices(labels, view));
+  }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label,
                             std::span<storage::PropertyPath const> properties,
                             std::span<storage::PropertyValueRange const> property_ranges,
@@ -822,6 +849,10 @@ class DbAccessor final {
     return accessor_->ApproximateVerticesPointCount(label, property);
   }
 
+  std::optional<uint64_t> VerticesIntersectionCount(std::span<storage::LabelId const> labels) const {
+    return accessor_->ApproximateVerticesIntersectionCount(labels);
+  }
+
   std::optional<uint64_t> VerticesVectorCount(std::string_view index_name) const {
     return accessor_->ApproximateVerticesVectorCount(index_name);
   }
@@ -0,0 +1,287 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/compiled_expression.hpp"
+
+#include <string_view>
+
+#include "query/context.hpp"
+#include "query/exceptions.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/interpret/frame.hpp"
+#include "utils/typeinfo.hpp"
+#include "utils/variant_helpers.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+using Comparison = CompiledFilter::Comparison;
+
+std::optional<Comparison> ComparisonOf(Expression *expression) {
+  if (utils::IsSubtype(*expression, EqualOperator::kType)) return Comparison::EQUAL;
+  if (utils::IsSubtype(*expression, NotEqualOperator::kType)) return Comparison::NOT_EQUAL;
+  if (utils::IsSubtype(*expression, LessOperator::kType)) return Comparison::LESS;
+  if (utils::IsSubtype(*expression, GreaterOperator::kType)) return Comparison::GREATER;
+  if (utils::IsSubtype(*expression, LessEqualOperator::kType)) return Comparison::LESS_EQUAL;
+  if (utils::IsSubtype(*expression, GreaterEqualOperator::kType)) return Comparison::GREATER_EQUAL;
+  return std::nullopt;
+}
+
+std::string_view CypherOperator(Comparison comparison) {
+  switch (comparison) {
+    case Comparison::EQUAL:
+      return "=";
+    case Comparison::NOT_EQUAL:
+      return "<>";
+    case Comparison::LESS:
+      return "<";
+    case Comparison::GREATER:
+      return ">";
+    case Comparison::LESS_EQUAL:
+      return "<=";
+    case Comparison::GREATER_EQUAL:
+      return ">=";
+  }
+  return "";
+}
+
+/// `identifier.property`, looked up one property at a time.
+PropertyLookup *AsIdentifierProperty(Expression *expression) {
+  auto *lookup = utils::Downcast<PropertyLookup>(expression);
+  if (!lookup || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY ||
+      lookup->property_path_.size() > 1) {
+    return nullptr;
+  }
+  auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+  if (!identifier || identifier->symbol_pos_ < 0) return nullptr;
+  return lookup;
+}
+
+std::optional<std::variant<storage::ExternalPropertyValue, int32_t>> AsOperand(Expression *expression) {
+  if (auto *literal = utils::Downcast<PrimitiveLiteral>(expression)) return literal->value_;
+  if (auto *parameter = utils::Downcast<ParameterLookup>(expression)) return parameter->token_position_;
+  return std::nullopt;
+}
+
+bool CompileConjunction(Expression *expression, std::vector<CompiledFilter::Predicate> *predicates) {
+  if (auto *and_operator = utils::Downcast<AndOperator>(expression)) {
+    return CompileConjunction(and_operator->expression1_, predicates) &&
+           CompileConjunction(and_operator->expression2_, predicates);
+  }
+  auto comparison = ComparisonOf(expression);
+  if (!comparison) return false;
+  auto *binary = static_cast<BinaryOperator *>(expression);
+  auto *lookup = AsIdentifierProperty(binary->expression1_);
+  auto operand = AsOperand(binary->expression2_);
+  bool const property_first = lookup != nullptr;
+  if (!property_first) {
+    lookup = AsIdentifierProperty(binary->expression2_);
+    operand = AsOperand(binary->expression1_);
+  }
+  if (!lookup || !operand) return false;
+  predicates->push_back({.symbol_pos = static_cast<Identifier *>(lookup->expression_)->symbol_pos_,
+                         .property = lookup->property_,
+                         .comparison = *comparison,
+                         .property_first = property_first,
+                         .operand = std::move(*operand)});
+  return true;
+}
+
+// The results of comparing in the order of the expression, defined through `<` and `==` like TypedValue does
+bool CompareOrdered(Comparison comparison, bool less, bool equal) {
+  switch (comparison) {
+    case Comparison::EQUAL:
+      return equal;
+    case Comparison::NOT_EQUAL:
+      return !equal;
+    case Comparison::LESS:
+      return less;
+    case Comparison::GREATER:
+      return !(less || equal);
+    case Comparison::LESS_EQUAL:
+      return less || equal;
+    case Comparison::GREATER_EQUAL:
+      return !less;
+  }
+  return false;
+}
+
+TypedValue CompareValues(Comparison comparison, const TypedValue &lhs, const TypedValue &rhs) {
+  try {
+    switch (comparison) {
+      case Comparison::EQUAL:
+        return lhs == rhs;
+      case Comparison::NOT_EQUAL:
+        return lhs != rhs;
+      case Comparison::LESS:
+        return lhs < rhs;
+      case Comparison::GREATER:
+        return lhs > rhs;
+      case Comparison::LESS_EQUAL:
+        return lhs <= rhs;
+      case Comparison::GREATER_EQUAL:
+        return lhs >= rhs;
+    }
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException(
+        "Invalid types: {} and {} for '{}'.", lhs.type(), rhs.type(), CypherOperator(comparison));
+  }
+  return {};
+}
+
+/// Compares without converting the property to a TypedValue when both sides are numbers or both are strings, the only
+/// pairs of types for which it's cheaper. Nullopt stands for Null.
+std::optional<bool> ComparePredicate(const CompiledFilter::Predicate &predicate,
+                                     const storage::PropertyValue &property, const TypedValue &operand,
+                                     ExpressionEvaluator &evaluator) {
+  auto const is_number = [](const auto &value) { return value.IsInt() || value.IsDouble(); };
+  auto const to_double = [](const auto &value) {
+    return value.IsInt() ? static_cast<double>(value.ValueInt()) : value.ValueDouble();
+  };
+  if (property.IsNull() && (is_number(operand) || operand.IsString())) return std::nullopt;
+  if (is_number(property) && is_number(operand)) {
+    if (property.IsInt() && operand.IsInt()) {
+      auto const lhs = predicate.property_first ? property.ValueInt() : operand.ValueInt();
+      auto const rhs = predicate.property_first ? operand.ValueInt() : property.ValueInt();
+      return CompareOrdered(predicate.comparison, lhs < rhs, lhs == rhs);
+    }
+    auto const lhs = predicate.property_first ? to_double(property) : to_double(operand);
+    auto const rhs = predicate.property_first ? to_double(operand) : to_double(property);
+    return CompareOrdered(predicate.comparison, lhs < rhs, lhs == rhs);
+  }
+  if (property.IsString() && operand.IsString()) {
+    std::string_view const property_string = property.ValueString();
+    std::string_view const operand_string = operand.ValueString();
+    auto const lhs = predicate.property_first ? property_string : operand_string;
+    auto const rhs = predicate.property_first ? operand_string : property_string;
+    return CompareOrdered(predicate.comparison, lhs < rhs, lhs == rhs);
+  }
+
+  TypedValue const value(property, evaluator.GetNameIdMapper(), evaluator.GetMemoryResource());
+  auto result = predicate.property_first ? CompareValues(predicate.comparison, value, operand)
+                                         : CompareValues(predicate.comparison, operand, value);
+  if (result.IsNull()) return std::nullopt;
+  return result.ValueBool();
+}
+
+}  // namespace
+
+std::shared_ptr<const CompiledFilter> CompiledFilter::Compile(Expression *expression) {
+  if (!expression) return nullptr;
+  auto compiled = std::make_shared<CompiledFilter>();
+  if (!CompileConjunction(expression, &compiled->predicates_)) return nullptr;
+  return compiled;
+}
+
+void CompiledFilter::BindOperands(const EvaluationContext &ctx, utils::pmr::vector<TypedValue> *operands) const {
+  operands->clear();
+  operands->reserve(predicates_.size());
+  for (const auto &predicate : predicates_) {
+    std::visit(utils::Overloaded{[&](const storage::ExternalPropertyValue &literal) {
+                                   operands->emplace_back(literal);
+                                 },
+                                 [&](int32_t token_position) {
+                                   operands->emplace_back(ctx.parameters.AtTokenPosition(token_position));
+                                 }},
+               predicate.operand);
+  }
+}
+
+std::optional<bool> CompiledFilter::Evaluate(const Frame &frame, ExpressionEvaluator &evaluator,
+                                             const utils::pmr::vector<TypedValue> &operands) const {
+  DMG_ASSERT(operands.size() == predicates_.size(), "Operands of the compiled filter weren't bound");
+  // Like AND, a false predicate ends the evaluation while a null one doesn't
+  bool is_null = false;
+  for (size_t i = 0; i < predicates_.size(); ++i) {
+    const auto &predicate = predicates_[i];
+    const auto &object = frame.elems()[predicate.symbol_pos];
+    std::optional<bool> result;
+    switch (object.type()) {
+      case TypedValue::Type::Vertex: {
+        auto const property = evaluator.GetProperty(object.ValueVertex(), predicate.property);
+        result = ComparePredicate(predicate, property, operands[i], evaluator);
+        break;
+      }
+      case TypedValue::Type::Edge: {
+        auto const property = evaluator.GetProperty(object.ValueEdge(), predicate.property);
+        result = ComparePredicate(predicate, property, operands[i], evaluator);
+        break;
+      }
+      case TypedValue::Type::Null:
+        result = ComparePredicate(predicate, storage::PropertyValue{}, operands[i], evaluator);
+        break;
+      default:
+        return std::nullopt;
+    }
+    if (!result) {
+      is_null = true;
+    } else if (!*result) {
+      return false;
+    }
+  }
+  return !is_null;
+}
+
+std::shared_ptr<const CompiledProjection> CompiledProjection::Compile(
+    const std::vector<NamedExpression *> &named_expressions, const SymbolTable &symbol_table) {
+  auto compiled = std::make_shared<CompiledProjection>();
+  compiled->items_.reserve(named_expressions.size());
+  for (auto *named_expression : named_expressions) {
+    auto const &output = symbol_table.at(*named_expression);
+    if (auto *identifier = utils::Downcast<Identifier>(named_expression->expression_);
+        identifier && identifier->symbol_pos_ >= 0) {
+      compiled->items_.push_back({.output = output, .symbol_pos = identifier->symbol_pos_, .property = std::nullopt});
+    } else if (auto *lookup = AsIdentifierProperty(named_expression->expression_)) {
+      compiled->items_.push_back({.output = output,
+                                  .symbol_pos = static_cast<Identifier *>(lookup->expression_)->symbol_pos_,
+                                  .property = lookup->property_});
+    } else {
+      return nullptr;
+    }
+  }
+  return compiled;
+}
+
+bool CompiledProjection::Project(Frame &frame, ExpressionEvaluator &evaluator,
+                                 FrameChangeCollector *frame_change_collector) const {
+  auto *memory = evaluator.GetMemoryResource();
+  auto frame_writer = frame.GetFrameWriter(frame_change_collector, memory);
+  for (const auto &item : items_) {
+    const auto &object = frame.elems()[item.symbol_pos];
+    if (!item.property) {
+      frame_writer.WriteAt(item.output, TypedValue(object, memory));
+      continue;
+    }
+    switch (object.type()) {
+      case TypedValue::Type::Vertex:
+        frame_writer.WriteAt(item.output,
+                             TypedValue(evaluator.GetProperty(object.ValueVertex(), *item.property),
+                                        evaluator.GetNameIdMapper(),
+                                        memory));
+        break;
+      case TypedValue::Type::Edge:
+        frame_writer.WriteAt(item.output,
+                             TypedValue(evaluator.GetProperty(object.ValueEdge(), *item.property),
+                                        evaluator.GetNameIdMapper(),
+                                        memory));
+        break;
+      case TypedValue::Type::Null:
+        frame_writer.WriteAt(item.output, TypedValue(memory));
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace memgraph::query
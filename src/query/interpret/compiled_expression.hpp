@@ -0,0 +1,95 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// Compiled forms of the expressions Filter and Produce evaluate for every row. The most common shapes, a conjunction
+/// of comparisons between properties and constants (`n.age > $age AND n.name = 'x'`) and projections of identifiers and
+/// their properties (`RETURN n, n.name`), are flattened once per plan into a list of steps. Evaluating the steps skips
+/// the visitor walk over the AST, and the temporary TypedValues it creates for literals, property values and results.
+/// Everything else is left to the ExpressionEvaluator.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query {
+
+class ExpressionEvaluator;
+class Frame;
+class FrameChangeCollector;
+struct EvaluationContext;
+
+class CompiledFilter {
+ public:
+  enum class Comparison : uint8_t { EQUAL, NOT_EQUAL, LESS, GREATER, LESS_EQUAL, GREATER_EQUAL };
+
+  /// `<symbol>.<property> <comparison> <operand>`, or the other way around when `property_first` is false.
+  struct Predicate {
+    int32_t symbol_pos;
+    PropertyIx property;
+    Comparison comparison;
+    bool property_first;
+    /// A literal, or the token position of a parameter.
+    std::variant<storage::ExternalPropertyValue, int32_t> operand;
+  };
+
+  /// Returns nullptr when `expression` isn't a conjunction of predicates.
+  static std::shared_ptr<const CompiledFilter> Compile(Expression *expression);
+
+  /// Values of the predicate operands in one execution, in the order of `predicates()`.
+  void BindOperands(const EvaluationContext &ctx, utils::pmr::vector<TypedValue> *operands) const;
+
+  /// Whether the row on the frame passes the filter, evaluated in the same order and with the same results and errors
+  /// as the expression it was compiled from. Returns nullopt once a predicate looks up a property of something other
+  /// than a node, an edge or null, leaving the row to the ExpressionEvaluator.
+  std::optional<bool> Evaluate(const Frame &frame, ExpressionEvaluator &evaluator,
+                               const utils::pmr::vector<TypedValue> &operands) const;
+
+  const std::vector<Predicate> &predicates() const { return predicates_; }
+
+ private:
+  std::vector<Predicate> predicates_;
+};
+
+class CompiledProjection {
+ public:
+  /// Writes the value of the symbol at `symbol_pos`, or its `property` when set, to `output`.
+  struct Item {
+    Symbol output;
+    int32_t symbol_pos;
+    std::optional<PropertyIx> property;
+  };
+
+  /// Returns nullptr unless every named expression is an identifier or a property of one.
+  static std::shared_ptr<const CompiledProjection> Compile(const std::vector<NamedExpression *> &named_expressions,
+                                                           const SymbolTable &symbol_table);
+
+  /// Writes the projected values of the row to the frame. Returns false once an item looks up a property of something
+  /// other than a node, an edge or null; the items written before it are written again by the ExpressionEvaluator.
+  bool Project(Frame &frame, ExpressionEvaluator &evaluator, FrameChangeCollector *frame_change_collector) const;
+
+  const std::vector<Item> &items() const { return items_; }
+
+ private:
+  std::vector<Item> items_;
+};
+
+}  // namespace memgraph::query
@@ -78,6 +78,7 @@ class Frame {
 
  private:
   friend struct FrameWriter;
+  friend class FrameBatch;
   utils::pmr::vector<TypedValue> elems_;
 };
 
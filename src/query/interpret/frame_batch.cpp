@@ -0,0 +1,58 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/frame_batch.hpp"
+
+#include <utility>
+
+#include "query/frame_change.hpp"
+#include "query/interpret/frame.hpp"
+
+namespace memgraph::query {
+
+size_t FrameBatch::Column(const Symbol &symbol) {
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    if (columns_[i].symbol.position() == symbol.position()) return i;
+  }
+  columns_.push_back({.symbol = symbol, .values = utils::pmr::vector<TypedValue>(size_, memory_)});
+  return columns_.size() - 1;
+}
+
+size_t FrameBatch::AppendRow() {
+  for (auto &column : columns_) column.values.emplace_back();
+  return size_++;
+}
+
+size_t FrameBatch::AppendRowFrom(const FrameBatch &other, size_t row) {
+  auto const new_row = AppendRow();
+  for (auto const &column : other.columns_) {
+    columns_[Column(column.symbol)].values[new_row] = column.values[row];
+  }
+  return new_row;
+}
+
+FrameBatch::RowScope::RowScope(FrameBatch &batch, size_t row, Frame &frame,
+                               FrameChangeCollector *frame_change_collector)
+    : batch_(batch), row_(row), frame_(frame), frame_change_collector_(frame_change_collector) {
+  Swap();
+}
+
+FrameBatch::RowScope::~RowScope() { Swap(); }
+
+void FrameBatch::RowScope::Swap() {
+  for (auto &column : batch_.columns_) {
+    std::swap(frame_.elems_[column.symbol.position()], column.values[row_]);
+    // The value changed without going through a FrameWriter
+    if (frame_change_collector_) frame_change_collector_->ResetCache(column.symbol);
+  }
+}
+
+}  // namespace memgraph::query
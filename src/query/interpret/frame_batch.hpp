@@ -0,0 +1,111 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "query/frontend/semantic/symbol.hpp"
+#include "query/typed_value.hpp"
+#include "utils/memory.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query {
+
+class Frame;
+class FrameChangeCollector;
+
+/// A block of rows pulled at once through `plan::Cursor::PullBatch`.
+///
+/// The batch is column oriented: it only holds the symbols written by the operators that produced it, one value per
+/// row. Every other symbol has the same value in all rows of the batch and stays on the frame the batch was pulled
+/// with, so a row is evaluated by swapping its values into that frame (see `RowScope`).
+class FrameBatch {
+ public:
+  static constexpr size_t kCapacity = 1024;
+
+  explicit FrameBatch(utils::MemoryResource *memory) : memory_(memory) {}
+
+  size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  bool full() const { return size_ >= kCapacity; }
+
+  utils::MemoryResource *memory() const { return memory_; }
+
+  /// Drops all rows and columns.
+  void clear() {
+    columns_.clear();
+    size_ = 0;
+  }
+
+  /// Index of the column holding `symbol`. A new column is Null in all existing rows.
+  size_t Column(const Symbol &symbol);
+
+  /// Appends a row that is Null in every column and returns its index.
+  size_t AppendRow();
+
+  /// Appends a copy of `row` of `other`, adding the columns of `other` that are missing, and returns its index.
+  size_t AppendRowFrom(const FrameBatch &other, size_t row);
+
+  TypedValue &At(size_t column, size_t row) { return columns_[column].values[row]; }
+
+  /// Keeps the rows `keep(row)` returns true for, in their order.
+  template <typename TFunc>
+  void Retain(TFunc &&keep) {
+    size_t kept = 0;
+    for (size_t row = 0; row < size_; ++row) {
+      if (!keep(row)) continue;
+      if (kept != row) {
+        for (auto &column : columns_) column.values[kept] = std::move(column.values[row]);
+      }
+      ++kept;
+    }
+    for (auto &column : columns_) column.values.erase(column.values.begin() + kept, column.values.end());
+    size_ = kept;
+  }
+
+  /// Swaps the values of a row into the frame for the duration of the scope, and back out of it when it ends. Values
+  /// the row's columns get on the frame in the meantime end up in the batch.
+  class RowScope {
+   public:
+    RowScope(FrameBatch &batch, size_t row, Frame &frame, FrameChangeCollector *frame_change_collector);
+    ~RowScope();
+
+    RowScope(const RowScope &) = delete;
+    RowScope(RowScope &&) = delete;
+    RowScope &operator=(const RowScope &) = delete;
+    RowScope &operator=(RowScope &&) = delete;
+
+   private:
+    void Swap();
+
+    FrameBatch &batch_;
+    size_t row_;
+    Frame &frame_;
+    FrameChangeCollector *frame_change_collector_;
+  };
+
+ private:
+  struct ColumnValues {
+    Symbol symbol;
+    utils::pmr::vector<TypedValue> values;
+  };
+
+  utils::MemoryResource *memory_;
+  std::vector<ColumnValues> columns_;
+  size_t size_{0};
+};
+
+}  // namespace memgraph::query
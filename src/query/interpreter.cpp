@@ -90,6 +90,7 @@
 #include "query/plan/fmt.hpp"
 #include "query/plan/hint_provider.hpp"
 #include "query/plan/parallel_checker.hpp"
+#include "query/plan/read_labels_collector.hpp"
 #include "query/plan/planner.hpp"
 #include "query/plan/profile.hpp"
 #include "query/plan/vertex_count_cache.hpp"
@@ -97,6 +98,7 @@
 #include "query/procedure/module.hpp"
 #include "query/query_user.hpp"
 #include "query/replication_query_handler.hpp"
+#include "query/result_cache.hpp"
 #include "query/stream.hpp"
 #include "query/stream/common.hpp"
 #include "query/stream/sources.hpp"
@@ -3782,6 +3784,10 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
     return std::nullopt;
   }
 
+  // Operators stopped early (i.e. under a Limit) merge the work of their parallel branches into the context here, so
+  // it has to happen before the summary is read from it
+  cursor_->Shutdown();
+
   summary->insert_or_assign("plan_execution_time", execution_time_.count());
   summary->insert_or_assign("number_of_hops", ctx_.number_of_hops);
 
@@ -3802,7 +3808,6 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
     }
     summary->insert_or_assign("stats", std::move(stats));
   }
-  cursor_->Shutdown();
   // NOTE: += because each thread adds its own execution time to the total execution time
   ctx_.profile_execution_time += execution_time_;
 
@@ -4008,6 +4013,34 @@ void CheckParallelExecution(std::optional<size_t> &parallel_execution, plan::Log
 }
 #endif
 
+namespace {
+
+/// The key of the query's results in the result cache, nullopt when they can't be cached. Only a read-only implicit
+/// transaction which sees a fixed committed snapshot and reads with the same rights as any other user with the same
+/// roles returns the same rows on the next run at the same commit.
+std::optional<ResultCacheKey> ResultCacheKeyFor(ParsedQuery const &parsed_query, PlanWrapper const &plan,
+                                                DbAccessor const &dba, Interpreter const &interpreter,
+                                                QueryUserOrRole const *user_or_role) {
+  if (plan.rw_type() != RWType::R || !plan.is_deterministic() || interpreter.in_explicit_transaction_ ||
+      interpreter.GetCachedFga() || !dba.SnapshotCommitTimestamp()) {
+    return std::nullopt;
+  }
+  return ResultCacheKey{parsed_query.stripped_query.stripped_query(), parsed_query.parameters, user_or_role};
+}
+
+/// Passes the rows on to the client while they are recorded for the result cache.
+struct RecordingStream {
+  void Result(const std::vector<TypedValue> &values) {
+    stream->Result(values);
+    recorder->Result(values);
+  }
+
+  AnyStream *stream;
+  ResultRecorder *recorder;
+};
+
+}  // namespace
+
 PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary,
                                  InterpreterContext *interpreter_context, CurrentDB &current_db,
                                  utils::MemoryResource *execution_memory, std::vector<Notification> *notifications,
@@ -4118,6 +4151,40 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
     header.push_back(
         utils::FindOr(parsed_query.stripped_query.named_expressions(), symbol.token_position(), symbol.name()).first);
   }
+
+  auto *result_cache = current_db.db_acc_->get()->result_cache();
+  auto const result_cache_max_memory = result_cache->Lock()->max_memory();
+  std::optional<ResultRecorder> result_recorder;
+  if (result_cache_max_memory > 0) {
+    if (auto key = ResultCacheKeyFor(parsed_query, *plan, *dba, interpreter, user_or_role.get())) {
+      auto const commit_timestamp = *dba->SnapshotCommitTimestamp();
+      auto const &label_changes = current_db.db_acc_->get()->storage()->label_change_log_;
+      if (auto cached = result_cache->WithLock(
+              [&](ResultCache &cache) { return cache.Get(*key, commit_timestamp, label_changes); })) {
+        return PreparedQuery{
+            .header = std::move(header),
+            .privileges = std::move(parsed_query.required_privileges),
+            .query_handler = [cached = std::move(cached), next_row = size_t{0}, summary](
+                                 AnyStream *stream, std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
+              utils::Timer timer;
+              for (int i = 0; next_row < cached->rows.size() && (!n || i < *n); ++i, ++next_row) {
+                stream->Result(cached->rows[next_row]);
+              }
+              if (next_row < cached->rows.size()) return std::nullopt;
+              summary->insert_or_assign("plan_execution_time", timer.Elapsed().count());
+              summary->insert_or_assign("number_of_hops", int64_t{0});
+              return QueryHandlerResult::COMMIT;
+            },
+            .rw_type = rw_type,
+            .db = current_db.db_acc_->get()->name(),
+            .priority = utils::Priority::LOW};
+      }
+      auto read_labels = plan::ReadLabelsCollector{dba}.Collect(plan->plan());
+      result_recorder.emplace(
+          result_cache, std::move(*key), commit_timestamp, std::move(read_labels), result_cache_max_memory);
+    }
+  }
+
   // TODO: pass current DB into plan, in future current can change during pull
   auto *trigger_context_collector =
       current_db.trigger_context_collector_ ? &*current_db.trigger_context_collector_ : nullptr;
@@ -4148,9 +4215,21 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   return PreparedQuery{
       .header = std::move(header),
       .privileges = std::move(parsed_query.required_privileges),
-      .query_handler = [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
-                           AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
-        if (pull_plan->Pull(stream, n, output_symbols, summary)) {
+      .query_handler = [pull_plan = std::move(pull_plan),
+                        output_symbols = std::move(output_symbols),
+                        summary,
+                        result_recorder = std::move(result_recorder)](
+                           AnyStream *stream, std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
+        if (!result_recorder) {
+          if (pull_plan->Pull(stream, n, output_symbols, summary)) {
+            return QueryHandlerResult::COMMIT;
+          }
+          return std::nullopt;
+        }
+        auto recording_stream = RecordingStream{.stream = stream, .recorder = &*result_recorder};
+        AnyStream recorded{&recording_stream, utils::NewDeleteResource()};
+        if (pull_plan->Pull(&recorded, n, output_symbols, summary)) {
+          result_recorder->Store();
           return QueryHandlerResult::COMMIT;
         }
         return std::nullopt;
@@ -4425,6 +4504,73 @@ PreparedQuery PrepareDumpQuery(ParsedQuery parsed_query, CurrentDB &current_db,
       .rw_type = RWType::R};
 }
 
+constexpr size_t kMostCommonValuesLimit = 16;
+// How much more frequent than the average value a value has to be to be one of the most common
+constexpr double kMostCommonValueFactor = 1.25;
+constexpr size_t kHistogramBuckets = 32;
+
+/// Fills in how the values of the first indexed property are distributed, from how many vertices hold each
+/// combination of the indexed values.
+void SetValueDistribution(storage::LabelPropertyIndexStats &stats,
+                          std::map<std::vector<storage::PropertyValue>, int64_t> const &values_map) {
+  // Combinations are ordered, so the ones sharing their first value are next to each other
+  std::vector<std::pair<storage::PropertyValue const *, uint64_t>> value_counts;
+  for (auto const &[values, count] : values_map) {
+    auto const &value = values.front();
+    if (value.IsNull()) continue;
+    if (value_counts.empty() || *value_counts.back().first != value) {
+      value_counts.emplace_back(&value, 0);
+    }
+    value_counts.back().second += count;
+  }
+  if (value_counts.empty()) return;
+
+  uint64_t total = 0;
+  for (auto const &[_, count] : value_counts) total += count;
+  auto const avg_group_size = static_cast<double>(total) / static_cast<double>(value_counts.size());
+
+  auto by_count = value_counts;
+  auto const mcv_end =
+      by_count.begin() + static_cast<std::ptrdiff_t>(std::min(kMostCommonValuesLimit, by_count.size()));
+  std::ranges::partial_sort(by_count, mcv_end, std::greater{}, [](auto const &entry) { return entry.second; });
+  uint64_t mcv_total = 0;
+  for (auto it = by_count.begin(); it != mcv_end; ++it) {
+    if (it->second < 2 || static_cast<double>(it->second) <= avg_group_size * kMostCommonValueFactor) break;
+    stats.most_common_values.emplace_back(std::hash<storage::PropertyValue>{}(*it->first), it->second);
+    mcv_total += it->second;
+  }
+  stats.other_values_count = total - mcv_total;
+  stats.other_distinct_values_count = value_counts.size() - stats.most_common_values.size();
+
+  // The most common values are only known by their hash, so the histogram has to cover them as well
+  std::vector<std::pair<double, uint64_t>> numeric_counts;
+  for (auto const &[value, count] : value_counts) {
+    if (value->IsInt()) {
+      numeric_counts.emplace_back(static_cast<double>(value->ValueInt()), count);
+    } else if (value->IsDouble() && std::isfinite(value->ValueDouble())) {
+      numeric_counts.emplace_back(value->ValueDouble(), count);
+    }
+  }
+  if (numeric_counts.size() < 2) return;
+  std::ranges::sort(numeric_counts);
+
+  uint64_t histogram_count = 0;
+  for (auto const &[_, count] : numeric_counts) histogram_count += count;
+  stats.histogram_bounds.reserve(kHistogramBuckets + 1);
+  auto it = numeric_counts.begin();
+  // How many values there are up to and including the one `it` points to
+  uint64_t seen = it->second;
+  for (size_t bucket = 0; bucket <= kHistogramBuckets; ++bucket) {
+    auto const rank = bucket * (histogram_count - 1) / kHistogramBuckets;
+    while (seen <= rank) {
+      ++it;
+      seen += it->second;
+    }
+    stats.histogram_bounds.push_back(it->first);
+  }
+  stats.histogram_count = histogram_count;
+}
+
 }  // namespace
 
 std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreateStatistics(
@@ -4600,6 +4746,7 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
                                                .statistic = chi_squared_stat,
                                                .avg_group_size = avg_group_size,
                                                .avg_degree = average_degree};
+          SetValueDistribution(index_stats, values_map);
           execution_db_accessor->SetIndexStats(label_property.label, label_property.properties, index_stats);
           label_property_stats.push_back(std::make_pair(label_property, index_stats));
         });
@@ -6655,9 +6802,11 @@ PreparedQuery PrepareStorageModeQuery(ParsedQuery parsed_query, const bool in_ex
   return PreparedQuery{
       .header = {},
       .privileges = std::move(parsed_query.required_privileges),
-      .query_handler = [callback = std::move(callback)](AnyStream * /*stream*/,
-                                                        std::optional<int> /*n*/) -> std::optional<QueryHandlerResult> {
+      .query_handler = [callback = std::move(callback), result_cache = db_acc->result_cache()](
+                           AnyStream * /*stream*/, std::optional<int> /*n*/) -> std::optional<QueryHandlerResult> {
         callback();
+        // Neither analytical writes nor a switch of the storage move the commit timestamp the results are cached by
+        result_cache->WithLock([](ResultCache &cache) { cache.Reset(); });
         return QueryHandlerResult::COMMIT;
       },
       .rw_type = RWType::NONE};
@@ -6818,8 +6967,10 @@ PreparedQuery PrepareRecoverSnapshotQuery(ParsedQuery parsed_query, bool in_expl
                         s3_cfg = std::move(s3_config)](AnyStream * /*stream*/, std::optional<int> /*n*/) mutable
           -> std::optional<QueryHandlerResult> {
         auto *mem_storage = static_cast<storage::InMemoryStorage *>(db_acc->storage());
-        if (auto maybe_error = mem_storage->RecoverSnapshot(path, force, replication_role, std::move(s3_cfg));
-            !maybe_error.has_value()) {
+        auto maybe_error = mem_storage->RecoverSnapshot(path, force, replication_role, std::move(s3_cfg));
+        // The commit timestamp of the recovered data may have been seen with other data, also when recovery failed late
+        db_acc->result_cache()->WithLock([](ResultCache &cache) { cache.Reset(); });
+        if (!maybe_error.has_value()) {
           switch (maybe_error.error()) {
             using enum storage::InMemoryStorage::RecoverSnapshotError;
             case DisabledForReplica: {
@@ -19,6 +19,7 @@ namespace CostParam {
 inline constexpr double kMinimumCost{0.001};  // everything has some runtime cost
 inline constexpr double kScanAll{1.0};
 inline constexpr double kScanAllByLabel{1.1};
+inline constexpr double kScanAllByLabelIntersection{1.2};  // seeks between the indices on top of the label scan
 inline constexpr double kScanAllByLabelProperties{1.1};
 inline constexpr double kScanAllByPointDistance{1.1};
 inline constexpr double kScanAllByPointWithinbbox{1.1};
@@ -32,6 +33,7 @@ inline constexpr double kScanAllByEdgeProperty{1.1};
 inline constexpr double kScanAllByVertexProperty{1.1};
 inline constexpr double kExpand{2.0};
 inline constexpr double kExpandVariable{3.0};
+inline constexpr double kExpandIntersect{2.2};
 inline constexpr double kFilter{1.5};
 inline constexpr double kEdgeUniquenessFilter{1.5};
 inline constexpr double kUnwind{1.3};
@@ -47,6 +49,7 @@ inline constexpr double kOrderByMinCardinality{
 namespace CardParam {
 inline constexpr double kExpand{3.0};
 inline constexpr double kExpandVariable{9.0};
+inline constexpr double kExpandIntersect{0.3};  // share of the neighbours that close the cycle
 inline constexpr double kFilter{0.25};
 inline constexpr double kEdgeUniquenessFilter{0.95};
 }  // namespace CardParam
@@ -55,6 +58,9 @@ inline constexpr double kEdgeUniquenessFilter{0.95};
 namespace MiscParam {
 inline constexpr double kUnwindNoLiteral{10.0};
 inline constexpr double kForeachNoLiteral{10.0};
+// Largest share of the smallest label index the estimated label intersection can be and still be preferred over
+// scanning that index and filtering on the other labels
+inline constexpr double kLabelIntersectionMaxShare{0.5};
 }  // namespace MiscParam
 
 }  // namespace memgraph::query::plan
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 
 #include "query/parameters.hpp"
 #include "query/plan/cost_constants.hpp"
@@ -130,6 +131,17 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PostVisit(ScanAllByLabelIntersection &logical_op) override {
+    // Only planned when the storage can estimate it
+    cardinality_ *= db_accessor_->VerticesIntersectionCount(logical_op.labels_).value_or(0);
+    if (std::ranges::any_of(logical_op.labels_,
+                            [&](auto const &label) { return index_hints_.HasLabelIndex(db_accessor_, label); })) {
+      use_index_hints_ = true;
+    }
+    IncrementCost(CostParam::kScanAllByLabelIntersection);
+    return true;
+  }
+
   bool PostVisit(ScanAllByLabelProperties &logical_op) override {
     auto index_stats = db_accessor_->GetIndexStats(logical_op.label_, logical_op.properties_);
     if (index_stats) {
@@ -274,6 +286,13 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ProduceParallel &op) override {
+    // Start of parallel execution
+    // Set parallel execution mode for cost calculation
+    num_threads_ = op.num_threads_;
+    return true;
+  }
+
   bool PostVisit(ScanChunk &op) override {
     // ScanChunk has the output symbol, so we need to save the stats here
     if (last_index_stats_) {
@@ -403,6 +422,21 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PostVisit(ExpandIntersect &op) override {
+    // One walk over the edges of the input node, where each neighbour is only looked up among the neighbours of the
+    // closing node instead of being expanded as well
+    auto degree = CardParam::kExpand;
+    if (auto stats = GetStatsFor(op.input_symbol_)) {
+      degree = stats->degree;
+    }
+
+    cardinality_ *= degree;
+    IncrementCost(CostParam::kExpandIntersect);
+    cardinality_ *= CardParam::kExpandIntersect;
+
+    return true;
+  }
+
 // For the given op first increments the cardinality and then cost.
 #define POST_VISIT_CARD_FIRST(NAME)     \
   bool PostVisit(NAME &) override {     \
@@ -800,6 +834,56 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return EstimateInListSum(db_accessor_, label, properties, list, slot, pvrs, parameters);
   }
 
+  // Estimates how many vertices of the index hold a first property value within `range` from the most common values
+  // and the histogram gathered by ANALYZE GRAPH. Returns nullopt if there are no such statistics for the range.
+  std::optional<double> EstimateFirstPropertyCardinality(storage::LabelId label,
+                                                         std::vector<storage::PropertyPath> const &properties,
+                                                         storage::PropertyValueRange const &range) {
+    if (range.type_ == storage::PropertyRangeType::INVALID) return 0.0;
+    if (range.type_ != storage::PropertyRangeType::BOUNDED) return std::nullopt;
+    auto const stats = db_accessor_->GetIndexStats(label, properties);
+    if (!stats) return std::nullopt;
+
+    auto const &lower = range.lower_;
+    auto const &upper = range.upper_;
+    if (lower && upper && lower->IsInclusive() && upper->IsInclusive() && lower->value() == upper->value()) {
+      // Statistics from before the value distribution was gathered have neither
+      if (stats->most_common_values.empty() && stats->other_distinct_values_count == 0) return std::nullopt;
+      auto const hash = std::hash<storage::PropertyValue>{}(lower->value());
+      if (auto it = ranges::find(stats->most_common_values, hash, [](auto const &mcv) { return mcv.first; });
+          it != stats->most_common_values.end()) {
+        return static_cast<double>(it->second);
+      }
+      if (stats->other_distinct_values_count == 0) return 0.0;
+      return static_cast<double>(stats->other_values_count) / static_cast<double>(stats->other_distinct_values_count);
+    }
+
+    auto const &bounds = stats->histogram_bounds;
+    if (bounds.empty()) return std::nullopt;
+    auto const to_number = [](std::optional<utils::Bound<storage::PropertyValue>> const &bound,
+                              double unbounded) -> std::optional<double> {
+      if (!bound) return unbounded;
+      if (bound->value().IsInt()) return static_cast<double>(bound->value().ValueInt());
+      if (bound->value().IsDouble()) return bound->value().ValueDouble();
+      return std::nullopt;
+    };
+    auto const from = to_number(lower, -std::numeric_limits<double>::infinity());
+    auto const to = to_number(upper, std::numeric_limits<double>::infinity());
+    if (!from || !to || (!lower && !upper)) return std::nullopt;
+    if (*from >= *to) return 0.0;
+
+    // Share of the histogram's values below `x`, assuming they are spread evenly within a bucket
+    auto const fraction_below = [&](double x) {
+      if (x <= bounds.front()) return 0.0;
+      if (x >= bounds.back()) return 1.0;
+      auto const next = ranges::upper_bound(bounds, x);
+      auto const prev = std::prev(next);
+      auto const bucket = static_cast<double>(std::distance(bounds.begin(), prev));
+      return (bucket + (x - *prev) / (*next - *prev)) / static_cast<double>(bounds.size() - 1);
+    };
+    return static_cast<double>(stats->histogram_count) * (fraction_below(*to) - fraction_below(*from));
+  }
+
   // Helper function to estimate cardinality for label properties queries.
   // Used by both single-threaded and parallel scan operators.
   double EstimateLabelPropertiesCardinality(storage::LabelId label,
@@ -824,6 +908,12 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     }
 
     if (in_slots.empty()) {
+      // Only the later properties are unknown, so the first one can still narrow the estimate down
+      if (maybe_ranges.front()) {
+        if (auto first = EstimateFirstPropertyCardinality(label, properties, *maybe_ranges.front())) {
+          return *first * CardParam::kFilter;
+        }
+      }
       return db_accessor_->VerticesCount(label, properties) * CardParam::kFilter;
     }
 
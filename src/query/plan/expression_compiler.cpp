@@ -0,0 +1,33 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/expression_compiler.hpp"
+
+#include "query/interpret/compiled_expression.hpp"
+
+namespace memgraph::query::plan {
+
+bool ExpressionCompiler::PreVisit(Filter &op) {
+  op.compiled_expression_ = CompiledFilter::Compile(op.expression_);
+  return true;
+}
+
+bool ExpressionCompiler::PreVisit(Produce &op) {
+  op.compiled_projection_ = CompiledProjection::Compile(op.named_expressions_, symbol_table_);
+  return true;
+}
+
+void CompileExpressions(LogicalOperator &root, const SymbolTable &symbol_table) {
+  auto compiler = ExpressionCompiler{symbol_table};
+  root.Accept(compiler);
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,46 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/plan/operator.hpp"
+
+namespace memgraph::query::plan {
+
+/// Compiles the expressions of Filter and Produce operators which have a compiled form (see
+/// query/interpret/compiled_expression.hpp). Runs on a final plan, as rewriting or cloning an operator drops it.
+struct ExpressionCompiler : public virtual HierarchicalLogicalOperatorVisitor {
+  explicit ExpressionCompiler(const SymbolTable &symbol_table) : symbol_table_(symbol_table) {}
+
+  ExpressionCompiler(const ExpressionCompiler &) = delete;
+  ExpressionCompiler(ExpressionCompiler &&) = delete;
+
+  ExpressionCompiler &operator=(const ExpressionCompiler &) = delete;
+  ExpressionCompiler &operator=(ExpressionCompiler &&) = delete;
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool PreVisit(Filter &) override;
+  bool PreVisit(Produce &) override;
+
+  bool Visit(Once &) override { return true; }
+
+ private:
+  const SymbolTable &symbol_table_;
+};
+
+/// Compiles the expressions of the plan rooted at `root`.
+void CompileExpressions(LogicalOperator &root, const SymbolTable &symbol_table);
+
+}  // namespace memgraph::query::plan
@@ -61,6 +61,10 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
 
   bool PostVisit(ExpandVariable & /*unused*/) override { return true; }
 
+  bool PreVisit(ExpandIntersect & /*unused*/) override { return true; }
+
+  bool PostVisit(ExpandIntersect & /*unused*/) override { return true; }
+
   bool PreVisit(Merge &op) override {
     op.input()->Accept(*this);
     op.merge_match_->Accept(*this);
@@ -105,6 +109,10 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
 
   bool PostVisit(ScanAllByLabel & /*unused*/) override { return true; }
 
+  bool PreVisit(ScanAllByLabelIntersection & /*unused*/) override { return true; }
+
+  bool PostVisit(ScanAllByLabelIntersection & /*unused*/) override { return true; }
+
   bool PreVisit(ScanAllByLabelProperties & /*unused*/) override { return true; }
 
   bool PostVisit(ScanAllByLabelProperties & /*unused*/) override { return true; }
@@ -289,6 +297,10 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
 
   bool PostVisit(OrderByParallel & /*unused*/) override { return true; }
 
+  bool PreVisit(ProduceParallel & /*unused*/) override { return true; }
+
+  bool PostVisit(ProduceParallel & /*unused*/) override { return true; }
+
   bool PreVisit(Unwind & /*unused*/) override { return true; }
 
   bool PostVisit(Unwind & /*unused*/) override { return true; }
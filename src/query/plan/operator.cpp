@@ -14,16 +14,22 @@
 #include "metrics/prometheus_metrics.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <charconv>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <execution>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <ranges>
+#include <span>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -48,11 +54,13 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/graph.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/parallel_state.hpp"
 #include "query/parse_config_map.hpp"
 #include "query/path.hpp"
 #include "query/plan/scoped_profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
 #include "query/trigger_context.hpp"
@@ -478,6 +486,156 @@ class SharedDistinctState {
   std::array<SeenRowsSet, kNumShards> shards_;
 };
 
+/// Runs `task(i)` for each `i` below `num_tasks` on the query worker pool, with the calling thread stealing tasks while
+/// it waits for them. The first exception thrown by a task is rethrown once all of them are done.
+template <typename TTask>
+void RunOnWorkerPool(ExecutionContext &context, size_t num_tasks, const TTask &task) {
+  std::vector<std::exception_ptr> exceptions(num_tasks, nullptr);
+  utils::TaskCollection tasks(num_tasks);
+  for (size_t i = 0UZ; i < num_tasks; ++i) {
+    tasks.AddTask([&,
+                   i,
+                   main_thread = std::this_thread::get_id(),
+                   mem_tracking = memgraph::memory::CrossThreadMemoryTracking(context.db_arena_pool)](
+                      utils::Priority /*unused*/) mutable {
+      const OOMExceptionEnabler oom_exception;
+      if (main_thread != std::this_thread::get_id()) {  // Main thread can steal work, so ignore if stolen
+        mem_tracking.StartTracking();
+      }
+      auto stop_tracking = utils::OnScopeExit([&] {
+        if (main_thread != std::this_thread::get_id()) mem_tracking.StopTracking();
+      });
+      try {
+        task(i);
+      } catch (const std::exception &) {
+        exceptions[i] = std::current_exception();
+      }
+    });
+  }
+  context.worker_pool->ScheduledCollection(tasks);
+  tasks.WaitOrSteal();
+  for (const auto &exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+}
+
+/// Hashtable of a HashJoin shared by the parallel branches that probe it, each with its own chunk of the right side.
+/// The first branch to get to it builds it from the whole left side, while the others wait for the build. The left
+/// frames are split by the hash of their join value into partitions, which are then hashed in parallel on the worker
+/// pool. Branches hold on to the left frames while probing, so the hashtable is dropped only once the last of them
+/// releases it.
+class SharedHashJoinState {
+ public:
+  using LeftFrames = utils::pmr::vector<utils::pmr::vector<TypedValue>>;
+  using Hashtable = utils::pmr::unordered_map<TypedValue, LeftFrames, TypedValue::Hash, TypedValue::BoolEqual>;
+
+  static constexpr size_t kNumPartitions = 64;  // Power of 2, the partition is taken from the top bits of the hash
+  // Hashing fewer left frames isn't worth scheduling tasks for
+  static constexpr size_t kMinParallelBuildRows = 16384;
+
+  explicit SharedHashJoinState(utils::MemoryResource *mem) : mem_(mem) {
+    partitions_.reserve(kNumPartitions);
+    for (size_t i = 0UZ; i < kNumPartitions; ++i) partitions_.emplace_back(mem);
+  }
+
+  /// Builds the hashtable from the frames pulled from `left_cursor`, unless another branch already did.
+  void Build(Cursor &left_cursor, Frame &frame, ExecutionContext &context, Expression *join_value) {
+    {
+      std::unique_lock lock(mutex_);
+      built_cv_.wait(lock, [this] { return state_ != State::BUILDING; });
+      if (state_ == State::BUILT) {
+        ++users_;
+        return;
+      }
+      state_ = State::BUILDING;
+    }
+    // A failed build leaves the hashtable empty; the error is reported by the branch that built it
+    bool failed = false;
+    auto notify_built = utils::OnScopeExit([this, &failed] {
+      {
+        const std::lock_guard lock(mutex_);
+        state_ = State::BUILT;
+        if (!failed) ++users_;
+      }
+      built_cv_.notify_all();
+    });
+
+    try {
+      std::vector<std::vector<std::pair<TypedValue, utils::pmr::vector<TypedValue>>>> staged(kNumPartitions);
+      while (left_cursor.Pull(frame, context)) {
+        ExpressionEvaluator evaluator{&frame, context, storage::View::OLD, nullptr, &context.number_of_hops};
+        auto value = join_value->Accept(evaluator);
+        if (value.IsNull()) continue;
+        auto const partition = PartitionOf(value);
+        staged[partition].emplace_back(
+            std::move(value), utils::pmr::vector<TypedValue>(frame.elems().begin(), frame.elems().end(), mem_));
+        ++num_rows_;
+      }
+
+      auto build_partition = [&](size_t i) {
+        auto &partition = partitions_[i];
+        partition.reserve(staged[i].size());
+        for (auto &[value, left_frame] : staged[i]) partition[std::move(value)].emplace_back(std::move(left_frame));
+        staged[i].clear();
+      };
+      if (!context.worker_pool || num_rows_ < kMinParallelBuildRows) {
+        for (size_t i = 0UZ; i < kNumPartitions; ++i) build_partition(i);
+        return;
+      }
+
+      RunOnWorkerPool(context, kNumPartitions, build_partition);
+    } catch (const std::exception &) {
+      failed = true;
+      const std::lock_guard lock(mutex_);
+      ClearLocked();
+      throw;
+    }
+  }
+
+  /// Left frames with the join value `value`, nullptr if there are none.
+  const LeftFrames *Find(const TypedValue &value) const {
+    const auto &partition = partitions_[PartitionOf(value)];
+    auto it = partition.find(value);
+    return it == partition.end() ? nullptr : &it->second;
+  }
+
+  bool Empty() const { return num_rows_ == 0; }
+
+  /// Called by a branch that built or waited for the hashtable once it stops probing it. The last branch to release
+  /// it drops the hashtable, so it gets built again on the next pull.
+  void Release() {
+    const std::lock_guard lock(mutex_);
+    DMG_ASSERT(users_ > 0, "SharedHashJoinState released more times than it was acquired");
+    if (--users_ == 0) ClearLocked();
+  }
+
+  utils::MemoryResource *GetMemoryResource() const { return mem_; }
+
+ private:
+  enum class State : uint8_t { EMPTY, BUILDING, BUILT };
+
+  static size_t PartitionOf(const TypedValue &value) {
+    // Hashes of small integers leave the top bits empty, so they are mixed in first
+    constexpr uint64_t kFibonacciMultiplier = 0x9E3779B97F4A7C15ULL;
+    constexpr auto kPartitionBits = std::countr_zero(kNumPartitions);
+    return (static_cast<uint64_t>(TypedValue::Hash{}(value)) * kFibonacciMultiplier) >> (64 - kPartitionBits);
+  }
+
+  void ClearLocked() {
+    for (auto &partition : partitions_) partition.clear();
+    num_rows_ = 0;
+    state_ = State::EMPTY;
+  }
+
+  utils::MemoryResource *mem_;
+  std::mutex mutex_;
+  std::condition_variable built_cv_;
+  State state_{State::EMPTY};
+  size_t users_{0};  // Branches probing the built hashtable
+  size_t num_rows_{0};
+  std::vector<Hashtable> partitions_;
+};
+
 // Parallel execution plan creation helper
 struct CreationHelper {
   std::shared_ptr<Cursor> cursor_{nullptr};
@@ -485,6 +643,8 @@ struct CreationHelper {
   std::map<const LogicalOperator *, utils::SharedQuota> quotas_;  // Skip/Limit cursors need to use the same quota
   std::map<const LogicalOperator *, std::shared_ptr<SharedDistinctState>>
       shared_distinct_states_;  // Distinct cursors share deduplication state
+  std::map<const LogicalOperator *, std::shared_ptr<SharedHashJoinState>>
+      shared_hash_join_states_;  // HashJoin cursors probe the same hashtable
   std::shared_ptr<std::vector<utils::SharedQuota *>> shared_plan_quotas_{nullptr};
 
   utils::SharedQuota GetSharedQuota(const LogicalOperator *op) {
@@ -501,6 +661,15 @@ struct CreationHelper {
     }
     return it->second;
   }
+
+  /// Get or create the hashtable shared by the branches of a parallel HashJoin.
+  std::shared_ptr<SharedHashJoinState> GetSharedHashJoinState(const LogicalOperator *op, utils::MemoryResource *mem) {
+    auto [it, inserted] = shared_hash_join_states_.try_emplace(op, nullptr);
+    if (inserted) {
+      it->second = std::make_shared<SharedHashJoinState>(mem);
+    }
+    return it->second;
+  }
 };
 
 // Per-thread scratch state for parallel plan/cursor creation.
@@ -558,6 +727,14 @@ struct PlanCreationHelper {
       context.is_profile_query ? std::optional<ScopedProfile>(std::in_place, ComputeProfilingKey(this), ref, &context) \
                                : std::nullopt;
 
+bool Cursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  // A single row, with all of its values on the frame
+  batch.clear();
+  if (!Pull(frame, context)) return false;
+  batch.AppendRow();
+  return true;
+}
+
 bool Once::OnceCursor::Pull(Frame &, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP("Once");
@@ -930,13 +1107,17 @@ template <class TVerticesFun>
 class ScanAllCursor : public Cursor {
  public:
   explicit ScanAllCursor(const ScanAll &self, Symbol output_symbol, UniqueCursorPtr input_cursor, storage::View view,
-                         TVerticesFun get_vertices, const char *op_name)
+                         TVerticesFun get_vertices, const char *op_name,
+                         std::span<const std::optional<Symbol>> index_value_symbols = {},
+                         std::span<const storage::PropertyPath> index_properties = {})
       : self_(self),
         output_symbol_(std::move(output_symbol)),
         input_cursor_(std::move(input_cursor)),
         view_(view),
         get_vertices_(std::move(get_vertices)),
-        op_name_(op_name) {}
+        op_name_(op_name),
+        index_value_symbols_(index_value_symbols),
+        index_properties_(index_properties) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -953,6 +1134,7 @@ class ScanAllCursor : public Cursor {
       auto next_vertices = get_vertices_(frame, context);
       if (!next_vertices) continue;
       vertices_ = std::move(next_vertices);
+      DecodeIndexValues();
       vertices_it_.emplace(vertices_->begin());
       vertices_end_it_.emplace(vertices_->end());
     }
@@ -964,10 +1146,63 @@ class ScanAllCursor : public Cursor {
 
     auto frame_writer = frame.GetFrameWriter(context.frame_change_collector, context.evaluation_context.memory);
     frame_writer.Write(output_symbol_, *vertices_it_.value());
+    if (!index_value_symbols_.empty()) {
+      auto const vertex = *vertices_it_.value();
+      auto const values = IndexValues();
+      for (size_t pos = 0; pos != index_value_symbols_.size(); ++pos) {
+        if (!index_value_symbols_[pos]) continue;
+        frame_writer.Write(*index_value_symbols_[pos],
+                           IndexValue(vertex, values, pos, context, context.evaluation_context.memory));
+      }
+    }
     ++vertices_it_.value();
     return true;
   }
 
+  bool PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    AbortCheck(context);
+
+    batch.clear();
+    while (batch.empty()) {
+      // A batch only holds the vertices for a single input row, which stays on the frame
+      while (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
+        if (!input_cursor_->Pull(frame, context)) {
+          return false;
+        }
+        auto next_vertices = get_vertices_(frame, context);
+        if (!next_vertices) continue;
+        vertices_ = std::move(next_vertices);
+        DecodeIndexValues();
+        vertices_it_.emplace(vertices_->begin());
+        vertices_end_it_.emplace(vertices_->end());
+      }
+
+      auto const column = batch.Column(output_symbol_);
+      for (; !batch.full() && vertices_it_.value() != vertices_end_it_.value(); ++vertices_it_.value()) {
+#ifdef MG_ENTERPRISE
+        if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+            !context.auth_checker->Has(
+                *vertices_it_.value(), view_, memgraph::query::AuthQuery::FineGrainedPrivilege::READ)) {
+          continue;
+        }
+#endif
+        auto const row = batch.AppendRow();
+        batch.At(column, row) = TypedValue(*vertices_it_.value(), batch.memory());
+        if (!index_value_symbols_.empty()) {
+          auto const vertex = *vertices_it_.value();
+          auto const values = IndexValues();
+          for (size_t pos = 0; pos != index_value_symbols_.size(); ++pos) {
+            if (!index_value_symbols_[pos]) continue;
+            batch.At(batch.Column(*index_value_symbols_[pos]), row) =
+                IndexValue(vertex, values, pos, context, batch.memory());
+          }
+        }
+      }
+    }
+    return true;
+  }
+
 #ifdef MG_ENTERPRISE
   bool FindNextVertex(const ExecutionContext &context) {
     while (vertices_it_.value() != vertices_end_it_.value()) {
@@ -991,6 +1226,36 @@ class ScanAllCursor : public Cursor {
   }
 
  private:
+  std::optional<storage::IndexOrderedValuesView> IndexValues() const {
+    if constexpr (requires { vertices_it_.value().IndexValues(); }) {
+      return vertices_it_.value().IndexValues();
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  // An index-only scan has the index read the visible values of the indexed properties while it checks each vertex
+  void DecodeIndexValues() {
+    if constexpr (requires { vertices_->DecodeIndexValues(); }) {
+      if (!index_value_symbols_.empty()) vertices_->DecodeIndexValues();
+    }
+  }
+
+  // The value an index-only scan writes for the property at `pos`, masked like the evaluator masks it. Only vertices
+  // not produced by an in-memory index have it read from the vertex.
+  TypedValue IndexValue(const VertexAccessor &vertex, const std::optional<storage::IndexOrderedValuesView> &values,
+                        size_t pos, ExecutionContext &context, utils::MemoryResource *memory) const {
+    auto const property = index_properties_[pos][0];
+#ifdef MG_ENTERPRISE
+    if (!PropertyReadAllowed(context.auth_checker, vertex, view_, property)) return TypedValue(memory);
+#endif
+    auto *name_id_mapper = context.db_accessor->GetStorageAccessor()->GetNameIdMapper();
+    if (values) return TypedValue((*values)[pos], name_id_mapper, memory);
+    auto maybe_value = vertex.GetProperty(view_, property);
+    if (!maybe_value) throw QueryRuntimeException("Unexpected error when getting a property.");
+    return TypedValue(*std::move(maybe_value), name_id_mapper, memory);
+  }
+
   const ScanAll &self_;
   const Symbol output_symbol_;
   const UniqueCursorPtr input_cursor_;
@@ -1000,6 +1265,8 @@ class ScanAllCursor : public Cursor {
   std::optional<decltype(vertices_->begin())> vertices_it_;
   std::optional<decltype(vertices_->end())> vertices_end_it_;
   const char *op_name_;
+  std::span<const std::optional<Symbol>> index_value_symbols_;
+  std::span<const storage::PropertyPath> index_properties_;
 };
 
 template <typename TEdgesFun>
@@ -1157,6 +1424,46 @@ std::unique_ptr<LogicalOperator> ScanAllByLabel::Clone(AstStorage *storage) cons
   return object;
 }
 
+ScanAllByLabelIntersection::ScanAllByLabelIntersection(const std::shared_ptr<LogicalOperator> &input,
+                                                       Symbol output_symbol, std::vector<storage::LabelId> labels,
+                                                       storage::View view)
+    : ScanAll(input, output_symbol, view), labels_(std::move(labels)) {}
+
+ACCEPT_WITH_INPUT(ScanAllByLabelIntersection)
+
+UniqueCursorPtr ScanAllByLabelIntersection::MakeCursor(utils::MemoryResource *mem,
+                                                       metrics::DatabaseMetricHandles &metric_handles) const {
+  // Counted with the single label scans, it reads the same indices
+  metric_handles.scan_all_by_label_operator.Increment();
+
+  auto vertices = [this](Frame &, ExecutionContext &context) {
+    auto *db = context.db_accessor;
+    return std::make_optional(db->Vertices(view_, std::span<storage::LabelId const>(labels_)));
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem,
+                                                                *this,
+                                                                output_symbol_,
+                                                                input_->MakeCursor(mem, metric_handles),
+                                                                view_,
+                                                                std::move(vertices),
+                                                                "ScanAllByLabelIntersection");
+}
+
+std::string ScanAllByLabelIntersection::ToString(const DbAccessor *dba) const {
+  return fmt::format("ScanAllByLabelIntersection ({} :{})",
+                     output_symbol_.name(),
+                     utils::IterableToString(labels_, ":", [&](const auto &label) { return dba->LabelToName(label); }));
+}
+
+std::unique_ptr<LogicalOperator> ScanAllByLabelIntersection::Clone(AstStorage *storage) const {
+  auto object = std::make_unique<ScanAllByLabelIntersection>();
+  object->input_ = input_ ? input_->Clone(storage) : nullptr;
+  object->output_symbol_ = output_symbol_;
+  object->view_ = view_;
+  object->labels_ = labels_;
+  return object;
+}
+
 ScanAllByEdge::ScanAllByEdge(const std::shared_ptr<LogicalOperator> &input, Symbol edge_symbol, Symbol node1_symbol,
                              Symbol node2_symbol, EdgeAtom::Direction direction,
                              const std::vector<storage::EdgeTypeId> &edge_types, storage::View view)
@@ -1728,7 +2035,17 @@ UniqueCursorPtr ScanAllByLabelProperties::MakeCursor(utils::MemoryResource *mem,
                                                                 input_->MakeCursor(mem, metric_handles),
                                                                 view_,
                                                                 std::move(vertices),
-                                                                "ScanAllByLabelProperties");
+                                                                "ScanAllByLabelProperties",
+                                                                index_value_symbols_,
+                                                                properties_);
+}
+
+std::vector<Symbol> ScanAllByLabelProperties::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = ScanAll::ModifiedSymbols(table);
+  for (auto const &symbol : index_value_symbols_) {
+    if (symbol) symbols.emplace_back(*symbol);
+  }
+  return symbols;
 }
 
 std::string ScanAllByLabelProperties::ToString(const DbAccessor *dba) const {
@@ -1759,6 +2076,7 @@ std::unique_ptr<LogicalOperator> ScanAllByLabelProperties::Clone(AstStorage *sto
                                rv::transform([&](auto &&expr) { return ExpressionRange(expr, *storage); }) |
                                ranges::to_vector;
   object->index_order_ = index_order_;
+  object->index_value_symbols_ = index_value_symbols_;
   return object;
 }
 
@@ -1949,35 +2267,74 @@ std::unique_ptr<LogicalOperator> Expand::Clone(AstStorage *storage) const {
 
 Expand::ExpandCursor::ExpandCursor(const Expand &self, utils::MemoryResource *mem,
                                    metrics::DatabaseMetricHandles &metric_handles)
-    : self_(self), input_cursor_(self.input_->MakeCursor(mem, metric_handles)) {}
+    : self_(self), input_cursor_(self.input_->MakeCursor(mem, metric_handles)), input_batch_(mem) {}
 
 Expand::ExpandCursor::ExpandCursor(const Expand &self, int64_t input_degree, int64_t existing_node_degree,
                                    utils::MemoryResource *mem, metrics::DatabaseMetricHandles &metric_handles)
     : self_(self),
       input_cursor_(self.input_->MakeCursor(mem, metric_handles)),
       prev_input_degree_(input_degree),
-      prev_existing_degree_(existing_node_degree) {}
+      prev_existing_degree_(existing_node_degree),
+      input_batch_(mem) {}
 
 bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP_BY_REF(self_);
 
-  // A helper function for expanding a node from an edge.
   auto frame_writer = frame.GetFrameWriter(context.frame_change_collector, context.evaluation_context.memory);
-  auto pull_node = [this, &frame_writer]<EdgeAtom::Direction direction>(const EdgeAccessor &new_edge,
-                                                                        utils::tag_value<direction>) {
-    if (self_.common_.existing_node) return;
-    if constexpr (direction == EdgeAtom::Direction::IN) {
-      frame_writer.Write(self_.common_.node_symbol, new_edge.From());
-    } else if constexpr (direction == EdgeAtom::Direction::OUT) {
-      frame_writer.Write(self_.common_.node_symbol, new_edge.To());
-    } else {
-      LOG_FATAL("Must indicate exact expansion direction here");
+  while (true) {
+    AbortCheck(context);
+    if (auto const next = NextEdge(context)) {
+      auto const &[edge, direction] = *next;
+      frame_writer.Write(self_.common_.edge_symbol, edge);
+      if (!self_.common_.existing_node) {
+        frame_writer.Write(self_.common_.node_symbol, direction == EdgeAtom::Direction::IN ? edge.From() : edge.To());
+      }
+      return true;
     }
-  };
 
+    // If we are here, either the edges have not been initialized,
+    // or they have been exhausted. Attempt to initialize the edges.
+    if (!InitEdges(frame, context)) return false;
+
+    // we have re-initialized the edges, continue with the loop
+  }
+}
+
+bool Expand::ExpandCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  AbortCheck(context);
+
+  batch.clear();
+  while (!batch.full()) {
+    if (auto const next = NextEdge(context)) {
+      auto const &[edge, direction] = *next;
+      auto const row = batch.AppendRowFrom(input_batch_, input_row_);
+      batch.At(batch.Column(self_.common_.edge_symbol), row) = TypedValue(edge, batch.memory());
+      if (!self_.common_.existing_node) {
+        batch.At(batch.Column(self_.common_.node_symbol), row) =
+            TypedValue(direction == EdgeAtom::Direction::IN ? edge.From() : edge.To(), batch.memory());
+      }
+      continue;
+    }
+
+    if (++input_row_ >= input_batch_.size()) {
+      // The rows of a batch share the frame, so a batch is never built from more than one input batch
+      if (!batch.empty()) break;
+      if (!input_cursor_->PullBatch(frame, input_batch_, context)) return false;
+      input_row_ = 0;
+    }
+    if (context.hops_limit.IsLimitReached()) break;
+
+    FrameBatch::RowScope const input_row{input_batch_, input_row_, frame, context.frame_change_collector};
+    InitEdgesFrom(frame, context);
+  }
+  return !batch.empty();
+}
+
+std::optional<std::pair<EdgeAccessor, EdgeAtom::Direction>> Expand::ExpandCursor::NextEdge(
+    ExecutionContext &context) {
   while (true) {
-    AbortCheck(context);
     // attempt to get a value from the incoming edges
     if (in_edges_ && *in_edges_it_ != in_edges_->end()) {
       auto edge = *(*in_edges_it_)++;
@@ -1989,10 +2346,7 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
         continue;
       }
 #endif
-
-      frame_writer.Write(self_.common_.edge_symbol, edge);
-      pull_node(edge, utils::tag_v<EdgeAtom::Direction::IN>);
-      return true;
+      return std::pair{edge, EdgeAtom::Direction::IN};
     }
 
     // attempt to get a value from the outgoing edges
@@ -2010,16 +2364,10 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
         continue;
       }
 #endif
-      frame_writer.Write(self_.common_.edge_symbol, edge);
-      pull_node(edge, utils::tag_v<EdgeAtom::Direction::OUT>);
-      return true;
+      return std::pair{edge, EdgeAtom::Direction::OUT};
     }
 
-    // If we are here, either the edges have not been initialized,
-    // or they have been exhausted. Attempt to initialize the edges.
-    if (!InitEdges(frame, context)) return false;
-
-    // we have re-initialized the edges, continue with the loop
+    return std::nullopt;
   }
 }
 
@@ -2031,6 +2379,8 @@ void Expand::ExpandCursor::Reset() {
   in_edges_it_ = std::nullopt;
   out_edges_ = std::nullopt;
   out_edges_it_ = std::nullopt;
+  input_batch_.clear();
+  input_row_ = 0;
 }
 
 ExpansionInfo Expand::ExpandCursor::GetExpansionInfo(Frame &frame) {
@@ -2091,78 +2441,297 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
 
     if (context.hops_limit.IsLimitReached()) return false;
 
-    expansion_info_ = GetExpansionInfo(frame);
+    if (InitEdgesFrom(frame, context)) return true;
+  }
+}
 
-    if (!expansion_info_.input_node) {
-      continue;
-    }
+bool Expand::ExpandCursor::InitEdgesFrom(Frame &frame, ExecutionContext &context) {
+  expansion_info_ = GetExpansionInfo(frame);
 
-    auto vertex = *expansion_info_.input_node;
-    auto direction = expansion_info_.direction;
+  if (!expansion_info_.input_node) {
+    return false;
+  }
 
-    int64_t num_expanded_first = -1;
-    if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
-      if (self_.common_.existing_node) {
-        if (expansion_info_.existing_node) {
-          auto existing_node = *expansion_info_.existing_node;
+  auto vertex = *expansion_info_.input_node;
+  auto direction = expansion_info_.direction;
 
-          auto edges_result = UnwrapEdgesResult(
-              vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
-          context.number_of_hops += edges_result.expanded_count;
-          in_edges_.emplace(std::move(edges_result.edges));
-          num_expanded_first = edges_result.expanded_count;
-        }
-      } else {
-        auto edges_result =
-            UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+  int64_t num_expanded_first = -1;
+  if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
+    if (self_.common_.existing_node) {
+      if (expansion_info_.existing_node) {
+        auto existing_node = *expansion_info_.existing_node;
+
+        auto edges_result = UnwrapEdgesResult(
+            vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
         context.number_of_hops += edges_result.expanded_count;
         in_edges_.emplace(std::move(edges_result.edges));
         num_expanded_first = edges_result.expanded_count;
       }
-      if (in_edges_) {
-        in_edges_it_.emplace(in_edges_->begin());
-      }
+    } else {
+      auto edges_result =
+          UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+      context.number_of_hops += edges_result.expanded_count;
+      in_edges_.emplace(std::move(edges_result.edges));
+      num_expanded_first = edges_result.expanded_count;
     }
+    if (in_edges_) {
+      in_edges_it_.emplace(in_edges_->begin());
+    }
+  }
 
-    int64_t num_expanded_second = -1;
-    if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
-      if (self_.common_.existing_node) {
-        if (expansion_info_.existing_node) {
-          auto existing_node = *expansion_info_.existing_node;
-          auto edges_result = UnwrapEdgesResult(
-              vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
-          context.number_of_hops += edges_result.expanded_count;
-          out_edges_.emplace(std::move(edges_result.edges));
-          num_expanded_second = edges_result.expanded_count;
-        }
-      } else {
-        auto edges_result =
-            UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+  int64_t num_expanded_second = -1;
+  if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
+    if (self_.common_.existing_node) {
+      if (expansion_info_.existing_node) {
+        auto existing_node = *expansion_info_.existing_node;
+        auto edges_result = UnwrapEdgesResult(
+            vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
         context.number_of_hops += edges_result.expanded_count;
         out_edges_.emplace(std::move(edges_result.edges));
         num_expanded_second = edges_result.expanded_count;
       }
-      if (out_edges_) {
-        out_edges_it_.emplace(out_edges_->begin());
-      }
+    } else {
+      auto edges_result =
+          UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+      context.number_of_hops += edges_result.expanded_count;
+      out_edges_.emplace(std::move(edges_result.edges));
+      num_expanded_second = edges_result.expanded_count;
     }
+    if (out_edges_) {
+      out_edges_it_.emplace(out_edges_->begin());
+    }
+  }
 
-    if (!expansion_info_.existing_node) {
-      return true;
+  if (!expansion_info_.existing_node) {
+    return true;
+  }
+
+  num_expanded_first = num_expanded_first == -1 ? 0 : num_expanded_first;
+  num_expanded_second = num_expanded_second == -1 ? 0 : num_expanded_second;
+  int64_t total_expanded_edges = num_expanded_first + num_expanded_second;
+
+  if (!expansion_info_.reversed) {
+    prev_input_degree_ = total_expanded_edges;
+  } else {
+    prev_existing_degree_ = total_expanded_edges;
+  }
+
+  return true;
+}
+
+ExpandIntersect::ExpandIntersect(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol,
+                                 ExpandCommon common, ExpandCommon closing, storage::View view)
+    : input_(input ? input : std::make_shared<Once>()),
+      input_symbol_(std::move(input_symbol)),
+      common_(std::move(common)),
+      closing_(std::move(closing)),
+      view_(view) {}
+
+ACCEPT_WITH_INPUT(ExpandIntersect)
+
+class ExpandIntersectCursor : public Cursor {
+ public:
+  ExpandIntersectCursor(const ExpandIntersect &self, utils::MemoryResource *mem,
+                        metrics::DatabaseMetricHandles &metric_handles)
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem, metric_handles)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    auto frame_writer = frame.GetFrameWriter(context.frame_change_collector, context.evaluation_context.memory);
+    while (true) {
+      AbortCheck(context);
+      if (closing_edges_ && closing_edge_pos_ < closing_edges_->size()) {
+        frame_writer.Write(self_.common_.edge_symbol, *edge_);
+        frame_writer.Write(self_.common_.node_symbol, *node_);
+        frame_writer.Write(self_.closing_.edge_symbol, (*closing_edges_)[closing_edge_pos_++]);
+        return true;
+      }
+      if (NextEdge(context)) continue;
+      if (!InitEdges(frame, context)) return false;
     }
+  }
 
-    num_expanded_first = num_expanded_first == -1 ? 0 : num_expanded_first;
-    num_expanded_second = num_expanded_second == -1 ? 0 : num_expanded_second;
-    int64_t total_expanded_edges = num_expanded_first + num_expanded_second;
+  void Shutdown() override { input_cursor_->Shutdown(); }
 
-    if (!expansion_info_.reversed) {
-      prev_input_degree_ = total_expanded_edges;
-    } else {
-      prev_existing_degree_ = total_expanded_edges;
+  void Reset() override {
+    input_cursor_->Reset();
+    edges_.clear();
+    edge_pos_ = 0;
+    closing_edges_ = nullptr;
+    closing_node_.reset();
+    closing_index_.clear();
+  }
+
+ private:
+  bool InitEdges(Frame &frame, ExecutionContext &context) {
+    while (true) {
+      if (!input_cursor_->Pull(frame, context)) return false;
+
+      if (context.hops_limit.IsLimitReached()) return false;
+
+      if (InitEdgesFrom(frame, context)) return true;
     }
+  }
+
+  bool InitEdgesFrom(Frame &frame, ExecutionContext &context) {
+    edges_.clear();
+    edge_pos_ = 0;
+
+    // Either node could be null if it is created by a failed optional match
+    TypedValue const &input_value = frame[self_.input_symbol_];
+    TypedValue const &closing_value = frame[self_.closing_.node_symbol];
+    if (input_value.IsNull() || closing_value.IsNull()) return false;
+    ExpectType(self_.input_symbol_, input_value, TypedValue::Type::Vertex);
+    ExpectType(self_.closing_.node_symbol, closing_value, TypedValue::Type::Vertex);
+
+    IndexClosingNode(closing_value.ValueVertex(), context);
+    if (closing_index_.empty()) return false;
 
+    auto const &vertex = input_value.ValueVertex();
+    auto const direction = self_.common_.direction;
+    if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
+      auto edges_result =
+          UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+      context.number_of_hops += edges_result.expanded_count;
+      for (auto &edge : edges_result.edges) edges_.emplace_back(std::move(edge), EdgeAtom::Direction::IN);
+    }
+    if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
+      auto edges_result =
+          UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+      context.number_of_hops += edges_result.expanded_count;
+      for (auto &edge : edges_result.edges) {
+        // Cycles were already found among the incoming edges
+        if (direction == EdgeAtom::Direction::BOTH && edge.IsCycle()) continue;
+        edges_.emplace_back(std::move(edge), EdgeAtom::Direction::OUT);
+      }
+    }
     return true;
   }
+
+  // Indexes the edges the closing expansion would find from each neighbour of the closing node by that neighbour.
+  // They are looked up from the closing node, so the direction is reversed.
+  void IndexClosingNode(const VertexAccessor &closing_node, ExecutionContext &context) {
+    if (closing_node_ == closing_node) return;
+    closing_node_ = closing_node;
+    closing_index_.clear();
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+        !context.auth_checker->Has(
+            closing_node, self_.view_, memgraph::query::AuthQuery::FineGrainedPrivilege::READ)) {
+      return;
+    }
+#endif
+    auto const add = [&](const VertexAccessor &neighbour, const EdgeAccessor &edge) {
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ)) {
+        return;
+      }
+#endif
+      closing_index_[neighbour].push_back(edge);
+    };
+
+    auto const direction = self_.closing_.direction;
+    if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
+      auto edges_result =
+          UnwrapEdgesResult(closing_node.OutEdges(self_.view_, self_.closing_.edge_types, &context.hops_limit));
+      context.number_of_hops += edges_result.expanded_count;
+      for (const auto &edge : edges_result.edges) add(edge.To(), edge);
+    }
+    if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
+      auto edges_result =
+          UnwrapEdgesResult(closing_node.InEdges(self_.view_, self_.closing_.edge_types, &context.hops_limit));
+      context.number_of_hops += edges_result.expanded_count;
+      for (const auto &edge : edges_result.edges) {
+        // Cycles were already found among the edges coming into the neighbour
+        if (direction == EdgeAtom::Direction::BOTH && edge.IsCycle()) continue;
+        add(edge.From(), edge);
+      }
+    }
+  }
+
+  // Moves to the next edge of the input node that leads to a neighbour of the closing node
+  bool NextEdge(ExecutionContext &context) {
+    closing_edges_ = nullptr;
+    while (edge_pos_ < edges_.size()) {
+      auto const &[edge, direction] = edges_[edge_pos_++];
+      auto node = direction == EdgeAtom::Direction::IN ? edge.From() : edge.To();
+      auto const found = closing_index_.find(node);
+      if (found == closing_index_.end()) continue;
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(node, self_.view_, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        continue;
+      }
+#endif
+      edge_ = edge;
+      node_ = std::move(node);
+      closing_edges_ = &found->second;
+      closing_edge_pos_ = 0;
+      return true;
+    }
+    return false;
+  }
+
+  const ExpandIntersect &self_;
+  const UniqueCursorPtr input_cursor_;
+
+  // Edges of the current input node with their direction, and the one to expand next
+  std::vector<std::pair<EdgeAccessor, EdgeAtom::Direction>> edges_;
+  size_t edge_pos_{0};
+  std::optional<EdgeAccessor> edge_;
+  std::optional<VertexAccessor> node_;
+  // Edges from the current neighbour to the closing node, and the one to return next
+  const std::vector<EdgeAccessor> *closing_edges_{nullptr};
+  size_t closing_edge_pos_{0};
+  std::optional<VertexAccessor> closing_node_;
+  std::unordered_map<VertexAccessor, std::vector<EdgeAccessor>> closing_index_;
+};
+
+UniqueCursorPtr ExpandIntersect::MakeCursor(utils::MemoryResource *mem,
+                                            metrics::DatabaseMetricHandles &metric_handles) const {
+  metric_handles.expand_operator.Increment();
+
+  return MakeUniqueCursorPtr<ExpandIntersectCursor>(mem, *this, mem, metric_handles);
+}
+
+std::vector<Symbol> ExpandIntersect::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  symbols.emplace_back(common_.node_symbol);
+  symbols.emplace_back(common_.edge_symbol);
+  symbols.emplace_back(closing_.edge_symbol);
+  return symbols;
+}
+
+std::string ExpandIntersect::ToString(const DbAccessor *dba) const {
+  auto const edge = [dba](const ExpandCommon &common) {
+    return fmt::format(
+        "{}[{}{}]{}",
+        common.direction == query::EdgeAtom::Direction::IN ? "<-" : "-",
+        common.edge_symbol.name(),
+        utils::IterableToString(
+            common.edge_types, "|", [dba](const auto &edge_type) { return ":" + dba->EdgeTypeToName(edge_type); }),
+        common.direction == query::EdgeAtom::Direction::OUT ? "->" : "-");
+  };
+  return fmt::format("ExpandIntersect ({}){}({}){}({})",
+                     input_symbol_.name(),
+                     edge(common_),
+                     common_.node_symbol.name(),
+                     edge(closing_),
+                     closing_.node_symbol.name());
+}
+
+std::unique_ptr<LogicalOperator> ExpandIntersect::Clone(AstStorage *storage) const {
+  auto object = std::make_unique<ExpandIntersect>();
+  object->input_ = input_ ? input_->Clone(storage) : nullptr;
+  object->input_symbol_ = input_symbol_;
+  object->common_ = common_;
+  object->closing_ = closing_;
+  object->view_ = view_;
+  return object;
 }
 
 ExpandVariable::ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
@@ -2512,6 +3081,86 @@ class ExpandVariableCursor : public Cursor {
   }
 };
 
+namespace {
+
+/// Set of vertices kept as a bitmap over their gids. The storage hands gids out densely, so for a search that has
+/// reached a good part of the graph this is smaller than a hash set and much cheaper to probe.
+class VertexBitmap {
+ public:
+  explicit VertexBitmap(utils::MemoryResource *memory) : words_(memory) {}
+
+  bool Contains(const VertexAccessor &vertex) const {
+    auto const gid = vertex.Gid().AsUint();
+    return gid / kBitsPerWord < words_.size() && ((words_[gid / kBitsPerWord] >> (gid % kBitsPerWord)) & 1U);
+  }
+
+  void Insert(const VertexAccessor &vertex) {
+    auto const gid = vertex.Gid().AsUint();
+    if (gid / kBitsPerWord >= words_.size()) words_.resize(gid / kBitsPerWord + 1, 0);
+    words_[gid / kBitsPerWord] |= uint64_t{1} << (gid % kBitsPerWord);
+  }
+
+  void Clear() { words_.clear(); }
+
+ private:
+  static constexpr uint64_t kBitsPerWord = 64;
+
+  utils::pmr::vector<uint64_t> words_;
+};
+
+// Frontiers smaller than this are always expanded top-down, a bottom-up step reads every vertex of the graph
+constexpr size_t kMinBottomUpFrontier = 1024;
+// A level is expanded bottom-up once its frontier holds more than 1/kBottomUpShare of the vertices left to visit. This
+// is the switch of direction-optimizing BFS (Beamer et al.) counted in vertices instead of edges.
+constexpr int64_t kBottomUpShare = 14;
+
+bool ShouldStepBottomUp(size_t frontier_size, size_t visited_count, const ExecutionContext &context) {
+  // The hops limit counts the edges of the frontier that are followed, a bottom-up step follows different ones
+  if (frontier_size < kMinBottomUpFrontier || context.hops_limit.IsUsed()) return false;
+  auto const unvisited = context.db_accessor->VerticesCount() - static_cast<int64_t>(visited_count);
+  return unvisited > 0 && static_cast<int64_t>(frontier_size) * kBottomUpShare > unvisited;
+}
+
+enum class BottomUpVisit : uint8_t { REJECTED, ACCEPTED, STOP };
+
+/// Bottom-up step of a breadth-first search. Instead of following the edges of every `frontier` vertex, each vertex
+/// not `visited` yet looks through its edges for one that leads to it from the frontier. `visit(parent, edge, vertex)`
+/// decides on each such edge: the vertex stops looking at the first one accepted, and the whole step ends at STOP.
+/// Once the frontier is a large part of the graph most vertices find an edge early, so this reads far fewer edges than
+/// expanding the frontier, which would mostly find vertices visited already.
+template <typename TVisit>
+void StepBottomUp(const std::vector<storage::EdgeTypeId> &edge_types, bool expand_out, bool expand_in,
+                  const VertexBitmap &visited, const VertexBitmap &frontier, ExecutionContext &context,
+                  const TVisit &visit) {
+  for (const auto &vertex : context.db_accessor->Vertices(storage::View::OLD)) {
+    AbortCheck(context);
+    if (visited.Contains(vertex)) continue;
+    auto result = BottomUpVisit::REJECTED;
+    // The frontier reaches the vertex over its own out edges through the vertex's in edges, and the other way around
+    if (expand_out) {
+      auto in_edges_result = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, edge_types));
+      context.number_of_hops += in_edges_result.expanded_count;
+      for (const auto &edge : in_edges_result.edges) {
+        if (!frontier.Contains(edge.From())) continue;
+        result = visit(edge.From(), edge, vertex);
+        if (result != BottomUpVisit::REJECTED) break;
+      }
+    }
+    if (result == BottomUpVisit::REJECTED && expand_in) {
+      auto out_edges_result = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, edge_types));
+      context.number_of_hops += out_edges_result.expanded_count;
+      for (const auto &edge : out_edges_result.edges) {
+        if (!frontier.Contains(edge.To())) continue;
+        result = visit(edge.To(), edge, vertex);
+        if (result != BottomUpVisit::REJECTED) break;
+      }
+    }
+    if (result == BottomUpVisit::STOP) return;
+  }
+}
+
+}  // namespace
+
 class STShortestPathCursor : public query::plan::Cursor {
  public:
   STShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem,
@@ -2608,6 +3257,97 @@ class STShortestPathCursor : public query::plan::Cursor {
     throw QueryRuntimeException("Expansion condition must evaluate to boolean or null");
   }
 
+  // Frontiers smaller than this are expanded on the pulling thread, it isn't worth scheduling tasks for them
+  static constexpr size_t kMinParallelFrontier = 4096;
+  static constexpr size_t kMaxFrontierChunks = 64;
+
+  static bool CanRead([[maybe_unused]] const EdgeAccessor &edge, [[maybe_unused]] const VertexAccessor &neighbour,
+                      [[maybe_unused]] const ExecutionContext &context) {
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+        !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+          context.auth_checker->Has(
+              neighbour, storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+      return false;
+    }
+#endif
+    return true;
+  }
+
+  /// Calls `visit(vertex, edge, neighbour)` for the edges of each vertex of `frontier` in the direction of the
+  /// expansion, until it returns true.
+  template <typename TVisit>
+  void ExpandFrontier(const utils::pmr::vector<VertexAccessor> &frontier, bool from_source, ExecutionContext &context,
+                      const TVisit &visit) {
+    // Expanding from the sink follows the edges against the direction of the pattern
+    auto const direction = self_.common_.direction;
+    bool const expand_out = from_source ? direction != EdgeAtom::Direction::IN : direction != EdgeAtom::Direction::OUT;
+    bool const expand_in = from_source ? direction != EdgeAtom::Direction::OUT : direction != EdgeAtom::Direction::IN;
+
+    // Under parallel execution the edges of a large frontier are read on the worker pool, which the transaction only
+    // allows then because of its delta cache. The hops limit is counted on the pulling thread, so there mustn't be one.
+    // The edges are then visited in the same order as they would be by a single thread.
+    if (context.parallel_execution && context.worker_pool && !context.hops_limit.IsUsed() &&
+        frontier.size() >= kMinParallelFrontier) {
+      struct Hop {
+        size_t vertex;
+        EdgeAccessor edge;
+        bool out;
+      };
+      auto const num_chunks = std::min(kMaxFrontierChunks, frontier.size() / (kMinParallelFrontier / 4));
+      auto const chunk_size = (frontier.size() + num_chunks - 1) / num_chunks;
+      std::vector<std::vector<Hop>> hops(num_chunks);
+      std::vector<int64_t> expanded_counts(num_chunks, 0);
+      RunOnWorkerPool(context, num_chunks, [&](size_t chunk) {
+        auto const end = std::min(frontier.size(), (chunk + 1) * chunk_size);
+        for (auto i = chunk * chunk_size; i < end; ++i) {
+          if (expand_out) {
+            auto out_edges_result =
+                UnwrapEdgesResult(frontier[i].OutEdges(storage::View::OLD, self_.common_.edge_types));
+            expanded_counts[chunk] += out_edges_result.expanded_count;
+            for (auto &edge : out_edges_result.edges) hops[chunk].push_back({i, std::move(edge), true});
+          }
+          if (expand_in) {
+            auto in_edges_result = UnwrapEdgesResult(frontier[i].InEdges(storage::View::OLD, self_.common_.edge_types));
+            expanded_counts[chunk] += in_edges_result.expanded_count;
+            for (auto &edge : in_edges_result.edges) hops[chunk].push_back({i, std::move(edge), false});
+          }
+        }
+      });
+      for (auto const expanded_count : expanded_counts) context.number_of_hops += expanded_count;
+      for (const auto &chunk : hops) {
+        for (const auto &[vertex, edge, out] : chunk) {
+          auto const neighbour = out ? edge.To() : edge.From();
+          if (!CanRead(edge, neighbour, context)) continue;
+          if (visit(frontier[vertex], edge, neighbour)) return;
+        }
+      }
+      return;
+    }
+
+    for (const auto &vertex : frontier) {
+      if (context.hops_limit.IsLimitReached()) break;
+      if (expand_out) {
+        auto out_edges_result =
+            UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+        context.number_of_hops += out_edges_result.expanded_count;
+        for (const auto &edge : out_edges_result.edges) {
+          if (!CanRead(edge, edge.To(), context)) continue;
+          if (visit(vertex, edge, edge.To())) return;
+        }
+      }
+      if (expand_in) {
+        auto in_edges_result =
+            UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+        context.number_of_hops += in_edges_result.expanded_count;
+        for (const auto &edge : in_edges_result.edges) {
+          if (!CanRead(edge, edge.From(), context)) continue;
+          if (visit(vertex, edge, edge.From())) return;
+        }
+      }
+    }
+  }
+
   bool FindPath(const VertexAccessor &source, const VertexAccessor &sink, int64_t lower_bound, int64_t upper_bound,
                 Frame *frame, ExpressionEvaluator *evaluator, ExecutionContext &context) {
     if (source == sink) return false;
@@ -2630,152 +3370,102 @@ class STShortestPathCursor : public query::plan::Cursor {
 
     // Maps each vertex we visited expanding from the source (sink) to the
     // edge used. Necessary for path reconstruction.
-    VertexEdgeMapT in_edge(pull_memory);
-    VertexEdgeMapT out_edge(pull_memory);
-
-    size_t current_length = 0;
-
-    source_frontier.emplace_back(source);
-    in_edge[source] = std::nullopt;
-    sink_frontier.emplace_back(sink);
-    out_edge[sink] = std::nullopt;
-
-    while (true) {
-      AbortCheck(context);
-      // Top-down step (expansion from the source).
-      ++current_length;
-      if (current_length > upper_bound) return false;
-
-      for (const auto &vertex : source_frontier) {
-        if (context.hops_limit.IsLimitReached()) break;
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto out_edges_result =
-              UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += out_edges_result.expanded_count;
-          for (const auto &edge : out_edges_result.edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(
-                      edge.To(), storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(edge.To(), edge, frame, evaluator, context) && !in_edge.contains(edge.To())) {
-              in_edge.emplace(edge.To(), edge);
-              if (out_edge.contains(edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, context);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.To());
-            }
-          }
-        }
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto in_edges_result =
-              UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += in_edges_result.expanded_count;
-          for (const auto &edge : in_edges_result.edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(
-                      edge.From(), storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(edge.From(), edge, frame, evaluator, context) && !in_edge.contains(edge.From())) {
-              in_edge.emplace(edge.From(), edge);
-              if (out_edge.contains(edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, context);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.From());
-            }
-          }
-        }
-      }
-
-      if (source_next.empty()) return false;
-      source_frontier.clear();
-      std::swap(source_frontier, source_next);
-
-      // Bottom-up step (expansion from the sink).
-      ++current_length;
-      if (current_length > upper_bound) return false;
-
-      // When expanding from the sink we have to be careful which edge
-      // endpoint we pass to `should_expand`, because everything is
-      // reversed.
-      for (const auto &vertex : sink_frontier) {
-        if (context.hops_limit.IsLimitReached()) break;
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto out_edges_result =
-              UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += out_edges_result.expanded_count;
-          for (const auto &edge : out_edges_result.edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(
-                      edge.To(), storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(vertex, edge, frame, evaluator, context) && !out_edge.contains(edge.To())) {
-              out_edge.emplace(edge.To(), edge);
-              if (in_edge.contains(edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, context);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.To());
-            }
-          }
-        }
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto in_edges_result =
-              UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += in_edges_result.expanded_count;
-          for (const auto &edge : in_edges_result.edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(
-                      edge.From(), storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(vertex, edge, frame, evaluator, context) && !out_edge.contains(edge.From())) {
-              out_edge.emplace(edge.From(), edge);
-              if (in_edge.contains(edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, context);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.From());
-            }
-          }
-        }
+    VertexEdgeMapT in_edge(pull_memory);
+    VertexEdgeMapT out_edge(pull_memory);
+
+    // The same visited vertices as bitmaps, filled in once a side first expands bottom-up
+    VertexBitmap source_visited_bits(pull_memory);
+    VertexBitmap sink_visited_bits(pull_memory);
+    bool source_bottom_up = false;
+    bool sink_bottom_up = false;
+    VertexBitmap frontier_bits(pull_memory);
+
+    size_t current_length = 0;
+
+    source_frontier.emplace_back(source);
+    in_edge[source] = std::nullopt;
+    sink_frontier.emplace_back(sink);
+    out_edge[sink] = std::nullopt;
+
+    while (true) {
+      AbortCheck(context);
+      ++current_length;
+      if (current_length > upper_bound) return false;
+
+      // Each step expands the smaller of the two frontiers by a level, which lengthens the searched paths by one hop
+      // for the least work. On graphs where one side fans out much faster this keeps expanding the other one.
+      bool const from_source = source_frontier.size() <= sink_frontier.size();
+      auto &frontier = from_source ? source_frontier : sink_frontier;
+      auto &next = from_source ? source_next : sink_next;
+      auto &visited = from_source ? in_edge : out_edge;
+      const auto &other_visited = from_source ? out_edge : in_edge;
+      auto &visited_bits = from_source ? source_visited_bits : sink_visited_bits;
+      auto &bottom_up = from_source ? source_bottom_up : sink_bottom_up;
+
+      std::optional<VertexAccessor> midpoint;
+      if (ShouldStepBottomUp(frontier.size(), visited.size(), context)) {
+        if (!bottom_up) {
+          for (const auto &[vertex, _] : visited) visited_bits.Insert(vertex);
+          bottom_up = true;
+        }
+        frontier_bits.Clear();
+        for (const auto &vertex : frontier) frontier_bits.Insert(vertex);
+        auto const direction = self_.common_.direction;
+        bool const expand_out =
+            from_source ? direction != EdgeAtom::Direction::IN : direction != EdgeAtom::Direction::OUT;
+        bool const expand_in =
+            from_source ? direction != EdgeAtom::Direction::OUT : direction != EdgeAtom::Direction::IN;
+        StepBottomUp(self_.common_.edge_types,
+                     expand_out,
+                     expand_in,
+                     visited_bits,
+                     frontier_bits,
+                     context,
+                     [&](const VertexAccessor &parent, const EdgeAccessor &edge, const VertexAccessor &vertex) {
+                       if (!CanRead(edge, vertex, context) ||
+                           !ShouldExpand(from_source ? vertex : parent, edge, frame, evaluator, context)) {
+                         return BottomUpVisit::REJECTED;
+                       }
+                       visited.emplace(vertex, edge);
+                       visited_bits.Insert(vertex);
+                       if (other_visited.contains(vertex)) {
+                         midpoint.emplace(vertex);
+                         return BottomUpVisit::STOP;
+                       }
+                       next.push_back(vertex);
+                       return BottomUpVisit::ACCEPTED;
+                     });
+      } else {
+        // When expanding from the sink we have to be careful which edge
+        // endpoint we pass to `should_expand`, because everything is
+        // reversed.
+        ExpandFrontier(frontier,
+                       from_source,
+                       context,
+                       [&](const VertexAccessor &vertex, const EdgeAccessor &edge, const VertexAccessor &neighbour) {
+                         if (!ShouldExpand(from_source ? neighbour : vertex, edge, frame, evaluator, context) ||
+                             visited.contains(neighbour)) {
+                           return false;
+                         }
+                         visited.emplace(neighbour, edge);
+                         if (bottom_up) visited_bits.Insert(neighbour);
+                         if (other_visited.contains(neighbour)) {
+                           midpoint.emplace(neighbour);
+                           return true;
+                         }
+                         next.push_back(neighbour);
+                         return false;
+                       });
+      }
+      if (midpoint) {
+        if (current_length < lower_bound) return false;
+        ReconstructPath(*midpoint, in_edge, out_edge, frame, context);
+        return true;
       }
 
-      if (sink_next.empty()) return false;
-      sink_frontier.clear();
-      std::swap(sink_frontier, sink_next);
+      if (next.empty()) return false;
+      frontier.clear();
+      std::swap(frontier, next);
     }
   }
 };
@@ -2788,7 +3478,9 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         input_cursor_(self_.input()->MakeCursor(mem, metric_handles)),
         processed_(mem),
         to_visit_next_(mem),
-        to_visit_current_(mem) {
+        to_visit_current_(mem),
+        processed_bits_(mem),
+        frontier_bits_(mem) {
     DMG_ASSERT(!self_.common_.existing_node,
                "Single source shortest path algorithm "
                "should not be used when `existing_node` "
@@ -2851,6 +3543,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
       }
       to_visit_next_.emplace_back(edge, vertex, std::move(curr_acc_path));
       processed_.emplace(vertex, edge);
+      if (bottom_up_) processed_bits_.Insert(vertex);
       return true;
     };
 
@@ -2885,11 +3578,41 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
       }
     };
 
+    // Expands the whole level in to_visit_current_ bottom-up, if that pays off. The accumulated path of a filter
+    // lambda belongs to the vertex expanded from, so such searches always go top-down.
+    auto expand_level_bottom_up = [&]() -> bool {
+      if (self_.filter_lambda_.accumulated_path_symbol || current_depth_ >= upper_bound_ ||
+          !ShouldStepBottomUp(to_visit_current_.size(), processed_.size(), context)) {
+        return false;
+      }
+      if (!bottom_up_) {
+        for (const auto &[vertex, _] : processed_) processed_bits_.Insert(vertex);
+        bottom_up_ = true;
+      }
+      frontier_bits_.Clear();
+      for (const auto &entry : to_visit_current_) frontier_bits_.Insert(std::get<VertexAccessor>(entry));
+      StepBottomUp(self_.common_.edge_types,
+                   self_.common_.direction != EdgeAtom::Direction::IN,
+                   self_.common_.direction != EdgeAtom::Direction::OUT,
+                   processed_bits_,
+                   frontier_bits_,
+                   context,
+                   [&](const VertexAccessor &, const EdgeAccessor &edge, const VertexAccessor &vertex) {
+                     expand_pair(edge, vertex);
+                     return processed_bits_.Contains(vertex) ? BottomUpVisit::ACCEPTED : BottomUpVisit::REJECTED;
+                   });
+      return true;
+    };
+
     // do it all in a loop because we skip some elements
     while (true) {
       AbortCheck(context);
       // if we have nothing to visit on the current depth, switch to next
-      if (to_visit_current_.empty()) to_visit_current_.swap(to_visit_next_);
+      if (to_visit_current_.empty() && !to_visit_next_.empty()) {
+        to_visit_current_.swap(to_visit_next_);
+        ++current_depth_;
+        current_level_expanded_ = expand_level_bottom_up();
+      }
 
       // if current is still empty, it means both are empty, so pull from
       // input
@@ -2901,6 +3624,9 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         to_visit_current_.clear();
         to_visit_next_.clear();
         processed_.clear();
+        processed_bits_.Clear();
+        bottom_up_ = false;
+        current_depth_ = 0;
 
         const auto &vertex_value = frame[self_.input_symbol_];
         // it is possible that the vertex is Null due to optional matching
@@ -2952,7 +3678,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
           MG_ASSERT(curr_acc_path.has_value(), "Expected non-null accumulated path");
           frame_writer.Write(self_.filter_lambda_.accumulated_path_symbol.value(), std::move(curr_acc_path.value()));
         }
-        if (!context.hops_limit.IsLimitReached()) {
+        if (!current_level_expanded_ && !context.hops_limit.IsLimitReached()) {
           expand_from_vertex(curr_vertex);
         }
       }
@@ -2980,6 +3706,10 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     processed_.clear();
     to_visit_next_.clear();
     to_visit_current_.clear();
+    processed_bits_.Clear();
+    bottom_up_ = false;
+    current_depth_ = 0;
+    current_level_expanded_ = false;
   }
 
  private:
@@ -2998,6 +3728,13 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   // edge, vertex we have yet to visit, for current and next depth and their accumulated paths
   utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_next_;
   utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_current_;
+  // processed_ as a bitmap, filled in once the search first expands a level bottom-up
+  VertexBitmap processed_bits_;
+  bool bottom_up_{false};
+  VertexBitmap frontier_bits_;
+  // depth of the vertices in to_visit_current_, and whether the level after them was already expanded bottom-up
+  int64_t current_depth_{0};
+  bool current_level_expanded_{false};
 };
 
 namespace {
@@ -3290,12 +4027,7 @@ void ValidateWeightTypes(const TypedValue &lhs, const TypedValue &rhs) {
       "https://memgr.ph/wsp"));
 }
 
-TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::ExpansionLambda> &weight_lambda,
-                               const TypedValue &total_weight, ExpressionEvaluator &evaluator) {
-  if (!weight_lambda) {
-    return {};
-  }
-  TypedValue current_weight = weight_lambda->expression->Accept(evaluator);
+TypedValue AddWeight(const TypedValue &current_weight, const TypedValue &total_weight) {
   ValidateWeight(current_weight);
   if (total_weight.IsNull()) {
     return current_weight;
@@ -3305,6 +4037,61 @@ TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::Expans
   return current_weight + total_weight;
 }
 
+TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::ExpansionLambda> &weight_lambda,
+                               const TypedValue &total_weight, ExpressionEvaluator &evaluator) {
+  if (!weight_lambda) {
+    return {};
+  }
+  return AddWeight(weight_lambda->expression->Accept(evaluator), total_weight);
+}
+
+/// The property read by a weight lambda that is just a property of the expanded edge, like `(e, v | e.distance)`.
+std::optional<PropertyIx> EdgeWeightProperty(
+    const std::optional<memgraph::query::plan::ExpansionLambda> &weight_lambda) {
+  if (!weight_lambda || !weight_lambda->expression) return std::nullopt;
+  auto *lookup = utils::Downcast<PropertyLookup>(weight_lambda->expression);
+  if (!lookup || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY ||
+      lookup->property_path_.size() > 1) {
+    return std::nullopt;
+  }
+  auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+  if (!identifier || identifier->symbol_pos_ != weight_lambda->inner_edge_symbol.position()) return std::nullopt;
+  return lookup->property_;
+}
+
+/// Total weight of the path extended by `edge` to `vertex`. When the lambda only reads `edge_weight_property` of the
+/// edge, the property is read directly, without writing the lambda's symbols to the frame and evaluating it.
+TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::ExpansionLambda> &weight_lambda,
+                               const std::optional<PropertyIx> &edge_weight_property, const EdgeAccessor &edge,
+                               const VertexAccessor &vertex, const TypedValue &total_weight,
+                               ExpressionEvaluator &evaluator, FrameWriter &frame_writer) {
+  if (edge_weight_property) {
+    return AddWeight(TypedValue(evaluator.GetProperty(edge, *edge_weight_property),
+                                evaluator.GetNameIdMapper(),
+                                evaluator.GetMemoryResource()),
+                     total_weight);
+  }
+  frame_writer.Write(weight_lambda->inner_edge_symbol, edge);
+  frame_writer.Write(weight_lambda->inner_node_symbol, vertex);
+  return CalculateNextWeight(weight_lambda, total_weight, evaluator);
+}
+
+/// Whether `lhs` is a strictly lower weight than `rhs`. Null, the weight of a path without edges, is the lowest.
+bool IsLighter(const TypedValue &lhs, const TypedValue &rhs) {
+  if (rhs.IsNull()) return false;
+  if (lhs.IsNull()) return true;
+  ValidateWeightTypes(lhs, rhs);
+  return (lhs < rhs).ValueBool();
+}
+
+/// Sum of two (already validated) path weights, where null is the weight of a path without edges.
+TypedValue SumWeights(const TypedValue &lhs, const TypedValue &rhs) {
+  if (lhs.IsNull()) return rhs;
+  if (rhs.IsNull()) return lhs;
+  ValidateWeightTypes(lhs, rhs);
+  return lhs + rhs;
+}
+
 }  // namespace
 
 class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
@@ -3313,10 +4100,14 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
                                    metrics::DatabaseMetricHandles &metric_handles)
       : self_(self),
         input_cursor_(self_.input_->MakeCursor(mem, metric_handles)),
+        edge_weight_property_(EdgeWeightProperty(self_.weight_lambda_)),
+        bidirectional_(self_.common_.existing_node && !self_.filter_lambda_.expression && !self_.upper_bound_),
         total_cost_(mem),
         previous_(mem),
         yielded_vertices_(mem),
-        pq_(mem) {}
+        pq_(mem),
+        forward_(mem),
+        backward_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -3338,9 +4129,8 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
                                                                                 const VertexAccessor &vertex,
                                                                                 const TypedValue &total_weight,
                                                                                 int64_t depth) {
-      frame_writer.Write(self_.weight_lambda_->inner_edge_symbol, edge);
-      frame_writer.Write(self_.weight_lambda_->inner_node_symbol, vertex);
-      TypedValue next_weight = CalculateNextWeight(self_.weight_lambda_, total_weight, evaluator);
+      TypedValue next_weight = CalculateNextWeight(
+          self_.weight_lambda_, edge_weight_property_, edge, vertex, total_weight, evaluator, frame_writer);
 
       std::optional<Path> curr_acc_path = std::nullopt;
       if (self_.filter_lambda_.expression) {
@@ -3456,6 +4246,18 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         TypedValue current_weight =
             CalculateNextWeight(self_.weight_lambda_, /* total_weight */ TypedValue(), evaluator);
 
+        if (bidirectional_) {
+          if (ExpandBidirectional(vertex,
+                                  frame[self_.common_.node_symbol].ValueVertex(),
+                                  current_weight,
+                                  context,
+                                  evaluator,
+                                  frame_writer)) {
+            return true;
+          }
+          continue;
+        }
+
         // Clear existing data structures.
         previous_.clear();
         total_cost_.clear();
@@ -3482,8 +4284,14 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         previous_.emplace(current_state, current_edge);
         total_cost_.emplace(current_state, current_weight);
 
+        auto *pull_memory = context.evaluation_context.memory;
+        // The search for the path to an existing node ends at that node, so it isn't expanded
+        bool const reached_existing_node =
+            self_.common_.existing_node && !yielded_vertices_.contains(current_vertex) &&
+            (frame[self_.common_.node_symbol] == TypedValue(current_vertex, pull_memory)).ValueBool();
+
         // Expand only if what we've just expanded is less than max depth.
-        if (current_depth < upper_bound_) {
+        if (current_depth < upper_bound_ && !reached_existing_node) {
           if (self_.filter_lambda_.accumulated_path_symbol) {
             frame_writer.Write(self_.filter_lambda_.accumulated_path_symbol.value(), std::move(curr_acc_path.value()));
           }
@@ -3494,10 +4302,19 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         // don't return the path again.
         if (yielded_vertices_.contains(current_vertex)) continue;
 
+        // Place destination node on the frame, handle existence flag.
+        if (self_.common_.existing_node) {
+          if (!reached_existing_node) continue;
+          // Prevent expanding other paths, because we found the
+          // shortest to existing node.
+          ClearQueue();
+        } else {
+          frame_writer.Write(self_.common_.node_symbol, current_vertex);
+        }
+
         // Reconstruct the path.
         auto last_vertex = current_vertex;
         auto last_depth = current_depth;
-        auto *pull_memory = context.evaluation_context.memory;
         utils::pmr::vector<TypedValue> edge_list(pull_memory);
         while (true) {
           // Origin_vertex must be in previous.
@@ -3508,19 +4325,6 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
           edge_list.emplace_back(previous_edge.value());
         }
 
-        // Place destination node on the frame, handle existence flag.
-        if (self_.common_.existing_node) {
-          const auto &node = frame[self_.common_.node_symbol];
-          if ((node != TypedValue(current_vertex, pull_memory)).ValueBool()) {
-            continue;
-          }
-          // Prevent expanding other paths, because we found the
-          // shortest to existing node.
-          ClearQueue();
-        } else {
-          frame_writer.Write(self_.common_.node_symbol, current_vertex);
-        }
-
         if (!self_.is_reverse_) {
           // Place edges on the frame in the correct order.
           std::ranges::reverse(edge_list);
@@ -3541,6 +4345,8 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
     total_cost_.clear();
     yielded_vertices_.clear();
     ClearQueue();
+    forward_.Clear();
+    backward_.Clear();
   }
 
  private:
@@ -3551,6 +4357,12 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
   int64_t upper_bound_{-1};
   bool upper_bound_set_{false};
 
+  // Set when the weight lambda only reads this property of the expanded edge.
+  std::optional<PropertyIx> edge_weight_property_;
+
+  // Set when the destination is bound and only the weights decide the path, see ExpandBidirectional.
+  bool bidirectional_;
+
   struct WspStateHash {
     size_t operator()(const std::pair<VertexAccessor, int64_t> &key) const {
       return utils::HashCombine<VertexAccessor, int64_t>{}(key.first, key.second);
@@ -3597,6 +4409,164 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
   void ClearQueue() {
     while (!pq_.empty()) pq_.pop();
   }
+
+  class SearchQueueComparator {
+   public:
+    bool operator()(const std::pair<TypedValue, VertexAccessor> &lhs,
+                    const std::pair<TypedValue, VertexAccessor> &rhs) const {
+      return IsLighter(rhs.first, lhs.first);
+    }
+  };
+
+  // One direction of the bidirectional search: the lowest weight found to (or from) each vertex, the edge it was
+  // reached by, and the vertices whose weight is final.
+  struct SearchSide {
+    explicit SearchSide(utils::MemoryResource *mem) : cost(mem), previous(mem), settled(mem), queue(mem) {}
+
+    void Clear() {
+      cost.clear();
+      previous.clear();
+      settled.clear();
+      while (!queue.empty()) queue.pop();
+    }
+
+    utils::pmr::unordered_map<VertexAccessor, TypedValue> cost;
+    utils::pmr::unordered_map<VertexAccessor, EdgeAccessor> previous;
+    utils::pmr::unordered_set<VertexAccessor> settled;
+    std::priority_queue<std::pair<TypedValue, VertexAccessor>,
+                        utils::pmr::vector<std::pair<TypedValue, VertexAccessor>>,
+                        SearchQueueComparator>
+        queue;
+  };
+
+  SearchSide forward_;
+  SearchSide backward_;
+
+  // Finds the lowest weight path from `source` to the bound `target` with Dijkstra's search from both ends at once.
+  // Without a filter lambda or an upper bound only the weights decide the path, so it can just as well be walked
+  // backwards from the target. The search stops once the lightest queued vertices of both sides together weigh at
+  // least as much as the best path through a vertex reached from both, which on large graphs settles far fewer
+  // vertices than searching from the source until the target comes up.
+  bool ExpandBidirectional(const VertexAccessor &source, const VertexAccessor &target, const TypedValue &source_weight,
+                           ExecutionContext &context, ExpressionEvaluator &evaluator, FrameWriter &frame_writer) {
+    // Paths never end where they start
+    if (source == target) return false;
+
+    auto const can_read = [&context]([[maybe_unused]] const EdgeAccessor &edge,
+                                     [[maybe_unused]] const VertexAccessor &vertex) {
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(
+                vertex, storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        return false;
+      }
+#endif
+      return true;
+    };
+#ifdef MG_ENTERPRISE
+    // The search from the source only ends in the target if it may read it
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+        !context.auth_checker->Has(
+            target, storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ)) {
+      return false;
+    }
+#endif
+
+    forward_.Clear();
+    backward_.Clear();
+    // Every path starts with the weight of the source, so the search from the target starts from nothing
+    forward_.cost.emplace(source, source_weight);
+    forward_.queue.emplace(source_weight, source);
+    backward_.cost.emplace(target, TypedValue());
+    backward_.queue.emplace(TypedValue(), target);
+
+    std::optional<TypedValue> best_weight;
+    std::optional<VertexAccessor> meeting_vertex;
+
+    auto const settle_next = [&](bool forward) {
+      auto &side = forward ? forward_ : backward_;
+      auto const &other = forward ? backward_ : forward_;
+      auto [weight, vertex] = side.queue.top();
+      side.queue.pop();
+      if (!side.settled.insert(vertex).second) return;
+
+      auto const relax = [&](const EdgeAccessor &edge, const VertexAccessor &next) {
+        if (!can_read(edge, next)) return;
+        // The weight lambda sees the edge with the vertex the path arrives at when walked from the source
+        auto next_weight = CalculateNextWeight(self_.weight_lambda_,
+                                               edge_weight_property_,
+                                               edge,
+                                               forward ? next : vertex,
+                                               weight,
+                                               evaluator,
+                                               frame_writer);
+        auto found = side.cost.find(next);
+        if (found != side.cost.end() && !IsLighter(next_weight, found->second)) return;
+        if (auto other_cost = other.cost.find(next); other_cost != other.cost.end()) {
+          auto path_weight = SumWeights(next_weight, other_cost->second);
+          if (!best_weight || IsLighter(path_weight, *best_weight)) {
+            best_weight = std::move(path_weight);
+            meeting_vertex = next;
+          }
+        }
+        side.previous.insert_or_assign(next, edge);
+        side.queue.emplace(next_weight, next);
+        if (found == side.cost.end()) {
+          side.cost.emplace(next, std::move(next_weight));
+        } else {
+          found->second = std::move(next_weight);
+        }
+      };
+
+      // Walking back from the target crosses the edges against the pattern's direction
+      auto const direction = self_.common_.direction;
+      if (forward ? direction != EdgeAtom::Direction::IN : direction != EdgeAtom::Direction::OUT) {
+        auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+        for (const auto &edge : out_edges) relax(edge, edge.To());
+      }
+      if (forward ? direction != EdgeAtom::Direction::OUT : direction != EdgeAtom::Direction::IN) {
+        auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+        for (const auto &edge : in_edges) relax(edge, edge.From());
+      }
+    };
+
+    while (!forward_.queue.empty() && !backward_.queue.empty()) {
+      AbortCheck(context);
+      // A path not found yet weighs at least as much as the lightest queued vertices of both sides together
+      if (best_weight &&
+          !IsLighter(SumWeights(forward_.queue.top().first, backward_.queue.top().first), *best_weight)) {
+        break;
+      }
+      // Grow the side with the smaller frontier
+      settle_next(forward_.queue.size() <= backward_.queue.size());
+    }
+    if (!meeting_vertex) return false;
+
+    auto const other_end = [](const EdgeAccessor &edge, const VertexAccessor &vertex) {
+      return edge.From() == vertex ? edge.To() : edge.From();
+    };
+    utils::pmr::vector<TypedValue> edge_list(context.evaluation_context.memory);
+    for (auto vertex = *meeting_vertex;;) {
+      auto const found = forward_.previous.find(vertex);
+      if (found == forward_.previous.end()) break;
+      edge_list.emplace_back(found->second);
+      vertex = other_end(found->second, vertex);
+    }
+    std::ranges::reverse(edge_list);
+    for (auto vertex = *meeting_vertex;;) {
+      auto const found = backward_.previous.find(vertex);
+      if (found == backward_.previous.end()) break;
+      edge_list.emplace_back(found->second);
+      vertex = other_end(found->second, vertex);
+    }
+
+    // The edges go from the source to the target
+    if (self_.is_reverse_) std::ranges::reverse(edge_list);
+    frame_writer.Write(self_.common_.edge_symbol, std::move(edge_list));
+    frame_writer.Write(self_.total_weight_.value(), *std::move(best_weight));
+    return true;
+  }
 };
 
 namespace {
@@ -3622,6 +4592,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
                                metrics::DatabaseMetricHandles &metric_handles)
       : self_(self),
         input_cursor_(self_.input_->MakeCursor(mem, metric_handles)),
+        edge_weight_property_(EdgeWeightProperty(self_.weight_lambda_)),
         cheapest_cost_(mem),
         visited_cost_(mem),
         total_cost_(mem),
@@ -3653,9 +4624,8 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       auto const &next_vertex = direction == EdgeAtom::Direction::IN ? edge.From() : edge.To();
 
       // Evaluate current weight
-      frame_writer.Write(self_.weight_lambda_->inner_edge_symbol, edge);
-      frame_writer.Write(self_.weight_lambda_->inner_node_symbol, next_vertex);
-      TypedValue next_weight = CalculateNextWeight(self_.weight_lambda_, total_weight, evaluator);
+      TypedValue next_weight = CalculateNextWeight(
+          self_.weight_lambda_, edge_weight_property_, edge, next_vertex, total_weight, evaluator, frame_writer);
 
       // If filter expression exists, evaluate filter
       std::optional<Path> curr_acc_path = std::nullopt;
@@ -3828,11 +4798,24 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       return true;
     };
 
-    auto create_DFS_traversal_tree = [this, &context, &memory, &frame_writer, &create_state, &expand_from_vertex]() {
+    // `sink` is the existing node the paths have to end in, unless it's the start vertex
+    auto create_DFS_traversal_tree = [this, &context, &memory, &frame_writer, &create_state, &expand_from_vertex](
+                                         const VertexAccessor *sink) {
       while (!pq_.empty()) {
         AbortCheck(context);
 
         auto [current_weight, current_depth, current_vertex, directed_edge, acc_path] = pq_.top();
+
+        // Only the cheapest paths to an existing node are returned. Weights aren't negative, so once the queue holds
+        // nothing as cheap as what already reaches that node, the rest of it can't lead to one of those paths.
+        if (sink && !current_weight.IsNull()) {
+          auto sink_cost = cheapest_cost_.find(*sink);
+          if (sink_cost != cheapest_cost_.end() && !sink_cost->second.IsNull() &&
+              (current_weight > sink_cost->second).ValueBool() && !are_equal(current_weight, sink_cost->second)) {
+            ClearQueue();
+            break;
+          }
+        }
         pq_.pop();
 
         const auto &[current_edge, direction, weight] = directed_edge;
@@ -3939,7 +4922,10 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       }
 
       // Create a DFS traversal tree from the start node
-      create_DFS_traversal_tree();
+      const auto &existing_node = frame[self_.common_.node_symbol];
+      bool const has_sink = self_.common_.existing_node && start_vertex && existing_node.IsVertex() &&
+                            existing_node.ValueVertex() != *start_vertex;
+      create_DFS_traversal_tree(has_sink ? &existing_node.ValueVertex() : nullptr);
 
       // DFS traversal tree is create,
       if (start_vertex && next_edges_.contains({*start_vertex, 0})) {
@@ -3969,6 +4955,9 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
   int64_t upper_bound_{-1};
   bool upper_bound_set_{false};
 
+  // Set when the weight lambda only reads this property of the expanded edge.
+  std::optional<PropertyIx> edge_weight_property_;
+
   struct AspStateHash {
     size_t operator()(const std::pair<VertexAccessor, int64_t> &key) const {
       return utils::HashCombine<VertexAccessor, int64_t>{}(key.first, key.second);
@@ -5028,7 +6017,20 @@ Filter::FilterCursor::FilterCursor(const Filter &self, utils::MemoryResource *me
                                    metrics::DatabaseMetricHandles &metric_handles)
     : self_(self),
       input_cursor_(self_.input_->MakeCursor(mem, metric_handles)),
-      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem, metric_handles)) {}
+      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem, metric_handles)),
+      compiled_operands_(mem) {}
+
+bool Filter::FilterCursor::EvaluateExpression(ExpressionEvaluator &evaluator, Frame &frame,
+                                              ExecutionContext &context) {
+  if (self_.compiled_expression_) {
+    if (!compiled_operands_bound_) {
+      self_.compiled_expression_->BindOperands(context.evaluation_context, &compiled_operands_);
+      compiled_operands_bound_ = true;
+    }
+    if (auto result = self_.compiled_expression_->Evaluate(frame, evaluator, compiled_operands_)) return *result;
+  }
+  return EvaluateFilter(evaluator, self_.expression_);
+}
 
 bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
@@ -5045,7 +6047,26 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
-    if (EvaluateFilter(evaluator, self_.expression_)) return true;
+    if (EvaluateExpression(evaluator, frame, context)) return true;
+  }
+  return false;
+}
+
+bool Filter::FilterCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+
+  while (input_cursor_->PullBatch(frame, batch, context)) {
+    AbortCheck(context);
+    batch.Retain([&](size_t row) {
+      FrameBatch::RowScope const scope{batch, row, frame, context.frame_change_collector};
+      for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
+        pattern_filter_cursor->Pull(frame, context);
+      }
+      ExpressionEvaluator evaluator{
+          &frame, context, storage::View::OLD, context.frame_change_collector, &context.number_of_hops};
+      return EvaluateExpression(evaluator, frame, context);
+    });
+    if (!batch.empty()) return true;
   }
   return false;
 }
@@ -5168,15 +6189,41 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
     // Produce should always yield the latest results.
     ExpressionEvaluator evaluator{
         &frame, context, storage::View::NEW, context.frame_change_collector, &context.number_of_hops};
-
-    for (auto *named_expr : self_.named_expressions_) {
-      named_expr->Accept(evaluator);
-    }
+    Project(evaluator, frame, context);
     return true;
   }
   return false;
 }
 
+bool Produce::ProduceCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+
+  if (!input_cursor_->PullBatch(frame, batch, context)) return false;
+  AbortCheck(context);
+
+  // The produced values have to stay with their rows, not on the shared frame
+  for (auto *named_expr : self_.named_expressions_) {
+    batch.Column(context.symbol_table.at(*named_expr));
+  }
+  for (size_t row = 0; row < batch.size(); ++row) {
+    FrameBatch::RowScope const scope{batch, row, frame, context.frame_change_collector};
+    ExpressionEvaluator evaluator{
+        &frame, context, storage::View::NEW, context.frame_change_collector, &context.number_of_hops};
+    Project(evaluator, frame, context);
+  }
+  return true;
+}
+
+void Produce::ProduceCursor::Project(ExpressionEvaluator &evaluator, Frame &frame, ExecutionContext &context) {
+  if (self_.compiled_projection_ &&
+      self_.compiled_projection_->Project(frame, evaluator, context.frame_change_collector)) {
+    return;
+  }
+  for (auto *named_expr : self_.named_expressions_) {
+    named_expr->Accept(evaluator);
+  }
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
@@ -6792,7 +7839,10 @@ class AggregateCursor : public Cursor {
         return true;
       }
     }
-    if (aggregation_it_ == aggregation_.end()) return false;
+    // Groups spilled to disk follow the ones kept in memory, a partition at a time
+    while (aggregation_it_ == aggregation_.end()) {
+      if (!ProcessSpilledPartition(&context)) return false;
+    }
     // place aggregation values on the frame
     size_t pos = 0;
     for (const auto &aggregation_elem : self_.aggregations_)
@@ -6812,6 +7862,8 @@ class AggregateCursor : public Cursor {
     aggregation_.clear();
     aggregation_it_ = aggregation_.begin();
     pulled_all_input_ = false;
+    partitions_.clear();
+    spilled_partition_ = 0;
   }
 
  private:
@@ -6969,6 +8021,9 @@ class AggregateCursor : public Cursor {
   // this LogicalOp pulls all from the input on it's first pull
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
+  // rows of the groups created after the query got close to its memory limit, split by the hash of their group
+  std::vector<std::unique_ptr<SpillFile>> partitions_;
+  size_t spilled_partition_{0};
   DbAccessor *db_accessor_{nullptr};
   FineGrainedAuthChecker const *auth_checker_{nullptr};
 
@@ -6980,13 +8035,65 @@ class AggregateCursor : public Cursor {
         ExpressionEvaluator{frame, *context, storage::View::NEW, nullptr, &context->number_of_hops};
 
     bool pulled = false;
-    while (input_cursor_->Pull(*frame, *context)) {
-      ProcessOne(*frame, &evaluator);
-      pulled = true;
+    if (!context->is_profile_query) {
+      FrameBatch batch{aggregation_.get_allocator().resource()};
+      while (input_cursor_->PullBatch(*frame, batch, *context)) {
+        for (size_t row = 0; row < batch.size(); ++row) {
+          FrameBatch::RowScope const scope{batch, row, *frame, context->frame_change_collector};
+          ProcessOne(*frame, &evaluator, context);
+        }
+        pulled = true;
+      }
+    } else {
+      while (input_cursor_->Pull(*frame, *context)) {
+        ProcessOne(*frame, &evaluator, context);
+        pulled = true;
+      }
     }
     if (!pulled) return false;
 
-    // post processing
+    for (auto &partition : partitions_) RecordSpill(*context, partition->FinishWriting());
+    PostProcess(context);
+    return true;
+  }
+
+  /// Aggregates the next partition of spilled groups, false once there are none left.
+  bool ProcessSpilledPartition(ExecutionContext *context) {
+    if (spilled_partition_ == partitions_.size()) {
+      partitions_.clear();
+      spilled_partition_ = 0;
+      return false;
+    }
+    aggregation_.clear();
+
+    auto *mem = aggregation_.get_allocator().resource();
+    auto const num_group_by = self_.group_by_.size();
+    auto const remember_begin = num_group_by + (2 * self_.aggregations_.size());
+    utils::pmr::vector<TypedValue> row(mem);
+    auto &partition = partitions_[spilled_partition_++];
+    while (partition->Read(&row, context->db_accessor)) {
+      AbortCheck(*context);
+      reused_group_by_.assign(std::make_move_iterator(row.begin()),
+                              std::make_move_iterator(row.begin() + static_cast<ptrdiff_t>(num_group_by)));
+      auto res = aggregation_.try_emplace(reused_group_by_, mem, self_.aggregations_.size(), self_.remember_.size());
+      auto &agg_value = res.first->second;
+      if (res.second) {
+        EnsureInitialized([&](size_t i) -> const TypedValue & { return row[remember_begin + i]; }, &agg_value);
+      }
+      Update(
+          [&](size_t pos, Expression *expression) {
+            auto const arg = num_group_by + (2 * pos) + (expression == self_.aggregations_[pos].arg1 ? 0 : 1);
+            return std::move(row[arg]);
+          },
+          &agg_value);
+    }
+    partition.reset();
+    PostProcess(context);
+    aggregation_it_ = aggregation_.begin();
+    return true;
+  }
+
+  void PostProcess(ExecutionContext *context) {
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
       switch (self_.aggregations_[pos].op) {
         case Aggregation::Op::AVG: {
@@ -7020,13 +8127,12 @@ class AggregateCursor : public Cursor {
           break;
       }
     }
-    return true;
   }
 
   /**
    * Performs a single accumulation.
    */
-  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator, ExecutionContext *context) {
     // Preallocated group_by, since most of the time the aggregation key won't be unique
     reused_group_by_.clear();
     evaluator->ResetPropertyLookupCache();
@@ -7036,18 +8142,53 @@ class AggregateCursor : public Cursor {
     for (Expression *expression : self_.group_by_) {
       reused_group_by_.emplace_back(expression->Accept(*evaluator));
     }
+    auto const evaluate = [evaluator](size_t /*pos*/, Expression *expression) {
+      return expression->Accept(*evaluator);
+    };
+    if (!partitions_.empty()) {
+      // Past the memory limit only the groups already in memory are updated, new ones are aggregated later
+      if (auto it = aggregation_.find(reused_group_by_); it != aggregation_.end()) {
+        Update(evaluate, &it->second);
+      } else {
+        SpillOne(frame, evaluator);
+      }
+      return;
+    }
     auto *mem = aggregation_.get_allocator().resource();
     auto res = aggregation_.try_emplace(reused_group_by_, mem, self_.aggregations_.size(), self_.remember_.size());
     auto &agg_value = res.first->second;
-    if (res.second /*was newly inserted*/) EnsureInitialized(frame, &agg_value);
-    Update(evaluator, &agg_value);
+    if (res.second /*was newly inserted*/) {
+      EnsureInitialized([&](size_t i) -> const TypedValue & { return frame[self_.remember_[i]]; }, &agg_value);
+    }
+    Update(evaluate, &agg_value);
+    if (res.second && !self_.group_by_.empty() && ShouldSpill(*context)) {
+      partitions_.reserve(kSpillPartitions);
+      for (size_t i = 0; i < kSpillPartitions; ++i) partitions_.push_back(std::make_unique<SpillFile>());
+    }
+  }
+
+  /// Writes the group-by key of a row, the aggregation arguments and the remembered values to the partition of its
+  /// group. An aggregation without an argument, and the second argument of one whose first is Null, is written as
+  /// Null.
+  void SpillOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+    auto const partition = SpillPartition(aggregation_.hash_function()(reused_group_by_));
+    auto *mem = aggregation_.get_allocator().resource();
+    for (const auto &agg_elem : self_.aggregations_) {
+      auto arg1 = agg_elem.arg1 ? agg_elem.arg1->Accept(*evaluator) : TypedValue(mem);
+      auto arg2 = agg_elem.arg2 && !arg1.IsNull() ? agg_elem.arg2->Accept(*evaluator) : TypedValue(mem);
+      reused_group_by_.emplace_back(std::move(arg1));
+      reused_group_by_.emplace_back(std::move(arg2));
+    }
+    for (const Symbol &remember_sym : self_.remember_) reused_group_by_.emplace_back(frame[remember_sym]);
+    partitions_[partition]->Write(reused_group_by_);
   }
 
   /** Ensures the new AggregationValue has been initialized. This means
    * that the value vectors are filled with an appropriate number of Nulls,
    * counts are set to 0 and remember values are remembered.
    */
-  void EnsureInitialized(const Frame &frame, CompactAggregationValue *agg_value) const {
+  template <typename TRemembered>
+  void EnsureInitialized(TRemembered &&remembered, CompactAggregationValue *agg_value) const {
     if (agg_value->initialized_) return;
     agg_value->initialized_ = true;
     auto *mem = agg_value->mem_resource_;
@@ -7058,16 +8199,16 @@ class AggregateCursor : public Cursor {
     }
     // counts_ are already 0 from constructor
     // Populate Remembered values
-    size_t rem_idx = 0;
-    for (const Symbol &remember_sym : self_.remember_) {
-      // Copy value from frame
-      agg_value->remember_[rem_idx++] = frame[remember_sym];
+    for (size_t rem_idx = 0; rem_idx < self_.remember_.size(); ++rem_idx) {
+      agg_value->remember_[rem_idx] = remembered(rem_idx);
     }
   }
 
   /** Updates the given AggregationValue with new data. Assumes that
-   * the AggregationValue has been initialized */
-  void Update(ExpressionEvaluator *evaluator, AggregateCursor::CompactAggregationValue *agg_value) {
+   * the AggregationValue has been initialized. `arg(pos, expression)`
+   * gives the value of an argument of the aggregation at `pos`. */
+  template <typename TArg>
+  void Update(TArg &&arg, AggregateCursor::CompactAggregationValue *agg_value) {
     DMG_ASSERT(self_.aggregations_.size() == agg_value->num_aggs_,
                "Expected as much AggregationValue.values_ as there are "
                "aggregations.");
@@ -7083,7 +8224,7 @@ class AggregateCursor : public Cursor {
         continue;
       }
 
-      TypedValue input_value = input_expr_ptr->Accept(*evaluator);
+      TypedValue input_value = arg(pos, input_expr_ptr);
 
       // Aggregations skip Null input values.
       if (input_value.IsNull()) continue;
@@ -7120,18 +8261,18 @@ class AggregateCursor : public Cursor {
             break;
           }
           case Aggregation::Op::PROJECT_LISTS: {
-            ProjectList(input_value, agg_elem.arg2->Accept(*evaluator), agg_value->values_[pos].ValueGraph());
+            ProjectList(input_value, arg(pos, agg_elem.arg2), agg_value->values_[pos].ValueGraph());
             break;
           }
           case Aggregation::Op::DERIVE: {
             ProjectPathWithOptions(input_value,
-                                   agg_elem.arg2->Accept(*evaluator),
+                                   arg(pos, agg_elem.arg2),
                                    agg_value->values_[pos].ValueVirtualGraph(),
                                    agg_value->derive_dedup_[pos]);
             break;
           }
           case Aggregation::Op::COLLECT_MAP:
-            auto key = agg_elem.arg2->Accept(*evaluator);
+            auto key = arg(pos, agg_elem.arg2);
             if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
             agg_value->values_[pos].ValueMap().emplace(key.ValueString(), std::move(input_value));
             break;
@@ -7187,18 +8328,18 @@ class AggregateCursor : public Cursor {
         }
 
         case Aggregation::Op::PROJECT_LISTS: {
-          ProjectList(input_value, agg_elem.arg2->Accept(*evaluator), agg_value->values_[pos].ValueGraph());
+          ProjectList(input_value, arg(pos, agg_elem.arg2), agg_value->values_[pos].ValueGraph());
           break;
         }
         case Aggregation::Op::DERIVE: {
           ProjectPathWithOptions(input_value,
-                                 agg_elem.arg2->Accept(*evaluator),
+                                 arg(pos, agg_elem.arg2),
                                  agg_value->values_[pos].ValueVirtualGraph(),
                                  agg_value->derive_dedup_[pos]);
           break;
         }
         case Aggregation::Op::COLLECT_MAP:
-          auto key = agg_elem.arg2->Accept(*evaluator);
+          auto key = arg(pos, agg_elem.arg2);
           if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
           agg_value->values_[pos].ValueMap().emplace(key.ValueString(), std::move(input_value));
           break;
@@ -7495,13 +8636,25 @@ class OrderByCursor : public Cursor {
       utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by(query_mem);  // Cached for parallel merge
       utils::pmr::vector<utils::pmr::vector<TypedValue>> output(query_mem);    // Cached, query memory
 
-      while (input_cursor_->Pull(frame, context)) {
+      // With a bound, order_by and output form a max-heap holding the best `top_k` rows seen so far, its top being
+      // the row the next better one evicts
+      auto const top_k = TopK(evaluator);
+      auto const cmp = self_.compare_.lex_cmp();
+      auto const proj = [](auto const &value) -> auto const & { return std::get<0>(value); };
+
+      auto const collect = [&] {
         // collect the order_by elements
         utils::pmr::vector<TypedValue> order_by_elem(query_mem);
         order_by_elem.reserve(self_.order_by_.size());
         for (auto const &expression_ptr : self_.order_by_) {
           order_by_elem.emplace_back(expression_ptr->Accept(evaluator));
         }
+        if (top_k && order_by.size() == *top_k) {
+          if (*top_k == 0 || !cmp(order_by_elem, order_by.front())) return;
+          ranges::pop_heap(rv::zip(order_by, output), cmp, proj);
+          order_by.pop_back();
+          output.pop_back();
+        }
         order_by.emplace_back(std::move(order_by_elem));
 
         // collect the output elements
@@ -7511,14 +8664,42 @@ class OrderByCursor : public Cursor {
           output_elem.emplace_back(frame[output_sym]);
         }
         output.emplace_back(std::move(output_elem));
+        if (top_k) {
+          ranges::push_heap(rv::zip(order_by, output), cmp, proj);
+        } else if (!parallel_execution_ &&
+                   (spill_run_rows_ == 0 ? ShouldSpill(context) : order_by.size() >= spill_run_rows_)) {
+          SpillRun(order_by, output, context);
+        }
+      };
+
+      if (!context.is_profile_query) {
+        FrameBatch batch{query_mem};
+        while (input_cursor_->PullBatch(frame, batch, context)) {
+          for (size_t row = 0; row < batch.size(); ++row) {
+            FrameBatch::RowScope const scope{batch, row, frame, context.frame_change_collector};
+            collect();
+          }
+        }
+      } else {
+        while (input_cursor_->Pull(frame, context)) collect();
+      }
+
+      if (!runs_.empty()) {
+        // The input didn't fit in memory, the rows come out of merging the sorted runs
+        if (!order_by.empty()) SpillRun(order_by, output, context);
+        StartMerge(context.db_accessor);
+        did_pull_all_ = true;
+        return PullMerged(frame, context);
       }
 
       // sorting with range zip
       // we compare on just the projection of the 1st range (order_by)
       // this will also permute the 2nd range (output)
-      ranges::sort(rv::zip(order_by, output), self_.compare_.lex_cmp(), [](auto const &value) -> auto const & {
-        return std::get<0>(value);
-      });
+      if (top_k) {
+        ranges::sort_heap(rv::zip(order_by, output), cmp, proj);
+      } else {
+        ranges::sort(rv::zip(order_by, output), cmp, proj);
+      }
 
       // Keep order_by for parallel merge only (saves memory in single-threaded mode)
       if (parallel_execution_) {
@@ -7531,6 +8712,8 @@ class OrderByCursor : public Cursor {
       order_by_cache_it_ = order_by_cache_.begin();
     }
 
+    if (!runs_.empty()) return PullMerged(frame, context);
+
     if (cache_it_ == cache_.end()) return false;
 
     AbortCheck(context);
@@ -7562,9 +8745,123 @@ class OrderByCursor : public Cursor {
       order_by_cache_.clear();
       order_by_cache_it_ = order_by_cache_.begin();
     }
+    merge_heap_.clear();
+    runs_.clear();
+    spill_run_rows_ = 0;
   }
 
  private:
+  // At most this many runs are merged at once, each one holding a read buffer; more get merged into one run first
+  static constexpr size_t kMaxMergedRuns = 16;
+
+  // A sorted run of rows moved to disk, with the next row to be merged out of it
+  struct SpilledRun {
+    std::unique_ptr<SpillFile> file;
+    utils::pmr::vector<TypedValue> order_by;
+    utils::pmr::vector<TypedValue> output;
+  };
+
+  /// Sorts the collected rows and moves them to disk. The first run is cut when the query gets close to its memory
+  /// limit, every later one at the same number of rows.
+  void SpillRun(utils::pmr::vector<utils::pmr::vector<TypedValue>> &order_by,
+                utils::pmr::vector<utils::pmr::vector<TypedValue>> &output, ExecutionContext &context) {
+    ranges::sort(rv::zip(order_by, output), self_.compare_.lex_cmp(), [](auto const &value) -> auto const & {
+      return std::get<0>(value);
+    });
+    auto file = std::make_unique<SpillFile>();
+    for (auto const &[order_by_elem, output_elem] : rv::zip(order_by, output)) {
+      file->Write(order_by_elem);
+      file->Write(output_elem);
+    }
+    RecordSpill(context, file->FinishWriting());
+    if (spill_run_rows_ == 0) spill_run_rows_ = order_by.size();
+    order_by.clear();
+    output.clear();
+
+    AddRun(std::move(file));
+    if (runs_.size() < kMaxMergedRuns) return;
+
+    auto merged = std::make_unique<SpillFile>();
+    StartMerge(context.db_accessor);
+    while (!merge_heap_.empty()) {
+      auto &run = PopMerged();
+      merged->Write(run.order_by);
+      merged->Write(run.output);
+      RefillMerged(run, context.db_accessor);
+    }
+    RecordSpill(context, merged->FinishWriting());
+    runs_.clear();
+    AddRun(std::move(merged));
+  }
+
+  void AddRun(std::unique_ptr<SpillFile> file) {
+    auto *mem = cache_.get_allocator().resource();
+    runs_.push_back(SpilledRun{.file = std::move(file),
+                               .order_by = utils::pmr::vector<TypedValue>(mem),
+                               .output = utils::pmr::vector<TypedValue>(mem)});
+  }
+
+  /// Reads the first row of every run and orders the runs by it in merge_heap_.
+  void StartMerge(DbAccessor *dba) {
+    merge_heap_.clear();
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      if (runs_[i].file->Read(&runs_[i].order_by, dba) && runs_[i].file->Read(&runs_[i].output, dba)) {
+        merge_heap_.push_back(i);
+        std::ranges::push_heap(merge_heap_, MergeOrder());
+      }
+    }
+  }
+
+  /// The run whose next row comes first. It is taken out of merge_heap_ until RefillMerged.
+  SpilledRun &PopMerged() {
+    std::ranges::pop_heap(merge_heap_, MergeOrder());
+    return runs_[merge_heap_.back()];
+  }
+
+  void RefillMerged(SpilledRun &run, DbAccessor *dba) {
+    if (run.file->Read(&run.order_by, dba) && run.file->Read(&run.output, dba)) {
+      std::ranges::push_heap(merge_heap_, MergeOrder());
+    } else {
+      merge_heap_.pop_back();
+    }
+  }
+
+  // Heap order putting the run with the smallest next row on top
+  auto MergeOrder() const {
+    return [this, cmp = self_.compare_.lex_cmp()](size_t lhs, size_t rhs) {
+      return cmp(runs_[rhs].order_by, runs_[lhs].order_by);
+    };
+  }
+
+  bool PullMerged(Frame &frame, ExecutionContext &context) {
+    if (merge_heap_.empty()) return false;
+    AbortCheck(context);
+    auto &run = PopMerged();
+    auto output_sym_it = self_.output_symbols_.begin();
+    auto frame_writer = frame.GetFrameWriter(context.frame_change_collector, context.evaluation_context.memory);
+    for (auto &&output : run.output) {
+      frame_writer.Write(*output_sym_it++, std::move(output));
+    }
+    RefillMerged(run, context.db_accessor);
+    return true;
+  }
+
+  /// Number of rows the Limit and Skip above can pull, if RewriteTopK bounded this operator. Invalid bounds are left
+  /// for Limit and Skip to report.
+  std::optional<size_t> TopK(ExpressionEvaluator &evaluator) const {
+    if (!self_.limit_) return std::nullopt;
+    auto const limit = self_.limit_->Accept(evaluator);
+    if (limit.type() != TypedValue::Type::Int || limit.ValueInt() < 0) return std::nullopt;
+    int64_t skip = 0;
+    if (self_.skip_) {
+      auto const value = self_.skip_->Accept(evaluator);
+      if (value.type() != TypedValue::Type::Int || value.ValueInt() < 0) return std::nullopt;
+      skip = value.ValueInt();
+    }
+    if (limit.ValueInt() > std::numeric_limits<int64_t>::max() - skip) return std::nullopt;
+    return static_cast<size_t>(skip + limit.ValueInt());
+  }
+
   const OrderBy &self_;
   const UniqueCursorPtr input_cursor_;
   bool did_pull_all_{false};
@@ -7577,6 +8874,12 @@ class OrderByCursor : public Cursor {
   // Cache of order_by values for parallel merge (kept after sorting; only used when parallel_execution_)
   utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by_cache_;
   decltype(order_by_cache_.begin()) order_by_cache_it_ = order_by_cache_.begin();
+  // Sorted runs the input was spilled to, if it didn't fit under the query memory limit
+  std::vector<SpilledRun> runs_;
+  // Indices of the runs with rows left to merge, see MergeOrder
+  std::vector<size_t> merge_heap_;
+  // Number of rows per spilled run, 0 until the first one
+  size_t spill_run_rows_{0};
 };
 
 UniqueCursorPtr OrderBy::MakeCursor(utils::MemoryResource *mem, metrics::DatabaseMetricHandles &metric_handles) const {
@@ -7595,6 +8898,8 @@ std::unique_ptr<LogicalOperator> OrderBy::Clone(AstStorage *storage) const {
   }
   object->output_symbols_ = output_symbols_;
   object->parallel_execution_ = parallel_execution_;
+  object->limit_ = limit_ ? limit_->Clone(storage) : nullptr;
+  object->skip_ = skip_ ? skip_->Clone(storage) : nullptr;
   return object;
 }
 
@@ -7883,10 +9188,16 @@ class DistinctCursor : public Cursor {
 
     AbortCheck(context);
 
+    if (spilled_input_) return PullSpilled(frame, context);
+
     while (true) {
       if (!input_cursor_->Pull(frame, context)) {
         seen_rows_.clear();
-        return false;
+        if (partitions_.empty()) return false;
+        // Rows that weren't seen before the spill come out of the partitions, each one deduplicated on its own
+        for (auto &partition : partitions_) RecordSpill(context, partition->FinishWriting());
+        spilled_input_ = true;
+        return PullSpilled(frame, context);
       }
 
       utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().resource());
@@ -7896,7 +9207,17 @@ class DistinctCursor : public Cursor {
         row.emplace_back(frame.at(symbol));
       }
 
+      if (!partitions_.empty()) {
+        // Past the memory limit only rows seen before are let through right away, the rest are deferred
+        if (!seen_rows_.contains(row)) partitions_[SpillPartition(seen_rows_.hash_function()(row))]->Write(row);
+        continue;
+      }
+
       if (seen_rows_.insert(std::move(row)).second) {
+        if (ShouldSpill(context)) {
+          partitions_.reserve(kSpillPartitions);
+          for (size_t i = 0; i < kSpillPartitions; ++i) partitions_.push_back(std::make_unique<SpillFile>());
+        }
         return true;
       }
     }
@@ -7907,15 +9228,42 @@ class DistinctCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     seen_rows_.clear();
+    partitions_.clear();
+    spilled_input_ = false;
+    spilled_partition_ = 0;
+  }
+
+ private:
+  bool PullSpilled(Frame &frame, ExecutionContext &context) {
+    utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().resource());
+    while (spilled_partition_ < partitions_.size()) {
+      AbortCheck(context);
+      if (!partitions_[spilled_partition_]->Read(&row, context.db_accessor)) {
+        seen_rows_.clear();
+        partitions_[spilled_partition_++].reset();
+        continue;
+      }
+      auto [it, inserted] = seen_rows_.insert(std::move(row));
+      if (!inserted) continue;
+      auto frame_writer = frame.GetFrameWriter(context.frame_change_collector, context.evaluation_context.memory);
+      for (size_t i = 0; i < self_.value_symbols_.size(); ++i) {
+        frame_writer.Write(self_.value_symbols_[i], (*it)[i]);
+      }
+      return true;
+    }
+    return false;
   }
 
- private:
   const Distinct &self_;
   const UniqueCursorPtr input_cursor_;
   utils::pmr::unordered_set<utils::pmr::vector<TypedValue>,
                             utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
                             TypedValueVectorEqual>
       seen_rows_;
+  // Rows not seen before the query got close to its memory limit, split by their hash
+  std::vector<std::unique_ptr<SpillFile>> partitions_;
+  bool spilled_input_{false};
+  size_t spilled_partition_{0};
 };
 
 #ifdef MG_ENTERPRISE
@@ -9482,12 +10830,15 @@ namespace {
 
 class HashJoinCursor : public Cursor {
  public:
-  HashJoinCursor(const HashJoin &self, utils::MemoryResource *mem, metrics::DatabaseMetricHandles &metric_handles)
+  HashJoinCursor(const HashJoin &self, utils::MemoryResource *mem, metrics::DatabaseMetricHandles &metric_handles,
+                 std::shared_ptr<SharedHashJoinState> shared_state = nullptr)
       : self_(self),
         left_op_cursor_(self.left_op_->MakeCursor(mem, metric_handles)),
         right_op_cursor_(self_.right_op_->MakeCursor(mem, metric_handles)),
+        shared_state_(std::move(shared_state)),
         hashtable_(mem),
-        right_op_frame_(mem) {
+        right_op_frame_(mem),
+        spilled_row_(mem) {
     MG_ASSERT(left_op_cursor_ != nullptr, "HashJoinCursor: Missing left operator cursor.");
     MG_ASSERT(right_op_cursor_ != nullptr, "HashJoinCursor: Missing right operator cursor.");
   }
@@ -9498,12 +10849,16 @@ class HashJoinCursor : public Cursor {
     AbortCheck(context);
 
     if (!hash_join_initialized_) {
-      InitializeHashJoin(frame, context);
+      if (shared_state_) {
+        shared_state_->Build(*left_op_cursor_, frame, context, self_.hash_join_condition_->expression1_);
+      } else {
+        InitializeHashJoin(frame, context);
+      }
       hash_join_initialized_ = true;
     }
 
     // If left_op yielded zero results, there is no cartesian product.
-    if (hashtable_.empty()) {
+    if (shared_state_ ? shared_state_->Empty() : (hashtable_.empty() && left_partitions_.empty())) {
       return false;
     }
 
@@ -9517,20 +10872,16 @@ class HashJoinCursor : public Cursor {
     if (!common_value_found_) {
       // Pull from the right_op until there's a mergeable frame
       while (true) {
-        auto pulled = right_op_cursor_->Pull(frame, context);
-        if (!pulled) return false;
+        TypedValue right_value;
+        if (!PullRight(frame, context, &right_value)) return false;
 
         // Check if the join value from the pulled frame is shared with any left frames
-        ExpressionEvaluator evaluator =
-            ExpressionEvaluator{&frame, context, storage::View::OLD, nullptr, &context.number_of_hops};
-
-        auto right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
-        if (hashtable_.contains(right_value)) {
+        if (const auto *left_frames = FindLeftFrames(right_value)) {
           // If so, finish pulling for now and proceed to joining the pulled frame
           right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
           common_value_found_ = true;
-          common_value = right_value;
-          left_op_frame_it_ = hashtable_[common_value].begin();
+          left_frames_ = left_frames;
+          left_op_frame_it_ = left_frames_->begin();
           break;
         }
       }
@@ -9544,7 +10895,7 @@ class HashJoinCursor : public Cursor {
     left_op_frame_it_++;
     // When all left frames with the common value have been joined, move on to pulling and joining the next right
     // frame
-    if (common_value_found_ && left_op_frame_it_ == hashtable_[common_value].end()) {
+    if (common_value_found_ && left_op_frame_it_ == left_frames_->end()) {
       common_value_found_ = false;
     }
 
@@ -9560,10 +10911,16 @@ class HashJoinCursor : public Cursor {
     left_op_cursor_->Reset();
     right_op_cursor_->Reset();
     hashtable_.clear();
+    if (shared_state_ && hash_join_initialized_) shared_state_->Release();
     right_op_frame_.clear();
+    left_frames_ = nullptr;
     left_op_frame_it_ = {};
     hash_join_initialized_ = false;
     common_value_found_ = false;
+    left_partitions_.clear();
+    right_partitions_.clear();
+    spilled_partition_ = 0;
+    partition_loaded_ = false;
   }
 
  private:
@@ -9574,28 +10931,135 @@ class HashJoinCursor : public Cursor {
           ExpressionEvaluator{&frame, context, storage::View::OLD, nullptr, &context.number_of_hops};
 
       auto left_value = self_.hash_join_condition_->expression1_->Accept(evaluator);
-      if (left_value.type() != TypedValue::Type::Null) {
-        hashtable_[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+      if (left_value.type() == TypedValue::Type::Null) continue;
+      if (!left_partitions_.empty()) {
+        SpillRow(left_partitions_, std::move(left_value), self_.left_symbols_, frame.elems());
+        continue;
+      }
+      hashtable_[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+      if (ShouldSpill(context)) SpillHashtable();
+    }
+    if (left_partitions_.empty()) return;
+
+    // The left side didn't fit in memory, so both sides get split by the hash of their join value and each pair of
+    // partitions is joined on its own
+    for (auto &partition : left_partitions_) RecordSpill(context, partition->FinishWriting());
+    for (size_t i = 0; i < kSpillPartitions; ++i) right_partitions_.push_back(std::make_unique<SpillFile>());
+    while (right_op_cursor_->Pull(frame, context)) {
+      ExpressionEvaluator evaluator =
+          ExpressionEvaluator{&frame, context, storage::View::OLD, nullptr, &context.number_of_hops};
+
+      auto right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
+      if (right_value.type() == TypedValue::Type::Null) continue;
+      SpillRow(right_partitions_, std::move(right_value), self_.right_symbols_, frame.elems());
+    }
+    for (auto &partition : right_partitions_) RecordSpill(context, partition->FinishWriting());
+  }
+
+  const SharedHashJoinState::LeftFrames *FindLeftFrames(const TypedValue &value) const {
+    if (shared_state_) return shared_state_->Find(value);
+    auto it = hashtable_.find(value);
+    return it == hashtable_.end() ? nullptr : &it->second;
+  }
+
+  /// Moves the left frames collected so far to disk, along with all the following ones.
+  void SpillHashtable() {
+    left_partitions_.reserve(kSpillPartitions);
+    for (size_t i = 0; i < kSpillPartitions; ++i) left_partitions_.push_back(std::make_unique<SpillFile>());
+    for (auto &[left_value, left_frames] : hashtable_) {
+      for (const auto &left_frame : left_frames) {
+        SpillRow(left_partitions_, left_value, self_.left_symbols_, left_frame);
+      }
+    }
+    hashtable_.clear();
+  }
+
+  /// Writes the join value followed by the values of `symbols` to the partition of the join value.
+  void SpillRow(std::vector<std::unique_ptr<SpillFile>> &partitions, TypedValue join_value,
+                const std::vector<Symbol> &symbols, const auto &values) {
+    auto const partition = SpillPartition(hashtable_.hash_function()(join_value));
+    spilled_row_.clear();
+    spilled_row_.emplace_back(std::move(join_value));
+    for (const auto &symbol : symbols) spilled_row_.emplace_back(values[symbol.position()]);
+    partitions[partition]->Write(spilled_row_);
+  }
+
+  /// Pulls the next right frame and evaluates its join value. Once spilled, the right frames come out of the
+  /// partitions, with the hashtable holding the left frames of the partition being read.
+  bool PullRight(Frame &frame, ExecutionContext &context, TypedValue *right_value) {
+    if (right_partitions_.empty()) {
+      if (!right_op_cursor_->Pull(frame, context)) return false;
+      ExpressionEvaluator evaluator =
+          ExpressionEvaluator{&frame, context, storage::View::OLD, nullptr, &context.number_of_hops};
+      *right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
+      return true;
+    }
+
+    while (spilled_partition_ < right_partitions_.size()) {
+      AbortCheck(context);
+      if (!partition_loaded_) LoadLeftPartition(frame, context);
+      // Without left frames in the partition, none of its right frames can join
+      if (!hashtable_.empty() && right_partitions_[spilled_partition_]->Read(&spilled_row_, context.db_accessor)) {
+        auto frame_writer = frame.GetFrameWriter(context.frame_change_collector, context.evaluation_context.memory);
+        *right_value = std::move(spilled_row_[0]);
+        for (size_t i = 0; i < self_.right_symbols_.size(); ++i) {
+          frame_writer.Write(self_.right_symbols_[i], std::move(spilled_row_[i + 1]));
+        }
+        return true;
       }
+      hashtable_.clear();
+      right_partitions_[spilled_partition_].reset();
+      ++spilled_partition_;
+      partition_loaded_ = false;
     }
+    return false;
+  }
+
+  void LoadLeftPartition(Frame &frame, ExecutionContext &context) {
+    auto *mem = hashtable_.get_allocator().resource();
+    auto &partition = left_partitions_[spilled_partition_];
+    while (partition->Read(&spilled_row_, context.db_accessor)) {
+      // Left frames are kept whole, with only the left symbols set
+      utils::pmr::vector<TypedValue> left_frame(frame.elems().size(), mem);
+      for (size_t i = 0; i < self_.left_symbols_.size(); ++i) {
+        left_frame[self_.left_symbols_[i].position()] = std::move(spilled_row_[i + 1]);
+      }
+      hashtable_[spilled_row_[0]].emplace_back(std::move(left_frame));
+    }
+    partition.reset();
+    partition_loaded_ = true;
   }
 
   const HashJoin &self_;
   const UniqueCursorPtr left_op_cursor_;
   const UniqueCursorPtr right_op_cursor_;
-  utils::pmr::unordered_map<TypedValue, utils::pmr::vector<utils::pmr::vector<TypedValue>>, TypedValue::Hash,
-                            TypedValue::BoolEqual>
-      hashtable_;
+  // Set when the branches of a parallel query probe the same hashtable, built in place of `hashtable_`
+  std::shared_ptr<SharedHashJoinState> shared_state_;
+  SharedHashJoinState::Hashtable hashtable_;
   utils::pmr::vector<TypedValue> right_op_frame_;
-  utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frame_it_;
+  const SharedHashJoinState::LeftFrames *left_frames_{nullptr};
+  SharedHashJoinState::LeftFrames::const_iterator left_op_frame_it_;
   bool hash_join_initialized_{false};
   bool common_value_found_{false};
-  TypedValue common_value;
+  // Frames of both sides split by the hash of their join value, if the left side didn't fit under the query memory
+  // limit
+  std::vector<std::unique_ptr<SpillFile>> left_partitions_;
+  std::vector<std::unique_ptr<SpillFile>> right_partitions_;
+  size_t spilled_partition_{0};
+  bool partition_loaded_{false};
+  utils::pmr::vector<TypedValue> spilled_row_;
 };
 }  // namespace
 
 UniqueCursorPtr HashJoin::MakeCursor(utils::MemoryResource *mem, metrics::DatabaseMetricHandles &metric_handles) const {
   metric_handles.hash_join_operator.Increment();
+#ifdef MG_ENTERPRISE
+  if (parallel_execution_) {
+    // Parallel mode: the branches probe one hashtable built from the whole left side
+    return MakeUniqueCursorPtr<HashJoinCursor>(
+        mem, *this, mem, metric_handles, plan_creation_helper_().GetSharedHashJoinState(this, mem));
+  }
+#endif
   return MakeUniqueCursorPtr<HashJoinCursor>(mem, *this, mem, metric_handles);
 }
 
@@ -9606,6 +11070,7 @@ std::unique_ptr<LogicalOperator> HashJoin::Clone(AstStorage *storage) const {
   object->right_op_ = right_op_ ? right_op_->Clone(storage) : nullptr;
   object->right_symbols_ = right_symbols_;
   object->hash_join_condition_ = hash_join_condition_ ? hash_join_condition_->Clone(storage) : nullptr;
+  object->parallel_execution_ = parallel_execution_;
   return object;
 }
 
@@ -11013,6 +12478,23 @@ class ParallelBranchCursor : public Cursor {
   }
 
  protected:
+  /// State of the branches running in parallel tasks, kept until it's unified into the main context.
+  struct BranchResults {
+    explicit BranchResults(size_t num_branches)
+        : exceptions(num_branches, nullptr),
+          branch_contexts(num_branches - 1),
+          branch_trigger_collectors(num_branches - 1),
+          branch_frame_collectors(num_branches - 1) {}
+
+    std::atomic_int pull_result = 0;
+    std::vector<std::exception_ptr> exceptions;
+    // Store context copies from each branch for unification after execution
+    std::vector<ExecutionContext> branch_contexts;
+    // Store collector copies for each branch (they're not thread-safe, so each branch needs its own)
+    std::vector<std::optional<TriggerContextCollector>> branch_trigger_collectors;
+    std::vector<std::optional<FrameChangeCollector>> branch_frame_collectors;
+  };
+
   /**
    * Execute all branches in parallel and unify context fields.
    * The first branch (index 0) runs on the main thread, others run in parallel tasks.
@@ -11028,24 +12510,78 @@ class ParallelBranchCursor : public Cursor {
       return false;
     }
 
+    AbortCheck(context);
+
+    main_thread_.store(std::this_thread::get_id(), std::memory_order_release);
+    BranchResults results(branch_cursors_.size());
+    ScheduleBranches(
+        results,
+        frame,
+        context,
+        self,
+        [&pre_pull_func, post_pull_func](Cursor *cursor, Frame &branch_frame, ExecutionContext &branch_ctx) mutable {
+          pre_pull_func(cursor);
+          const bool pulled = cursor->Pull(branch_frame, branch_ctx);
+          post_pull_func(cursor, &branch_frame);
+          return pulled;
+        },
+        [] {});
+
+    // TODO Reuse the same logic as each thread
+    // Execute branch 0 on the main thread
+    // Set plan quotas for the hops limit (this is needed for parallel execution to avoid deadlock in case multiple
+    // shared quotas are used)
+    if (branch_plan_quotas_[0] && context.hops_limit.IsUsed() && context.hops_limit.shared_quota_) {
+      context.hops_limit.shared_quota_->SetPlanQuotas(branch_plan_quotas_[0]);
+    }
+    const auto &cursor = branch_cursors_[0];
+    try {
+      pre_pull_func(cursor.get());
+      results.pull_result.fetch_add((int)cursor->Pull(frame, context));
+      // NOTE: hops limit is shared between threads, so we need to free the leftover quota
+      context.hops_limit.Free();
+      post_pull_func(cursor.get(), &frame);
+    } catch (const std::exception &e) {
+      RecordException(results, 0, context);
+    }
+
+    collection_scheduler_->WaitOrSteal();
+    RethrowFirstException(results);
+
+    // Nothing to pull, return
+    if (results.pull_result.load() == 0) return false;
+
+    // Unify context fields from all branches
+    plan::ProfilingStats *parallel_stats = context.stats_root;  // save before resetting the profile
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    const_cast<std::optional<ScopedProfile> &>(profile).reset();
+    UnifyContexts(context,
+                  results.branch_contexts,
+                  results.branch_trigger_collectors,
+                  results.branch_frame_collectors,
+                  parallel_stats);
+
+    return true;
+  }
+
+  /**
+   * Create the tasks running branches 1..N on the worker pool. They are started once the first ParallelMerge in
+   * branch 0 has been pulled, so branch 0 has to be pulled by the caller. A task that runs on `main_thread_` was
+   * stolen by the caller, so the caller has to keep it up to date.
+   *
+   * @param results State of the branches, has to outlive the tasks
+   * @param pull_func Called as pull_func(cursor, frame, context) to pull a branch, returns whether it pulled anything
+   * @param on_exit_func Called on the branch's thread once the branch finished and its context was saved to results
+   */
+  void ScheduleBranches(BranchResults &results, const Frame &frame, ExecutionContext &context,
+                        const LogicalOperator &self, auto &&pull_func, auto &&on_exit_func) {
     // Make sure auth is thread safe
     if (context.auth_checker) {
       context.auth_checker->MakeThreadSafe();
     }
 
-    AbortCheck(context);
-
-    std::atomic_int pull_result = 0;
     const auto num_branches = branch_cursors_.size();
-    const auto num_branches_without_main = num_branches - 1;
-
     utils::TaskCollection tasks(num_branches);
-    std::vector<std::exception_ptr> exceptions(num_branches, nullptr);
-    // Store context copies from each branch for unification after execution
-    std::vector<ExecutionContext> branch_contexts(num_branches_without_main);
-    // Store collector copies for each branch (they're not thread-safe, so each branch needs its own)
-    std::vector<std::optional<TriggerContextCollector>> branch_trigger_collectors(num_branches_without_main);
-    std::vector<std::optional<FrameChangeCollector>> branch_frame_collectors(num_branches_without_main);
 
     // Execute branches 1..N in parallel
     for (size_t i = 1; i < num_branches; i++) {
@@ -11053,13 +12589,15 @@ class ParallelBranchCursor : public Cursor {
                      i,
                      context,
                      frame_size = frame.elems().size(),
-                     main_thread = std::this_thread::get_id(),
-                     post_pull_func,
+                     pull_func,
+                     on_exit_func,
                      mem_tracking = memgraph::memory::CrossThreadMemoryTracking(context.db_arena_pool)](
                         utils::Priority /*unused*/) mutable {
         const OOMExceptionEnabler oom_exception;
         const utils::Timer timer;
-        if (main_thread != std::this_thread::get_id()) {  // Main thread can steal work, so ignore if stolen
+        // Main thread can steal work, so ignore if stolen; decided once so the tracking is stopped where it started
+        const bool stolen = main_thread_.load(std::memory_order_acquire) == std::this_thread::get_id();
+        if (!stolen) {
           mem_tracking.StartTracking();
         }
         // Create parallel operator entry in branch's stats tree
@@ -11084,9 +12622,9 @@ class ParallelBranchCursor : public Cursor {
           // Force state reset (life extended through the context)
           // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
           const_cast<std::optional<ScopedProfile> &>(profile).reset();
-          if (main_thread != std::this_thread::get_id()) {  // Main thread can steal work, so ignore if stolen
-            // NOTE: Parallel operators have to PullAll, so no need to worry about switching threads (at the bolt level)
-            // Main thread is handled by the higher level
+          if (!stolen) {
+            // NOTE: A branch run on a worker thread finishes on it. ProduceParallel streams its rows across pulls, but
+            // the branches it pulls itself run on the main thread, which is handled by the higher level
             context.profile_execution_time += timer.Elapsed();
             // Main thread will continue using the same tracker
             mem_tracking.StopTracking();
@@ -11094,7 +12632,8 @@ class ParallelBranchCursor : public Cursor {
           // NOTE: hops limit is shared between threads, so we need to free the leftover quota
           context.hops_limit.Free();
           // Move current context to the branch context for unification
-          branch_contexts[metadata_i] = std::move(context);
+          results.branch_contexts[metadata_i] = std::move(context);
+          on_exit_func();
         });
 
         // Everything that can allocate runs inside the try: under a QUERY MEMORY
@@ -11106,7 +12645,7 @@ class ParallelBranchCursor : public Cursor {
         try {
           if (context.frame_change_collector != nullptr) {
             auto &collector =
-                branch_frame_collectors[metadata_i].emplace(context.frame_change_collector->get_allocator());
+                results.branch_frame_collectors[metadata_i].emplace(context.frame_change_collector->get_allocator());
             // Copy the cache structure (keys and invalidators) from the main collector so that
             // cache invalidation works correctly when frame values change in this branch.
             collector.CopyStructureFrom(*context.frame_change_collector);
@@ -11115,7 +12654,7 @@ class ParallelBranchCursor : public Cursor {
           if (context.trigger_context_collector != nullptr) {
             // Create an empty collector with same config for this branch (don't copy existing data)
             // Main branch retains its own data, this branch will only receive new changes.
-            auto &collector = branch_trigger_collectors[metadata_i].emplace(
+            auto &collector = results.branch_trigger_collectors[metadata_i].emplace(
                 context.trigger_context_collector->CreateEmptyWithSameConfig());
             context.trigger_context_collector = &collector;
           }
@@ -11129,16 +12668,10 @@ class ParallelBranchCursor : public Cursor {
           // TODO Try to not allocate since Scan will copy it. Problem if we return before Scan; will crash
           Frame frame_local(static_cast<int64_t>(frame_size));
 
-          pre_pull_func(cursor.get());
-          pull_result.fetch_add((int)cursor->Pull(frame_local, context));
-          post_pull_func(cursor.get(), &frame_local);
+          results.pull_result.fetch_add((int)pull_func(cursor.get(), frame_local, context));
         } catch (const std::exception &e) {
           // Stop all other threads
-          DMG_ASSERT(context.stopping_context.exception_occurred != nullptr, "Exception occurred must be set");
-          if (!context.stopping_context.exception_occurred->fetch_or(true, std::memory_order::acq_rel)) {
-            // Set exception occurred flag and pass exception to the main thread
-            exceptions[i] = std::current_exception();
-          }
+          RecordException(results, i, context);
           return;
         }
       });
@@ -11152,49 +12685,25 @@ class ParallelBranchCursor : public Cursor {
     }
     collection_scheduler_->SetCollection(std::make_shared<utils::TaskCollection>(std::move(tasks)));
     collection_scheduler_->SetPool(context.worker_pool);
+  }
 
-    // TODO Reuse the same logic as each thread
-    // Execute branch 0 on the main thread
-    // Set plan quotas for the hops limit (this is needed for parallel execution to avoid deadlock in case multiple
-    // shared quotas are used)
-    if (branch_plan_quotas_[0] && context.hops_limit.IsUsed() && context.hops_limit.shared_quota_) {
-      context.hops_limit.shared_quota_->SetPlanQuotas(branch_plan_quotas_[0]);
-    }
-    const auto &cursor = branch_cursors_[0];
-    try {
-      pre_pull_func(cursor.get());
-      pull_result.fetch_add((int)cursor->Pull(frame, context));
-      // NOTE: hops limit is shared between threads, so we need to free the leftover quota
-      context.hops_limit.Free();
-      post_pull_func(cursor.get(), &frame);
-    } catch (const std::exception &e) {
-      DMG_ASSERT(context.stopping_context.exception_occurred != nullptr, "Exception occurred must be set");
-      if (!context.stopping_context.exception_occurred->fetch_or(true, std::memory_order::acq_rel)) {
-        // Exception occurred on the main thread, set flag and pass exception to the main thread
-        exceptions[0] = std::current_exception();
-      }
+  /// Keeps the exception being handled if it's the first one in the query, and stops all other branches.
+  static void RecordException(BranchResults &results, size_t branch_index, const ExecutionContext &context) {
+    DMG_ASSERT(context.stopping_context.exception_occurred != nullptr, "Exception occurred must be set");
+    if (!context.stopping_context.exception_occurred->fetch_or(true, std::memory_order::acq_rel)) {
+      // Set exception occurred flag and pass exception to the main thread
+      results.exceptions[branch_index] = std::current_exception();
     }
+  }
 
-    collection_scheduler_->WaitOrSteal();
-
-    // Check for exceptions
-    if (const auto exception_it = std::find_if(
-            exceptions.begin(), exceptions.end(), [](const std::exception_ptr &e) { return e != nullptr; });
-        exception_it != exceptions.end()) {
+  static void RethrowFirstException(const BranchResults &results) {
+    if (const auto exception_it = std::find_if(results.exceptions.begin(),
+                                               results.exceptions.end(),
+                                               [](const std::exception_ptr &e) { return e != nullptr; });
+        exception_it != results.exceptions.end()) {
       // Just rethrow the first exception
       std::rethrow_exception(*exception_it);
     }
-
-    // Nothing to pull, return
-    if (pull_result.load() == 0) return false;
-
-    // Unify context fields from all branches
-    plan::ProfilingStats *parallel_stats = context.stats_root;  // save before resetting the profile
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    const_cast<std::optional<ScopedProfile> &>(profile).reset();
-    UnifyContexts(context, branch_contexts, branch_trigger_collectors, branch_frame_collectors, parallel_stats);
-
-    return true;
   }
 
   /**
@@ -11301,6 +12810,8 @@ class ParallelBranchCursor : public Cursor {
   std::shared_ptr<utils::CollectionScheduler> collection_scheduler_;
   std::vector<std::shared_ptr<std::vector<utils::SharedQuota *>>> branch_plan_quotas_;
   const std::vector<UniqueCursorPtr> branch_cursors_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+  // Thread pulling this cursor; Bolt can pull the results on a different thread every time
+  std::atomic<std::thread::id> main_thread_;
 };
 
 namespace {
@@ -11856,6 +13367,279 @@ std::vector<Symbol> OrderByParallel::OutputSymbols(const SymbolTable &symbol_tab
 
 ACCEPT_WITH_INPUT(OrderByParallel);
 
+#ifdef MG_ENTERPRISE
+class ProduceParallelCursor : public ParallelBranchCursor {
+ public:
+  ProduceParallelCursor(const ProduceParallel &self, utils::MemoryResource *mem,
+                        metrics::DatabaseMetricHandles &metric_handles)
+      : ParallelBranchCursor(self.input_, self.num_threads_, mem, metric_handles), self_(self) {}
+
+  ProduceParallelCursor(const ProduceParallelCursor &) = delete;
+  ProduceParallelCursor(ProduceParallelCursor &&) = delete;
+  ProduceParallelCursor &operator=(const ProduceParallelCursor &) = delete;
+  ProduceParallelCursor &operator=(ProduceParallelCursor &&) = delete;
+
+  ~ProduceParallelCursor() override { StopBranches(); }
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    const OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (branch_cursors_.empty() || finished_) {
+      return false;
+    }
+
+    // Bolt can pull the results on a different thread every time
+    main_thread_.store(std::this_thread::get_id(), std::memory_order_release);
+    // Kept for Shutdown, which finishes the branches when an operator above stops pulling early (i.e. Limit)
+    context_ = &context;
+    parallel_stats_ = context.stats_root;
+
+    // First pull, start the other branches; they stream their rows while this thread pulls branch 0
+    if (!stream_) {
+      AbortCheck(context);
+      StartBranches(frame, context);
+    }
+
+    try {
+      while (true) {
+        AbortCheck(context);
+        // Rows of the other branches come first so they don't wait for room in the stream
+        if (PopRow(frame, context)) return true;
+        if (local_branch_ < branch_cursors_.size()) {
+          if (branch_cursors_[local_branch_]->Pull(frame, context)) return true;
+          // NOTE: hops limit is shared between threads, so we need to free the leftover quota
+          context.hops_limit.Free();
+          ClaimNextBranch(context);
+          continue;
+        }
+        if (!WaitForRows()) break;
+      }
+    } catch (const std::exception &e) {
+      RecordException(stream_->results, 0, context);
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    const_cast<std::optional<ScopedProfile> &>(profile).reset();
+    FinishBranches(context);
+    return false;
+  }
+
+  void Shutdown() override {
+    if (stream_ && !finished_) {
+      DMG_ASSERT(context_, "ProduceParallel was started without a context");
+      FinishBranches(*context_);
+    }
+    ParallelBranchCursor::Shutdown();
+  }
+
+  void Reset() override {
+    StopBranches();
+    stream_.reset();
+    finished_ = false;
+    local_branch_ = 0;
+    context_ = nullptr;
+    parallel_stats_ = nullptr;
+    ParallelBranchCursor::Reset();
+  }
+
+ private:
+  // Rows a branch can get ahead of the thread pulling the results before it waits
+  static constexpr size_t kRowsBufferedPerBranch{256};
+
+  // Rows streamed by the branches running on the worker pool, waiting to be pulled
+  struct RowStream {
+    explicit RowStream(size_t num_branches) : results(num_branches) {}
+
+    BranchResults results;
+    std::mutex mutex;
+    std::condition_variable row_ready;
+    std::condition_variable space_available;
+    std::deque<std::vector<TypedValue>> rows;
+    size_t finished_branches{0};
+    bool stopped{false};
+  };
+
+  void StartBranches(Frame &frame, ExecutionContext &context) {
+    output_symbols_ = self_.input_->OutputSymbols(context.symbol_table);
+    stream_ = std::make_unique<RowStream>(branch_cursors_.size());
+
+    auto pull_func = [this](Cursor *cursor, Frame &branch_frame, ExecutionContext &branch_context) {
+      bool pulled = false;
+      while (cursor->Pull(branch_frame, branch_context)) {
+        pulled = true;
+        std::vector<TypedValue> row;
+        row.reserve(output_symbols_.size());
+        for (const auto &symbol : output_symbols_) {
+          row.emplace_back(branch_frame[symbol], branch_context.evaluation_context.memory);
+        }
+        if (!PushRow(std::move(row))) break;
+      }
+      return pulled;
+    };
+    auto on_exit_func = [this]() { MarkBranchFinished(); };
+    ScheduleBranches(stream_->results, frame, context, self_, pull_func, on_exit_func);
+
+    // Set plan quotas for the hops limit (this is needed for parallel execution to avoid deadlock in case multiple
+    // shared quotas are used)
+    if (branch_plan_quotas_[0] && context.hops_limit.IsUsed() && context.hops_limit.shared_quota_) {
+      context.hops_limit.shared_quota_->SetPlanQuotas(branch_plan_quotas_[0]);
+    }
+  }
+
+  /// Moves this thread on to the next branch no worker has picked up yet. It is pulled a row at a time, like branch 0,
+  /// instead of being stolen as a whole, which would buffer all of its rows since this thread can't wait for itself
+  /// to pull them.
+  void ClaimNextBranch(ExecutionContext &context) {
+    for (++local_branch_; local_branch_ < branch_cursors_.size(); ++local_branch_) {
+      if (!ClaimBranch(local_branch_)) continue;
+      if (branch_plan_quotas_[local_branch_] && context.hops_limit.IsUsed() && context.hops_limit.shared_quota_) {
+        context.hops_limit.shared_quota_->SetPlanQuotas(branch_plan_quotas_[local_branch_]);
+      }
+      return;
+    }
+  }
+
+  /// Takes branch `i` (1..N) away from the worker pool; its task won't run, so it counts as finished for the stream.
+  bool ClaimBranch(size_t i) {
+    if (!collection_scheduler_->Claim(i - 1)) return false;
+    MarkBranchFinished();
+    return true;
+  }
+
+  void MarkBranchFinished() {
+    {
+      const std::lock_guard lock(stream_->mutex);
+      ++stream_->finished_branches;
+    }
+    stream_->row_ready.notify_all();
+  }
+
+  /// Returns false once the branches were stopped.
+  bool PushRow(std::vector<TypedValue> row) {
+    std::unique_lock lock(stream_->mutex);
+    stream_->space_available.wait(lock, [this] {
+      return stream_->stopped || stream_->rows.size() < kRowsBufferedPerBranch * branch_cursors_.size();
+    });
+    if (stream_->stopped) return false;
+    stream_->rows.push_back(std::move(row));
+    stream_->row_ready.notify_one();
+    return true;
+  }
+
+  bool PopRow(Frame &frame, ExecutionContext &context) {
+    std::optional<std::vector<TypedValue>> row;
+    {
+      const std::lock_guard lock(stream_->mutex);
+      if (stream_->rows.empty()) return false;
+      row.emplace(std::move(stream_->rows.front()));
+      stream_->rows.pop_front();
+    }
+    stream_->space_available.notify_one();
+
+    DMG_ASSERT(output_symbols_.size() == row->size(),
+               "Number of values does not match the number of output symbols in ProduceParallel");
+    auto frame_writer = frame.GetFrameWriter(context.frame_change_collector, context.evaluation_context.memory);
+    for (size_t i = 0; i < output_symbols_.size(); ++i) {
+      frame_writer.Write(output_symbols_[i], std::move((*row)[i]));
+    }
+    return true;
+  }
+
+  /// Waits until a branch running on the worker pool streams a row. Every branch is either claimed by this thread or
+  /// already picked up by a worker at this point, so this only waits for branches that make progress.
+  /// Returns false once all branches finished and their rows were pulled.
+  bool WaitForRows() {
+    std::unique_lock lock(stream_->mutex);
+    stream_->row_ready.wait(lock, [this] {
+      return !stream_->rows.empty() || stream_->finished_branches == branch_cursors_.size() - 1;
+    });
+    return !stream_->rows.empty();
+  }
+
+  /// Stops the branches, then reports their errors and unifies their contexts into the main one.
+  void FinishBranches(ExecutionContext &context) {
+    finished_ = true;
+    StopBranches();
+    RethrowFirstException(stream_->results);
+
+    // Unify context fields from all branches
+    UnifyContexts(context,
+                  stream_->results.branch_contexts,
+                  stream_->results.branch_trigger_collectors,
+                  stream_->results.branch_frame_collectors,
+                  parallel_stats_);
+  }
+
+  /// Stops the branches that are still running and waits for all of them to finish.
+  void StopBranches() {
+    if (!stream_) return;
+    {
+      const std::lock_guard lock(stream_->mutex);
+      stream_->stopped = true;
+    }
+    stream_->space_available.notify_all();
+    // Branches no worker picked up yet don't need to run at all
+    for (size_t i = local_branch_ + 1; i < branch_cursors_.size(); ++i) ClaimBranch(i);
+    collection_scheduler_->WaitOrSteal();
+  }
+
+  const ProduceParallel &self_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+  std::vector<Symbol> output_symbols_;
+  std::unique_ptr<RowStream> stream_;
+  size_t local_branch_{0};  // Branch pulled on this thread; 0 first, then the ones claimed from the worker pool
+  ExecutionContext *context_{nullptr};
+  plan::ProfilingStats *parallel_stats_{nullptr};
+  bool finished_{false};
+};
+#endif
+
+#ifdef MG_ENTERPRISE
+ProduceParallel::ProduceParallel(const std::shared_ptr<LogicalOperator> &produce_input, size_t num_threads)
+    : input_(produce_input), num_threads_(num_threads) {
+  DMG_ASSERT(dynamic_cast<Produce *>(produce_input.get()) != nullptr, "Input must be a Produce");
+  DMG_ASSERT(num_threads > 0, "Number of threads must be greater than 0");
+}
+#else
+ProduceParallel::ProduceParallel(const std::shared_ptr<LogicalOperator> & /*produce_input*/, size_t /*num_threads*/) {
+  throw QueryRuntimeException("ProduceParallel is not supported in the community edition");
+}
+#endif
+
+UniqueCursorPtr ProduceParallel::MakeCursor(utils::MemoryResource *mem,
+                                            metrics::DatabaseMetricHandles &metric_handles) const {
+  metric_handles.produce_operator.Increment();
+#ifdef MG_ENTERPRISE
+  if (!license::global_license_checker.IsEnterpriseValidFast()) {
+    throw QueryRuntimeException("ProduceParallel is not supported in the community edition");
+  }
+  return MakeUniqueCursorPtr<ProduceParallelCursor>(mem, *this, mem, metric_handles);
+#else
+  (void)mem;
+  throw QueryRuntimeException("ProduceParallel is not supported in the community edition");
+#endif
+}
+
+std::vector<Symbol> ProduceParallel::ModifiedSymbols(const SymbolTable &table) const {
+#ifdef MG_ENTERPRISE
+  return input_->ModifiedSymbols(table);
+#else
+  (void)table;
+  return {};
+#endif
+}
+
+std::vector<Symbol> ProduceParallel::OutputSymbols(const SymbolTable &symbol_table) const {
+#ifdef MG_ENTERPRISE
+  return input_->OutputSymbols(symbol_table);
+#else
+  (void)symbol_table;
+  return {};
+#endif
+}
+
+ACCEPT_WITH_INPUT(ProduceParallel);
+
 Skip::Skip(const std::shared_ptr<LogicalOperator> &input, Expression *expression)
     : input_(input ? input : std::make_shared<Once>()), expression_(expression) {}
 
@@ -21,6 +21,7 @@
 
 #include "query/common.hpp"
 #include "query/frontend/semantic/symbol.hpp"
+#include "query/interpret/frame_batch.hpp"
 #include "query/parameters.hpp"
 #include "query/plan/point_distance_condition.hpp"
 #include "query/plan/preprocess.hpp"
@@ -41,6 +42,8 @@ struct DatabaseMetricHandles;
 namespace memgraph::query {
 
 struct ExecutionContext;
+class CompiledFilter;
+class CompiledProjection;
 class DbAccessor;
 class ExpressionEvaluator;
 class Frame;
@@ -100,6 +103,24 @@ class Cursor {
   /// calling Reset().
   virtual bool Pull(Frame &, ExecutionContext &) = 0;
 
+  /// Run iterations of a @c LogicalOperator until `batch` is full or the
+  /// input runs out, replacing the contents of `batch`.
+  ///
+  /// The rows only hold the symbols written by operators that pull in
+  /// batches; everything else is on `frame`, which must not change until the
+  /// rows have been consumed. The default implementation pulls a single row
+  /// with `Pull`, so an operator without a batch implementation runs as
+  /// before in the middle of a batched pipeline.
+  ///
+  /// A cursor is pulled either with `Pull` or with `PullBatch` until it is
+  /// reset. Batches are only pulled by operators that consume all of their
+  /// input anyway, and never in PROFILE, which counts pulls per row.
+  ///
+  /// @throws QueryRuntimeException if something went wrong with execution
+  /// @return true if `batch` holds at least one row, false if the cursor is
+  /// exhausted.
+  virtual bool PullBatch(Frame &, FrameBatch &, ExecutionContext &);
+
   /// Resets the Cursor to its initial state.
   virtual void Reset() = 0;
 
@@ -128,6 +149,7 @@ class CreateNode;
 class CreateExpand;
 class ScanAll;
 class ScanAllByLabel;
+class ScanAllByLabelIntersection;
 class ScanAllByLabelProperties;
 class ScanAllById;
 class ScanAllByEdge;
@@ -144,6 +166,7 @@ class ScanAllByPointDistance;
 class ScanAllByPointWithinbbox;
 class Expand;
 class ExpandVariable;
+class ExpandIntersect;
 class ConstructNamedPath;
 class Filter;
 class Produce;
@@ -182,6 +205,7 @@ class SetNestedProperty;
 class RemoveNestedProperty;
 class AggregateParallel;
 class OrderByParallel;
+class ProduceParallel;
 class ParallelMerge;
 class ScanParallel;
 class ScanParallelByLabel;
@@ -199,18 +223,19 @@ class ScanChunk;
 class ScanChunkByEdge;
 
 using LogicalOperatorCompositeVisitor = utils::CompositeVisitor<
-    Once, CreateNode, CreateExpand, ScanAll, ScanAllByLabel, ScanAllByLabelProperties, ScanAllById, ScanAllByEdge,
-    ScanAllByEdgeType, ScanAllByEdgeTypeProperty, ScanAllByEdgeTypePropertyValue, ScanAllByEdgeTypePropertyRange,
-    ScanAllByEdgeProperty, ScanAllByEdgePropertyValue, ScanAllByEdgePropertyRange, ScanAllByEdgeId,
-    ScanAllByVertexProperty, ScanAllByPointDistance, ScanAllByPointWithinbbox, Expand, ExpandVariable,
-    ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties, SetLabels, RemoveProperty, RemoveLabels,
-    EdgeUniquenessFilter, Accumulate, Aggregate, Skip, Limit, OrderBy, Merge, Optional, Unwind, Distinct, Union,
-    Cartesian, CallProcedure, LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter, Apply, IndexedJoin, HashJoin,
-    RollUpApply, PeriodicCommit, PeriodicSubquery, SetNestedProperty, RemoveNestedProperty, LoadParquet, LoadJsonl,
-    AggregateParallel, OrderByParallel, ScanParallel, ScanParallelByLabel, ScanParallelByLabelProperties,
-    ScanParallelByEdgeType, ScanParallelByEdgeTypeProperty, ScanParallelByEdge, ScanParallelByEdgeTypePropertyValue,
-    ScanParallelByEdgeTypePropertyRange, ScanParallelByEdgeProperty, ScanParallelByEdgePropertyValue,
-    ScanParallelByEdgePropertyRange, ScanParallelByVertexProperty, ScanChunk, ScanChunkByEdge, ParallelMerge>;
+    Once, CreateNode, CreateExpand, ScanAll, ScanAllByLabel, ScanAllByLabelIntersection, ScanAllByLabelProperties,
+    ScanAllById, ScanAllByEdge, ScanAllByEdgeType, ScanAllByEdgeTypeProperty, ScanAllByEdgeTypePropertyValue,
+    ScanAllByEdgeTypePropertyRange, ScanAllByEdgeProperty, ScanAllByEdgePropertyValue, ScanAllByEdgePropertyRange,
+    ScanAllByEdgeId, ScanAllByVertexProperty, ScanAllByPointDistance, ScanAllByPointWithinbbox, Expand,
+    ExpandVariable, ExpandIntersect, ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties,
+    SetLabels, RemoveProperty, RemoveLabels, EdgeUniquenessFilter, Accumulate, Aggregate, Skip, Limit, OrderBy, Merge,
+    Optional, Unwind, Distinct, Union, Cartesian, CallProcedure, LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter,
+    Apply, IndexedJoin, HashJoin, RollUpApply, PeriodicCommit, PeriodicSubquery, SetNestedProperty,
+    RemoveNestedProperty, LoadParquet, LoadJsonl, AggregateParallel, OrderByParallel, ProduceParallel, ScanParallel,
+    ScanParallelByLabel, ScanParallelByLabelProperties, ScanParallelByEdgeType, ScanParallelByEdgeTypeProperty,
+    ScanParallelByEdge, ScanParallelByEdgeTypePropertyValue, ScanParallelByEdgeTypePropertyRange,
+    ScanParallelByEdgeProperty, ScanParallelByEdgePropertyValue, ScanParallelByEdgePropertyRange,
+    ScanParallelByVertexProperty, ScanChunk, ScanChunkByEdge, ParallelMerge>;
 
 using LogicalOperatorLeafVisitor = utils::LeafVisitor<Once>;
 
@@ -275,8 +300,8 @@ class LogicalOperator : public utils::Visitable<HierarchicalLogicalOperatorVisit
    *
    * - column-defining: @c Produce, @c Union, @c CallProcedure, @c LoadCsv, @c LoadParquet, @c LoadJsonl,
    *   @c OutputTable, @c OutputTableStream;
-   * - propagating from their input: @c OrderBy, @c OrderByParallel, @c Distinct, @c Skip, @c Limit,
-   *   @c PeriodicCommit, @c RollUpApply;
+   * - propagating from their input: @c OrderBy, @c OrderByParallel, @c ProduceParallel, @c Distinct, @c Skip,
+   *   @c Limit, @c PeriodicCommit, @c RollUpApply;
    * - @c EmptyResult, which suppresses them.
    *
    * Propagation is never automatic - the default returns @c {} whatever the input - so an operator between
@@ -637,6 +662,29 @@ class ScanAllByLabel : public memgraph::query::plan::ScanAll {
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
 };
 
+/// Behaves like @c ScanAll, but this operator produces only vertices with
+/// all of the given labels, found by intersecting their label indices.
+///
+/// @sa ScanAllByLabel
+class ScanAllByLabelIntersection : public memgraph::query::plan::ScanAll {
+ public:
+  static const utils::TypeInfo kType;
+
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  ScanAllByLabelIntersection() = default;
+  ScanAllByLabelIntersection(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                             std::vector<storage::LabelId> labels, storage::View view = storage::View::OLD);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *, metrics::DatabaseMetricHandles &) const override;
+
+  std::vector<storage::LabelId> labels_;
+
+  std::string ToString(const DbAccessor *dba) const override;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
+};
+
 struct ScanByEdgeCommon {
   static const utils::TypeInfo kType;
 
@@ -922,11 +970,17 @@ class ScanAllByLabelProperties : public memgraph::query::plan::ScanAll {
 
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *, metrics::DatabaseMetricHandles &) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
 
   storage::LabelId label_;
   std::vector<storage::PropertyPath> properties_;
   std::vector<ExpressionRange> expression_ranges_;
   storage::IndexOrder index_order_{storage::IndexOrder::ASC};
+  /// One per property. When set, the visible value of the property, decoded
+  /// by the index while it checks the vertex, is written there, so the
+  /// operators above don't read it from the vertex. Set by the index-only scan
+  /// rewrite.
+  std::vector<std::optional<Symbol>> index_value_symbols_;
 
   std::string ToString(const DbAccessor *dba) const override;
 
@@ -1110,6 +1164,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     ExpandCursor(const Expand &, int64_t input_degree, int64_t existing_node_degree, utils::MemoryResource *,
                  metrics::DatabaseMetricHandles &);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
     ExpansionInfo GetExpansionInfo(Frame &);
@@ -1133,8 +1188,13 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     ExpansionInfo expansion_info_;
     int64_t prev_input_degree_{-1};
     int64_t prev_existing_degree_{-1};
+    // Input rows when pulled in batches, and the one whose edges are being expanded
+    FrameBatch input_batch_;
+    size_t input_row_{0};
 
     bool InitEdges(Frame &, ExecutionContext &);
+    bool InitEdgesFrom(Frame &, ExecutionContext &);
+    std::optional<std::pair<EdgeAccessor, EdgeAtom::Direction>> NextEdge(ExecutionContext &);
   };
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
@@ -1148,6 +1208,57 @@ class Expand : public memgraph::query::plan::LogicalOperator {
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
 };
 
+/// Expansion that closes a cycle, like `(x)-[e1]->(y)-[e2]->(z)` where `z` is
+/// already on the frame. It does the work of an Expand from `x` to a new node
+/// `y`, followed by an Expand from `y` to the existing `z`, but instead of
+/// walking the edges of every `y` it intersects the adjacency of `x` with the
+/// adjacency of `z`. The edges of `z` are indexed by their other endpoint and
+/// each neighbour of `x` is looked up there. The index is kept for as long as
+/// the input keeps `z`, which for cyclic patterns is most of the input rows.
+///
+/// The planner doesn't create this operator, the plan rewrite fuses the two
+/// Expands into it.
+class ExpandIntersect : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  /**
+   * @param input Logical operator that binds the input and the closing node.
+   * @param input_symbol Symbol of the node the expansion starts from.
+   * @param common Expansion from the input node to a new node.
+   * @param closing Expansion from that new node to the existing closing node.
+   * @param view State from which the nodes should get expanded.
+   */
+  ExpandIntersect(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, ExpandCommon common,
+                  ExpandCommon closing, storage::View view);
+
+  ExpandIntersect() = default;
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *, metrics::DatabaseMetricHandles &) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  Symbol input_symbol_;
+  /// Expansion from `input_symbol_` to a new node.
+  memgraph::query::plan::ExpandCommon common_;
+  /// Expansion from `common_.node_symbol` to the node already on the frame.
+  memgraph::query::plan::ExpandCommon closing_;
+  storage::View view_;
+
+  std::string ToString(const DbAccessor *dba) const override;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
+};
+
 struct ExpansionLambda {
   static const utils::TypeInfo kType;
 
@@ -1327,6 +1438,8 @@ class Filter : public memgraph::query::plan::LogicalOperator {
   std::vector<std::shared_ptr<memgraph::query::plan::LogicalOperator>> pattern_filters_;
   Expression *expression_;
   memgraph::query::plan::Filters all_filters_;
+  /// `expression_` compiled once the plan is final, see `CompileExpressions`. Null when it has no compiled form.
+  std::shared_ptr<const CompiledFilter> compiled_expression_;
 
   static std::string SingleFilterName(const query::plan::FilterInfo &single_filter);
 
@@ -1339,13 +1452,19 @@ class Filter : public memgraph::query::plan::LogicalOperator {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *, metrics::DatabaseMetricHandles &);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    bool EvaluateExpression(ExpressionEvaluator &evaluator, Frame &frame, ExecutionContext &context);
+
     const Filter &self_;
     const UniqueCursorPtr input_cursor_;
     const std::vector<UniqueCursorPtr> pattern_filter_cursors_;
+    // Operands of the compiled expression, bound on the first pull
+    utils::pmr::vector<TypedValue> compiled_operands_;
+    bool compiled_operands_bound_{false};
   };
 };
 
@@ -1380,6 +1499,9 @@ class Produce : public memgraph::query::plan::LogicalOperator {
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
   std::vector<NamedExpression *> named_expressions_;
+  /// `named_expressions_` compiled once the plan is final, see `CompileExpressions`. Null when they have no compiled
+  /// form.
+  std::shared_ptr<const CompiledProjection> compiled_projection_;
 
   std::string ToString(const DbAccessor *dba) const override;
 
@@ -1390,10 +1512,13 @@ class Produce : public memgraph::query::plan::LogicalOperator {
    public:
     ProduceCursor(const Produce &, utils::MemoryResource *, metrics::DatabaseMetricHandles &);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    void Project(ExpressionEvaluator &evaluator, Frame &frame, ExecutionContext &context);
+
     const Produce &self_;
     const UniqueCursorPtr input_cursor_;
   };
@@ -2066,6 +2191,44 @@ class OrderByParallel : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Streams the rows of a Produce pulled by `num_threads` branches in parallel, in the order they are produced.
+class ProduceParallel : public memgraph::query::plan::LogicalOperator {
+ public:
+  static constexpr utils::TypeInfo kType{
+      utils::TypeId::PRODUCE_PARALLEL, "ProduceParallel", &query::plan::LogicalOperator::kType};
+
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  ProduceParallel() = default;
+  ProduceParallel(const std::shared_ptr<LogicalOperator> &produce_input, size_t num_threads);
+
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *mem, metrics::DatabaseMetricHandles &metric_handles) const override;
+
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &table) const override;
+
+  std::vector<Symbol> OutputSymbols(const SymbolTable &symbol_table) const override;
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+
+  bool HasSingleInput() const override { return true; }
+
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  size_t num_threads_;
+
+  std::string ToString(const DbAccessor * /*dba*/) const override { return "ProduceParallel"; }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ProduceParallel>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->num_threads_ = num_threads_;
+    return object;
+  }
+};
+
 class ScanParallel : public memgraph::query::plan::LogicalOperator {
  public:
   static const utils::TypeInfo kType;
@@ -2575,6 +2738,10 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
   std::vector<Expression *> order_by_;
   std::vector<Symbol> output_symbols_;
   bool parallel_execution_{false};  // When true, OrderByCursor keeps order_by_cache_ for OrderByParallel merge
+  /// Bound of the Limit (and Skip) reading this operator, set by RewriteTopK. Only the first `skip_ + limit_` rows
+  /// can ever be pulled, so the cursor keeps just those instead of sorting all of its input.
+  Expression *limit_{nullptr};
+  Expression *skip_{nullptr};
 
   std::string ToString(const DbAccessor *dba) const override;
 
@@ -3189,6 +3356,9 @@ class HashJoin : public memgraph::query::plan::LogicalOperator {
   std::shared_ptr<memgraph::query::plan::LogicalOperator> right_op_;
   std::vector<Symbol> right_symbols_;
   EqualOperator *hash_join_condition_;
+  /// Set when the right side is split between parallel branches, which then probe one hashtable built from the whole
+  /// left side.
+  std::optional<size_t> parallel_execution_{std::nullopt};
 
   std::string ToString(const DbAccessor *dba) const override;
 
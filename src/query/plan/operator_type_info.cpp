@@ -36,6 +36,11 @@ constexpr utils::TypeInfo query::plan::ScanAll::kType{
 constexpr utils::TypeInfo query::plan::ScanAllByLabel::kType{
     .id = utils::TypeId::SCAN_ALL_BY_LABEL, .name = "ScanAllByLabel", .superclass = &query::plan::ScanAll::kType};
 
+constexpr utils::TypeInfo query::plan::ScanAllByLabelIntersection::kType{
+    .id = utils::TypeId::SCAN_ALL_BY_LABEL_INTERSECTION,
+    .name = "ScanAllByLabelIntersection",
+    .superclass = &query::plan::ScanAll::kType};
+
 constexpr utils::TypeInfo query::plan::ScanAllByLabelProperties::kType{
     utils::TypeId::SCAN_ALL_BY_LABEL_PROPERTIES, "ScanAllByLabelProperties", &query::plan::ScanAll::kType};
 
@@ -91,6 +96,10 @@ constexpr utils::TypeInfo query::plan::ExpansionLambda::kType{
 constexpr utils::TypeInfo query::plan::ExpandVariable::kType{
     .id = utils::TypeId::EXPAND_VARIABLE, .name = "ExpandVariable", .superclass = &query::plan::LogicalOperator::kType};
 
+constexpr utils::TypeInfo query::plan::ExpandIntersect::kType{.id = utils::TypeId::EXPAND_INTERSECT,
+                                                              .name = "ExpandIntersect",
+                                                              .superclass = &query::plan::LogicalOperator::kType};
+
 constexpr utils::TypeInfo query::plan::ConstructNamedPath::kType{
     utils::TypeId::CONSTRUCT_NAMED_PATH, "ConstructNamedPath", &query::plan::LogicalOperator::kType};
 
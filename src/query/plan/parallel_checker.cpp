@@ -22,6 +22,11 @@ bool ParallelChecker::PreVisit(OrderByParallel & /*unused*/) {
   return false;
 }
 
+bool ParallelChecker::PreVisit(ProduceParallel & /*unused*/) {
+  is_parallelized_ = true;
+  return false;
+}
+
 bool ParallelChecker::Visit(Once &) { return true; }  // NOLINT(hicpp-named-parameter)
 
 void ParallelChecker::CheckParallelized(const LogicalOperator &root) {
@@ -38,6 +38,7 @@ struct ParallelChecker : public virtual HierarchicalLogicalOperatorVisitor {
   // Parallel operators - return false to stop traversal once we find one
   bool PreVisit(AggregateParallel &) override;
   bool PreVisit(OrderByParallel &) override;
+  bool PreVisit(ProduceParallel &) override;
 
   bool Visit(Once &) override;
 };
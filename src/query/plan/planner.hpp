@@ -29,12 +29,15 @@
 #include "query/plan/pretty_print.hpp"
 #include "query/plan/rewrite/edge_index_lookup.hpp"
 #include "query/plan/rewrite/enum.hpp"
+#include "query/plan/rewrite/expand_intersect.hpp"
 #include "query/plan/rewrite/index_lookup.hpp"
+#include "query/plan/rewrite/index_only_scan.hpp"
 #include "query/plan/rewrite/join.hpp"
 #include "query/plan/rewrite/parallel_rewrite.hpp"
 #include "query/plan/rewrite/periodic_delete.hpp"
 #include "query/plan/rewrite/plan_validator.hpp"
 #include "query/plan/rewrite/pruning_bfs.hpp"
+#include "query/plan/rewrite/top_k.hpp"
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/variable_start_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
@@ -89,7 +92,15 @@ class PostProcessor final {
            [&](auto p) { return RewriteWithJoinRewriter(std::move(p), symbol_table, ast, db); } |
            [&](auto p) { return RewriteWithEdgeIndexRewriter(std::move(p), symbol_table, ast, db, parallel_exec); } |
            [&](auto p) { return RewritePeriodicDelete(std::move(p), symbol_table, ast, db); } |
-           [&](auto p) { return RewriteWithPruningBFS(std::move(p), symbol_table, parameters_, &reads_parameters_); }
+           [&](auto p) { return RewriteWithPruningBFS(std::move(p), symbol_table, parameters_, &reads_parameters_); } |
+           [&](auto p) { return RewriteExpandIntersect(std::move(p)); } |
+           // After the index rewrites, which may drop the OrderBy altogether
+           [&](auto p) { return RewriteTopK(std::move(p), symbol_table, ast, db); } |
+           // After the index rewrites, which pick the scans and fold filters into them
+           [&](auto p) {
+             if (parallel_exec) return p;
+             return RewriteIndexOnlyScan(std::move(p), symbol_table, ast, db);
+           }
 #ifdef MG_ENTERPRISE
            |
            // Keep at the end
@@ -282,6 +282,7 @@ struct PlanToJsonVisitor final : virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(Expand & /*unused*/) override;
   bool PreVisit(ExpandVariable & /*unused*/) override;
+  bool PreVisit(ExpandIntersect & /*unused*/) override;
 
   bool PreVisit(ConstructNamedPath & /*unused*/) override;
 
@@ -298,6 +299,7 @@ struct PlanToJsonVisitor final : virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(ScanAll & /*unused*/) override;
   bool PreVisit(ScanAllByLabel & /*unused*/) override;
+  bool PreVisit(ScanAllByLabelIntersection & /*unused*/) override;
   bool PreVisit(ScanAllByLabelProperties & /*unused*/) override;
   bool PreVisit(ScanAllById & /*unused*/) override;
 
@@ -336,6 +338,7 @@ struct PlanToJsonVisitor final : virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(Limit & /*unused*/) override;
   bool PreVisit(OrderBy & /*unused*/) override;
   bool PreVisit(OrderByParallel & /*unused*/) override;
+  bool PreVisit(ProduceParallel & /*unused*/) override;
   bool PreVisit(Distinct & /*unused*/) override;
   bool PreVisit(Union & /*unused*/) override;
 
@@ -389,6 +392,7 @@ PRE_VISIT(Delete);
 
 PRE_VISIT_TS(ScanAll);
 PRE_VISIT_TS(ScanAllByLabel);
+PRE_VISIT_TS(ScanAllByLabelIntersection);
 PRE_VISIT_TS(ScanAllByLabelProperties);
 PRE_VISIT_TS(ScanAllById);
 PRE_VISIT_TS(ScanAllByEdge);
@@ -456,6 +460,13 @@ bool PlanPrinter::PreVisit(OrderByParallel & /*unused*/) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(ProduceParallel & /*unused*/) {
+  // Hiding in the plan, since it is an implementation detail
+  // Next operator is always going to be Produce, so no information is lost
+  is_parallel_ = true;  // Start of parallel execution
+  return true;
+}
+
 bool PlanPrinter::PreVisit(ParallelMerge & /*unused*/) {
   // Hiding in the plan, since it is a backend connector, not a logical operator
   is_parallel_ = false;  // End of parallel execution
@@ -464,6 +475,7 @@ bool PlanPrinter::PreVisit(ParallelMerge & /*unused*/) {
 
 PRE_VISIT_TS(Expand);
 PRE_VISIT_TS(ExpandVariable);
+PRE_VISIT_TS(ExpandIntersect);
 PRE_VISIT_TS(Produce);
 
 PRE_VISIT(ConstructNamedPath);
@@ -664,6 +676,19 @@ bool PlanToJsonVisitor::PreVisit(ScanAllByLabel &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllByLabelIntersection &op) {
+  json self;
+  self["name"] = "ScanAllByLabelIntersection";
+  self["labels"] = ToJson(op.labels_, *dba_);
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(ScanAllByLabelProperties &op) {
   json self;
   self["name"] = "ScanAllByLabelProperties";
@@ -1096,6 +1121,26 @@ bool PlanToJsonVisitor::PreVisit(Expand &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ExpandIntersect &op) {
+  json self;
+  self["name"] = "ExpandIntersect";
+  self["input_symbol"] = ToJson(op.input_symbol_);
+  self["node_symbol"] = ToJson(op.common_.node_symbol);
+  self["edge_symbol"] = ToJson(op.common_.edge_symbol);
+  self["edge_types"] = ToJson(op.common_.edge_types, *dba_);
+  self["direction"] = ToString(op.common_.direction);
+  self["closing_node_symbol"] = ToJson(op.closing_.node_symbol);
+  self["closing_edge_symbol"] = ToJson(op.closing_.edge_symbol);
+  self["closing_edge_types"] = ToJson(op.closing_.edge_types, *dba_);
+  self["closing_direction"] = ToString(op.closing_.direction);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(ExpandVariable &op) {
   json self;
   self["name"] = "ExpandVariable";
@@ -1371,6 +1416,12 @@ bool PlanToJsonVisitor::PreVisit(OrderBy &op) {
     self["order_by"].push_back(json);
   }
   self["output_symbols"] = ToJson(op.output_symbols_);
+  if (op.limit_) {
+    self["limit"] = ToJson(op.limit_, *dba_);
+  }
+  if (op.skip_) {
+    self["skip"] = ToJson(op.skip_, *dba_);
+  }
 
   op.input_->Accept(*this);
   self["input"] = PopOutput();
@@ -1391,6 +1442,18 @@ bool PlanToJsonVisitor::PreVisit(OrderByParallel &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ProduceParallel &op) {
+  json self;
+  self["name"] = "ProduceParallel";
+  self["num_threads"] = op.num_threads_;
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(Merge &op) {
   json self;
   self["name"] = "Merge";
@@ -56,6 +56,7 @@ struct PlanPrinter final : virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(ScanAll & /*unused*/) override;
   bool PreVisit(ScanAllByLabel & /*unused*/) override;
+  bool PreVisit(ScanAllByLabelIntersection & /*unused*/) override;
   bool PreVisit(ScanAllByLabelProperties & /*unused*/) override;
   bool PreVisit(ScanAllById & /*unused*/) override;
   bool PreVisit(ScanAllByEdge & /*unused*/) override;
@@ -88,6 +89,7 @@ struct PlanPrinter final : virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(Expand & /*unused*/) override;
   bool PreVisit(ExpandVariable & /*unused*/) override;
+  bool PreVisit(ExpandIntersect & /*unused*/) override;
 
   bool PreVisit(ConstructNamedPath & /*unused*/) override;
 
@@ -109,6 +111,7 @@ struct PlanPrinter final : virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(Limit & /*unused*/) override;
   bool PreVisit(OrderBy & /*unused*/) override;
   bool PreVisit(OrderByParallel & /*unused*/) override;
+  bool PreVisit(ProduceParallel & /*unused*/) override;
   bool PreVisit(Distinct & /*unused*/) override;
   bool PreVisit(Union & /*unused*/) override;
   bool PreVisit(RollUpApply & /*unused*/) override;
@@ -19,6 +19,7 @@
 
 #include "query/context.hpp"
 #include "utils/likely.hpp"
+#include "utils/readable_size.hpp"
 
 namespace memgraph::query::plan {
 
@@ -57,7 +58,11 @@ class ProfilingStatsToTableHelper {
   void Output(const ProfilingStats &cumulative_stats) {
     auto cycles = IndividualCycles(cumulative_stats);
 
-    rows_.emplace_back(std::vector<TypedValue>{TypedValue(FormatOperator(cumulative_stats.name.c_str())),
+    auto name = cumulative_stats.name;
+    if (cumulative_stats.spilled_bytes > 0) {
+      name += fmt::format(" (spilled {})", utils::GetReadableSize(static_cast<double>(cumulative_stats.spilled_bytes)));
+    }
+    rows_.emplace_back(std::vector<TypedValue>{TypedValue(FormatOperator(name.c_str())),
                                                TypedValue(cumulative_stats.actual_hits),
                                                TypedValue(FormatRelativeTime(cycles)),
                                                TypedValue(FormatAbsoluteTime(cycles))});
@@ -141,6 +146,7 @@ class ProfilingStatsToJsonHelper {
 
     obj->emplace("name", cumulative_stats.name.c_str());
     obj->emplace("actual_hits", cumulative_stats.actual_hits);
+    obj->emplace("spilled_bytes", cumulative_stats.spilled_bytes);
     obj->emplace("relative_time", RelativeTime(cycles, total_cycles_));
     obj->emplace("absolute_time", AbsoluteTime(cycles, total_cycles_, total_time_));
     obj->emplace("children", json::array());
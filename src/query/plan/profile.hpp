@@ -28,6 +28,8 @@ struct ProfilingStats {
   int64_t actual_hits{0};
   unsigned long long num_cycles{0};
   uint64_t key{0};
+  // bytes the operator moved to disk to stay within the query memory limit
+  int64_t spilled_bytes{0};
   std::string name;
   // TODO: This should use the allocator for query execution
   std::vector<ProfilingStats> children;
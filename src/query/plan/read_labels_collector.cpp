@@ -0,0 +1,174 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/read_labels_collector.hpp"
+
+#include <algorithm>
+
+#include "query/db_accessor.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/ast/query/identifier.hpp"
+#include "utils/typeinfo.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PRE_VISIT(TOp) \
+  bool ReadLabelsCollector::PreVisit(TOp &) { return true; }
+
+// Operators which combine rows hide the filters above them from the operators below them
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define HIDE_FILTERS(TOp)                                             \
+  bool ReadLabelsCollector::PreVisit(TOp &) { return HideFilters(); } \
+  bool ReadLabelsCollector::PostVisit(TOp &) { return ShowFilters(); }
+
+namespace memgraph::query::plan {
+
+std::optional<std::vector<storage::LabelId>> ReadLabelsCollector::Collect(const LogicalOperator &root) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  const_cast<LogicalOperator *>(&root)->Accept(*this);
+  if (reads_any_label_) return std::nullopt;
+  std::ranges::sort(labels_);
+  auto const duplicates = std::ranges::unique(labels_);
+  labels_.erase(duplicates.begin(), duplicates.end());
+  return labels_;
+}
+
+bool ReadLabelsCollector::PreVisit(ScanAll &op) { return AddFilteredLabels(op.output_symbol_); }
+
+bool ReadLabelsCollector::PreVisit(ScanAllByLabel &op) {
+  AddLabels({op.label_});
+  return true;
+}
+
+bool ReadLabelsCollector::PreVisit(ScanAllByLabelIntersection &op) {
+  AddLabels(op.labels_);
+  return true;
+}
+
+bool ReadLabelsCollector::PreVisit(ScanAllByLabelProperties &op) {
+  AddLabels({op.label_});
+  return true;
+}
+
+bool ReadLabelsCollector::PreVisit(ScanAllByPointDistance &op) {
+  AddLabels({op.label_});
+  return true;
+}
+
+bool ReadLabelsCollector::PreVisit(ScanAllByPointWithinbbox &op) {
+  AddLabels({op.label_});
+  return true;
+}
+
+bool ReadLabelsCollector::PreVisit(ScanParallelByLabel &op) {
+  AddLabels({op.label_});
+  return true;
+}
+
+bool ReadLabelsCollector::PreVisit(ScanParallelByLabelProperties &op) {
+  AddLabels({op.label_});
+  return true;
+}
+
+// Scans the chunks of the parallel scan below it
+PRE_VISIT(ScanChunk)
+
+bool ReadLabelsCollector::PreVisit(Expand &op) {
+  // The edges between two known nodes also changed both of them
+  if (op.common_.existing_node) return true;
+  return AddFilteredLabels(op.common_.node_symbol);
+}
+
+bool ReadLabelsCollector::PreVisit(Filter &op) {
+  auto labels_of_symbols = filters_.back();
+  AddRequiredLabels(op.expression_, labels_of_symbols);
+  filters_.push_back(std::move(labels_of_symbols));
+  return true;
+}
+
+bool ReadLabelsCollector::PostVisit(Filter & /*op*/) { return ShowFilters(); }
+
+PRE_VISIT(ConstructNamedPath)
+PRE_VISIT(EdgeUniquenessFilter)
+PRE_VISIT(EmptyResult)
+PRE_VISIT(Produce)
+PRE_VISIT(Accumulate)
+PRE_VISIT(Unwind)
+
+HIDE_FILTERS(Aggregate)
+HIDE_FILTERS(Skip)
+HIDE_FILTERS(Limit)
+HIDE_FILTERS(OrderBy)
+HIDE_FILTERS(Distinct)
+HIDE_FILTERS(Optional)
+HIDE_FILTERS(Cartesian)
+HIDE_FILTERS(Union)
+HIDE_FILTERS(Apply)
+HIDE_FILTERS(IndexedJoin)
+HIDE_FILTERS(HashJoin)
+HIDE_FILTERS(RollUpApply)
+HIDE_FILTERS(EvaluatePatternFilter)
+
+bool ReadLabelsCollector::Visit(Once & /*op*/) { return true; }
+
+bool ReadLabelsCollector::DefaultPreVisit() {
+  reads_any_label_ = true;
+  return false;
+}
+
+void ReadLabelsCollector::AddLabels(const std::vector<storage::LabelId> &labels) {
+  labels_.insert(labels_.end(), labels.begin(), labels.end());
+}
+
+bool ReadLabelsCollector::AddFilteredLabels(const Symbol &node_symbol) {
+  auto const &labels_of_symbols = filters_.back();
+  auto const it = labels_of_symbols.find(node_symbol.position());
+  if (it == labels_of_symbols.end()) return DefaultPreVisit();
+  AddLabels(it->second);
+  return true;
+}
+
+void ReadLabelsCollector::AddRequiredLabels(Expression *expression, LabelsOfSymbols &labels_of_symbols) {
+  if (auto *and_operator = utils::Downcast<AndOperator>(expression)) {
+    AddRequiredLabels(and_operator->expression1_, labels_of_symbols);
+    AddRequiredLabels(and_operator->expression2_, labels_of_symbols);
+    return;
+  }
+  auto *labels_test = utils::Downcast<LabelsTest>(expression);
+  if (!labels_test) return;
+  auto *identifier = utils::Downcast<Identifier>(labels_test->expression_);
+  if (!identifier) return;
+  // A node passing the test has all of `labels_` and one of each group in `or_labels_`, so it has one of all of them
+  std::vector<storage::LabelId> labels;
+  for (const auto &label : labels_test->labels_) {
+    labels.push_back(dba_->NameToLabel(label.name));
+  }
+  for (const auto &group : labels_test->or_labels_) {
+    for (const auto &label : group) {
+      labels.push_back(dba_->NameToLabel(label.name));
+    }
+  }
+  if (labels.empty()) return;
+  auto &required = labels_of_symbols[identifier->symbol_pos_];
+  // A node which has to pass several tests is known by the labels of any of them
+  if (required.empty()) required = std::move(labels);
+}
+
+bool ReadLabelsCollector::HideFilters() {
+  filters_.emplace_back();
+  return true;
+}
+
+bool ReadLabelsCollector::ShowFilters() {
+  filters_.pop_back();
+  return true;
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,121 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "query/plan/operator.hpp"
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::query {
+class DbAccessor;
+}  // namespace memgraph::query
+
+namespace memgraph::query::plan {
+
+/// Collects the labels of the vertices a read-only plan reads, so that a commit which changed none of them can't have
+/// changed its results. Vertices come from label scans, and from scans of all nodes and expansions to nodes which a
+/// filter above them requires a label of. Only filters which see the rows of the scan or expansion one by one count,
+/// any operator which combines rows (aggregations, ordering, limits, optional matches, joins, ...) hides the filters
+/// above it. Any other operator which produces vertices, like an unfiltered scan, a variable length expansion or a
+/// procedure, may read vertices of any label.
+struct ReadLabelsCollector : public virtual HierarchicalLogicalOperatorVisitor {
+ public:
+  explicit ReadLabelsCollector(DbAccessor *dba) : dba_(dba) {}
+
+  ReadLabelsCollector(const ReadLabelsCollector &) = delete;
+  ReadLabelsCollector(ReadLabelsCollector &&) = delete;
+
+  ReadLabelsCollector &operator=(const ReadLabelsCollector &) = delete;
+  ReadLabelsCollector &operator=(ReadLabelsCollector &&) = delete;
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  /// Sorted labels read by the plan, nullopt when it may read vertices of any label.
+  std::optional<std::vector<storage::LabelId>> Collect(const LogicalOperator &root);
+
+  bool PreVisit(ScanAll &) override;
+  bool PreVisit(ScanAllByLabel &) override;
+  bool PreVisit(ScanAllByLabelIntersection &) override;
+  bool PreVisit(ScanAllByLabelProperties &) override;
+  bool PreVisit(ScanAllByPointDistance &) override;
+  bool PreVisit(ScanAllByPointWithinbbox &) override;
+  bool PreVisit(ScanParallelByLabel &) override;
+  bool PreVisit(ScanParallelByLabelProperties &) override;
+  bool PreVisit(ScanChunk &) override;
+
+  bool PreVisit(Expand &) override;
+
+  bool PreVisit(Filter &) override;
+  bool PostVisit(Filter &) override;
+
+  bool PreVisit(ConstructNamedPath &) override;
+  bool PreVisit(EdgeUniquenessFilter &) override;
+  bool PreVisit(EmptyResult &) override;
+  bool PreVisit(Produce &) override;
+  bool PreVisit(Accumulate &) override;
+  bool PreVisit(Unwind &) override;
+
+  bool PreVisit(Aggregate &) override;
+  bool PostVisit(Aggregate &) override;
+  bool PreVisit(Skip &) override;
+  bool PostVisit(Skip &) override;
+  bool PreVisit(Limit &) override;
+  bool PostVisit(Limit &) override;
+  bool PreVisit(OrderBy &) override;
+  bool PostVisit(OrderBy &) override;
+  bool PreVisit(Distinct &) override;
+  bool PostVisit(Distinct &) override;
+  bool PreVisit(Optional &) override;
+  bool PostVisit(Optional &) override;
+  bool PreVisit(Cartesian &) override;
+  bool PostVisit(Cartesian &) override;
+  bool PreVisit(Union &) override;
+  bool PostVisit(Union &) override;
+  bool PreVisit(Apply &) override;
+  bool PostVisit(Apply &) override;
+  bool PreVisit(IndexedJoin &) override;
+  bool PostVisit(IndexedJoin &) override;
+  bool PreVisit(HashJoin &) override;
+  bool PostVisit(HashJoin &) override;
+  bool PreVisit(RollUpApply &) override;
+  bool PostVisit(RollUpApply &) override;
+  bool PreVisit(EvaluatePatternFilter &) override;
+  bool PostVisit(EvaluatePatternFilter &) override;
+
+  bool Visit(Once &) override;
+
+ protected:
+  /// Any operator not handled above may read vertices of any label.
+  bool DefaultPreVisit() override;
+
+ private:
+  // Labels a filter requires of each node symbol
+  using LabelsOfSymbols = std::map<Symbol::Position_t, std::vector<storage::LabelId>>;
+
+  void AddLabels(const std::vector<storage::LabelId> &labels);
+  bool AddFilteredLabels(const Symbol &node_symbol);
+  void AddRequiredLabels(Expression *expression, LabelsOfSymbols &labels_of_symbols);
+  bool HideFilters();
+  bool ShowFilters();
+
+  DbAccessor *dba_;
+  bool reads_any_label_{false};
+  std::vector<storage::LabelId> labels_;
+  std::vector<LabelsOfSymbols> filters_{1};
+};
+
+}  // namespace memgraph::query::plan
@@ -35,6 +35,7 @@ PRE_VISIT(RemoveLabels, RWType::W, true)
 
 PRE_VISIT(ScanAll, RWType::R, true)
 PRE_VISIT(ScanAllByLabel, RWType::R, true)
+PRE_VISIT(ScanAllByLabelIntersection, RWType::R, true)
 PRE_VISIT(ScanAllByLabelProperties, RWType::R, true)
 PRE_VISIT(ScanAllById, RWType::R, true)
 
@@ -51,6 +52,7 @@ PRE_VISIT(ScanAllByVertexProperty, RWType::R, true)
 
 PRE_VISIT(Expand, RWType::R, true)
 PRE_VISIT(ExpandVariable, RWType::R, true)
+PRE_VISIT(ExpandIntersect, RWType::R, true)
 
 PRE_VISIT(ConstructNamedPath, RWType::R, true)
 
@@ -130,6 +132,7 @@ bool ReadWriteTypeChecker::PreVisit(RollUpApply &op) {
 
 PRE_VISIT(AggregateParallel, RWType::NONE, true)
 PRE_VISIT(OrderByParallel, RWType::NONE, true)
+PRE_VISIT(ProduceParallel, RWType::NONE, true)
 PRE_VISIT(ParallelMerge, RWType::NONE, true)
 PRE_VISIT(ScanParallel, RWType::R, true)
 PRE_VISIT(ScanParallelByLabel, RWType::R, true)
@@ -56,6 +56,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
 
   bool PreVisit(ScanAll &) override;
   bool PreVisit(ScanAllByLabel &) override;
+  bool PreVisit(ScanAllByLabelIntersection &) override;
   bool PreVisit(ScanAllByLabelProperties &) override;
   bool PreVisit(ScanAllById &) override;
 
@@ -72,6 +73,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
 
   bool PreVisit(Expand &) override;
   bool PreVisit(ExpandVariable &) override;
+  bool PreVisit(ExpandIntersect &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
 
@@ -107,6 +109,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
 
   bool PreVisit(AggregateParallel &) override;
   bool PreVisit(OrderByParallel &) override;
+  bool PreVisit(ProduceParallel &) override;
   bool PreVisit(ParallelMerge &) override;
   bool PreVisit(ScanParallel &) override;
   bool PreVisit(ScanParallelByLabel &) override;
@@ -0,0 +1,106 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// Expand intersect rewrite. A cyclic pattern like `(a)-[e1]->(b)-[e2]->(c)-[e3]->(a)` is planned as a chain of
+/// Expands whose last one ends in a node that's already bound, so every `c` reached from `b` has all of its edges
+/// expanded only to find the few that lead back to `a`. The last two Expands, and the filters the planner put between
+/// them, are replaced by an ExpandIntersect that looks up each neighbour of `b` among the neighbours of `a`, with the
+/// filters moved above it. The uniqueness filter of the closing edge, which always follows the closing Expand, is
+/// where a cycle is recognized.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "query/plan/operator.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+class ExpandIntersectRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once & /*unused*/) override { return true; }
+
+  // A commit in the middle of the query would leave edges of the previous transaction in the index of the closing node
+  bool PreVisit(PeriodicCommit & /*unused*/) override {
+    blocked_ = true;
+    return true;
+  }
+
+  bool PreVisit(PeriodicSubquery & /*unused*/) override {
+    blocked_ = true;
+    return true;
+  }
+
+  bool PostVisit(EdgeUniquenessFilter &op) override {
+    closing_filters_.push_back(&op);
+    return true;
+  }
+
+  /// Fuses the cycles found while visiting the plan.
+  void Rewrite() {
+    if (blocked_) return;
+    for (auto *filter : closing_filters_) TryFuse(*filter);
+  }
+
+ private:
+  static void TryFuse(EdgeUniquenessFilter &filter) {
+    auto closing = std::dynamic_pointer_cast<Expand>(filter.input());
+    if (!closing || !closing->common_.existing_node || closing->common_.edge_symbol != filter.expand_symbol_) return;
+
+    std::vector<LogicalOperator *> between;
+    auto op = closing->input();
+    while (op->GetTypeInfo() == EdgeUniquenessFilter::kType || op->GetTypeInfo() == Filter::kType) {
+      between.push_back(op.get());
+      op = op->input();
+    }
+    auto first = std::dynamic_pointer_cast<Expand>(op);
+    if (!first || first->common_.existing_node || first->common_.node_symbol != closing->input_symbol_ ||
+        first->common_.node_symbol == closing->common_.node_symbol) {
+      return;
+    }
+    // The index of the closing node is kept between rows, which is only correct while the expanded state doesn't
+    // change under it
+    if (first->view_ != storage::View::OLD || closing->view_ != storage::View::OLD) return;
+
+    auto fused = std::make_shared<ExpandIntersect>(
+        first->input(), first->input_symbol_, first->common_, closing->common_, storage::View::OLD);
+    if (between.empty()) {
+      filter.set_input(fused);
+      return;
+    }
+    between.back()->set_input(fused);
+    filter.set_input(closing->input());
+  }
+
+  bool blocked_{false};
+  // Uniqueness filters in the order they were visited, so cycles deeper in the plan are fused first
+  std::vector<EdgeUniquenessFilter *> closing_filters_;
+};
+
+}  // namespace impl
+
+inline std::unique_ptr<LogicalOperator> RewriteExpandIntersect(std::unique_ptr<LogicalOperator> root_op) {
+  auto rewriter = impl::ExpandIntersectRewriter{};
+  root_op->Accept(rewriter);
+  rewriter.Rewrite();
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
@@ -204,6 +204,7 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
         db_(db),
         index_hints_(std::move(index_hints)),
         parameters_(parameters),
+        parallel_execution_(parallel_execution),
         inherited_bound_symbols_(std::move(inherited_bound_symbols)),
         order_by_eliminator_(db, prev_ops_, parallel_execution) {}
 
@@ -629,6 +630,16 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByLabelIntersection &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+
+  bool PostVisit(ScanAllByLabelIntersection &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ScanAllByLabelProperties &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -969,6 +980,8 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
   std::vector<LogicalOperator *> prev_ops_;
   IndexHints index_hints_;
   const Parameters &parameters_;
+  // Parallel scans split a single index, so label indices aren't intersected then.
+  bool const parallel_execution_;
   OrderByEliminator<TDbAccessor> order_by_eliminator_;
 
   // additional symbols that are present from other non-main branches but have influence on indexing
@@ -1079,6 +1092,32 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return best_label;
   }
 
+  /// The indexed labels worth scanning together instead of scanning the smallest index of them and filtering on the
+  /// rest. Empty when there aren't any.
+  std::vector<LabelIx> FindLabelIntersection(const std::unordered_set<LabelIx> &labels, int64_t best_label_count) {
+    if (parallel_execution_ || labels.size() < 2) return {};
+    // A hint picks the one label index to scan
+    for (const auto &[index_type, label, _] : index_hints_.label_index_hints_) {
+      if (labels.contains(label)) return {};
+    }
+
+    auto indexed_labels =
+        labels | ranges::views::filter([&](const LabelIx &label) { return db_->LabelIndexReady(GetLabel(label)); }) |
+        ranges::to_vector;
+    if (indexed_labels.size() < 2) return {};
+    // The order is only for the plan to come out the same every time
+    ranges::sort(indexed_labels, {}, &LabelIx::name);
+    auto const label_ids =
+        indexed_labels | ranges::views::transform([&](const LabelIx &label) { return GetLabel(label); }) |
+        ranges::to_vector;
+    auto const count = db_->VerticesIntersectionCount(label_ids);
+    if (!count) return {};
+    if (static_cast<double>(*count) > MiscParam::kLabelIntersectionMaxShare * static_cast<double>(best_label_count)) {
+      return {};
+    }
+    return indexed_labels;
+  }
+
   struct PointIndexInfo {
     storage::LabelId label_{};
     storage::PropertyId property_{};
@@ -1539,8 +1578,9 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       return HasIndexedSource(input_op->input());
     }
 
-    return type_info == ScanAllByLabel::kType || type_info == ScanAllByLabelProperties::kType ||
-           type_info == ScanAllById::kType || type_info == ScanAllByVertexProperty::kType;
+    return type_info == ScanAllByLabel::kType || type_info == ScanAllByLabelIntersection::kType ||
+           type_info == ScanAllByLabelProperties::kType || type_info == ScanAllById::kType ||
+           type_info == ScanAllByVertexProperty::kType;
   }
 
   // Estimates whether STShortestPath (pairwise bidirectional BFS) is beneficial
@@ -1607,6 +1647,10 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       auto *scan_op = dynamic_cast<ScanAllByLabel *>(op);
       return static_cast<double>(db_->VerticesCount(scan_op->label_));
     }
+    if (type_info == ScanAllByLabelIntersection::kType) {
+      auto *scan_op = dynamic_cast<ScanAllByLabelIntersection *>(op);
+      return static_cast<double>(db_->VerticesIntersectionCount(scan_op->labels_).value_or(0));
+    }
     if (type_info == ScanAllByLabelProperties::kType) {
       auto *scan_op = dynamic_cast<ScanAllByLabelProperties *>(op);
 
@@ -2055,6 +2099,14 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
           if (vertex_prop_result && vertex_prop_result->estimated_count < label_count) {
             return std::move(*vertex_prop_result);
           }
+          if (auto intersection = FindLabelIntersection(labels, label_count); !intersection.empty()) {
+            auto label_ids = intersection |
+                             ranges::views::transform([&](const LabelIx &label) { return GetLabel(label); }) |
+                             ranges::to_vector;
+            metadata.labels_to_erase.insert(metadata.labels_to_erase.end(), intersection.begin(), intersection.end());
+            auto op = std::make_unique<ScanAllByLabelIntersection>(input, node_symbol, std::move(label_ids), view);
+            return ScanByIndexResult{std::move(op), std::move(metadata)};
+          }
           metadata.labels_to_erase.push_back(label);
           auto op = std::make_unique<ScanAllByLabel>(input, node_symbol, GetLabel(label), view);
           return ScanByIndexResult{std::move(op), std::move(metadata)};
@@ -0,0 +1,373 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// Index-only scan rewrite. A label-property index walks the visible version of each vertex it produces to check that
+/// it still matches the entry, and a ScanAllByLabelProperties can have it decode the indexed values along the way.
+/// Filters and projections reading the scan's vertex through Limit, Skip and other Filters and Produces, so before
+/// anything could change the graph, get those properties from symbols the scan fills with the decoded values instead
+/// of looking them up on the vertex.
+///
+/// The AST is shared by all candidate plans, so expressions are cloned before their lookups are replaced.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "query/plan/operator.hpp"
+#include "query/plan/read_write_type_checker.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+template <class TDbAccessor>
+class ExpressionIndexValueRewriter : public ExpressionVisitor<void> {
+ public:
+  ExpressionIndexValueRewriter(ScanAllByLabelProperties *scan, SymbolTable *symbol_table, AstStorage *storage,
+                               TDbAccessor *dba)
+      : scan_(scan), symbol_table_(symbol_table), storage_(storage), dba_(dba) {
+    for (size_t pos = 0; pos != scan_->properties_.size(); ++pos) {
+      // Nested paths are indexed by a value inside a map, which the evaluator reads through the whole map
+      if (scan_->properties_[pos].size() != 1) continue;
+      positions_.emplace(scan_->properties_[pos][0], pos);
+    }
+    scan_->index_value_symbols_.resize(scan_->properties_.size());
+  }
+
+  /// Returns `expression` with the covered lookups replaced. It is changed in place, so it must not be shared.
+  Expression *Rewrite(Expression *expression) {
+    AcceptExpression(expression);
+    return expression;
+  }
+
+  bool replaced() const { return replaced_; }
+
+  void Reset() { replaced_ = false; }
+
+ private:
+  void Visit(PropertyLookup &lookup) override {
+    auto *identifier = utils::Downcast<Identifier>(lookup.expression_);
+    if (identifier && identifier->symbol_pos_ == scan_->output_symbol_.position() &&
+        lookup.evaluation_mode_ == PropertyLookup::EvaluationMode::GET_OWN_PROPERTY &&
+        lookup.property_path_.size() == 1) {
+      if (auto it = positions_.find(dba_->NameToProperty(lookup.property_.name)); it != positions_.end()) {
+        prev_expressions_.back() = ValueIdentifier(it->second);
+        replaced_ = true;
+        return;
+      }
+    }
+    AcceptExpression(lookup.expression_);
+  }
+
+  Identifier *ValueIdentifier(size_t pos) {
+    auto &symbol = scan_->index_value_symbols_[pos];
+    if (!symbol) symbol = symbol_table_->CreateAnonymousSymbol();
+    auto *identifier = storage_->Create<Identifier>(symbol->name());
+    identifier->MapTo(*symbol);
+    return identifier;
+  }
+
+  // Helper method to maintain the previous expressions
+  void AcceptExpression(Expression *&expr) {
+    if (!expr) return;
+    prev_expressions_.emplace_back(expr);
+    expr->Accept(*this);
+    // If modified, then replace the expression
+    if (expr != prev_expressions_.back()) {
+      expr = prev_expressions_.back();
+    }
+    prev_expressions_.pop_back();
+  }
+
+  // Unary operators
+  void Visit(NotOperator &op) override { AcceptExpression(op.expression_); }
+
+  void Visit(IsNullOperator &op) override { AcceptExpression(op.expression_); };
+
+  void Visit(UnaryPlusOperator &op) override { AcceptExpression(op.expression_); }
+
+  void Visit(UnaryMinusOperator &op) override { AcceptExpression(op.expression_); }
+
+  // Binary operators
+  void Visit(OrOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(XorOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(AndOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(NotEqualOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(EqualOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(InListOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(AdditionOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(SubtractionOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(MultiplicationOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(DivisionOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(ModOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(ExponentiationOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(LessOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(GreaterOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(LessEqualOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(GreaterEqualOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(RangeOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(SubscriptOperator &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  void Visit(Aggregation &op) override {
+    AcceptExpression(op.expression1_);
+    AcceptExpression(op.expression2_);
+  }
+
+  // Other
+  void Visit(ListSlicingOperator &op) override {
+    AcceptExpression(op.list_);
+    AcceptExpression(op.lower_bound_);
+    AcceptExpression(op.upper_bound_);
+  }
+
+  void Visit(IfOperator &op) override {
+    AcceptExpression(op.condition_);
+    AcceptExpression(op.then_expression_);
+    AcceptExpression(op.else_expression_);
+  }
+
+  void Visit(ListLiteral &op) override {
+    for (auto *&element : op.elements_) {
+      AcceptExpression(element);
+    }
+  }
+
+  void Visit(MapLiteral &op) override {
+    for (auto &[key, element] : op.elements_) {
+      AcceptExpression(element);
+    }
+  }
+
+  void Visit(MapProjectionLiteral &op) override {}
+
+  void Visit(LabelsTest &op) override {}
+
+  void Visit(EdgeTypesTest &op) override {}
+
+  void Visit(Function &op) override {
+    for (auto *&argument : op.arguments_) {
+      AcceptExpression(argument);
+    }
+  }
+
+  void Visit(Reduce &op) override { AcceptExpression(op.expression_); }
+
+  void Visit(Coalesce &op) override {
+    for (auto *&expression : op.expressions_) {
+      AcceptExpression(expression);
+    }
+  }
+
+  void Visit(Extract &op) override { AcceptExpression(op.expression_); }
+
+  void Visit(SubqueryExpression &op) override {}
+
+  void Visit(All &op) override {}
+
+  void Visit(Single &op) override {}
+
+  void Visit(Any &op) override {}
+
+  void Visit(None &op) override {}
+
+  void Visit(ListComprehension &op) override {}
+
+  void Visit(Identifier &op) override {}
+
+  void Visit(PrimitiveLiteral &op) override {}
+
+  void Visit(AllPropertiesLookup &op) override {}
+
+  void Visit(ParameterLookup &op) override {}
+
+  void Visit(RegexMatch &op) override {}
+
+  void Visit(NamedExpression &op) override { AcceptExpression(op.expression_); }
+
+  void Visit(PatternComprehension &op) override {}
+
+  void Visit(EnumValueAccess &op) override {}
+
+  ScanAllByLabelProperties *scan_;
+  SymbolTable *symbol_table_;
+  AstStorage *storage_;
+  TDbAccessor *dba_;
+  // Index position of each covered property
+  std::unordered_map<storage::PropertyId, size_t> positions_;
+  std::vector<Expression *> prev_expressions_;
+  bool replaced_{false};
+};
+
+template <class TDbAccessor>
+class IndexOnlyScanRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  IndexOnlyScanRewriter(SymbolTable *symbolTable, AstStorage *astStorage, TDbAccessor *db)
+      : symbol_table(symbolTable), ast_storage(astStorage), db(db) {}
+
+  ~IndexOnlyScanRewriter() override = default;
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once &t) override { return true; }
+
+  bool PreVisit(Produce &op) override {
+    RewriteChain(op);
+    return true;
+  }
+
+  bool PreVisit(Filter &op) override {
+    RewriteChain(op);
+    return true;
+  }
+
+ private:
+  // Operators are visited top-down, so the first one reaching a scan takes the longest chain above it
+  void RewriteChain(LogicalOperator &top) {
+    std::vector<LogicalOperator *> chain;
+    auto *op = &top;
+    for (;; op = op->input().get()) {
+      auto const &type = op->GetTypeInfo();
+      if (type == Produce::kType) {
+        chain.push_back(op);
+      } else if (type == Filter::kType) {
+        // Pattern filters run their own branches over the vertex
+        if (!static_cast<Filter *>(op)->pattern_filters_.empty()) return;
+        chain.push_back(op);
+      } else if (type != Limit::kType && type != Skip::kType) {
+        break;
+      }
+    }
+    if (op->GetTypeInfo() != ScanAllByLabelProperties::kType) return;
+    auto *scan = static_cast<ScanAllByLabelProperties *>(op);
+    // Already rewritten from an operator higher up the same chain
+    if (!scan->index_value_symbols_.empty()) return;
+
+    auto rewriter = ExpressionIndexValueRewriter<TDbAccessor>{scan, symbol_table, ast_storage, db};
+    for (auto *chain_op : chain) {
+      if (chain_op->GetTypeInfo() == Filter::kType) {
+        auto &filter = static_cast<Filter &>(*chain_op);
+        rewriter.Reset();
+        auto *expression = rewriter.Rewrite(filter.expression_->Clone(ast_storage));
+        if (rewriter.replaced()) filter.expression_ = expression;
+      } else {
+        for (auto *&named_expression : static_cast<Produce *>(chain_op)->named_expressions_) {
+          rewriter.Reset();
+          auto *clone = named_expression->Clone(ast_storage);
+          clone->expression_ = rewriter.Rewrite(clone->expression_);
+          if (rewriter.replaced()) named_expression = clone;
+        }
+      }
+    }
+    if (std::ranges::none_of(scan->index_value_symbols_, [](auto const &symbol) { return symbol.has_value(); })) {
+      scan->index_value_symbols_.clear();
+    }
+  }
+
+  SymbolTable *symbol_table;
+  AstStorage *ast_storage;
+  TDbAccessor *db;
+};
+
+}  // namespace impl
+
+template <class TDbAccessor>
+std::unique_ptr<LogicalOperator> RewriteIndexOnlyScan(std::unique_ptr<LogicalOperator> root_op,
+                                                      SymbolTable *symbol_table, AstStorage *ast_storage,
+                                                      TDbAccessor *db) {
+  // With writes in the query the graph can change between the scan and the operators above it
+  auto rw_checker = ReadWriteTypeChecker{};
+  rw_checker.InferRWType(*root_op);
+  if (rw_checker.type == ReadWriteTypeChecker::RWType::W || rw_checker.type == ReadWriteTypeChecker::RWType::RW) {
+    return root_op;
+  }
+  auto rewriter = impl::IndexOnlyScanRewriter<TDbAccessor>{symbol_table, ast_storage, db};
+  root_op->Accept(rewriter);
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
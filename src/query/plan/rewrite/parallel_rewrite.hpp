@@ -23,6 +23,7 @@
 #include "flags/bolt.hpp"
 #include "interpret/eval.hpp"
 #include "query/dependant_symbol_visitor.hpp"
+#include "query/plan/cost_estimator.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/read_write_type_checker.hpp"
 #include "utils/typeinfo.hpp"
@@ -34,8 +35,13 @@ namespace impl {
 template <class TDbAccessor>
 class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
  public:
-  ParallelRewriter(SymbolTable *symbolTable, AstStorage *astStorage, TDbAccessor *db, size_t num_threads)
-      : symbol_table(symbolTable), ast_storage(astStorage), db(db), num_threads_(num_threads) {}
+  ParallelRewriter(SymbolTable *symbolTable, AstStorage *astStorage, TDbAccessor *db, const Parameters &parameters,
+                   size_t num_threads)
+      : symbol_table(symbolTable),
+        ast_storage(astStorage),
+        db(db),
+        parameters_(parameters),
+        num_threads_(num_threads) {}
 
   std::unique_ptr<LogicalOperator> Rewrite(std::unique_ptr<LogicalOperator> root) {
     root_ = std::move(root);
@@ -66,7 +72,6 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
 
   DEFAULT_VISITS(Accumulate)
   DEFAULT_VISITS(Apply)
-  DEFAULT_VISITS(Produce)
   DEFAULT_VISITS(Merge)
   DEFAULT_VISITS(Optional)
   DEFAULT_VISITS(Foreach)
@@ -99,10 +104,12 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
   DEFAULT_VISITS(RemoveNestedProperty)
   DEFAULT_VISITS(Expand)
   DEFAULT_VISITS(ExpandVariable)
+  DEFAULT_VISITS(ExpandIntersect)
   DEFAULT_VISITS(CreateNode)
   DEFAULT_VISITS(CreateExpand)
   DEFAULT_VISITS(ScanAll)
   DEFAULT_VISITS(ScanAllByLabel)
+  DEFAULT_VISITS(ScanAllByLabelIntersection)
   DEFAULT_VISITS(ScanAllByLabelProperties)
   DEFAULT_VISITS(ScanAllById)
   DEFAULT_VISITS(ScanAllByEdge)
@@ -243,11 +250,50 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  // Produce streaming the query results (potentially parallelizable)
+  bool PreVisit(Produce &op) override {
+    // Only the rows returned by the query can be streamed in any order; Skip, Limit and Distinct above them run on the
+    // merged stream
+    const bool returns_results = std::ranges::all_of(prev_ops_, [](const LogicalOperator *prev_op) {
+      return std::ranges::find(update_types, prev_op->GetTypeInfo()) != update_types.end();
+    });
+    if (!returns_results) {
+      prev_ops_.push_back(&op);
+      return true;
+    }
+
+    // Collect symbols needed by this Produce (from named expressions)
+    std::set<Symbol::Position_t> required_symbols;
+    DependantSymbolVisitor symbol_visitor(required_symbols);
+    for (auto *named_expr : op.named_expressions_) {
+      if (named_expr != nullptr && named_expr->expression_ != nullptr) {
+        named_expr->expression_->Accept(symbol_visitor);
+      }
+    }
+
+    // Use the generic parallel rewrite logic
+    auto create_parallel = [this](auto op) {
+      using OpType = std::decay_t<decltype(op)>;
+      if constexpr (std::is_same_v<OpType, std::unique_ptr<LogicalOperator>>) {
+        return std::make_unique<ProduceParallel>(std::shared_ptr<LogicalOperator>(std::move(op)), num_threads_);
+      } else {
+        return std::make_shared<ProduceParallel>(std::move(op), num_threads_);
+      }
+    };
+    return TryParallelizeOperator(op, required_symbols, "produce", create_parallel);
+  }
+
+  bool PostVisit(Produce &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
  private:
   std::unique_ptr<LogicalOperator> root_;
   SymbolTable *symbol_table;
   AstStorage *ast_storage;
   TDbAccessor *db;
+  const Parameters &parameters_;
   std::vector<LogicalOperator *> prev_ops_;
   size_t num_threads_;
 
@@ -340,6 +386,8 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
       } else if (auto *hash_join_op = dynamic_cast<HashJoin *>(scan_parent)) {
         if (hash_join_op->left_op_.get() == target_scan) {
           hash_join_op->left_op_ = scan_chunk;
+        } else if (hash_join_op->right_op_.get() == target_scan && std::ranges::contains(update_ops, scan_parent)) {
+          hash_join_op->right_op_ = scan_chunk;
         } else {
           return failure("Target scan not found in left branch of HashJoin");
         }
@@ -372,6 +420,8 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
         limit_op->parallel_execution_.emplace(num_threads_);
       } else if (auto *distinct_op = dynamic_cast<Distinct *>(update_op)) {
         distinct_op->parallel_execution_.emplace(num_threads_);
+      } else if (auto *hash_join_op = dynamic_cast<HashJoin *>(update_op)) {
+        hash_join_op->parallel_execution_.emplace(num_threads_);
       } else {
         return failure(std::string{"Unsupported operator in parallel chain: "} + update_op->GetTypeInfo().name);
       }
@@ -744,6 +794,20 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
     return false;
   }
 
+  // Whether the branches should split the right side of a HashJoin and probe one hashtable built from the whole left
+  // side, instead of splitting the left side and each building a part of the hashtable and probing the whole right
+  // side. The former pays off once the right side is estimated to be at least as large as the left one.
+  bool ProbeHashJoinInParallel(HashJoin &op) {
+    if (ConflictingOperators(op.left_op_.get())) return false;
+    return EstimateCardinality(*op.right_op_) >= EstimateCardinality(*op.left_op_);
+  }
+
+  double EstimateCardinality(LogicalOperator &branch) {
+    CostEstimator<TDbAccessor> estimator(db, *symbol_table, parameters_, IndexHints{});
+    branch.Accept(estimator);
+    return estimator.cardinality();
+  }
+
   // Helper function to find the Scan operator that produces the required symbols
   // This traces symbol dependencies backwards through operators
   // Returns true if a suitable Scan is found, false otherwise
@@ -940,13 +1004,18 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
         // The right branch is going to be fully executed by each parallel branch, so no need to update operators to
         // their parallel versions
         // However, the right branch needs to be checked for conflicting operators
+        // The exception is a HashJoin whose right side is expected to outgrow the left one, see ProbeHashJoinInParallel
         LogicalOperator *found_scan = nullptr;
         LogicalOperator *found_parent = current;
-        std::vector<LogicalOperator *> update_ops;
+        std::vector<LogicalOperator *> branch_update_ops;
         if (auto *union_op = dynamic_cast<Union *>(current)) {
           if (ConflictingOperators(union_op->right_op_.get())) break;
-          if (FindScanForSymbols(
-                  union_op->left_op_.get(), symbols_to_find, found_scan, found_parent, update_ops, original_start)) {
+          if (FindScanForSymbols(union_op->left_op_.get(),
+                                 symbols_to_find,
+                                 found_scan,
+                                 found_parent,
+                                 branch_update_ops,
+                                 original_start)) {
             target_scan = found_scan;
             scan_parent = found_parent;
           }
@@ -956,7 +1025,7 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
                                  symbols_to_find,
                                  found_scan,
                                  found_parent,
-                                 update_ops,
+                                 branch_update_ops,
                                  original_start)) {
             target_scan = found_scan;
             scan_parent = found_parent;
@@ -967,18 +1036,35 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
                                  symbols_to_find,
                                  found_scan,
                                  found_parent,
-                                 update_ops,
+                                 branch_update_ops,
                                  original_start)) {
             target_scan = found_scan;
             scan_parent = found_parent;
           }
         } else if (auto *hash_join_op = dynamic_cast<HashJoin *>(current)) {
           if (ConflictingOperators(hash_join_op->right_op_.get())) break;
+          if (ProbeHashJoinInParallel(*hash_join_op)) {
+            // The branches split the right side and probe one hashtable built from the whole left side
+            std::set<Symbol::Position_t> right_symbols;
+            for (const auto &sym : hash_join_op->right_symbols_) right_symbols.insert(sym.position());
+            if (FindScanForSymbols(hash_join_op->right_op_.get(),
+                                   right_symbols,
+                                   found_scan,
+                                   found_parent,
+                                   branch_update_ops,
+                                   original_start)) {
+              target_scan = found_scan;
+              scan_parent = found_parent;
+              update_ops.insert(update_ops.end(), branch_update_ops.begin(), branch_update_ops.end());
+              update_ops.push_back(hash_join_op);
+              break;
+            }
+          }
           if (FindScanForSymbols(hash_join_op->left_op_.get(),
                                  symbols_to_find,
                                  found_scan,
                                  found_parent,
-                                 update_ops,
+                                 branch_update_ops,
                                  original_start)) {
             target_scan = found_scan;
             scan_parent = found_parent;
@@ -989,15 +1075,19 @@ class ParallelRewriter final : public HierarchicalLogicalOperatorVisitor {
                                  symbols_to_find,
                                  found_scan,
                                  found_parent,
-                                 update_ops,
+                                 branch_update_ops,
                                  original_start)) {
             target_scan = found_scan;
             scan_parent = found_parent;
           }
         } else if (auto *union_op = dynamic_cast<Union *>(current)) {
           if (ConflictingOperators(union_op->right_op_.get())) break;
-          if (FindScanForSymbols(
-                  union_op->left_op_.get(), symbols_to_find, found_scan, found_parent, update_ops, original_start)) {
+          if (FindScanForSymbols(union_op->left_op_.get(),
+                                 symbols_to_find,
+                                 found_scan,
+                                 found_parent,
+                                 branch_update_ops,
+                                 original_start)) {
             target_scan = found_scan;
             scan_parent = found_parent;
           }
@@ -1049,7 +1139,7 @@ std::unique_ptr<LogicalOperator> RewriteParallelExecution(
       // Default value
       return FLAGS_bolt_num_workers;
     };
-    impl::ParallelRewriter<TDbAccessor> rewriter{symbol_table, ast_storage, db, get_num_threads()};
+    impl::ParallelRewriter<TDbAccessor> rewriter{symbol_table, ast_storage, db, parameters, get_num_threads()};
     return rewriter.Rewrite(std::move(root_op));
   }
   return root_op;
@@ -0,0 +1,80 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// Top-K rewrite. An OrderBy read directly by Limit, possibly through Skip, can only ever hand out its first
+/// `skip + limit` rows, so the bound is copied onto the OrderBy and its cursor keeps a bounded heap instead of sorting
+/// the whole input. Under parallel execution every branch keeps its own top rows and OrderByParallel merges them.
+
+#pragma once
+
+#include <memory>
+
+#include "query/plan/operator.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+template <class TDbAccessor>
+class TopKRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  TopKRewriter(SymbolTable *symbolTable, AstStorage *astStorage, TDbAccessor *db)
+      : symbol_table(symbolTable), ast_storage(astStorage), db(db) {}
+
+  ~TopKRewriter() override = default;
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once &t) override { return true; }
+
+  bool PreVisit(Limit &op) override {
+    if (!IsConstant(op.expression_)) return true;
+    auto *input = op.input().get();
+    Expression *skip = nullptr;
+    if (auto *skip_op = dynamic_cast<Skip *>(input)) {
+      if (!IsConstant(skip_op->expression_)) return true;
+      skip = skip_op->expression_;
+      input = skip_op->input().get();
+    }
+    if (auto *order_by = dynamic_cast<OrderBy *>(input)) {
+      order_by->limit_ = op.expression_;
+      order_by->skip_ = skip;
+    }
+    return true;
+  }
+
+ private:
+  // The cursor evaluates the bound once more, so it has to come out the same
+  static bool IsConstant(Expression *expression) {
+    return utils::Downcast<PrimitiveLiteral>(expression) != nullptr ||
+           utils::Downcast<ParameterLookup>(expression) != nullptr;
+  }
+
+  SymbolTable *symbol_table;
+  AstStorage *ast_storage;
+  TDbAccessor *db;
+};
+
+}  // namespace impl
+
+template <class TDbAccessor>
+std::unique_ptr<LogicalOperator> RewriteTopK(std::unique_ptr<LogicalOperator> root_op, SymbolTable *symbol_table,
+                                             AstStorage *ast_storage, TDbAccessor *db) {
+  auto rewriter = impl::TopKRewriter<TDbAccessor>{symbol_table, ast_storage, db};
+  root_op->Accept(rewriter);
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
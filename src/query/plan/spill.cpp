@@ -0,0 +1,229 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/spill.hpp"
+
+#include <string>
+#include <system_error>
+
+#include "flags/general.hpp"
+#include "query/context.hpp"
+#include "query/db_accessor.hpp"
+#include "query/exceptions.hpp"
+#include "query/path.hpp"
+#include "utils/query_memory_tracker.hpp"
+#include "utils/uuid.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+
+constexpr std::string_view kSpillMagic{"MGsp"};
+constexpr uint64_t kSpillVersion{1};
+constexpr std::string_view kSpillDirectory{"query_spill"};
+
+// Spill once less than 1/kSpillHeadroom of the query memory limit is left
+constexpr size_t kSpillHeadroom{4};
+
+enum class SpilledType : uint8_t { VALUE, LIST, MAP, VERTEX, EDGE, PATH };
+
+}  // namespace
+
+SpillFile::SpillFile()
+    : path_(std::filesystem::path(FLAGS_data_directory) / kSpillDirectory / utils::GenerateUUID()),
+      encoder_(std::make_unique<storage::durability::Encoder<utils::OutputFile>>()) {
+  if (!utils::EnsureDir(path_.parent_path()) || !encoder_->Initialize(path_, kSpillMagic, kSpillVersion)) {
+    throw QueryRuntimeException("Couldn't create the file {} to spill query results to.", path_.string());
+  }
+}
+
+SpillFile::~SpillFile() {
+  if (encoder_) encoder_->Close();
+  decoder_.reset();
+  std::error_code error;
+  std::filesystem::remove(path_, error);
+}
+
+void SpillFile::Write(std::span<const TypedValue> row) {
+  DMG_ASSERT(encoder_, "Writing to a spill file that was already finished");
+  encoder_->WriteUint(row.size());
+  for (const auto &value : row) WriteValue(value);
+  ++rows_;
+}
+
+uint64_t SpillFile::FinishWriting() {
+  DMG_ASSERT(encoder_, "Spill file was already finished");
+  auto const size = encoder_->GetPosition();
+  encoder_->Close();
+  encoder_.reset();
+  return size;
+}
+
+bool SpillFile::Read(utils::pmr::vector<TypedValue> *row, DbAccessor *dba) {
+  DMG_ASSERT(!encoder_, "Reading from a spill file that is still being written");
+  if (rows_read_ == rows_) {
+    decoder_.reset();
+    return false;
+  }
+  if (!decoder_) {
+    decoder_ = std::make_unique<storage::durability::Decoder>();
+    if (decoder_->Initialize(path_, std::string{kSpillMagic}) != kSpillVersion) {
+      throw QueryRuntimeException("Couldn't open the file {} with spilled query results.", path_.string());
+    }
+  }
+  auto const size = decoder_->ReadUint();
+  if (!size) throw QueryRuntimeException("Couldn't read spilled query results from {}.", path_.string());
+  auto *memory = row->get_allocator().resource();
+  row->clear();
+  row->reserve(*size);
+  for (uint64_t i = 0; i < *size; ++i) row->emplace_back(ReadValue(dba, memory));
+  ++rows_read_;
+  return true;
+}
+
+void SpillFile::WriteValue(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::List:
+      encoder_->WriteUint(static_cast<uint64_t>(SpilledType::LIST));
+      encoder_->WriteUint(value.ValueList().size());
+      for (const auto &elem : value.ValueList()) WriteValue(elem);
+      return;
+    case TypedValue::Type::Map:
+      encoder_->WriteUint(static_cast<uint64_t>(SpilledType::MAP));
+      encoder_->WriteUint(value.ValueMap().size());
+      for (const auto &[key, elem] : value.ValueMap()) {
+        encoder_->WriteString(key);
+        WriteValue(elem);
+      }
+      return;
+    case TypedValue::Type::Vertex:
+      encoder_->WriteUint(static_cast<uint64_t>(SpilledType::VERTEX));
+      encoder_->WriteUint(value.ValueVertex().Gid().AsUint());
+      return;
+    case TypedValue::Type::Edge:
+      encoder_->WriteUint(static_cast<uint64_t>(SpilledType::EDGE));
+      encoder_->WriteUint(value.ValueEdge().Gid().AsUint());
+      encoder_->WriteUint(value.ValueEdge().From().Gid().AsUint());
+      return;
+    case TypedValue::Type::Path: {
+      const auto &path = value.ValuePath();
+      encoder_->WriteUint(static_cast<uint64_t>(SpilledType::PATH));
+      encoder_->WriteUint(path.edges().size());
+      for (const auto &vertex : path.vertices()) encoder_->WriteUint(vertex.Gid().AsUint());
+      for (const auto &edge : path.edges()) {
+        encoder_->WriteUint(edge.Gid().AsUint());
+        encoder_->WriteUint(edge.From().Gid().AsUint());
+      }
+      return;
+    }
+    case TypedValue::Type::Graph:
+    case TypedValue::Type::VirtualGraph:
+    case TypedValue::Type::Function:
+    case TypedValue::Type::VirtualEdge:
+    case TypedValue::Type::VirtualNode:
+      throw QueryRuntimeException("Query memory limit reached and a value of type {} can't be spilled to disk.",
+                                  value.type());
+    case TypedValue::Type::Null:
+    case TypedValue::Type::Bool:
+    case TypedValue::Type::Int:
+    case TypedValue::Type::Double:
+    case TypedValue::Type::String:
+    case TypedValue::Type::Date:
+    case TypedValue::Type::LocalTime:
+    case TypedValue::Type::LocalDateTime:
+    case TypedValue::Type::ZonedDateTime:
+    case TypedValue::Type::Duration:
+    case TypedValue::Type::Enum:
+    case TypedValue::Type::Point2d:
+    case TypedValue::Type::Point3d:
+      encoder_->WriteUint(static_cast<uint64_t>(SpilledType::VALUE));
+      encoder_->WriteExternalPropertyValue(static_cast<storage::ExternalPropertyValue>(value));
+      return;
+  }
+}
+
+TypedValue SpillFile::ReadValue(DbAccessor *dba, utils::MemoryResource *memory) {
+  auto const read_uint = [this] {
+    auto value = decoder_->ReadUint();
+    if (!value) throw QueryRuntimeException("Couldn't read spilled query results from {}.", path_.string());
+    return *value;
+  };
+  auto const find_vertex = [&](uint64_t gid) {
+    auto vertex = dba->FindVertex(storage::Gid::FromUint(gid), storage::View::NEW);
+    if (!vertex) throw QueryRuntimeException("A node in the spilled query results doesn't exist anymore.");
+    return *vertex;
+  };
+  auto const find_edge = [&](uint64_t gid, uint64_t from_gid) {
+    auto edge = dba->FindEdge(storage::Gid::FromUint(gid), storage::Gid::FromUint(from_gid), storage::View::NEW);
+    if (!edge) throw QueryRuntimeException("A relationship in the spilled query results doesn't exist anymore.");
+    return *edge;
+  };
+
+  switch (static_cast<SpilledType>(read_uint())) {
+    case SpilledType::VALUE: {
+      auto value = decoder_->ReadExternalPropertyValue();
+      if (!value) throw QueryRuntimeException("Couldn't read spilled query results from {}.", path_.string());
+      return TypedValue(std::move(*value), memory);
+    }
+    case SpilledType::LIST: {
+      auto const size = read_uint();
+      TypedValue::TVector list(memory);
+      list.reserve(size);
+      for (uint64_t i = 0; i < size; ++i) list.emplace_back(ReadValue(dba, memory));
+      return TypedValue(std::move(list), memory);
+    }
+    case SpilledType::MAP: {
+      auto const size = read_uint();
+      TypedValue::TMap map(memory);
+      for (uint64_t i = 0; i < size; ++i) {
+        auto key = decoder_->ReadString();
+        if (!key) throw QueryRuntimeException("Couldn't read spilled query results from {}.", path_.string());
+        map.emplace(TypedValue::TString(*key, memory), ReadValue(dba, memory));
+      }
+      return TypedValue(std::move(map), memory);
+    }
+    case SpilledType::VERTEX:
+      return TypedValue(find_vertex(read_uint()), memory);
+    case SpilledType::EDGE: {
+      auto const gid = read_uint();
+      return TypedValue(find_edge(gid, read_uint()), memory);
+    }
+    case SpilledType::PATH: {
+      auto const size = read_uint();
+      std::vector<VertexAccessor> vertices;
+      vertices.reserve(size + 1);
+      for (uint64_t i = 0; i <= size; ++i) vertices.push_back(find_vertex(read_uint()));
+      Path path(std::allocator_arg, memory, vertices.front());
+      for (uint64_t i = 0; i < size; ++i) {
+        auto const gid = read_uint();
+        path.Expand(find_edge(gid, read_uint()));
+        path.Expand(vertices[i + 1]);
+      }
+      return TypedValue(std::move(path), memory);
+    }
+  }
+  throw QueryRuntimeException("Couldn't read spilled query results from {}.", path_.string());
+}
+
+bool ShouldSpill(ExecutionContext &context) {
+  if (!FLAGS_query_spill_to_disk || context.parallel_execution || !context.db_accessor) return false;
+  const auto &tracker = context.db_accessor->GetTransactionMemoryTracker();
+  auto const limit = tracker.QueryLimit();
+  if (limit == 0) return false;
+  return tracker.RemainingQueryMemory() < static_cast<int64_t>(limit / kSpillHeadroom);
+}
+
+void RecordSpill(ExecutionContext &context, uint64_t bytes) {
+  if (!context.is_profile_query || !context.stats_root) return;
+  context.stats_root->spilled_bytes += static_cast<int64_t>(bytes);
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,87 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+#include "query/typed_value.hpp"
+#include "storage/v2/durability/serialization.hpp"
+#include "utils/file.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query {
+class DbAccessor;
+struct ExecutionContext;
+}  // namespace memgraph::query
+
+namespace memgraph::query::plan {
+
+/// Number of files an operator spilling by the hash of a key splits its rows over.
+inline constexpr size_t kSpillPartitions = 8;
+
+/// Partition of a row whose key hashes to `hash`. Takes the high bits, which the hash tables holding a partition once
+/// it's read back don't bucket by.
+inline size_t SpillPartition(size_t hash) {
+  static_assert((kSpillPartitions & (kSpillPartitions - 1)) == 0, "kSpillPartitions must be a power of 2");
+  return (static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(kSpillPartitions));
+}
+
+/// Rows of values an operator moved out of memory to a temporary file under `<data_directory>/query_spill`. Rows are
+/// read back in the order they were written, once writing has finished. The file is removed together with the object.
+///
+/// Vertices and edges are written as their gids and found again when read. Graphs and functions can't be spilled.
+class SpillFile {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile(SpillFile &&) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile &operator=(SpillFile &&) = delete;
+
+  void Write(std::span<const TypedValue> row);
+
+  /// Closes the file for writing and returns its size in bytes. Reading can start after it.
+  uint64_t FinishWriting();
+
+  /// Reads the next row into `row`, returning false once all rows were read.
+  bool Read(utils::pmr::vector<TypedValue> *row, DbAccessor *dba);
+
+  uint64_t rows() const { return rows_; }
+
+ private:
+  void WriteValue(const TypedValue &value);
+  TypedValue ReadValue(DbAccessor *dba, utils::MemoryResource *memory);
+
+  std::filesystem::path path_;
+  // Only one of them is open at a time; each holds a buffer, so they only exist while in use
+  std::unique_ptr<storage::durability::Encoder<utils::OutputFile>> encoder_;
+  std::unique_ptr<storage::durability::Decoder> decoder_;
+  uint64_t rows_{0};
+  uint64_t rows_read_{0};
+};
+
+/// Whether an operator collecting its input in memory should move it to disk: the query runs under a memory limit
+/// of which less than a quarter is left. Spilling is done only outside of parallel execution, and can be turned off
+/// with `--query-spill-to-disk`.
+bool ShouldSpill(ExecutionContext &context);
+
+/// Adds `bytes` to the spilled bytes in the profile of the operator being pulled.
+void RecordSpill(ExecutionContext &context, uint64_t bytes);
+
+}  // namespace memgraph::query::plan
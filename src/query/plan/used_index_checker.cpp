@@ -35,6 +35,11 @@ bool UsedIndexChecker::PreVisit(ScanAllByLabel &op) {
   return true;
 }
 
+bool UsedIndexChecker::PreVisit(ScanAllByLabelIntersection &op) {
+  required_indices_.label_.insert(required_indices_.label_.end(), op.labels_.begin(), op.labels_.end());
+  return true;
+}
+
 bool UsedIndexChecker::PreVisit(ScanAllByLabelProperties &op) {
   required_indices_.label_properties_.emplace_back(op.label_, op.properties_);
   return true;
@@ -87,6 +92,7 @@ PRE_VISIT(ScanAllByEdgeId)
 
 PRE_VISIT(Expand)
 PRE_VISIT(ExpandVariable)
+PRE_VISIT(ExpandIntersect)
 
 PRE_VISIT(ConstructNamedPath)
 
@@ -42,6 +42,7 @@ struct UsedIndexChecker : public virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(ScanAll &) override;
   bool PreVisit(ScanAllByLabel &) override;
+  bool PreVisit(ScanAllByLabelIntersection &) override;
   bool PreVisit(ScanAllByLabelProperties &) override;
   bool PreVisit(ScanAllById &) override;
 
@@ -58,6 +59,7 @@ struct UsedIndexChecker : public virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(Expand &) override;
   bool PreVisit(ExpandVariable &) override;
+  bool PreVisit(ExpandIntersect &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
 
@@ -89,6 +89,17 @@ class VertexCountCache {
     return it->second;
   }
 
+  std::optional<int64_t> VerticesIntersectionCount(std::span<storage::LabelId const> labels) {
+    auto key = std::vector(labels.begin(), labels.end());
+    auto it = labels_vertex_intersection_count_.find(key);
+    if (it == labels_vertex_intersection_count_.end()) {
+      auto val = db_->VerticesIntersectionCount(labels);
+      labels_vertex_intersection_count_.emplace(std::move(key), val);
+      return val;
+    }
+    return it->second;
+  }
+
   int64_t EdgesCount() {
     if (!edges_count_) edges_count_ = db_->EdgesCount();
     return *edges_count_;
@@ -285,6 +296,9 @@ class VertexCountCache {
   std::unordered_map<LabelPropertiesRangesKey, int64_t, LabelPropertiesRangesHash, LabelPropertiesRangesEqual>
       label_properties_ranges_vertex_count_;
   std::unordered_map<LabelPropertyKey, std::optional<int64_t>, LabelPropertyHash> label_property_vertex_point_count_;
+  std::unordered_map<std::vector<storage::LabelId>, std::optional<int64_t>,
+                     utils::FnvCollection<std::vector<storage::LabelId>, storage::LabelId>>
+      labels_vertex_intersection_count_;
 
   std::optional<int64_t> edges_count_;
   std::unordered_map<EdgeTypePropertyKey, int64_t, EdgeTypePropertyHash> edge_type_property_edge_count_;
@@ -0,0 +1,212 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/result_cache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <string_view>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "query/query_user.hpp"
+#include "utils/memory.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+// Roughly what a node of the map takes besides its key and value
+constexpr size_t kMapNodeOverhead = 32;
+
+/// Unlike `==`, which finds 1 equal to 1.0, only values which are returned the same are the same.
+bool IsSameValue(const storage::ExternalPropertyValue &lhs, const storage::ExternalPropertyValue &rhs) {
+  if (lhs.type() != rhs.type()) return false;
+  switch (lhs.type()) {
+    case storage::PropertyValueType::Double:
+      return std::bit_cast<uint64_t>(lhs.ValueDouble()) == std::bit_cast<uint64_t>(rhs.ValueDouble());
+    case storage::PropertyValueType::List:
+      return std::ranges::equal(lhs.ValueList(), rhs.ValueList(), IsSameValue);
+    case storage::PropertyValueType::Map:
+      return std::ranges::equal(lhs.ValueMap(), rhs.ValueMap(), [](const auto &lhs_entry, const auto &rhs_entry) {
+        return lhs_entry.first == rhs_entry.first && IsSameValue(lhs_entry.second, rhs_entry.second);
+      });
+    default:
+      return lhs == rhs;
+  }
+}
+
+size_t ShallowHash(const storage::ExternalPropertyValue &value) {
+  switch (value.type()) {
+    case storage::PropertyValueType::Bool:
+      return std::hash<bool>{}(value.ValueBool());
+    case storage::PropertyValueType::Int:
+      return std::hash<int64_t>{}(value.ValueInt());
+    case storage::PropertyValueType::String:
+      return std::hash<std::string_view>{}(value.ValueString());
+    default:
+      return static_cast<size_t>(value.type());
+  }
+}
+
+/// The memory a value takes in the cache, nullopt for values which can't be cached.
+std::optional<size_t> CachedValueMemory(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Null:
+    case TypedValue::Type::Bool:
+    case TypedValue::Type::Int:
+    case TypedValue::Type::Double:
+    case TypedValue::Type::Date:
+    case TypedValue::Type::LocalTime:
+    case TypedValue::Type::LocalDateTime:
+    case TypedValue::Type::ZonedDateTime:
+    case TypedValue::Type::Duration:
+    case TypedValue::Type::Point2d:
+    case TypedValue::Type::Point3d:
+      return sizeof(TypedValue);
+    case TypedValue::Type::String:
+      return sizeof(TypedValue) + value.ValueString().capacity();
+    case TypedValue::Type::List: {
+      size_t memory = sizeof(TypedValue);
+      for (const auto &element : value.ValueList()) {
+        auto element_memory = CachedValueMemory(element);
+        if (!element_memory) return std::nullopt;
+        memory += *element_memory;
+      }
+      return memory;
+    }
+    case TypedValue::Type::Map: {
+      size_t memory = sizeof(TypedValue);
+      for (const auto &[key, element] : value.ValueMap()) {
+        auto element_memory = CachedValueMemory(element);
+        if (!element_memory) return std::nullopt;
+        memory += kMapNodeOverhead + key.capacity() + *element_memory;
+      }
+      return memory;
+    }
+    // Graph elements are only valid in the transaction which read them and enums can be renamed without a commit
+    default:
+      return std::nullopt;
+  }
+}
+
+}  // namespace
+
+ResultCacheKey::ResultCacheKey(frontend::HashedString query, const Parameters &parameters,
+                               const QueryUserOrRole *user_or_role)
+    : query_(std::move(query)), parameters_(parameters.begin(), parameters.end()) {
+  std::ranges::sort(parameters_, {}, [](const auto &parameter) { return parameter.first; });
+  if (user_or_role) {
+    username_ = user_or_role->username();
+    rolenames_ = user_or_role->rolenames();
+  }
+  hash_ = query_.hash();
+  for (const auto &[position, value] : parameters_) {
+    boost::hash_combine(hash_, ShallowHash(value));
+  }
+  if (username_) boost::hash_combine(hash_, *username_);
+}
+
+bool operator==(const ResultCacheKey &lhs, const ResultCacheKey &rhs) {
+  return lhs.hash_ == rhs.hash_ && lhs.query_ == rhs.query_ && lhs.username_ == rhs.username_ &&
+         lhs.rolenames_ == rhs.rolenames_ &&
+         std::ranges::equal(lhs.parameters_, rhs.parameters_, [](const auto &lhs_parameter, const auto &rhs_parameter) {
+           return lhs_parameter.first == rhs_parameter.first && IsSameValue(lhs_parameter.second, rhs_parameter.second);
+         });
+}
+
+std::shared_ptr<const CachedResult> ResultCache::Get(const ResultCacheKey &key, uint64_t const commit_timestamp,
+                                                     const storage::LabelChangeLog &changes) {
+  auto const it = index_.find(key);
+  if (it == index_.end()) return nullptr;
+  auto &entry = *it->second;
+  if (entry.commit_timestamp != commit_timestamp) {
+    auto const [from, to] = std::minmax(entry.commit_timestamp, commit_timestamp);
+    auto const changed = changes.ChangedBetween(from, to);
+    if (!entry.read_labels || !changed || std::ranges::find_first_of(*entry.read_labels, *changed) !=
+                                              entry.read_labels->end()) {
+      // The result of the newer snapshot replaces it anyway
+      if (entry.commit_timestamp < commit_timestamp) Erase(it->second);
+      return nullptr;
+    }
+    // Later lookups only have to check the commits after this one
+    entry.commit_timestamp = to;
+  }
+  item_list_.splice(item_list_.begin(), item_list_, it->second);
+  return entry.result;
+}
+
+void ResultCache::Put(ResultCacheKey key, std::shared_ptr<const CachedResult> result, uint64_t const commit_timestamp,
+                      storage::LabelChangeLog::Labels read_labels) {
+  if (result->memory > max_memory_) return;
+  if (auto const it = index_.find(key); it != index_.end()) {
+    // A transaction which started before a newer result was stored can still finish after it
+    if (it->second->commit_timestamp >= commit_timestamp) return;
+    Erase(it->second);
+  }
+
+  memory_ += result->memory;
+  item_list_.push_front(Entry{.key = std::move(key),
+                              .result = std::move(result),
+                              .commit_timestamp = commit_timestamp,
+                              .read_labels = std::move(read_labels)});
+  index_.emplace(item_list_.front().key, item_list_.begin());
+  while (memory_ > max_memory_) {
+    Erase(std::prev(item_list_.end()));
+  }
+}
+
+void ResultCache::Reset() {
+  index_.clear();
+  item_list_.clear();
+  memory_ = 0;
+}
+
+void ResultCache::Erase(ListType::iterator it) {
+  memory_ -= it->result->memory;
+  index_.erase(it->key);
+  item_list_.erase(it);
+}
+
+void ResultRecorder::Result(const std::vector<TypedValue> &values) {
+  if (!result_) return;
+  size_t memory = sizeof(std::vector<TypedValue>);
+  for (const auto &value : values) {
+    auto value_memory = CachedValueMemory(value);
+    if (!value_memory) {
+      result_.reset();
+      return;
+    }
+    memory += *value_memory;
+  }
+  result_->memory += memory;
+  if (result_->memory > max_memory_) {
+    result_.reset();
+    return;
+  }
+
+  auto &row = result_->rows.emplace_back();
+  row.reserve(values.size());
+  for (const auto &value : values) {
+    row.emplace_back(value, utils::NewDeleteResource());
+  }
+}
+
+void ResultRecorder::Store() {
+  if (!result_) return;
+  auto result = std::make_shared<const CachedResult>(std::move(*result_));
+  result_.reset();
+  cache_->WithLock([&](ResultCache &cache) {
+    cache.Put(std::move(key_), std::move(result), commit_timestamp_, std::move(read_labels_));
+  });
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,135 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "query/frontend/stripped.hpp"
+#include "query/parameters.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/label_change_log.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::query {
+
+struct QueryUserOrRole;
+
+/// Identifies the result of a read-only query: the same text and parameters, run by the same user at the same
+/// committed snapshot, always return the same rows.
+class ResultCacheKey {
+ public:
+  ResultCacheKey(frontend::HashedString query, const Parameters &parameters, const QueryUserOrRole *user_or_role);
+
+  friend bool operator==(const ResultCacheKey &lhs, const ResultCacheKey &rhs);
+
+  size_t hash() const { return hash_; }
+
+ private:
+  frontend::HashedString query_;
+  // Ordered by token position, so equal parameters are stored equally
+  std::vector<std::pair<int, storage::ExternalPropertyValue>> parameters_;
+  std::optional<std::string> username_;
+  std::vector<std::string> rolenames_;
+  size_t hash_;
+};
+
+struct CachedResult {
+  std::vector<std::vector<TypedValue>> rows;
+  size_t memory{0};
+};
+
+/// Results of read-only queries, evicted least recently used first once they take more than `max_memory` bytes.
+/// Each result is kept with the committed snapshot it was read at and the labels of the vertices its query reads
+/// (nullopt for any label). It is also the result at any other snapshot as long as the commits in between changed none
+/// of these labels, see `storage::LabelChangeLog`. It is not thread-safe.
+class ResultCache {
+ public:
+  explicit ResultCache(size_t max_memory) : max_memory_(max_memory) {}
+
+  bool enabled() const { return max_memory_ > 0; }
+
+  size_t max_memory() const { return max_memory_; }
+
+  size_t memory() const { return memory_; }
+
+  size_t size() const { return index_.size(); }
+
+  /// The result of the query at the snapshot of `commit_timestamp`, null if it isn't known.
+  std::shared_ptr<const CachedResult> Get(const ResultCacheKey &key, uint64_t commit_timestamp,
+                                          const storage::LabelChangeLog &changes);
+
+  void Put(ResultCacheKey key, std::shared_ptr<const CachedResult> result, uint64_t commit_timestamp,
+           storage::LabelChangeLog::Labels read_labels);
+
+  void Reset();
+
+ private:
+  struct KeyHash {
+    size_t operator()(const ResultCacheKey &key) const { return key.hash(); }
+  };
+
+  struct Entry {
+    ResultCacheKey key;
+    std::shared_ptr<const CachedResult> result;
+    uint64_t commit_timestamp;
+    storage::LabelChangeLog::Labels read_labels;
+  };
+
+  using ListType = std::list<Entry>;
+
+  void Erase(ListType::iterator it);
+
+  size_t max_memory_;
+  size_t memory_{0};
+  ListType item_list_;
+  std::unordered_map<ResultCacheKey, ListType::iterator, KeyHash> index_;
+};
+
+using ResultCacheLRU = utils::Synchronized<ResultCache>;
+
+/// Collects the rows of a query while they are streamed and stores them once the query is fully pulled. The rows are
+/// dropped as soon as one of them holds a graph element, which is only valid inside its transaction, or they grow
+/// past what the cache may hold.
+class ResultRecorder {
+ public:
+  ResultRecorder(ResultCacheLRU *cache, ResultCacheKey key, uint64_t commit_timestamp,
+                 storage::LabelChangeLog::Labels read_labels, size_t max_memory)
+      : cache_(cache),
+        key_(std::move(key)),
+        commit_timestamp_(commit_timestamp),
+        read_labels_(std::move(read_labels)),
+        max_memory_(max_memory) {}
+
+  void Result(const std::vector<TypedValue> &values);
+
+  /// Stores the recorded rows, called once the last row was streamed.
+  void Store();
+
+ private:
+  ResultCacheLRU *cache_;
+  ResultCacheKey key_;
+  uint64_t commit_timestamp_;
+  storage::LabelChangeLog::Labels read_labels_;
+  size_t max_memory_;
+  std::optional<CachedResult> result_{std::in_place};
+};
+
+}  // namespace memgraph::query
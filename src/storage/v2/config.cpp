@@ -25,6 +25,7 @@ void to_json(nlohmann::json &data, SalientConfig::Items const &items) {
       {"enable_edge_type_index_auto_creation", items.enable_edge_type_index_auto_creation},
       {"storage_light_edge", items.storage_light_edge},
       {"property_store_compression_enabled", items.property_store_compression_enabled},
+      {"edge_type_grouped_adjacency", items.edge_type_grouped_adjacency},
   };
 }
 
@@ -40,6 +41,9 @@ void from_json(const nlohmann::json &data, SalientConfig::Items &items) {
     it->get_to(items.storage_light_edge);
   }
   data.at("property_store_compression_enabled").get_to(items.property_store_compression_enabled);
+  if (auto it = data.find("edge_type_grouped_adjacency"); it != data.end()) {
+    it->get_to(items.edge_type_grouped_adjacency);
+  }
 }
 
 void to_json(nlohmann::json &data, SalientConfig const &config) {
@@ -53,6 +53,7 @@ struct SalientConfig {
     bool storage_light_edge{false};
     bool delta_on_identical_property_update{true};
     bool property_store_compression_enabled{false};
+    bool edge_type_grouped_adjacency{false};
     friend bool operator==(const Items &lrh, const Items &rhs) = default;
     friend void to_json(nlohmann::json &data, Items const &items);
     friend void from_json(const nlohmann::json &data, Items &items);
@@ -71,6 +72,10 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    // Threads unlinking deltas and retiring deleted objects in a collection pass; small passes stay on one thread
+    uint64_t thread_count{1};
+    // Bound on the time a pass spends unlinking deltas; what is left over waits for the next pass. 0 means no bound.
+    std::chrono::milliseconds max_unlink_time{0};
     friend bool operator==(const Gc &lrh, const Gc &rhs) = default;
   } gc;  // SYSTEM FLAG
 
@@ -94,9 +99,17 @@ struct Config {
         std::chrono::minutes(2)};          // PER DATABASE - as at time of initialization; can be changed by user
     uint64_t snapshot_retention_count{3};  // PER DATABASE
 
+    // Periodic snapshots after a full one only write the vertices changed since the previous snapshot, until this
+    // many of them are chained onto the full one. 0 disables incremental snapshots.
+    uint64_t snapshot_incremental_chain_length{0};  // PER DATABASE
+
     uint64_t wal_file_size_kibibytes{20 * 1024};  // PER DATABASE
     uint64_t wal_file_flush_every_n_tx{100'000};  // PER DATABASE
 
+    // Commits wait for their WAL records to be synced, with one sync shared by all transactions committing at the
+    // same time. Replaces `wal_file_flush_every_n_tx`.
+    bool wal_group_commit{false};  // PER DATABASE
+
     bool snapshot_on_exit{false};                      // PER DATABASE
     bool restore_replication_state_on_startup{false};  // PER INSTANCE
 
@@ -104,6 +117,10 @@ struct Config {
     uint64_t snapshot_thread_count{8};    // PER INSTANCE SYSTEM FLAG
     uint64_t recovery_thread_count{8};    // PER INSTANCE SYSTEM FLAG
 
+    // Threads populating an index created on a live database, by CREATE INDEX or the background indexer. 1 keeps
+    // population on the creating thread.
+    uint64_t index_population_thread_count{1};  // PER INSTANCE SYSTEM FLAG
+
     // Per snapshot writer, so a parallel snapshot may hold this much again for every thread it
     // uses. 0 disables pacing.
     uint64_t snapshot_writeback_window_mib{32};  // PER INSTANCE SYSTEM FLAG
@@ -146,6 +163,9 @@ struct Config {
 
   bool track_label_counts{false};
 
+  // Take the skip-list nodes of vertices and edges from per-CPU pools of slabs instead of allocating each on its own
+  bool enable_skiplist_node_pool{false};
+
   bool register_metrics{true};
 
   friend bool operator==(const Config &lrh, const Config &rhs) = default;
@@ -110,6 +110,10 @@ class DiskStorage final : public Storage {
       throw utils::NotYetImplemented("ChunkedVertices is not implemented for DiskStorage.");
     }
 
+    VerticesIterable Vertices(std::span<LabelId const> /*labels*/, View /*view*/) override {
+      throw utils::NotYetImplemented("Label index intersection is not implemented for DiskStorage.");
+    }
+
     VerticesIterable Vertices(PropertyId /*property*/, View /*view*/) override {
       throw utils::NotYetImplemented("Global vertex property index is not implemented for DiskStorage.");
     }
@@ -242,6 +246,10 @@ class DiskStorage final : public Storage {
       return std::nullopt;
     }
 
+    std::optional<uint64_t> ApproximateVerticesIntersectionCount(std::span<LabelId const> /*labels*/) const override {
+      return std::nullopt;
+    }
+
     std::optional<uint64_t> ApproximateVerticesVectorCount(std::string_view /*index_name*/) const override {
       // Vector index does not exist for on disk
       return std::nullopt;
@@ -30,6 +30,7 @@
 #include "flags/experimental.hpp"
 #include "replication/epoch.hpp"
 #include "storage/v2/durability/durability.hpp"
+#include "storage/v2/durability/incremental_snapshot.hpp"
 #include "storage/v2/durability/metadata.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/wal.hpp"
@@ -623,6 +624,7 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
   std::optional<uint64_t> snapshot_durable_timestamp;
+  bool incremental_snapshots_applied = false;
   std::vector<WalDurabilityInfo> wal_files;
   if (!snapshot_files.empty()) {
     spdlog::info("Try recovering from snapshot directory {}.", snapshot_directory_);
@@ -673,6 +675,34 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
     repl_storage_state.epoch_.SetEpoch(std::move(recovered_snapshot->snapshot_info.epoch_id));
     recovery_info.last_durable_timestamp = *snapshot_durable_timestamp;
 
+    // Layer the incremental snapshots built on this one on top of it, the WAL is then replayed from the end of the
+    // chain. WAL files are kept from the full snapshot on, so a file that can't be applied just ends the chain early.
+    auto const incremental_snapshots = GetIncrementalSnapshotChain(
+        snapshot_directory_, last_snapshot_uuid_str, repl_storage_state.epoch_.id(), *snapshot_durable_timestamp);
+    for (auto const &[path, info] : incremental_snapshots) {
+      spdlog::info("Applying incremental snapshot {}.", path);
+      try {
+        auto const applied =
+            ApplyIncrementalSnapshot(path, info, vertices, edges, name_id_mapper, edge_count, config.salient.items);
+        recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, applied.next_vertex_id);
+        recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, applied.next_edge_id);
+        recovery_info.next_timestamp = std::max(recovery_info.next_timestamp, applied.next_timestamp);
+        recovery_info.num_committed_txns = applied.num_committed_txns;
+        recovery_info.last_durable_timestamp = applied.last_durable_timestamp;
+        snapshot_durable_timestamp = applied.last_durable_timestamp;
+        incremental_snapshots_applied = true;
+      } catch (const RecoveryFailure &e) {
+        spdlog::warn("Couldn't apply incremental snapshot {} because of: {}. The WAL is replayed from the previous "
+                     "snapshot instead.",
+                     path,
+                     e.what());
+        break;
+      }
+    }
+    if (incremental_snapshots_applied && schema_info) {
+      RebuildSchemaInfo(vertices, schema_info, config.salient.items.properties_on_edges);
+    }
+
     auto maybe_wal_files = GetWalFiles(wal_directory_, std::string{uuid});
     if (!maybe_wal_files.has_value()) {
       throw RecoveryFailure("Couldn't recover data because of the failure to read wal files");
@@ -799,7 +829,9 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
     *wal_seq_num = *previous_seq_num + 1;
 
     spdlog::info("All necessary WAL files are loaded successfully.");
+  }
 
+  if (!wal_files.empty() || incremental_snapshots_applied) {
     // Regenerate the vertex batches
     // TODO edges?
     size_t pos = 0;
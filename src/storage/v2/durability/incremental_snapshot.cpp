@@ -0,0 +1,608 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/incremental_snapshot.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <unordered_set>
+
+#include "spdlog/spdlog.h"
+#include "storage/v2/durability/exceptions.hpp"
+#include "storage/v2/durability/paths.hpp"
+#include "storage/v2/durability/serialization.hpp"
+#include "storage/v2/durability/version.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/edge_type_grouping.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/counter.hpp"
+#include "utils/file.hpp"
+#include "utils/logging.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/timer.hpp"
+
+namespace memgraph::storage::durability {
+
+void SnapshotChangeTracker::Record(std::span<Gid const> vertices, uint64_t const commit_timestamp) {
+  if (vertices.empty()) return;
+  state_.WithLock([&](State &state) {
+    for (auto const gid : vertices) {
+      auto &timestamp = state.vertices[gid];
+      timestamp = std::max(timestamp, commit_timestamp);
+    }
+  });
+}
+
+void SnapshotChangeTracker::InvalidateAt(uint64_t const commit_timestamp) {
+  state_.WithLock([&](State &state) {
+    state.chain.reset();
+    state.full_required_from = std::max(state.full_required_from, commit_timestamp);
+  });
+}
+
+void SnapshotChangeTracker::Reset() {
+  state_.WithLock([](State &state) { state = State{}; });
+}
+
+auto SnapshotChangeTracker::PlanIncremental(std::string_view const epoch_id, uint64_t const durable_timestamp,
+                                            uint64_t const max_chain_length, uint64_t const vertex_count)
+    -> std::optional<Plan> {
+  return state_.WithLock([&](State const &state) -> std::optional<Plan> {
+    if (!state.chain || state.chain->epoch_id != epoch_id) return std::nullopt;
+    if (state.chain->length >= max_chain_length) return std::nullopt;
+    if (durable_timestamp <= state.chain->previous_durable_timestamp) return std::nullopt;
+    // Past this point the incremental snapshot is about as large as a full one, and recovery would pay for both
+    if (state.vertices.size() > vertex_count / 2) return std::nullopt;
+
+    // All recorded vertices, including the ones last touched after `durable_timestamp`: they may have been changed
+    // before it as well. The snapshot writes whatever is visible at its timestamp, so extra ones cost only space.
+    Plan plan{.vertices = {},
+              .base_durable_timestamp = state.chain->base_durable_timestamp,
+              .previous_durable_timestamp = state.chain->previous_durable_timestamp};
+    plan.vertices.reserve(state.vertices.size());
+    for (auto const &[gid, _] : state.vertices) plan.vertices.push_back(gid);
+    std::ranges::sort(plan.vertices);
+    return plan;
+  });
+}
+
+void SnapshotChangeTracker::SnapshotWritten(std::string_view const epoch_id, uint64_t const durable_timestamp,
+                                            bool const full) {
+  state_.WithLock([&](State &state) {
+    std::erase_if(state.vertices, [&](auto const &item) { return item.second <= durable_timestamp; });
+    if (full) {
+      state.chain.reset();
+      if (durable_timestamp >= state.full_required_from) {
+        state.chain = Chain{.epoch_id = std::string{epoch_id},
+                            .base_durable_timestamp = durable_timestamp,
+                            .previous_durable_timestamp = durable_timestamp,
+                            .length = 0};
+      }
+    } else if (state.chain) {
+      // The chain may have been invalidated while the snapshot was written; then it stays that way
+      state.chain->previous_durable_timestamp = durable_timestamp;
+      ++state.chain->length;
+    }
+  });
+}
+
+IncrementalSnapshotInfo ReadIncrementalSnapshotInfo(std::filesystem::path const &path) {
+  Decoder snapshot;
+  auto const version = snapshot.Initialize(path, kIncrementalSnapshotMagic);
+  if (!version) throw RecoveryFailure("Couldn't read incremental snapshot magic and/or version!");
+  // Written by this version only; anything else is skipped and the WAL is replayed instead
+  if (*version != kVersion) throw RecoveryFailure("Unsupported incremental snapshot version {}!", *version);
+
+  IncrementalSnapshotInfo info;
+
+  // Read offsets.
+  {
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_OFFSETS)
+      throw RecoveryFailure("Couldn't read marker for section offsets!");
+
+    auto const snapshot_size = snapshot.GetSize();
+    auto read_offset = [&snapshot, snapshot_size] {
+      auto maybe_offset = snapshot.ReadUint();
+      if (!maybe_offset || *maybe_offset > snapshot_size) throw RecoveryFailure("Invalid incremental snapshot format!");
+      return *maybe_offset;
+    };
+
+    info.offset_vertices = read_offset();
+    info.offset_mapper = read_offset();
+    info.offset_metadata = read_offset();
+  }
+
+  // Read metadata.
+  {
+    if (!snapshot.SetPosition(info.offset_metadata)) throw RecoveryFailure("Couldn't read metadata offset!");
+
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_METADATA)
+      throw RecoveryFailure("Couldn't read marker for section metadata!");
+
+    auto read_string = [&snapshot](std::string_view what) {
+      auto value = snapshot.ReadString();
+      if (!value) throw RecoveryFailure("Couldn't read {}!", what);
+      return *std::move(value);
+    };
+    auto read_uint = [&snapshot](std::string_view what) {
+      auto value = snapshot.ReadUint();
+      if (!value) throw RecoveryFailure("Couldn't read {}!", what);
+      return *value;
+    };
+
+    info.uuid = read_string("storage_uuid");
+    info.epoch_id = read_string("epoch id");
+    info.base_durable_timestamp = read_uint("base durable timestamp");
+    info.previous_durable_timestamp = read_uint("previous durable timestamp");
+    info.start_timestamp = read_uint("start timestamp");
+    info.durable_timestamp = read_uint("durable timestamp");
+    info.num_committed_txns = read_uint("the number of committed txns");
+    info.vertices_count = read_uint("the number of vertices");
+    auto properties_on_edges = snapshot.ReadBool();
+    if (!properties_on_edges) throw RecoveryFailure("Couldn't read properties on edges!");
+    info.properties_on_edges = *properties_on_edges;
+  }
+
+  return info;
+}
+
+std::optional<std::filesystem::path> CreateIncrementalSnapshot(Storage *storage, Transaction *transaction,
+                                                               std::filesystem::path const &snapshot_directory,
+                                                               utils::SkipListDb<Vertex> *vertices,
+                                                               utils::UUID const &uuid, std::string_view epoch_id,
+                                                               SnapshotChangeTracker::Plan const &plan,
+                                                               utils::FileRetainer *file_retainer,
+                                                               std::atomic_bool *abort_snapshot) {
+  utils::Timer timer;
+
+  auto const directory = snapshot_directory / kIncrementalSnapshotDirectory;
+  utils::EnsureDirOrDie(directory);
+
+  auto const durable_timestamp =
+      transaction->last_durable_ts_ ? *transaction->last_durable_ts_ : transaction->start_timestamp;
+  auto const path = directory / MakeSnapshotName(durable_timestamp);
+
+  spdlog::info("incremental snapshot starting: {} ({} changed vertices, base at timestamp {})",
+               path,
+               plan.vertices.size(),
+               plan.base_durable_timestamp);
+  Encoder<utils::NonConcurrentOutputFile> snapshot;
+  snapshot.EnableWritebackPacing(storage->config_.durability.snapshot_writeback_window_mib * 1024UL * 1024UL);
+  if (!snapshot.Initialize(path, kIncrementalSnapshotMagic, kVersion)) {
+    spdlog::warn("Failed to open incremental snapshot file {}. Snapshot creation will be retried on the next scheduled "
+                 "interval.",
+                 path);
+    return std::nullopt;
+  }
+
+  bool finished = false;
+  const utils::OnScopeExit partial_file_cleanup{[&] {
+    if (finished) return;
+    snapshot.Close();
+    file_retainer->DeleteFile(path);
+  }};
+
+  uint64_t offset_offsets = 0;
+  uint64_t offset_vertices = 0;
+  uint64_t offset_mapper = 0;
+  uint64_t offset_metadata = 0;
+  auto write_offsets = [&] {
+    snapshot.WriteUint(offset_vertices);
+    snapshot.WriteUint(offset_mapper);
+    snapshot.WriteUint(offset_metadata);
+  };
+
+  snapshot.WriteMarker(Marker::SECTION_OFFSETS);
+  offset_offsets = snapshot.GetPosition();
+  write_offsets();
+
+  std::unordered_set<uint64_t> used_ids;
+  auto write_mapping = [&](auto mapping) {
+    used_ids.insert(mapping.AsUint());
+    snapshot.WriteUint(mapping.AsUint());
+  };
+  auto write_properties = [&](std::map<PropertyId, PropertyValue> const &properties) {
+    snapshot.WriteUint(properties.size());
+    for (auto const &[key, value] : properties) {
+      write_mapping(key);
+      snapshot.WriteExternalPropertyValue(ToExternalPropertyValue(value, storage->name_id_mapper_.get()));
+    }
+  };
+
+  bool const properties_on_edges = storage->config_.salient.items.properties_on_edges;
+  auto abort_counter = utils::ResettableCounter{1000};
+
+  offset_vertices = snapshot.GetPosition();
+  {
+    auto acc = vertices->access();
+    for (auto const gid : plan.vertices) {
+      if (abort_counter() && abort_snapshot && abort_snapshot->load(std::memory_order_acquire)) {
+        spdlog::info("incremental snapshot aborted");
+        return std::nullopt;
+      }
+
+      snapshot.WriteMarker(Marker::SECTION_VERTEX);
+      snapshot.WriteUint(gid.AsUint());
+
+      auto it = acc.find(gid);
+      auto va = it != acc.end() ? VertexAccessor::Create(&*it, storage, transaction, View::OLD) : std::nullopt;
+      snapshot.WriteBool(va.has_value());
+      if (!va) continue;  // Deleted (or not yet created) at the snapshot's timestamp
+
+      auto maybe_labels = va->Labels(View::OLD);
+      MG_ASSERT(maybe_labels.has_value(), "Invalid database state!");
+      auto maybe_props = va->Properties(View::OLD);
+      MG_ASSERT(maybe_props.has_value(), "Invalid database state!");
+      auto maybe_in_edges = va->InEdges(View::OLD);
+      MG_ASSERT(maybe_in_edges.has_value(), "Invalid database state!");
+      auto maybe_out_edges = va->OutEdges(View::OLD);
+      MG_ASSERT(maybe_out_edges.has_value(), "Invalid database state!");
+
+      snapshot.WriteUint(maybe_labels->size());
+      for (auto const label : *maybe_labels) write_mapping(label);
+      write_properties(*maybe_props);
+
+      snapshot.WriteUint(maybe_in_edges->edges.size());
+      for (auto const &edge : maybe_in_edges->edges) {
+        snapshot.WriteUint(edge.Gid().AsUint());
+        snapshot.WriteUint(edge.FromVertex().Gid().AsUint());
+        write_mapping(edge.EdgeType());
+      }
+      snapshot.WriteUint(maybe_out_edges->edges.size());
+      for (auto const &edge : maybe_out_edges->edges) {
+        snapshot.WriteUint(edge.Gid().AsUint());
+        snapshot.WriteUint(edge.ToVertex().Gid().AsUint());
+        write_mapping(edge.EdgeType());
+        if (properties_on_edges) {
+          auto maybe_edge_props = edge.Properties(View::OLD);
+          MG_ASSERT(maybe_edge_props.has_value(), "Invalid database state!");
+          write_properties(*maybe_edge_props);
+        }
+      }
+    }
+  }
+
+  {
+    offset_mapper = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_MAPPER);
+    snapshot.WriteUint(used_ids.size());
+    for (auto const id : used_ids) {
+      snapshot.WriteUint(id);
+      snapshot.WriteString(storage->name_id_mapper_->IdToName(id));
+    }
+  }
+
+  {
+    offset_metadata = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_METADATA);
+    snapshot.WriteString(std::string{uuid});
+    snapshot.WriteString(epoch_id);
+    snapshot.WriteUint(plan.base_durable_timestamp);
+    snapshot.WriteUint(plan.previous_durable_timestamp);
+    snapshot.WriteUint(transaction->start_timestamp);
+    snapshot.WriteUint(durable_timestamp);
+    snapshot.WriteUint(transaction->last_durable_num_committed_txns_);
+    snapshot.WriteUint(plan.vertices.size());
+    snapshot.WriteBool(properties_on_edges);
+  }
+
+  snapshot.SetPosition(offset_offsets);
+  write_offsets();
+
+  if (abort_snapshot && abort_snapshot->load(std::memory_order_acquire)) {
+    spdlog::info("incremental snapshot aborted");
+    return std::nullopt;
+  }
+
+  snapshot.Finalize(utils::PageCachePolicy::kDrop);
+  finished = true;
+  spdlog::info("incremental snapshot complete: {} ({} vertices, {:.1f} MiB, {:.2f}s)",
+               path,
+               plan.vertices.size(),
+               static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0),
+               std::chrono::duration<double>(timer.Elapsed()).count());
+  return path;
+}
+
+std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> GetIncrementalSnapshotChain(
+    std::filesystem::path const &snapshot_directory, std::string_view const uuid, std::string_view const epoch_id,
+    uint64_t const base_durable_timestamp) {
+  auto const directory = snapshot_directory / kIncrementalSnapshotDirectory;
+  std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> candidates;
+  std::error_code error_code;
+  if (!std::filesystem::is_directory(directory, error_code)) return {};
+  for (auto const &item : std::filesystem::directory_iterator(directory, error_code)) {
+    if (!item.is_regular_file()) continue;
+    try {
+      auto info = ReadIncrementalSnapshotInfo(item.path());
+      if (info.uuid != uuid || info.epoch_id != epoch_id || info.base_durable_timestamp != base_durable_timestamp) {
+        continue;
+      }
+      candidates.emplace_back(item.path(), std::move(info));
+    } catch (RecoveryFailure const &e) {
+      spdlog::warn("Skipping incremental snapshot file {} because of: {}", item.path(), e.what());
+    }
+  }
+  if (error_code) {
+    spdlog::warn("Couldn't read incremental snapshots from {}: {}", directory, error_code.message());
+  }
+
+  std::ranges::sort(candidates, {}, [](auto const &candidate) { return candidate.second.durable_timestamp; });
+
+  // Follow the links from the base; a file that doesn't continue the chain (e.g. left behind by an aborted one)
+  // ends it
+  std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> chain;
+  auto previous = base_durable_timestamp;
+  for (auto &candidate : candidates) {
+    if (candidate.second.previous_durable_timestamp != previous) continue;
+    previous = candidate.second.durable_timestamp;
+    chain.push_back(std::move(candidate));
+  }
+  return chain;
+}
+
+namespace {
+
+struct IncrementalEdge {
+  Gid gid;
+  Gid other;
+  EdgeTypeId edge_type;
+  std::vector<std::pair<PropertyId, PropertyValue>> properties;  // out edges with properties on edges only
+};
+
+struct IncrementalVertex {
+  Gid gid;
+  bool present;
+  std::vector<LabelId> labels;
+  std::vector<std::pair<PropertyId, PropertyValue>> properties;
+  std::vector<IncrementalEdge> in_edges;
+  std::vector<IncrementalEdge> out_edges;
+};
+
+std::vector<IncrementalVertex> ReadIncrementalVertices(std::filesystem::path const &path,
+                                                       IncrementalSnapshotInfo const &info,
+                                                       NameIdMapper *name_id_mapper) {
+  Decoder snapshot;
+  if (!snapshot.Initialize(path, kIncrementalSnapshotMagic)) {
+    throw RecoveryFailure("Couldn't read incremental snapshot magic and/or version!");
+  }
+
+  std::unordered_map<uint64_t, uint64_t> snapshot_id_map;
+  {
+    if (!snapshot.SetPosition(info.offset_mapper)) throw RecoveryFailure("Couldn't read mapper offset!");
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_MAPPER) throw RecoveryFailure("Failed to read section mapper!");
+    auto size = snapshot.ReadUint();
+    if (!size) throw RecoveryFailure("Failed to read name-id mapper size!");
+    for (uint64_t i = 0; i < *size; ++i) {
+      auto id = snapshot.ReadUint();
+      if (!id) throw RecoveryFailure("Failed to read id for name-id mapper!");
+      auto name = snapshot.ReadString();
+      if (!name) throw RecoveryFailure("Failed to read name for name-id mapper!");
+      snapshot_id_map.emplace(*id, name_id_mapper->NameToId(*name));
+    }
+  }
+  auto read_mapped = [&](std::string_view what) {
+    auto id = snapshot.ReadUint();
+    if (!id) throw RecoveryFailure("Couldn't read {}!", what);
+    auto it = snapshot_id_map.find(*id);
+    if (it == snapshot_id_map.end()) throw RecoveryFailure("Invalid {}!", what);
+    return it->second;
+  };
+  auto read_uint = [&](std::string_view what) {
+    auto value = snapshot.ReadUint();
+    if (!value) throw RecoveryFailure("Couldn't read {}!", what);
+    return *value;
+  };
+  auto read_properties = [&](auto &properties) {
+    auto const size = read_uint("the number of properties");
+    properties.reserve(size);
+    for (uint64_t i = 0; i < size; ++i) {
+      auto const key = PropertyId::FromUint(read_mapped("property id"));
+      auto value = snapshot.ReadExternalPropertyValue();
+      if (!value) throw RecoveryFailure("Couldn't read property value!");
+      properties.emplace_back(key, ToPropertyValue(*value, name_id_mapper));
+    }
+  };
+  auto read_edges = [&](auto &edges, bool with_properties) {
+    auto const size = read_uint("the number of edges");
+    edges.reserve(size);
+    for (uint64_t i = 0; i < size; ++i) {
+      auto &edge = edges.emplace_back();
+      edge.gid = Gid::FromUint(read_uint("edge gid"));
+      edge.other = Gid::FromUint(read_uint("vertex gid"));
+      edge.edge_type = EdgeTypeId::FromUint(read_mapped("edge type"));
+      if (with_properties) read_properties(edge.properties);
+    }
+  };
+
+  if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read vertices offset!");
+  std::vector<IncrementalVertex> result;
+  result.reserve(info.vertices_count);
+  for (uint64_t i = 0; i < info.vertices_count; ++i) {
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
+    auto &vertex = result.emplace_back();
+    vertex.gid = Gid::FromUint(read_uint("vertex gid"));
+    auto present = snapshot.ReadBool();
+    if (!present) throw RecoveryFailure("Couldn't read whether the vertex exists!");
+    vertex.present = *present;
+    if (!vertex.present) continue;
+
+    auto const labels_size = read_uint("the number of labels");
+    vertex.labels.reserve(labels_size);
+    for (uint64_t j = 0; j < labels_size; ++j) vertex.labels.push_back(LabelId::FromUint(read_mapped("label")));
+    read_properties(vertex.properties);
+    read_edges(vertex.in_edges, false);
+    read_edges(vertex.out_edges, info.properties_on_edges);
+  }
+  return result;
+}
+
+}  // namespace
+
+RecoveryInfo ApplyIncrementalSnapshot(std::filesystem::path const &path, IncrementalSnapshotInfo const &info,
+                                      utils::SkipListDb<Vertex> *vertices, utils::SkipListDb<Edge> *edges,
+                                      NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
+                                      SalientConfig::Items const &items) {
+  if (items.storage_light_edge) throw RecoveryFailure("Incremental snapshots don't support light edges!");
+  if (info.properties_on_edges != items.properties_on_edges) {
+    throw RecoveryFailure("The incremental snapshot was created with a different properties on edges setting!");
+  }
+
+  auto const records = ReadIncrementalVertices(path, info, name_id_mapper);
+
+  auto vertex_acc = vertices->access();
+  auto edge_acc = edges->access();
+
+  // Every vertex the changed ones point to has to exist once the file is applied; checked before anything changes
+  std::unordered_map<Gid, bool> recorded;
+  recorded.reserve(records.size());
+  for (auto const &record : records) recorded[record.gid] = record.present;
+  auto const exists_after = [&](Gid const gid) {
+    auto it = recorded.find(gid);
+    if (it != recorded.end()) return it->second;
+    return vertex_acc.find(gid) != vertex_acc.end();
+  };
+  for (auto const &record : records) {
+    if (!record.present) continue;
+    for (auto const *edges_of : {&record.in_edges, &record.out_edges}) {
+      for (auto const &edge : *edges_of) {
+        if (!exists_after(edge.other)) {
+          throw RecoveryFailure("Vertex {} of edge {} doesn't exist!", edge.other.AsUint(), edge.gid.AsUint());
+        }
+      }
+    }
+  }
+
+  RecoveryInfo ret;
+  uint64_t highest_vertex_gid = 0;
+  uint64_t highest_edge_gid = 0;
+
+  // Edges that were out edges of a changed vertex; the ones no changed vertex has any more are deleted
+  std::unordered_set<Gid> dropped_edges;
+
+  // Reset the changed vertices that exist in the base and create the new ones
+  std::vector<Vertex *> changed;
+  changed.reserve(records.size());
+  for (auto const &record : records) {
+    highest_vertex_gid = std::max(highest_vertex_gid, record.gid.AsUint());
+    auto it = vertex_acc.find(record.gid);
+    if (it != vertex_acc.end()) {
+      edge_count->fetch_sub(it->out_edges.size(), std::memory_order_acq_rel);
+      if (items.properties_on_edges) {
+        for (auto const &[_, __, edge_ref] : it->out_edges) dropped_edges.insert(edge_ref.ptr->gid);
+      }
+      it->labels.clear();
+      it->properties.ClearProperties();
+      it->in_edges.clear();
+      it->out_edges.clear();
+    }
+    if (!record.present) {
+      changed.push_back(nullptr);
+      continue;
+    }
+    if (it == vertex_acc.end()) {
+      it = vertex_acc.insert(Vertex{record.gid, nullptr}).first;
+    }
+    it->labels.reserve(record.labels.size());
+    for (auto const label : record.labels) it->labels.push_back(label);
+    if (!record.properties.empty()) it->properties.InitProperties(record.properties);
+    changed.push_back(&*it);
+  }
+
+  auto edge_ref_of = [&](IncrementalEdge const &edge) {
+    highest_edge_gid = std::max(highest_edge_gid, edge.gid.AsUint());
+    if (!items.properties_on_edges) return EdgeRef(edge.gid);
+    dropped_edges.erase(edge.gid);
+    auto it = edge_acc.find(edge.gid);
+    if (it == edge_acc.end()) it = edge_acc.insert(Edge{edge.gid, nullptr}).first;
+    return EdgeRef(&*it);
+  };
+
+  // Link the adjacency; all vertices exist by now
+  for (size_t i = 0; i < records.size(); ++i) {
+    auto *vertex = changed[i];
+    if (!vertex) continue;
+    auto const &record = records[i];
+    vertex->in_edges.reserve(record.in_edges.size());
+    for (auto const &edge : record.in_edges) {
+      auto from = vertex_acc.find(edge.other);
+      vertex->in_edges.emplace_back(edge.edge_type, &*from, edge_ref_of(edge));
+    }
+    vertex->out_edges.reserve(record.out_edges.size());
+    for (auto const &edge : record.out_edges) {
+      auto to = vertex_acc.find(edge.other);
+      auto const edge_ref = edge_ref_of(edge);
+      if (items.properties_on_edges) {
+        edge_ref.ptr->properties.ClearProperties();
+        if (!edge.properties.empty()) edge_ref.ptr->properties.InitProperties(edge.properties);
+      }
+      vertex->out_edges.emplace_back(edge.edge_type, &*to, edge_ref);
+    }
+    edge_count->fetch_add(record.out_edges.size(), std::memory_order_acq_rel);
+    if (items.edge_type_grouped_adjacency) {
+      GroupEdgesByType(vertex->in_edges);
+      GroupEdgesByType(vertex->out_edges);
+    }
+  }
+
+  for (auto const &record : records) {
+    if (!record.present) vertex_acc.remove(record.gid);
+  }
+  for (auto const gid : dropped_edges) edge_acc.remove(gid);
+
+  ret.next_vertex_id = highest_vertex_gid + 1;
+  ret.next_edge_id = highest_edge_gid + 1;
+  ret.next_timestamp = info.start_timestamp + 1;
+  ret.last_durable_timestamp = info.durable_timestamp;
+  ret.num_committed_txns = info.num_committed_txns;
+  return ret;
+}
+
+void RebuildSchemaInfo(utils::SkipListDb<Vertex> *vertices, SharedSchemaTracking *schema_info,
+                       bool const properties_on_edges) {
+  schema_info->Clear();
+  for (auto &vertex : vertices->access()) schema_info->RecoverVertex(&vertex);
+  for (auto &vertex : vertices->access()) {
+    for (auto const &[edge_type, to, edge_ref] : vertex.out_edges) {
+      schema_info->RecoverEdge(edge_type, edge_ref, &vertex, to, properties_on_edges);
+    }
+  }
+}
+
+void DeleteOrphanedIncrementalSnapshots(std::filesystem::path const &snapshot_directory, std::string_view const uuid,
+                                        std::span<uint64_t const> retained_durable_timestamps,
+                                        utils::FileRetainer *file_retainer) {
+  auto const directory = snapshot_directory / kIncrementalSnapshotDirectory;
+  std::error_code error_code;
+  if (!std::filesystem::is_directory(directory, error_code)) return;
+  for (auto const &item : std::filesystem::directory_iterator(directory, error_code)) {
+    if (!item.is_regular_file()) continue;
+    try {
+      auto const info = ReadIncrementalSnapshotInfo(item.path());
+      if (info.uuid == uuid && std::ranges::contains(retained_durable_timestamps, info.base_durable_timestamp)) {
+        continue;
+      }
+    } catch (RecoveryFailure const &e) {
+      spdlog::warn("Found a corrupt incremental snapshot file {} because of: {}", item.path(), e.what());
+    }
+    spdlog::trace("Deleting incremental snapshot file {}; its full snapshot is gone", item.path());
+    file_retainer->DeleteFile(item.path());
+  }
+}
+
+}  // namespace memgraph::storage::durability
@@ -0,0 +1,159 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/durability/metadata.hpp"
+#include "storage/v2/edge.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/name_id_mapper.hpp"
+#include "storage/v2/schema_info.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/file_locker.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/synchronized.hpp"
+#include "utils/uuid.hpp"
+
+namespace memgraph::storage {
+class Storage;
+}  // namespace memgraph::storage
+
+namespace memgraph::storage::durability {
+
+// Incremental snapshots (`Config::Durability::snapshot_incremental_chain_length`).
+//
+// A full snapshot starts a chain. Each following periodic snapshot only writes the vertices committed transactions
+// touched since the previous snapshot of the chain, with their labels, properties and whole adjacency (and the
+// properties of their out edges), plus a tombstone for each of them that no longer exists. The files live in the
+// `incremental` sub-directory of the snapshot directory and name the full snapshot they build on, so recovery loads
+// that snapshot, layers the chain on top of it in order and replays the WAL from the end of the chain.
+//
+// The chain only holds graph data. Anything else a full snapshot stores (indices, constraints, enums, TTL,
+// descriptions) changes through metadata deltas, and a commit with one ends the chain. WAL files are retained from
+// the oldest retained full snapshot as before, so a damaged or unusable chain is never needed: recovery stops at the
+// last file it could apply and the WAL covers the rest.
+
+/// Vertices changed since the last snapshot, and the chain the next snapshot can extend.
+class SnapshotChangeTracker {
+ public:
+  struct Plan {
+    std::vector<Gid> vertices;  // sorted
+    uint64_t base_durable_timestamp;
+    uint64_t previous_durable_timestamp;
+  };
+
+  /// Called for every commit that wrote to the WAL; `vertices` are the ones whose labels, properties or adjacency
+  /// (including the properties of their out edges) changed.
+  void Record(std::span<Gid const> vertices, uint64_t commit_timestamp);
+
+  /// A commit at `commit_timestamp` changed something a full snapshot stores outside of the graph data. Only a full
+  /// snapshot that includes it can start a new chain.
+  void InvalidateAt(uint64_t commit_timestamp);
+
+  /// The storage was cleared or changed in a way the tracker can't follow (e.g. analytical mode); the next snapshot
+  /// has to be full.
+  void Reset();
+
+  /// What an incremental snapshot at `durable_timestamp` would have to write, or nullopt if it has to be a full one:
+  /// there is no chain in `epoch_id`, the chain already has `max_chain_length` links or more than half of the
+  /// `vertex_count` vertices changed.
+  std::optional<Plan> PlanIncremental(std::string_view epoch_id, uint64_t durable_timestamp,
+                                      uint64_t max_chain_length, uint64_t vertex_count);
+
+  /// A snapshot at `durable_timestamp` was written. Changes it covers are dropped; a full one starts a new chain.
+  void SnapshotWritten(std::string_view epoch_id, uint64_t durable_timestamp, bool full);
+
+ private:
+  struct Chain {
+    std::string epoch_id;
+    uint64_t base_durable_timestamp;
+    uint64_t previous_durable_timestamp;
+    uint64_t length;
+  };
+
+  struct State {
+    // Newest commit timestamp that touched each vertex. Entries newer than a snapshot outlive it, so a vertex
+    // changed both before and after the snapshot's timestamp is written again by the next one.
+    std::unordered_map<Gid, uint64_t> vertices;
+    std::optional<Chain> chain;
+    uint64_t full_required_from{0};
+  };
+
+  utils::Synchronized<State, std::mutex> state_;
+};
+
+/// Structure used to hold information about an incremental snapshot.
+struct IncrementalSnapshotInfo {
+  uint64_t offset_vertices;
+  uint64_t offset_mapper;
+  uint64_t offset_metadata;
+
+  std::string uuid;
+  std::string epoch_id;
+  uint64_t base_durable_timestamp;
+  uint64_t previous_durable_timestamp;
+  uint64_t start_timestamp;
+  uint64_t durable_timestamp;
+  uint64_t num_committed_txns;
+  uint64_t vertices_count;
+  bool properties_on_edges;
+};
+
+/// Function used to read information about the incremental snapshot file.
+/// @throw RecoveryFailure
+IncrementalSnapshotInfo ReadIncrementalSnapshotInfo(std::filesystem::path const &path);
+
+/// Writes the vertices in `plan` as they are visible to `transaction` into a new incremental snapshot file.
+std::optional<std::filesystem::path> CreateIncrementalSnapshot(Storage *storage, Transaction *transaction,
+                                                               std::filesystem::path const &snapshot_directory,
+                                                               utils::SkipListDb<Vertex> *vertices,
+                                                               utils::UUID const &uuid, std::string_view epoch_id,
+                                                               SnapshotChangeTracker::Plan const &plan,
+                                                               utils::FileRetainer *file_retainer,
+                                                               std::atomic_bool *abort_snapshot = nullptr);
+
+/// Incremental snapshots building on the full snapshot described by `uuid`, `epoch_id` and `base_durable_timestamp`,
+/// in the order they have to be applied.
+std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> GetIncrementalSnapshotChain(
+    std::filesystem::path const &snapshot_directory, std::string_view uuid, std::string_view epoch_id,
+    uint64_t base_durable_timestamp);
+
+/// Applies one incremental snapshot onto the recovered graph. The file is read and checked as a whole before the
+/// graph is touched, so a failure leaves the graph as it was. Returns the recovery info of the applied file.
+/// @throw RecoveryFailure
+RecoveryInfo ApplyIncrementalSnapshot(std::filesystem::path const &path, IncrementalSnapshotInfo const &info,
+                                      utils::SkipListDb<Vertex> *vertices, utils::SkipListDb<Edge> *edges,
+                                      NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
+                                      SalientConfig::Items const &items);
+
+/// Rebuilds the schema info of the whole graph, after incremental snapshots changed it behind its back.
+void RebuildSchemaInfo(utils::SkipListDb<Vertex> *vertices, SharedSchemaTracking *schema_info,
+                       bool properties_on_edges);
+
+/// Deletes incremental snapshots whose full snapshot is no longer retained.
+void DeleteOrphanedIncrementalSnapshots(std::filesystem::path const &snapshot_directory, std::string_view uuid,
+                                        std::span<uint64_t const> retained_durable_timestamps,
+                                        utils::FileRetainer *file_retainer);
+
+}  // namespace memgraph::storage::durability
@@ -20,6 +20,7 @@
 namespace memgraph::storage::durability {
 
 static constexpr std::string_view kSnapshotDirectory{"snapshots"};
+static constexpr std::string_view kIncrementalSnapshotDirectory{"incremental"};  // inside kSnapshotDirectory
 static constexpr std::string_view kWalDirectory{"wal"};
 static constexpr std::string_view kBackupDirectory{".backup"};
 static constexpr std::string_view kLockFile{".lock"};
@@ -21,6 +21,8 @@ class ArenaPool;
 
 namespace memgraph::storage::durability {
 struct ParallelizedSchemaCreationInfo {
+  // (first gid, vertex count) batches laid out by recovery. Left empty when an index is created on a live database:
+  // index population then splits the vertex skip list into chunks itself. Constraint validation needs the batches.
   std::vector<std::pair<Gid, uint64_t>> vertex_recovery_info;
   uint64_t thread_count;
   memory::ArenaPool *arena_pool = nullptr;
@@ -328,6 +328,13 @@ void Encoder<FileType>::TryFlushing()
   file_.TryFlushing();
 }
 
+template <typename FileType>
+void Encoder<FileType>::Flush()
+  requires std::same_as<FileType, utils::OutputFile>
+{
+  file_.Flush();
+}
+
 template <typename FileType>
 std::pair<const uint8_t *, size_t> Encoder<FileType>::CurrentFileBuffer() const {
   return file_.CurrentBuffer();
@@ -104,6 +104,15 @@ class Encoder final : public BaseEncoder {
   // Try flushing the internal buffer.
   void TryFlushing()
     requires std::same_as<FileType, utils::OutputFile>;
+  // Write the internal buffer to the file, without syncing it.
+  void Flush()
+    requires std::same_as<FileType, utils::OutputFile>;
+  // POSIX handle of the underlying file.
+  int fd() const
+    requires std::same_as<FileType, utils::OutputFile>
+  {
+    return file_.fd();
+  }
   // Get the current internal buffer with its size.
   std::pair<const uint8_t *, size_t> CurrentFileBuffer() const;
 
@@ -33,6 +33,7 @@
 #include "spdlog/spdlog.h"
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/durability/exceptions.hpp"
+#include "storage/v2/durability/incremental_snapshot.hpp"
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/serialization.hpp"
 #include "storage/v2/durability/version.hpp"
@@ -40,6 +41,7 @@
 #include "storage/v2/edge.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edge_ref.hpp"
+#include "storage/v2/edge_type_grouping.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/indices/label_property_index_stats.hpp"
@@ -786,6 +788,8 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipListDb<Edge>
 
   // Recover edges.
   auto edge_acc = edges.access();
+  // Same as for vertices in `LoadPartialVertices`
+  auto edge_run = edge_acc.sorted_run();
   uint64_t last_edge_gid = 0;
   spdlog::info("Recovering {} edges.", edges_count);
   if (!snapshot.SetPosition(from_offset)) throw RecoveryFailure("Couldn't set offset position for reading edges!");
@@ -839,9 +843,7 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipListDb<Edge>
           }
         }
       } else {
-        auto [it, inserted] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
-        if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
-        edge_ptr = &*it;
+        edge_ptr = &edge_run.push_back(Edge{Gid::FromUint(*gid), nullptr});
       }
 
       // Recover properties.
@@ -874,6 +876,7 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipListDb<Edge>
     }
     if (on_progress) on_progress();
   }
+  if (!edge_acc.splice(edge_run)) throw RecoveryFailure("The edges must be inserted here!");
   spdlog::info("Process of recovering {} edges is finished.", edges_count);
 }
 
@@ -890,6 +893,8 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipListD
     throw RecoveryFailure("Couldn't set offset for reading vertices from a snapshot!");
 
   auto vertex_acc = vertices.access();
+  // The batch is sorted by gid, so it is built as one run and linked into the list at the end
+  auto vertex_run = vertex_acc.sorted_run();
   uint64_t last_vertex_gid = 0;
   spdlog::info("Recovering {} vertices.", vertices_count);
   std::vector<std::pair<PropertyId, PropertyValue>> read_properties;
@@ -924,14 +929,13 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipListD
       throw RecoveryFailure("Read vertex gid is invalid!");
     }
     last_vertex_gid = *gid;
-    auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
-    if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
+    auto &vertex = vertex_run.push_back(Vertex{Gid::FromUint(*gid), nullptr});
 
     // Recover labels.
     {
       auto labels_size = snapshot.ReadUint();
       if (!labels_size) throw RecoveryFailure("Couldn't read the size of vertex labels!");
-      auto &labels = it->labels;
+      auto &labels = vertex.labels;
       labels.reserve(*labels_size);
       for (uint64_t j = 0; j < *labels_size; ++j) {
         auto label = snapshot.ReadUint();
@@ -954,12 +958,12 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipListD
           if (!value) throw RecoveryFailure("Couldn't read vertex property value!");
           read_properties.emplace_back(get_property_from_id(*key), ToPropertyValue(*value, name_id_mapper));
         }
-        it->properties.InitProperties(std::move(read_properties));
+        vertex.properties.InitProperties(std::move(read_properties));
       }
     }
 
     // Update schema info
-    if (schema_info) schema_info->RecoverVertex(&*it);
+    if (schema_info) schema_info->RecoverVertex(&vertex);
 
     // Skip in edges.
     {
@@ -988,6 +992,7 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipListD
     }
     if (on_progress) on_progress();
   }
+  if (!vertex_acc.splice(vertex_run)) throw RecoveryFailure("The vertices must be inserted here!");
   spdlog::info("Process of recovering {} vertices is finished.", vertices_count);
 
   return last_vertex_gid;
@@ -1180,6 +1185,10 @@ LoadPartialConnectivityResult LoadPartialConnectivity(
         if (on_progress) on_progress();
       }
     }
+    if (items.edge_type_grouped_adjacency) {
+      GroupEdgesByType(vertex.in_edges);
+      GroupEdgesByType(vertex.out_edges);
+    }
     ++vertex_it;
   }
   spdlog::info("Process of recovering connectivity for {} vertices is finished.", vertices_count);
@@ -1667,6 +1676,10 @@ RecoveredSnapshot LoadSnapshotVersion14(Decoder &snapshot, const std::filesystem
         // information is duplicated in in_edges.
         edge_count->fetch_add(*out_size, std::memory_order_acq_rel);
       }
+      if (items.edge_type_grouped_adjacency) {
+        GroupEdgesByType(vertex.in_edges);
+        GroupEdgesByType(vertex.out_edges);
+      }
     }
     spdlog::info("Connectivity is recovered.");
 
@@ -10422,15 +10435,43 @@ RecoveredSnapshot LoadCurrentVersionSnapshot(Decoder &snapshot, std::filesystem:
           throw RecoveryFailure("Couldn't read average group size for label property index statistics!");
         const auto avg_degree = snapshot.ReadDouble();
         if (!avg_degree) throw RecoveryFailure("Couldn't read average degree for label property index statistics!");
+        auto stats = LabelPropertyIndexStats{.count = *count,
+                                             .distinct_values_count = *distinct_values_count,
+                                             .statistic = *statistic,
+                                             .avg_group_size = *avg_group_size,
+                                             .avg_degree = *avg_degree};
+        if (version >= kIndexValueDistribution) {
+          const auto mcv_size = snapshot.ReadUint();
+          if (!mcv_size) throw RecoveryFailure("Couldn't read most common values for label property index statistics!");
+          stats.most_common_values.reserve(*mcv_size);
+          for (uint64_t j = 0; j < *mcv_size; ++j) {
+            const auto hash = snapshot.ReadUint();
+            const auto value_count = snapshot.ReadUint();
+            if (!hash || !value_count)
+              throw RecoveryFailure("Couldn't read most common values for label property index statistics!");
+            stats.most_common_values.emplace_back(*hash, *value_count);
+          }
+          const auto other_values_count = snapshot.ReadUint();
+          const auto other_distinct_values_count = snapshot.ReadUint();
+          if (!other_values_count || !other_distinct_values_count)
+            throw RecoveryFailure("Couldn't read other values count for label property index statistics!");
+          stats.other_values_count = *other_values_count;
+          stats.other_distinct_values_count = *other_distinct_values_count;
+          const auto bounds_size = snapshot.ReadUint();
+          if (!bounds_size) throw RecoveryFailure("Couldn't read histogram for label property index statistics!");
+          stats.histogram_bounds.reserve(*bounds_size);
+          for (uint64_t j = 0; j < *bounds_size; ++j) {
+            const auto bound = snapshot.ReadDouble();
+            if (!bound) throw RecoveryFailure("Couldn't read histogram for label property index statistics!");
+            stats.histogram_bounds.push_back(*bound);
+          }
+          const auto histogram_count = snapshot.ReadUint();
+          if (!histogram_count) throw RecoveryFailure("Couldn't read histogram for label property index statistics!");
+          stats.histogram_count = *histogram_count;
+        }
         const auto label_id = get_label_from_id(*label);
         indices_constraints.indices.label_property_stats.emplace_back(
-            label_id,
-            std::make_pair(std::move(property_paths),
-                           LabelPropertyIndexStats{.count = *count,
-                                                   .distinct_values_count = *distinct_values_count,
-                                                   .statistic = *statistic,
-                                                   .avg_group_size = *avg_group_size,
-                                                   .avg_degree = *avg_degree}));
+            label_id, std::make_pair(std::move(property_paths), std::move(stats)));
         SPDLOG_TRACE("Recovered metadata of label+property index statistics for :{}({})",
                      name_id_mapper->IdToName(snapshot_id_map.at(*label)),
                      name_id_mapper->IdToName(snapshot_id_map.at(*property)));
@@ -13796,7 +13837,8 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
                                    on_progress,
                                    *version);
     }
-    case 37U: {
+    case 37U:
+    case 38U: {
       return LoadCurrentVersionSnapshot(snapshot,
                                         path,
                                         vertices,
@@ -14688,6 +14730,18 @@ std::optional<std::filesystem::path> CreateSnapshot(
             snapshot.WriteDouble(stats->statistic);
             snapshot.WriteDouble(stats->avg_group_size);
             snapshot.WriteDouble(stats->avg_degree);
+            snapshot.WriteUint(stats->most_common_values.size());
+            for (const auto &[hash, value_count] : stats->most_common_values) {
+              snapshot.WriteUint(hash);
+              snapshot.WriteUint(value_count);
+            }
+            snapshot.WriteUint(stats->other_values_count);
+            snapshot.WriteUint(stats->other_distinct_values_count);
+            snapshot.WriteUint(stats->histogram_bounds.size());
+            for (const auto bound : stats->histogram_bounds) {
+              snapshot.WriteDouble(bound);
+            }
+            snapshot.WriteUint(stats->histogram_count);
             ++i;
           }
         }
@@ -15133,6 +15187,15 @@ std::optional<std::filesystem::path> CreateSnapshot(
   auto const old_snapshot_files =
       EnsureRetentionCountSnapshotsExist(snapshot_directory, uuid_str, path, file_retainer, storage);
 
+  {
+    std::vector<uint64_t> retained_durable_timestamps{transaction->last_durable_ts_ ? *transaction->last_durable_ts_
+                                                                                    : transaction->start_timestamp};
+    for (auto const &[durable_timestamp, _] : old_snapshot_files) {
+      retained_durable_timestamps.push_back(durable_timestamp);
+    }
+    DeleteOrphanedIncrementalSnapshots(snapshot_directory, uuid_str, retained_durable_timestamps, file_retainer);
+  }
+
   // -1 needed because we skip the current snapshot
   if (old_snapshot_files.size() == storage->config_.durability.snapshot_retention_count - 1 &&
       utils::DirExists(wal_directory)) {
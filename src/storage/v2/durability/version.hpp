@@ -50,18 +50,20 @@ constexpr uint64_t kCrcProtection{36};
 // transaction summary the WAL header gained, back-patched when the file is finalized.
 constexpr uint64_t kVertexPropertyIndex{37};
 constexpr uint64_t kWalHeader{37};
+constexpr uint64_t kIndexValueDistribution{38};
 
 // The current version of snapshot and WAL encoding / decoding.
 // IMPORTANT: Please bump this version for every snapshot and/or WAL format
 // change!!!
 
 // #### CURRENT VERSION vvv
-constexpr uint64_t kVersion{kWalHeader};
+constexpr uint64_t kVersion{kIndexValueDistribution};
 // #### CURRENT VERSION ^^^
 
 // Magic values written to the start of a snapshot/WAL file to identify it.
 const std::string kSnapshotMagic{"MGsn"};
 const std::string kWalMagic{"MGwl"};
+const std::string kIncrementalSnapshotMagic{"MGsi"};
 
 static_assert(std::is_same_v<uint8_t, unsigned char>);
 
@@ -9,8 +9,12 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
 #include <range/v3/all.hpp>
 #include <type_traits>
 #include <unordered_map>
@@ -27,6 +31,7 @@
 #include "storage/v2/durability/version.hpp"
 #include "storage/v2/durability/wal.hpp"
 #include "storage/v2/edge.hpp"
+#include "storage/v2/edge_type_grouping.hpp"
 #include "storage/v2/indexed_property_decoder.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/indices/property_path.hpp"
@@ -1535,11 +1540,11 @@ std::optional<RecoveryInfo> LoadWal(
           throw RecoveryFailure("The from vertex already has this edge! Current ldt is: {}",
                                 ret->last_durable_timestamp);
         }
-        from_vertex->out_edges.push_back(out_link);
+        AddEdge(from_vertex->out_edges, out_link, items.edge_type_grouped_adjacency);
         auto in_link = std::tuple{edge_type_id, &*from_vertex, edge_ref};
         if (r::contains(to_vertex->in_edges, in_link))
           throw RecoveryFailure("The to vertex already has this edge! Current ldt is: {}", ret->last_durable_timestamp);
-        to_vertex->in_edges.push_back(in_link);
+        AddEdge(to_vertex->in_edges, in_link, items.edge_type_grouped_adjacency);
 
         ret->next_edge_id = std::max(ret->next_edge_id, data.gid.AsUint() + 1);
 
@@ -1588,13 +1593,11 @@ std::optional<RecoveryInfo> LoadWal(
             throw RecoveryFailure("The to vertex doesn't have this edge! Current ldt is: {}",
                                   ret->last_durable_timestamp);
 
-          // Both iterators are now known-valid; unlink from both independent vectors. Popping
-          // one does not invalidate the other's iterator, but neither `it` nor `in_it` may be
-          // used after its own vector's pop_back.
-          std::swap(*it, from_vertex->out_edges.back());
-          from_vertex->out_edges.pop_back();
-          std::swap(*in_it, to_vertex->in_edges.back());
-          to_vertex->in_edges.pop_back();
+          // Both iterators are now known-valid; unlink from both independent vectors. Removing
+          // from one does not invalidate the other's iterator, but neither `it` nor `in_it` may be
+          // used after its own vector's removal.
+          RemoveEdge(from_vertex->out_edges, it, items.edge_type_grouped_adjacency);
+          RemoveEdge(to_vertex->in_edges, in_it, items.edge_type_grouped_adjacency);
           // Update schema info before edge deallocation (it reads edge properties).
           if (schema_info) {
             schema_info->DeleteEdge(edge_type_id, edge_ref, &*from_vertex, &*to_vertex, items.properties_on_edges);
@@ -1625,8 +1628,7 @@ std::optional<RecoveryInfo> LoadWal(
           if (it == from_vertex->out_edges.end())
             throw RecoveryFailure("The from vertex doesn't have this edge! Current ldt is: {}",
                                   ret->last_durable_timestamp);
-          std::swap(*it, from_vertex->out_edges.back());
-          from_vertex->out_edges.pop_back();
+          RemoveEdge(from_vertex->out_edges, it, items.edge_type_grouped_adjacency);
         }
         {
           auto in_link = std::tuple{edge_type_id, &*from_vertex, edge_ref};
@@ -1634,8 +1636,7 @@ std::optional<RecoveryInfo> LoadWal(
           if (it == to_vertex->in_edges.end())
             throw RecoveryFailure("The to vertex doesn't have this edge! Current ldt is: {}",
                                   ret->last_durable_timestamp);
-          std::swap(*it, to_vertex->in_edges.back());
-          to_vertex->in_edges.pop_back();
+          RemoveEdge(to_vertex->in_edges, it, items.edge_type_grouped_adjacency);
         }
         // Update schema info before any edge deallocation (it reads edge properties).
         if (schema_info) {
@@ -2436,6 +2437,13 @@ WalTxnEndPos WalFile::AppendTransactionEnd(uint64_t timestamp) {
 
 void WalFile::Sync() { wal_.Sync(); }
 
+int WalFile::DuplicateForSync() {
+  wal_.Flush();
+  int const fd = dup(wal_.fd());
+  MG_ASSERT(fd != -1, "Failed to duplicate the descriptor of WAL file {}: {} ({})", path_, strerror(errno), errno);
+  return fd;
+}
+
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
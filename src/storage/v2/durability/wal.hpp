@@ -642,6 +642,10 @@ class WalFile {
 
   void Sync();
 
+  // Writes the buffered records to the file and returns a new descriptor of it, so the file can be synced without
+  // holding up further appends (or its finalization). The caller owns the descriptor.
+  int DuplicateForSync();
+
   uint64_t GetSize();
 
   uint64_t SequenceNumber() const;
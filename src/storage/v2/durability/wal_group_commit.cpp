@@ -0,0 +1,100 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/wal_group_commit.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "utils/logging.hpp"
+#include "utils/thread.hpp"
+#include "utils/timer.hpp"
+
+namespace memgraph::storage::durability {
+
+WalGroupCommit::WalGroupCommit(PrepareSync prepare_sync, metrics::HistogramHandle batch_size,
+                               metrics::HistogramHandle latency)
+    : prepare_sync_(std::move(prepare_sync)),
+      batch_size_(batch_size),
+      latency_(latency),
+      flusher_([this](std::stop_token token) { Run(std::move(token)); }) {}
+
+WalGroupCommit::~WalGroupCommit() {
+  flusher_.request_stop();
+  if (flusher_.joinable()) flusher_.join();
+}
+
+uint64_t WalGroupCommit::Enqueue() {
+  uint64_t ticket = 0;
+  {
+    auto guard = std::lock_guard{mutex_};
+    ticket = ++enqueued_;
+  }
+  pending_cv_.notify_one();
+  return ticket;
+}
+
+uint64_t WalGroupCommit::LastEnqueued() const {
+  auto guard = std::lock_guard{mutex_};
+  return enqueued_;
+}
+
+void WalGroupCommit::WaitDurable(uint64_t ticket) {
+  auto guard = std::unique_lock{mutex_};
+  durable_cv_.wait(guard, [&] { return durable_ >= ticket; });
+}
+
+void WalGroupCommit::Run(std::stop_token token) {
+  utils::ThreadSetName("wal_flusher");
+  while (true) {
+    {
+      auto guard = std::unique_lock{mutex_};
+      // Returns early on a stop request; tickets enqueued until then still get their sync
+      if (!pending_cv_.wait(guard, token, [&] { return enqueued_ != durable_; })) return;
+    }
+    SyncBatch();
+  }
+}
+
+void WalGroupCommit::SyncBatch() {
+  auto const timer = utils::Timer{};
+  auto const target = prepare_sync_();
+  if (target.fd != -1) {
+    int ret = 0;
+    do {
+      ret = fdatasync(target.fd);
+    } while (ret == -1 && errno == EINTR);
+    // Same reasoning as in `OutputFile::Sync`: after a failed sync there is no telling which writes made it to the
+    // device, so carrying on would acknowledge commits that may be lost.
+    MG_ASSERT(ret == 0, "While trying to sync the WAL an error occurred: {} ({})", strerror(errno), errno);
+    close(target.fd);
+  }
+
+  uint64_t batch = 0;
+  {
+    auto guard = std::lock_guard{mutex_};
+    if (target.ticket > durable_) {
+      batch = target.ticket - durable_;
+      durable_ = target.ticket;
+    }
+  }
+  durable_cv_.notify_all();
+
+  if (batch != 0) {
+    batch_size_.Observe(static_cast<double>(batch));
+    latency_.Observe(timer.Elapsed().count());
+  }
+}
+
+}  // namespace memgraph::storage::durability
@@ -0,0 +1,84 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "metrics/metric_handles.hpp"
+
+namespace memgraph::storage::durability {
+
+// Group commit for the WAL (`Config::Durability::wal_group_commit`).
+//
+// A committing transaction appends its records to the WAL as usual, takes a ticket with `Enqueue` and, once it no
+// longer holds the engine lock, blocks in `WaitDurable` until its records are on disk. A single flusher thread
+// drains the queue: it asks the storage for a sync target (the last ticket whose records reached the file and a
+// descriptor of that file), issues one `fdatasync` for the whole batch and releases all of its waiters together.
+// Commits arriving during a sync form the next batch, so the number of syncs follows the device latency rather than
+// the commit rate.
+class WalGroupCommit final {
+ public:
+  struct SyncTarget {
+    uint64_t ticket;
+    // Owned by the flusher, which closes it after the sync. -1 when there is nothing to sync, e.g. because the
+    // records went to a file that has been finalized (and thereby synced) since.
+    int fd;
+  };
+
+  // Runs on the flusher thread. It has to be serialized with the WAL appends and `Enqueue`, so that every ticket up
+  // to the returned one has its records in the returned file.
+  using PrepareSync = std::function<SyncTarget()>;
+
+  WalGroupCommit(PrepareSync prepare_sync, metrics::HistogramHandle batch_size, metrics::HistogramHandle latency);
+
+  WalGroupCommit(const WalGroupCommit &) = delete;
+  WalGroupCommit(WalGroupCommit &&) = delete;
+  WalGroupCommit &operator=(const WalGroupCommit &) = delete;
+  WalGroupCommit &operator=(WalGroupCommit &&) = delete;
+
+  /// Syncs whatever is still pending and stops the flusher.
+  ~WalGroupCommit();
+
+  /// Hands out the ticket of a transaction whose records have just been written to the WAL.
+  uint64_t Enqueue();
+
+  /// Last ticket handed out.
+  uint64_t LastEnqueued() const;
+
+  /// Blocks until the records of `ticket` are on disk.
+  void WaitDurable(uint64_t ticket);
+
+ private:
+  void Run(std::stop_token token);
+
+  void SyncBatch();
+
+  PrepareSync prepare_sync_;
+  metrics::HistogramHandle batch_size_;
+  metrics::HistogramHandle latency_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable_any pending_cv_;
+  std::condition_variable durable_cv_;
+  uint64_t enqueued_{0};
+  uint64_t durable_{0};
+
+  // Last member, so it is stopped before the state above goes away
+  std::jthread flusher_;
+};
+
+}  // namespace memgraph::storage::durability
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "storage/v2/delta.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
@@ -43,6 +45,21 @@ struct Edge {
 
   void SetDeleted(bool b) { delta_.Set<kDeletedBit>(b ? 1 : 0); }
 
+  struct Header {
+    Delta *delta;
+    bool deleted;
+  };
+
+  /// Reads `delta()` and `deleted()` without taking `lock`. Returns nothing if a writer held `lock` meanwhile, in which
+  /// case they have to be read under `lock` instead.
+  [[nodiscard]] std::optional<Header> TryReadHeader() const {
+    auto const version = lock.try_optimistic_read();
+    if (!version) return std::nullopt;
+    auto const header = delta_.Load();
+    if (!lock.validate_optimistic_read(*version)) return std::nullopt;
+    return Header{.delta = header.GetPtr(), .deleted = header.Get<kDeletedBit>() != 0};
+  }
+
  private:
   static constexpr int kDeletedBit = 0;
 
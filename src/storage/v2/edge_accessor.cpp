@@ -128,7 +128,10 @@ bool EdgeAccessor::IsVisible(const View view) const {
   auto check_presence_of_edge = [&view, this]() -> bool {
     bool deleted = true;
     Delta *delta = nullptr;
-    {
+    if (auto const header = edge_.ptr->TryReadHeader(); header) {
+      deleted = header->deleted;
+      delta = header->delta;
+    } else {
       auto guard = std::shared_lock{edge_.ptr->lock};
       deleted = edge_.ptr->deleted();
       delta = edge_.ptr->delta();
@@ -0,0 +1,71 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+// Helpers for the edge-type grouped adjacency layout (`SalientConfig::Items::edge_type_grouped_adjacency`).
+//
+// In that layout `Vertex::in_edges` / `Vertex::out_edges` are kept as sorted runs by `EdgeTypeId`; inside a run
+// edges keep their insertion order. A typed expansion then binary searches for its run(s) and only visits the
+// matching edges, instead of scanning the whole adjacency list of a supernode. The price is paid on writes: an
+// insert has to shift the tail of the list, and removals must preserve the order instead of swap-and-pop.
+//
+// Every writer of the adjacency lists has to go through these helpers (or re-group afterwards) when the layout is
+// enabled. Readers that do not filter by edge type are unaffected by the ordering.
+
+struct EdgeTypeLess {
+  bool operator()(EdgeTriple const &lhs, EdgeTypeId rhs) const { return std::get<kEdgeTypeIdPos>(lhs) < rhs; }
+  bool operator()(EdgeTypeId lhs, EdgeTriple const &rhs) const { return lhs < std::get<kEdgeTypeIdPos>(rhs); }
+  bool operator()(EdgeTriple const &lhs, EdgeTriple const &rhs) const {
+    return std::get<kEdgeTypeIdPos>(lhs) < std::get<kEdgeTypeIdPos>(rhs);
+  }
+};
+
+/// Run of edges with the given type. Only meaningful on a grouped adjacency list. O(log degree).
+inline std::span<EdgeTriple const> EdgesOfType(Edges const &edges, EdgeTypeId edge_type) {
+  auto const [first, last] = std::equal_range(edges.begin(), edges.end(), edge_type, EdgeTypeLess{});
+  if (first == last) return {};
+  return edges.subspan(std::distance(edges.begin(), first), std::distance(first, last));
+}
+
+/// Appends `edge`; when `grouped` it is moved to the end of its type run so the grouping is preserved.
+inline void AddEdge(Edges &edges, EdgeTriple const &edge, bool grouped) {
+  edges.push_back(edge);
+  if (!grouped) return;
+  auto const last = std::prev(edges.end());
+  auto const pos = std::upper_bound(edges.begin(), last, std::get<kEdgeTypeIdPos>(edge), EdgeTypeLess{});
+  std::rotate(pos, last, edges.end());
+}
+
+/// Removes the edge at `it`; swap-and-pop unless `grouped`, in which case the order is preserved.
+inline void RemoveEdge(Edges &edges, Edges::iterator it, bool grouped) {
+  if (grouped) {
+    edges.erase(it);
+    return;
+  }
+  std::swap(*it, edges.back());
+  edges.pop_back();
+}
+
+/// Restores the grouping after bulk, order-unaware modifications (recovery, abort). O(degree * log degree).
+inline void GroupEdgesByType(Edges &edges) {
+  if (std::is_sorted(edges.begin(), edges.end(), EdgeTypeLess{})) return;
+  std::stable_sort(edges.begin(), edges.end(), EdgeTypeLess{});
+}
+
+}  // namespace memgraph::storage
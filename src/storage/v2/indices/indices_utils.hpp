@@ -253,6 +253,10 @@ inline bool CurrentVersionHasProperty(TEntity const &entity, PropertyId key, Pro
   return exists && !deleted && current_value_equal_to_value;
 }
 
+// Chunks handed out per worker when population splits a live vertex skip list. More chunks than workers keep the
+// threads busy when labels cluster in one part of the gid range.
+inline constexpr uint64_t kIndexPopulationChunksPerThread = 4;
+
 template <typename TVerticesAccessor, typename TSkipListAccessorFactory, typename TFunc>
 inline void PopulateIndexOnMultipleThreads(TVerticesAccessor &vertices, TSkipListAccessorFactory &&accessor_factory,
                                            const TFunc &func,
@@ -260,11 +264,18 @@ inline void PopulateIndexOnMultipleThreads(TVerticesAccessor &vertices, TSkipLis
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
 
   const auto &vertex_batches = parallel_exec_info.vertex_recovery_info;
-  const auto thread_count = std::min(parallel_exec_info.thread_count, vertex_batches.size());
-
-  MG_ASSERT(!vertex_batches.empty(),
-            "The size of batches should always be greater than zero if you want to use the parallel version of index "
-            "creation!");
+  // Recovery lays out (gid, count) batches over a graph nothing else is writing to. A live database has no such
+  // batches, and counts would not survive concurrent inserts anyway, so its skip list is split into node ranges,
+  // which stay correct while other transactions insert vertices.
+  decltype(vertices.create_chunks(0)) chunks;
+  if (vertex_batches.empty()) {
+    chunks = vertices.create_chunks(parallel_exec_info.thread_count * kIndexPopulationChunksPerThread);
+  }
+  const auto work_count = vertex_batches.empty() ? chunks.size() : vertex_batches.size();
+  const auto thread_count = std::min(parallel_exec_info.thread_count, static_cast<uint64_t>(work_count));
+  if (work_count == 0) {
+    return;
+  }
 
   std::atomic<uint64_t> batch_counter = 0;
   // A cancel check throwing inside a worker would escape the thread function and terminate the process, so it is
@@ -283,17 +294,22 @@ inline void PopulateIndexOnMultipleThreads(TVerticesAccessor &vertices, TSkipLis
         auto acc = accessor_factory();
         while (!maybe_error.Lock()->has_value() && !cancelled.load(std::memory_order_relaxed)) {
           const auto batch_index = batch_counter++;
-          if (batch_index >= vertex_batches.size()) {
+          if (batch_index >= work_count) {
             return;
           }
-          const auto &batch = vertex_batches[batch_index];
-          auto it = vertices.find(batch.first);
 
           try {
-            for (auto i{0U}; i < batch.second; ++i, ++it) {
-              func(*it, acc);
+            if (vertex_batches.empty()) {
+              for (Vertex &vertex : chunks[batch_index]) {
+                func(vertex, acc);
+              }
+            } else {
+              const auto &batch = vertex_batches[batch_index];
+              auto it = vertices.find(batch.first);
+              for (auto i{0U}; i < batch.second; ++i, ++it) {
+                func(*it, acc);
+              }
             }
-
           } catch (utils::OutOfMemoryException &failure) {
             utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
             *maybe_error.Lock() = std::move(failure);
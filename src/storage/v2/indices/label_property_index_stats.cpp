@@ -11,12 +11,51 @@
 
 #include "storage/v2/indices/label_property_index_stats.hpp"
 
+#include <iterator>
+#include <sstream>
+
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 #include "utils/simple_json.hpp"
 
 namespace memgraph::storage {
 
+namespace {
+
+// The simple JSON reader has no arrays, so lists are written as strings of space separated entries.
+std::string ToJsonList(std::vector<std::pair<uint64_t, uint64_t>> const &in) {
+  std::string out;
+  for (auto const &[hash, count] : in) {
+    if (!out.empty()) out += ' ';
+    fmt::format_to(std::back_inserter(out), "{}:{}", hash, count);
+  }
+  return out;
+}
+
+std::string ToJsonList(std::vector<double> const &in) { return fmt::format("{}", fmt::join(in, " ")); }
+
+bool FromJsonList(std::string const &in, std::vector<std::pair<uint64_t, uint64_t>> &out) {
+  std::istringstream ss(in);
+  uint64_t hash{0};
+  uint64_t count{0};
+  char separator{0};
+  while (ss >> hash >> separator >> count) {
+    if (separator != ':') return false;
+    out.emplace_back(hash, count);
+  }
+  return ss.eof();
+}
+
+bool FromJsonList(std::string const &in, std::vector<double> &out) {
+  std::istringstream ss(in);
+  double value{0};
+  while (ss >> value) out.push_back(value);
+  return ss.eof();
+}
+
+}  // namespace
+
 bool FromJson(std::string const &json, LabelPropertyIndexStats &out) {
   bool res = true;
   res &= utils::GetJsonValue(json, "count", out.count);
@@ -24,17 +63,37 @@ bool FromJson(std::string const &json, LabelPropertyIndexStats &out) {
   res &= utils::GetJsonValue(json, "statistic", out.statistic);
   res &= utils::GetJsonValue(json, "avg_group_size", out.avg_group_size);
   res &= utils::GetJsonValue(json, "avg_degree", out.avg_degree);
+
+  // The value distribution is missing from statistics written by older versions
+  std::string list;
+  if (utils::GetJsonValue(json, "most_common_values", list)) {
+    res &= FromJsonList(list, out.most_common_values);
+    res &= utils::GetJsonValue(json, "other_values_count", out.other_values_count);
+    res &= utils::GetJsonValue(json, "other_distinct_values_count", out.other_distinct_values_count);
+  }
+  list.clear();
+  if (utils::GetJsonValue(json, "histogram_bounds", list)) {
+    res &= FromJsonList(list, out.histogram_bounds);
+    res &= utils::GetJsonValue(json, "histogram_count", out.histogram_count);
+  }
   return res;
 }
 
 std::string ToJson(LabelPropertyIndexStats const &in) {
   return fmt::format(
-      R"({{"count":{}, "distinct_values_count":{}, "statistic":{}, "avg_group_size":{} "avg_degree":{}}})",
+      R"({{"count":{}, "distinct_values_count":{}, "statistic":{}, "avg_group_size":{}, "avg_degree":{}, )"
+      R"("most_common_values":"{}", "other_values_count":{}, "other_distinct_values_count":{}, )"
+      R"("histogram_bounds":"{}", "histogram_count":{}}})",
       in.count,
       in.distinct_values_count,
       in.statistic,
       in.avg_group_size,
-      in.avg_degree);
+      in.avg_degree,
+      ToJsonList(in.most_common_values),
+      in.other_values_count,
+      in.other_distinct_values_count,
+      ToJsonList(in.histogram_bounds),
+      in.histogram_count);
 }
 
 }  // namespace memgraph::storage
@@ -13,6 +13,8 @@
 
 #include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace memgraph::storage {
 
@@ -20,6 +22,15 @@ struct LabelPropertyIndexStats {
   uint64_t count, distinct_values_count;
   double statistic, avg_group_size, avg_degree;
 
+  // How the values of the first indexed property are distributed. The most common values are kept as their hashes,
+  // together with the number of vertices holding each of them; the rest of the values are only counted.
+  std::vector<std::pair<uint64_t, uint64_t>> most_common_values{};
+  uint64_t other_values_count{0}, other_distinct_values_count{0};
+  // Bounds of equi-depth buckets over the numeric values, every bucket holds about the same number of the
+  // `histogram_count` vertices. Empty if there are fewer than two distinct numeric values.
+  std::vector<double> histogram_bounds{};
+  uint64_t histogram_count{0};
+
   auto operator<=>(const LabelPropertyIndexStats &) const = default;
 };
 
@@ -14,15 +14,23 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/index/predicates.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <iterator>
 #include <utility>
+#include "memory/db_arena_fwd.hpp"
 #include "storage/v2/indices/active_indices_updater.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
 #include "storage/v2/indices/point_index_change_collector.hpp"
 #include "storage/v2/indices/point_index_expensive_header.hpp"
 #include "storage/v2/indices/point_iterator.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/vertex.hpp"
 #include "utils/logging.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace memgraph::storage {
 
@@ -127,24 +135,16 @@ void PointIndexStorage::PublishActiveIndices(ActiveIndicesUpdater const &updater
   updater(std::make_shared<PointIndexStorage::ActiveIndices>(indexes_));
 }
 
-bool PointIndexStorage::CreatePointIndex(LabelId label, PropertyId property,
-                                         utils::SkipListDb<Vertex>::Accessor vertices,
-                                         ProgressCallback const &on_progress) {
-  auto key = LabelPropKey{label, property};
-  if (indexes_->contains(key)) return false;
-
-  auto points_2d_WGS = std::vector<Entry<IndexPointWGS2d>>{};
-  auto points_2d_Crt = std::vector<Entry<IndexPointCartesian2d>>{};
-  auto points_3d_WGS = std::vector<Entry<IndexPointWGS3d>>{};
-  auto points_3d_Crt = std::vector<Entry<IndexPointCartesian3d>>{};
-
-  for (auto const &v : vertices) {
-    if (v.deleted()) continue;
-    if (!std::ranges::contains(v.labels, label)) continue;
+namespace {
+// The points a new index is built from, by kind. A parallel population fills one per thread and appends them.
+struct PointEntries {
+  void Collect(Vertex const &v, LabelId label, PropertyId property, ProgressCallback const &on_progress) {
+    if (v.deleted()) return;
+    if (!std::ranges::contains(v.labels, label)) return;
 
     static constexpr auto point_types = std::array{PropertyStoreType::POINT};
     auto maybe_value = v.properties.GetPropertyOfTypes(property, point_types);
-    if (!maybe_value) continue;
+    if (!maybe_value) return;
 
     auto value = *maybe_value;
     switch (value.type()) {
@@ -167,15 +167,87 @@ bool PointIndexStorage::CreatePointIndex(LabelId label, PropertyId property,
         break;
       }
       default:
-        continue;
+        return;
     }
 
     if (on_progress) on_progress();
   }
+
+  void Append(PointEntries &&other) {
+    std::ranges::move(other.points_2d_WGS, std::back_inserter(points_2d_WGS));
+    std::ranges::move(other.points_2d_Crt, std::back_inserter(points_2d_Crt));
+    std::ranges::move(other.points_3d_WGS, std::back_inserter(points_3d_WGS));
+    std::ranges::move(other.points_3d_Crt, std::back_inserter(points_3d_Crt));
+  }
+
+  std::vector<Entry<IndexPointWGS2d>> points_2d_WGS;
+  std::vector<Entry<IndexPointCartesian2d>> points_2d_Crt;
+  std::vector<Entry<IndexPointWGS3d>> points_3d_WGS;
+  std::vector<Entry<IndexPointCartesian3d>> points_3d_Crt;
+};
+
+// Splits the vertex skip list into chunks that the threads take in turn, each collecting into its own PointEntries.
+// The index is built from all of the points once the threads have joined, so its shape does not depend on the split.
+auto CollectPointsOnMultipleThreads(utils::SkipListDb<Vertex>::Accessor &vertices, LabelId label, PropertyId property,
+                                    ProgressCallback const &on_progress,
+                                    durability::ParallelizedSchemaCreationInfo const &parallel_exec_info)
+    -> PointEntries {
+  auto chunks = vertices.create_chunks(parallel_exec_info.thread_count * kIndexPopulationChunksPerThread);
+  auto const thread_count = std::min(parallel_exec_info.thread_count, static_cast<uint64_t>(chunks.size()));
+  auto thread_entries = std::vector<PointEntries>(thread_count);
+  std::atomic<uint64_t> chunk_counter = 0;
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> first_exception{};
+  {
+    std::vector<memory::DbAwareThread> threads;
+    threads.reserve(thread_count);
+    for (uint64_t i = 0; i < thread_count; ++i) {
+      threads.emplace_back(parallel_exec_info.arena_pool, [&, i]() {
+        try {
+          for (auto chunk_index = chunk_counter++; chunk_index < chunks.size(); chunk_index = chunk_counter++) {
+            for (auto const &v : chunks[chunk_index]) {
+              thread_entries[i].Collect(v, label, property, on_progress);
+            }
+          }
+        } catch (...) {
+          first_exception.WithLock([captured = std::current_exception()](auto &ex) {
+            if (!ex) ex = captured;
+          });
+        }
+      });
+    }
+  }
+  first_exception.WithLock([](auto &ex) {
+    if (ex) std::rethrow_exception(ex);
+  });
+
+  auto entries = PointEntries{};
+  for (auto &part : thread_entries) {
+    entries.Append(std::move(part));
+  }
+  return entries;
+}
+}  // namespace
+
+bool PointIndexStorage::CreatePointIndex(
+    LabelId label, PropertyId property, utils::SkipListDb<Vertex>::Accessor vertices,
+    ProgressCallback const &on_progress,
+    std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info) {
+  auto key = LabelPropKey{label, property};
+  if (indexes_->contains(key)) return false;
+
+  auto entries = PointEntries{};
+  if (parallel_exec_info && parallel_exec_info->thread_count > 1) {
+    entries = CollectPointsOnMultipleThreads(vertices, label, property, on_progress, *parallel_exec_info);
+  } else {
+    for (auto const &v : vertices) {
+      entries.Collect(v, label, property, on_progress);
+    }
+  }
   // Skip the COW copy when the key already exists - matches the symmetric
   // early-return in DropPointIndex.
   if (indexes_->contains(key)) return false;
-  auto new_index = std::make_shared<PointIndex>(points_2d_WGS, points_2d_Crt, points_3d_WGS, points_3d_Crt);
+  auto new_index = std::make_shared<PointIndex>(
+      entries.points_2d_WGS, entries.points_2d_Crt, entries.points_3d_WGS, entries.points_3d_Crt);
   // Copy-on-write: create a new map so existing ActiveIndices snapshots are not affected.
   auto new_indexes = std::make_shared<index_container_t>(*indexes_);
   new_indexes->try_emplace(key, std::move(new_index));
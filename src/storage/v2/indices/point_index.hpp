@@ -11,7 +11,9 @@
 
 #pragma once
 #include <cstdint>
+#include <optional>
 #include "storage/v2/common_function_signatures.hpp"
+#include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/point_index_change_collector.hpp"
 #include "storage/v2/property_value.hpp"
@@ -112,8 +114,11 @@ struct PointIndexStorage {
   // Query (modify index set). Caller is responsible for publishing the
   // resulting ActiveIndices snapshot via PublishActiveIndices — for user DDL
   // this is typically deferred through Transaction::commit_callbacks_.
-  bool CreatePointIndex(LabelId label, PropertyId property, utils::SkipListDb<Vertex>::Accessor vertices,
-                        ProgressCallback const &on_progress = {});
+  // With `parallel_exec_info` set, the vertices are read on several threads.
+  bool CreatePointIndex(
+      LabelId label, PropertyId property, utils::SkipListDb<Vertex>::Accessor vertices,
+      ProgressCallback const &on_progress = {},
+      std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info = std::nullopt);
   /// Removes the index from the live container and returns the evicted PointIndex,
   /// or nullptr if no index existed for {label, property}. The caller can re-install
   /// the result via RestorePointIndex on transaction abort.
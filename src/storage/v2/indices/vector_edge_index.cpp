@@ -111,11 +111,12 @@ void VectorEdgeIndex::AddEdgeToIndex(uint64_t index_id, Edge *edge, EdgeTypeId e
 }
 
 bool VectorEdgeIndex::CreateIndex(const VectorEdgeIndexSpec &spec, utils::SkipListDb<Vertex>::Accessor &vertices,
-                                  NameIdMapper *name_id_mapper, ProgressCallback const &on_progress) {
+                                  NameIdMapper *name_id_mapper, ProgressCallback const &on_progress,
+                                  std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info) {
   try {
     const auto index_id = SetupIndex(spec, name_id_mapper);
     if (!index_id.has_value()) return false;
-    PopulateVectorIndexSingleThreaded(vertices, [&](Vertex &vertex, std::optional<std::size_t> thread_id) {
+    auto add_out_edges = [&](Vertex &vertex, std::optional<std::size_t> thread_id) {
       if (vertex.deleted()) return;
       for (auto &edge_tuple : vertex.out_edges) {
         const auto edge_type = std::get<kEdgeTypeIdPos>(edge_tuple);
@@ -128,7 +129,12 @@ bool VectorEdgeIndex::CreateIndex(const VectorEdgeIndexSpec &spec, utils::SkipLi
         AddEdgeToIndex(*index_id, edge, edge_type, &vertex, to_vertex, name_id_mapper, thread_id);
         if (on_progress) on_progress();
       }
-    });
+    };
+    if (const auto thread_count = VectorIndexPopulationThreadCount(parallel_exec_info); thread_count > 1) {
+      PopulateVectorIndexMultiThreaded(vertices, add_out_edges, thread_count);
+    } else {
+      PopulateVectorIndexSingleThreaded(vertices, add_out_edges);
+    }
     return true;
   } catch (const std::exception &) {
     DropIndex(spec.index_name, name_id_mapper);
@@ -203,9 +203,11 @@ class VectorEdgeIndex {
   /// Mirrors the API on TextEdgeIndex / PointIndexStorage.
   void PublishActiveIndices(ActiveIndicesUpdater const &updater) const;
 
-  /// @brief Creates a new index based on the provided specification.
+  /// @brief Creates a new index based on the provided specification. When `parallel_exec_info` is set, the vertices
+  /// are split between several threads.
   bool CreateIndex(const VectorEdgeIndexSpec &spec, utils::SkipListDb<Vertex>::Accessor &vertices,
-                   NameIdMapper *name_id_mapper, ProgressCallback const &on_progress = {});
+                   NameIdMapper *name_id_mapper, ProgressCallback const &on_progress = {},
+                   std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info = std::nullopt);
 
   /// @brief Recovers a vector edge index based on recovery info.
   void RecoverIndex(VectorEdgeIndexRecoveryInfo &recovery_info, utils::SkipListDb<Vertex>::Accessor &vertices,
@@ -36,18 +36,24 @@ VectorIndex::~VectorIndex() = default;
 void VectorIndex::PublishActiveIndices(ActiveIndicesUpdater const &updater) const { updater(GetActiveIndices()); }
 
 bool VectorIndex::CreateIndex(VectorIndexSpec &spec, utils::SkipListDb<Vertex>::Accessor &vertices, Indices *indices,
-                              NameIdMapper *name_id_mapper, ProgressCallback const &on_progress) {
+                              NameIdMapper *name_id_mapper, ProgressCallback const &on_progress,
+                              std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info) {
   try {
     const auto index_id = SetupIndex(spec, name_id_mapper);
     if (!index_id.has_value()) return false;
-    PopulateVectorIndexSingleThreaded(vertices, [&](Vertex &vertex, std::optional<std::size_t> thread_id) {
+    auto add_vertex = [&](Vertex &vertex, std::optional<std::size_t> thread_id) {
       AddVertexToIndex(
           *index_id,
           vertex,
           IndexedPropertyDecoder<Vertex>{.indices = indices, .name_id_mapper = name_id_mapper, .entity = &vertex},
           thread_id);
       if (on_progress) on_progress();
-    });
+    };
+    if (const auto thread_count = VectorIndexPopulationThreadCount(parallel_exec_info); thread_count > 1) {
+      PopulateVectorIndexMultiThreaded(vertices, add_vertex, thread_count);
+    } else {
+      PopulateVectorIndexSingleThreaded(vertices, add_vertex);
+    }
     return true;
   } catch (const std::exception &) {
     DropIndex(spec.index_name, name_id_mapper);
@@ -283,9 +283,11 @@ class VectorIndex {
   /// @param indices Indices (for property decoding).
   /// @param name_id_mapper Name id mapper (for property decoding).
   /// @param on_progress Invoked once per indexed item so a caller under a peer timeout can observe liveness.
+  /// @param parallel_exec_info When set, the vertices are split between several threads.
   /// @return true if the index was created successfully, false otherwise.
   bool CreateIndex(VectorIndexSpec &spec, utils::SkipListDb<Vertex>::Accessor &vertices, Indices *indices,
-                   NameIdMapper *name_id_mapper, ProgressCallback const &on_progress = {});
+                   NameIdMapper *name_id_mapper, ProgressCallback const &on_progress = {},
+                   std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info = std::nullopt);
 
   /// @brief Recovers an index based on the provided recovery information.
   /// @param recovery_info The recovery information to use.
@@ -18,6 +18,7 @@
 #include "memory/db_arena_fwd.hpp"
 #include "query/exceptions.hpp"
 #include "range/v3/algorithm/remove.hpp"
+#include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/indices/tracked_vector_allocator.hpp"
 #include "storage/v2/property_store.hpp"
 #include "storage/v2/property_value.hpp"
@@ -389,6 +390,14 @@ inline std::size_t GetVectorIndexThreadCount() {
                   static_cast<std::size_t>(FLAGS_storage_recovery_thread_count));
 }
 
+/// @brief Returns the number of threads to populate a new vector index on. Each thread adds under its own id, so
+/// there are never more of them than the thread slots the index reserves.
+inline std::size_t VectorIndexPopulationThreadCount(
+    std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info) {
+  if (!parallel_exec_info) return 1;
+  return std::min(static_cast<std::size_t>(parallel_exec_info->thread_count), GetVectorIndexThreadCount());
+}
+
 /// @brief Updates an entry in the vector index: removes existing entry if present, then adds new vector.
 /// If vector is empty, only removes the entry (if it exists) and returns.
 /// Automatically resizes the index if full during add.
@@ -485,11 +494,13 @@ void PopulateVectorIndexSingleThreaded(utils::SkipListDb<Vertex>::Accessor &vert
 /// @tparam ProcessFunc Callable with signature void(Vertex&, std::optional<std::size_t> thread_id).
 /// @param vertices The vertices accessor to iterate over.
 /// @param process The function to call for each vertex (thread_id is the chunk index).
+/// @param thread_count The number of chunks, each populated on its own thread.
 template <typename ProcessFunc>
   requires std::invocable<ProcessFunc, Vertex &, std::optional<std::size_t>>
-void PopulateVectorIndexMultiThreaded(utils::SkipListDb<Vertex>::Accessor &vertices, ProcessFunc &&process) {
+void PopulateVectorIndexMultiThreaded(utils::SkipListDb<Vertex>::Accessor &vertices, ProcessFunc &&process,
+                                      std::size_t thread_count = FLAGS_storage_recovery_thread_count) {
   const utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  auto vertices_chunks = vertices.create_chunks(FLAGS_storage_recovery_thread_count);
+  auto vertices_chunks = vertices.create_chunks(thread_count);
   const auto actual_chunk_count = vertices_chunks.size();
   utils::Synchronized<std::exception_ptr, utils::SpinLock> first_exception{};
   {
@@ -184,7 +184,7 @@ bool InMemoryEdgePropertyIndex::CreateIndexOnePass(PropertyId property, utils::S
                                                    ProgressCallback const &on_progress) {
   auto res = RegisterIndex(property, updater);
   if (!res) return false;
-  auto res2 = PopulateIndex(property, std::move(vertices), updater, on_progress);
+  auto res2 = PopulateIndex(property, std::move(vertices), std::nullopt, updater, on_progress);
   if (!res2) {
     MG_ASSERT(false,
               "CreateIndexOnePass never cancels: population only fails via a cancel check, and this entry point "
@@ -224,10 +224,11 @@ bool InMemoryEdgePropertyIndex::RegisterIndex(PropertyId property, ActiveIndices
                                  /*register_in_all_indices=*/true);
 }
 
-auto InMemoryEdgePropertyIndex::PopulateIndex(PropertyId property, utils::SkipListDb<Vertex>::Accessor vertices,
-                                              ActiveIndicesUpdater const &updater, ProgressCallback const &on_progress,
-                                              Transaction const *tx, CheckCancelFunction cancel_check)
-    -> std::expected<void, IndexPopulateError> {
+auto InMemoryEdgePropertyIndex::PopulateIndex(
+    PropertyId property, utils::SkipListDb<Vertex>::Accessor vertices,
+    std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info,
+    ActiveIndicesUpdater const &updater, ProgressCallback const &on_progress, Transaction const *tx,
+    CheckCancelFunction cancel_check) -> std::expected<void, IndexPopulateError> {
   auto index = GetIndividualIndex(property);
   if (!index) {
     MG_ASSERT(false, "It should not be possible to remove the index before populating it.");
@@ -241,14 +242,14 @@ auto InMemoryEdgePropertyIndex::PopulateIndex(PropertyId property, utils::SkipLi
         TryInsertEdgePropertyIndex(from_vertex, property, index_accessor, on_progress, *tx);
       };
       PopulateIndexDispatch(
-          vertices, accessor_factory, insert_function, std::move(cancel_check), {} /*TODO: parallel*/);
+          vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     } else {
       // If we are not in a transaction, we need to read the object as it is. (post recovery)
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgePropertyIndex(from_vertex, property, index_accessor, on_progress);
       };
       PopulateIndexDispatch(
-          vertices, accessor_factory, insert_function, std::move(cancel_check), {} /*TODO: parallel*/);
+          vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     }
   } catch (const PopulateCancel &) {
     (void)DropIndex(property, updater);
@@ -21,6 +21,7 @@
 #include "metrics/metric_handles.hpp"
 #include "metrics/scoped_gauge.hpp"
 #include "storage/v2/common_function_signatures.hpp"
+#include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/index_arming.hpp"
@@ -263,6 +264,7 @@ class InMemoryEdgePropertyIndex : public EdgePropertyIndex {
 
   bool RegisterIndex(PropertyId property, ActiveIndicesUpdater const &updater);
   auto PopulateIndex(PropertyId property, utils::SkipListDb<Vertex>::Accessor vertices,
+                     std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info,
                      ActiveIndicesUpdater const &updater, ProgressCallback const &on_progress = {},
                      Transaction const *tx = nullptr, CheckCancelFunction cancel_check = neverCancel)
       -> std::expected<void, IndexPopulateError>;
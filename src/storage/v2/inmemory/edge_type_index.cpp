@@ -121,7 +121,7 @@ bool InMemoryEdgeTypeIndex::CreateIndexOnePass(EdgeTypeId edge_type, utils::Skip
                                                ProgressCallback const &on_progress) {
   auto res = RegisterIndex(edge_type, updater);
   if (!res) return false;
-  auto res2 = PopulateIndex(edge_type, std::move(vertices), updater, on_progress);
+  auto res2 = PopulateIndex(edge_type, std::move(vertices), std::nullopt, updater, on_progress);
   if (!res2) {
     MG_ASSERT(false,
               "CreateIndexOnePass never cancels: population only fails via a cancel check, and this entry point "
@@ -130,10 +130,11 @@ bool InMemoryEdgeTypeIndex::CreateIndexOnePass(EdgeTypeId edge_type, utils::Skip
   return PublishIndex(edge_type, 0);
 }
 
-auto InMemoryEdgeTypeIndex::PopulateIndex(EdgeTypeId edge_type, utils::SkipListDb<Vertex>::Accessor vertices,
-                                          ActiveIndicesUpdater const &updater, ProgressCallback const &on_progress,
-                                          Transaction const *tx, CheckCancelFunction cancel_check)
-    -> std::expected<void, IndexPopulateError> {
+auto InMemoryEdgeTypeIndex::PopulateIndex(
+    EdgeTypeId edge_type, utils::SkipListDb<Vertex>::Accessor vertices,
+    std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info,
+    ActiveIndicesUpdater const &updater, ProgressCallback const &on_progress, Transaction const *tx,
+    CheckCancelFunction cancel_check) -> std::expected<void, IndexPopulateError> {
   auto index = GetIndividualIndex(edge_type);
   if (!index) {
     MG_ASSERT(false, "It should not be possible to remove the index before populating it.");
@@ -146,13 +147,13 @@ auto InMemoryEdgeTypeIndex::PopulateIndex(EdgeTypeId edge_type, utils::SkipListD
       auto const insert_func = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgeTypeIndex(from_vertex, edge_type, index_accessor, on_progress, *tx);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_func, std::move(cancel_check), {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_func, std::move(cancel_check), parallel_exec_info);
     } else {
       // If we are not in a transaction, we need to read the object as it is. (post recovery)
       auto const insert_func = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgeTypeIndex(from_vertex, edge_type, index_accessor, on_progress);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_func, std::move(cancel_check), {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_func, std::move(cancel_check), parallel_exec_info);
     }
   } catch (const PopulateCancel &) {
     (void)DropIndex(edge_type, updater);
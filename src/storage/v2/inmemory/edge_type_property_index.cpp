@@ -222,7 +222,7 @@ bool InMemoryEdgeTypePropertyIndex::CreateIndexOnePass(EdgeTypeId edge_type, Pro
                                                        ProgressCallback const &on_progress) {
   auto res = RegisterIndex(edge_type, property, updater);
   if (!res) return false;
-  auto res2 = PopulateIndex(edge_type, property, std::move(vertices), updater, on_progress);
+  auto res2 = PopulateIndex(edge_type, property, std::move(vertices), std::nullopt, updater, on_progress);
   if (!res2) {
     MG_ASSERT(false,
               "CreateIndexOnePass never cancels: population only fails via a cancel check, and this entry point "
@@ -268,12 +268,11 @@ auto InMemoryEdgeTypePropertyIndex::GetActiveIndices() const -> std::shared_ptr<
   return std::make_shared<ActiveIndices>(index_.ReadCopy());
 }
 
-auto InMemoryEdgeTypePropertyIndex::PopulateIndex(EdgeTypeId edge_type, PropertyId property,
-                                                  utils::SkipListDb<Vertex>::Accessor vertices,
-                                                  ActiveIndicesUpdater const &updater,
-                                                  ProgressCallback const &on_progress, Transaction const *tx,
-                                                  CheckCancelFunction cancel_check)
-    -> std::expected<void, IndexPopulateError> {
+auto InMemoryEdgeTypePropertyIndex::PopulateIndex(
+    EdgeTypeId edge_type, PropertyId property, utils::SkipListDb<Vertex>::Accessor vertices,
+    std::optional<durability::ParallelizedSchemaCreationInfo> const &parallel_exec_info,
+    ActiveIndicesUpdater const &updater, ProgressCallback const &on_progress, Transaction const *tx,
+    CheckCancelFunction cancel_check) -> std::expected<void, IndexPopulateError> {
   auto index = GetIndividualIndex(edge_type, property);
   if (!index) {
     MG_ASSERT(false, "It should not be possible to remove the index before populating it.");
@@ -287,14 +286,14 @@ auto InMemoryEdgeTypePropertyIndex::PopulateIndex(EdgeTypeId edge_type, Property
         TryInsertEdgeTypePropertyIndex(from_vertex, edge_type, property, index_accessor, on_progress, *tx);
       };
       PopulateIndexDispatch(
-          vertices, accessor_factory, insert_function, std::move(cancel_check), {} /*TODO: parallel*/);
+          vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     } else {
       // If we are not in a transaction, we need to read the object as it is. (post recovery)
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgeTypePropertyIndex(from_vertex, edge_type, property, index_accessor, on_progress);
       };
       PopulateIndexDispatch(
-          vertices, accessor_factory, insert_function, std::move(cancel_check), {} /*TODO: parallel*/);
+          vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     }
   } catch (const PopulateCancel &) {
     (void)DropIndex(edge_type, property, updater);
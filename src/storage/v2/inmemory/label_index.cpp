@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include "storage/v2/inmemory/label_index.hpp"
+#include <algorithm>
 #include <range/v3/all.hpp>
 
 #include "metrics/prometheus_metrics.hpp"
@@ -363,6 +364,87 @@ void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
                      self_->max_gid_);
 }
 
+InMemoryLabelIndex::IntersectionIterable::IntersectionIterable(
+    std::vector<utils::SkipListDb<InMemoryLabelIndex::Entry>::Accessor> index_accessors,
+    utils::SkipListDb<Vertex>::ConstAccessor vertices_accessor, std::vector<LabelId> labels, View view,
+    Storage *storage, Transaction *transaction, Gid max_gid)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessors_(std::move(index_accessors)),
+      labels_(std::move(labels)),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction),
+      max_gid_(max_gid) {}
+
+InMemoryLabelIndex::IntersectionIterable::Iterator InMemoryLabelIndex::IntersectionIterable::begin() {
+  std::vector<utils::SkipListDb<Entry>::Iterator> index_iterators;
+  index_iterators.reserve(index_accessors_.size());
+  for (auto &index_accessor : index_accessors_) {
+    index_iterators.push_back(index_accessor.begin());
+  }
+  return {this, std::move(index_iterators)};
+}
+
+InMemoryLabelIndex::IntersectionIterable::Iterator::Iterator(
+    IntersectionIterable *self, std::vector<utils::SkipListDb<InMemoryLabelIndex::Entry>::Iterator> index_iterators)
+    : self_(self),
+      index_iterators_(std::move(index_iterators)),
+      current_vertex_accessor_(nullptr, self_->storage_, nullptr),
+      current_vertex_(nullptr) {
+  // No iterators is the end
+  if (!index_iterators_.empty()) AdvanceUntilValid();
+}
+
+InMemoryLabelIndex::IntersectionIterable::Iterator &InMemoryLabelIndex::IntersectionIterable::Iterator::operator++() {
+  ++index_iterators_.front();
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryLabelIndex::IntersectionIterable::Iterator::AdvanceUntilValid() {
+  auto *checked_vertex = current_vertex_;
+  current_vertex_ = nullptr;
+  // A vertex has an entry per time it got the label, so the same vertex can come up more than once
+  for (; AlignIndices(); ++index_iterators_.front()) {
+    auto *vertex = index_iterators_.front()->vertex;
+    if (vertex == checked_vertex) continue;
+    checked_vertex = vertex;
+
+    if (vertex->gid >= self_->max_gid_) continue;
+
+    // Entries stay until GC even after the label is removed, so only the vertex itself can tell
+    auto accessor = VertexAccessor{vertex, self_->storage_, self_->transaction_};
+    auto labels = accessor.Labels(self_->view_);
+    if (!labels.has_value()) continue;
+    if (std::ranges::all_of(self_->labels_, [&](LabelId label) { return std::ranges::contains(*labels, label); })) {
+      current_vertex_ = vertex;
+      current_vertex_accessor_ = accessor;
+      return;
+    }
+  }
+}
+
+bool InMemoryLabelIndex::IntersectionIterable::Iterator::AlignIndices() {
+  while (true) {
+    Vertex *target = nullptr;
+    for (size_t i = 0; i < index_iterators_.size(); ++i) {
+      if (index_iterators_[i] == self_->index_accessors_[i].end()) return false;
+      target = std::max(target, index_iterators_[i]->vertex);
+    }
+
+    // Entries are ordered by vertex, so whichever index is behind can seek straight to the target
+    bool aligned = true;
+    for (size_t i = 0; i < index_iterators_.size(); ++i) {
+      auto &index_iterator = index_iterators_[i];
+      if (index_iterator->vertex == target) continue;
+      index_iterator = self_->index_accessors_[i].find_equal_or_greater(Entry{target, 0});
+      if (index_iterator == self_->index_accessors_[i].end()) return false;
+      if (index_iterator->vertex != target) aligned = false;
+    }
+    if (aligned) return true;
+  }
+}
+
 uint64_t InMemoryLabelIndex::ActiveIndices::ApproximateVertexCount(LabelId label) const {
   auto it = index_container_->find(label);
   MG_ASSERT(it != index_container_->end(), "Index for label {} doesn't exist", label.AsUint());
@@ -398,6 +480,37 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::ActiveIndices::Vertices(
   return {it->second->skiplist.access(), std::move(vertices_acc), label, view, storage, transaction, max_gid};
 }
 
+InMemoryLabelIndex::IntersectionIterable InMemoryLabelIndex::ActiveIndices::Vertices(std::span<LabelId const> labels,
+                                                                                     View view, Storage *storage,
+                                                                                     Transaction *transaction) {
+  DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
+                 storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
+             "LabelIndex trying to access InMemory vertices from OnDisk!");
+  auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
+  std::vector<std::shared_ptr<IndividualIndex>> indices;
+  indices.reserve(labels.size());
+  for (auto label : labels) {
+    const auto it = index_container_->find(label);
+    MG_ASSERT(it != index_container_->end(), "Index for label {} doesn't exist", label.AsUint());
+    indices.push_back(it->second);
+  }
+  // The first index is the one which steps between matches, the rest only seek, so it should be the smallest
+  std::ranges::sort(indices, {}, [](auto const &index) { return index->skiplist.size(); });
+  std::vector<utils::SkipListDb<Entry>::Accessor> index_accessors;
+  index_accessors.reserve(indices.size());
+  for (auto const &index : indices) {
+    index_accessors.push_back(index->skiplist.access());
+  }
+  const auto max_gid = Gid::FromUint(storage->vertex_id_.load(std::memory_order_acquire));
+  return {std::move(index_accessors),
+          std::move(vertices_acc),
+          std::vector<LabelId>(labels.begin(), labels.end()),
+          view,
+          storage,
+          transaction,
+          max_gid};
+}
+
 InMemoryLabelIndex::ChunkedIterable InMemoryLabelIndex::ActiveIndices::ChunkedVertices(
     LabelId label, utils::SkipListDb<Vertex>::ConstAccessor vertices_acc, View view, Storage *storage,
     Transaction *transaction, size_t num_chunks) {
@@ -13,6 +13,7 @@
 
 #include <mutex>
 #include <span>
+#include <vector>
 
 #include "memory/db_arena_fwd.hpp"
 #include "metrics/metric_handles.hpp"
@@ -122,6 +123,52 @@ class InMemoryLabelIndex : public LabelIndex {
     Gid max_gid_;
   };
 
+  /// Vertices which have all of the labels. The label indices are walked together, each one skipping ahead to the
+  /// vertex another is at, so vertices which miss one of the labels are mostly passed over without being read.
+  class IntersectionIterable {
+   public:
+    IntersectionIterable(std::vector<utils::SkipListDb<Entry>::Accessor> index_accessors,
+                         utils::SkipListDb<Vertex>::ConstAccessor vertices_accessor, std::vector<LabelId> labels,
+                         View view, Storage *storage, Transaction *transaction, Gid max_gid);
+
+    class Iterator {
+     public:
+      Iterator(IntersectionIterable *self, std::vector<utils::SkipListDb<Entry>::Iterator> index_iterators);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return current_vertex_ == other.current_vertex_; }
+
+      bool operator!=(const Iterator &other) const { return current_vertex_ != other.current_vertex_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+      /// Moves every index to the first vertex, not before the current positions, which all of them have.
+      /// Returns false when one of the indices runs out.
+      bool AlignIndices();
+
+      IntersectionIterable *self_;
+      std::vector<utils::SkipListDb<Entry>::Iterator> index_iterators_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+
+    Iterator end() { return {this, {}}; }
+
+   private:
+    utils::SkipListDb<Vertex>::ConstAccessor pin_accessor_;
+    std::vector<utils::SkipListDb<Entry>::Accessor> index_accessors_;
+    std::vector<LabelId> labels_;
+    View view_;
+    Storage *storage_;
+    Transaction *transaction_;
+    Gid max_gid_;
+  };
+
   class ChunkedIterable {
    public:
     ChunkedIterable(utils::SkipListDb<Entry>::Accessor index_accessor,
@@ -210,6 +257,10 @@ class InMemoryLabelIndex : public LabelIndex {
     Iterable Vertices(LabelId label, utils::SkipListDb<Vertex>::ConstAccessor vertices_acc, View view, Storage *storage,
                       Transaction *transaction);
 
+    /// Every one of the labels needs an index.
+    IntersectionIterable Vertices(std::span<LabelId const> labels, View view, Storage *storage,
+                                  Transaction *transaction);
+
     ChunkedIterable ChunkedVertices(LabelId label, utils::SkipListDb<Vertex>::ConstAccessor vertices_acc, View view,
                                     Storage *storage, Transaction *transaction, size_t num_chunks);
 
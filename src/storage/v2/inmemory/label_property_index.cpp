@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <array>
 #include <concepts>
 #include <cstdint>
@@ -34,6 +35,13 @@
 #include "utils/counter.hpp"
 #include "utils/logging.hpp"
 
+#include <boost/container_hash/hash.hpp>
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_label_property_index_hash_lookup, false,
+            "Keep a hash directory next to every label-property index created from now on, so that lookups by "
+            "equal values on all of the indexed properties don't search the ordered index.");
+
 namespace r = ranges;
 namespace rv = r::views;
 
@@ -95,27 +103,47 @@ auto BuildEntryValues(PropertiesPermutationHelper const &helper, PropertyStore c
   }
 }
 
+auto HashEntryValues(IndexOrderedValuesView values) -> std::size_t {
+  auto const prop_value_hash = std::hash<PropertyValue>{};
+  std::size_t seed = 0;
+  for (auto const &value : values) {
+    boost::hash_combine(seed, prop_value_hash(value));
+  }
+  return seed;
+}
+
+// Records an entry the skiplist insert has just added (and not found already
+// present) in the index's equality directory, if it keeps one.
+void RecordInsert(auto const &insert_result, InMemoryLabelPropertyIndex::EqualityDirectory *directory) {
+  auto const &[it, inserted] = insert_result;
+  if (inserted && directory) directory->Add(it->values.as_view(), it->vertex);
+}
+
 // Erase the contiguous run of skiplist entries for `vertex` at the given key.
 // Entries are sorted by (values, vertex, timestamp), so all entries with this
 // (values, vertex) pair are adjacent regardless of ASC/DESC ordering (the
 // reversal only affects the values comparison, not equal-key neighbours).
 template <typename Acc>
-void EraseEntriesAtKey(Acc &acc, IndexOrderedValuesVector const &values, Vertex *vertex) {
+void EraseEntriesAtKey(Acc &acc, InMemoryLabelPropertyIndex::EqualityDirectory *directory,
+                       IndexOrderedValuesVector const &values, Vertex *vertex) {
   using EntryT = typename Acc::value_type;
   for (auto it = acc.find_equal_or_greater(EntryT{values, vertex, 0});
        it != acc.end() && it->vertex == vertex && std::ranges::equal(it->values, values);) {
     auto const next_it = std::next(it);
-    acc.remove(*it);
+    if (acc.remove(*it) && directory) directory->Remove(values, vertex);
     it = next_it;
   }
 }
 
 // Helper function for iterating through label-property index. Returns true if
 // this transaction can see the given vertex, and the visible version has the
-// given label and properties.
+// given label and properties. When `visible_values` is given and the vertex
+// matches, it is filled with the visible values of the properties, in index
+// order. They equal `values` but need not have the same type (1 vs 1.0).
 bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, PropertiesPermutationHelper const &helper,
                                       IndexOrderedValuesView values, Transaction *transaction, View view,
-                                      std::vector<bool> &scratch, bool use_cache = true) {
+                                      std::vector<bool> &scratch, bool use_cache = true,
+                                      std::vector<PropertyValue> *visible_values = nullptr) {
   bool exists = true;
   bool deleted = false;
   bool has_label = false;
@@ -128,6 +156,7 @@ bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, Prope
   has_label = std::ranges::contains(vertex.labels, label);
   if (!delta && !has_label) return false;
   helper.MatchesValues(vertex.properties, values, current_values_equal_to_value);
+  if (visible_values) *visible_values = helper.Extract(vertex.properties);
 
   // If vertex has non-sequential deltas, hold lock while applying them
   if (!vertex.has_uncommitted_non_sequential_deltas()) {
@@ -140,7 +169,8 @@ bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, Prope
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = use_cache && transaction->UseCache();
-    if (useCache) {
+    // A cached property may have been stored from an index entry, which need not have the type of the visible value
+    if (useCache && !visible_values) {
       auto const &cache = transaction->manyDeltasCache;
       if (auto resError = HasError(view, cache, &vertex, false); resError) return false;
       auto resLabel = cache.GetHasLabel(view, &vertex, label);
@@ -178,6 +208,9 @@ bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, Prope
             PropertyValueMatch_ActionMethod(current_values_equal_to_value, helper, values)
           });
       // clang-format on
+      if (visible_values && delta.action == Delta::Action::SET_PROPERTY) {
+        helper.Update(delta.property.key, *delta.property.value, *visible_values);
+      }
     });
 
     // Unlock if we still hold the lock (i.e., vertex had non-sequential deltas)
@@ -197,13 +230,17 @@ bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, Prope
       // `a.b.c`.
       for (auto &&[pos, property_path, value] : helper.WithPropertyId(values)) {
         if (property_path.get().size() == 1 && current_values_equal_to_value[pos]) {
-          cache.StoreProperty(view, &vertex, property_path.get()[0], value.get());
+          auto const &stored = visible_values ? (*visible_values)[pos] : value.get();
+          cache.StoreProperty(view, &vertex, property_path.get()[0], stored);
         }
       }
     }
   }
 
-  return exists && !deleted && has_label && std::ranges::all_of(current_values_equal_to_value, std::identity{});
+  auto const matches =
+      exists && !deleted && has_label && std::ranges::all_of(current_values_equal_to_value, std::identity{});
+  if (matches && visible_values) helper.ApplyPermutationInPlace(std::span{*visible_values});
+  return matches;
 }
 
 /// Helper function for label-properties index garbage collection. Returns true if
@@ -259,7 +296,8 @@ inline bool AnyVersionHasLabelProperties(const Vertex &vertex, LabelId label, st
 void AdvanceUntilValid_(auto &index_iterator, const auto &end, auto *&current_vertex, auto &current_vertex_accessor,
                         auto *storage, auto *transaction, auto view, auto label, const auto &lower_bound,
                         const auto &upper_bound, auto &permutation_helper, memgraph::storage::Gid max_gid,
-                        std::vector<bool> &match_scratch, bool use_cache = true, bool reverse_iteration = false) {
+                        std::vector<bool> &match_scratch, bool use_cache = true, bool reverse_iteration = false,
+                        std::vector<PropertyValue> *visible_values = nullptr) {
   for (; index_iterator != end; ++index_iterator) {
     if (index_iterator->vertex == current_vertex) {
       continue;
@@ -362,7 +400,8 @@ void AdvanceUntilValid_(auto &index_iterator, const auto &end, auto *&current_ve
                                          transaction,
                                          view,
                                          match_scratch,
-                                         use_cache)) {
+                                         use_cache,
+                                         visible_values)) {
       current_vertex = index_iterator->vertex;
       current_vertex_accessor = VertexAccessor(current_vertex, storage, transaction);
       break;
@@ -394,7 +433,9 @@ bool InMemoryLabelPropertyIndex::BasicEntry<Order, N>::operator<=(std::vector<Pr
 }
 
 inline void TryInsertLabelPropertiesIndex(Vertex &vertex, LabelId label, PropertiesPermutationHelper const &props,
-                                          auto &&index_accessor, ProgressCallback const &on_progress) {
+                                          auto &&index_accessor,
+                                          InMemoryLabelPropertyIndex::EqualityDirectory *equality_directory,
+                                          ProgressCallback const &on_progress) {
   // observe regardless
   if (on_progress) on_progress();
 
@@ -408,12 +449,13 @@ inline void TryInsertLabelPropertiesIndex(Vertex &vertex, LabelId label, Propert
 
   // Using 0 as a timestamp is fine because the index is created at timestamp x
   // and any query using the index will be > x.
-  index_accessor.insert({std::move(*values), &vertex, 0});
+  RecordInsert(index_accessor.insert({std::move(*values), &vertex, 0}), equality_directory);
 }
 
 inline void TryInsertLabelPropertiesIndex(Vertex &vertex, LabelId label, PropertiesPermutationHelper const &props,
-                                          auto &&index_accessor, ProgressCallback const &on_progress,
-                                          Transaction const &tx) {
+                                          auto &&index_accessor,
+                                          InMemoryLabelPropertyIndex::EqualityDirectory *equality_directory,
+                                          ProgressCallback const &on_progress, Transaction const &tx) {
   // observe regardless
   if (on_progress) on_progress();
 
@@ -457,7 +499,8 @@ inline void TryInsertLabelPropertiesIndex(Vertex &vertex, LabelId label, Propert
     return;
   }
 
-  index_accessor.insert({props.ApplyPermutation(std::move(properties)), &vertex, tx.start_timestamp});
+  RecordInsert(index_accessor.insert({props.ApplyPermutation(std::move(properties)), &vertex, tx.start_timestamp}),
+               equality_directory);
 }
 
 bool InMemoryLabelPropertyIndex::CreateIndexOnePass(
@@ -575,12 +618,19 @@ auto InMemoryLabelPropertyIndex::PopulateIndex(
 
     if (tx) {
       auto const insert_function = [&](Vertex &vertex, auto &index_accessor) {
-        TryInsertLabelPropertiesIndex(vertex, label, index->permutations_helper, index_accessor, on_progress, *tx);
+        TryInsertLabelPropertiesIndex(vertex,
+                                      label,
+                                      index->permutations_helper,
+                                      index_accessor,
+                                      index->equality_directory.get(),
+                                      on_progress,
+                                      *tx);
       };
       PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     } else {
       auto const insert_function = [&](Vertex &vertex, auto &index_accessor) {
-        TryInsertLabelPropertiesIndex(vertex, label, index->permutations_helper, index_accessor, on_progress);
+        TryInsertLabelPropertiesIndex(
+            vertex, label, index->permutations_helper, index_accessor, index->equality_directory.get(), on_progress);
       };
       PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     }
@@ -666,7 +716,8 @@ void InMemoryLabelPropertyIndex::ActiveIndices::UpdateOnAddLabel(LabelId added_l
         auto values = BuildEntryValues<EntryT>(index.permutations_helper, vertex_after_update->properties);
         if (!values) return;
         auto acc = index.skiplist.access();
-        acc.insert({std::move(*values), vertex_after_update, tx.start_timestamp});
+        RecordInsert(acc.insert({std::move(*values), vertex_after_update, tx.start_timestamp}),
+                     index.equality_directory.get());
       });
     }
   };
@@ -700,7 +751,10 @@ void InMemoryLabelPropertyIndex::ActiveIndices::UpdateOnRemoveLabel(LabelId remo
         auto values = index.permutations_helper.Extract(vertex_before_update->properties);
         if (!AnyNonNull(values)) return;
         auto acc = index.skiplist.access();
-        EraseEntriesAtKey(acc, index.permutations_helper.ApplyPermutation(std::move(values)), vertex_before_update);
+        EraseEntriesAtKey(acc,
+                          index.equality_directory.get(),
+                          index.permutations_helper.ApplyPermutation(std::move(values)),
+                          vertex_before_update);
       });
     }
   };
@@ -749,12 +803,14 @@ void InMemoryLabelPropertyIndex::ActiveIndices::UpdateOnSetProperty(PropertyId p
           auto old_values = helper.Extract(vertex->properties);
           helper.Update(property, old_value, old_values);
           if (AnyNonNull(old_values)) {
-            EraseEntriesAtKey(with_acc(), helper.ApplyPermutation(std::move(old_values)), vertex);
+            EraseEntriesAtKey(
+                with_acc(), index.equality_directory.get(), helper.ApplyPermutation(std::move(old_values)), vertex);
           }
         }
 
         if (auto values = BuildEntryValues<EntryT>(helper, vertex->properties); values) {
-          with_acc().insert({std::move(*values), vertex, tx.start_timestamp});
+          RecordInsert(with_acc().insert({std::move(*values), vertex, tx.start_timestamp}),
+                       index.equality_directory.get());
         }
       });
     }
@@ -1108,7 +1164,9 @@ uint64_t InMemoryLabelPropertyIndex::RemoveObsoleteEntries(Storage *storage, uin
                                                                      it->values.as_view(),
                                                                      oldest_active_start_timestamp,
                                                                      match_scratch)) {
-              index_acc.remove(*it);
+              if (index_acc.remove(*it) && index.equality_directory) {
+                index.equality_directory->Remove(it->values.as_view(), it->vertex);
+              }
             }
           }
           if (!has_next) break;
@@ -1130,11 +1188,81 @@ uint64_t InMemoryLabelPropertyIndex::RemoveObsoleteEntries(Storage *storage, uin
   return swept;
 }
 
+bool InMemoryLabelPropertyIndex::EqualityDirectory::IsHashable(PropertyValue const &value) {
+  using enum PropertyValueType;
+  switch (value.type()) {
+    case Bool:
+    case Int:
+    case Double:
+    case String:
+    case TemporalData:
+    case ZonedTemporalData:
+    case Enum:
+    case Point2d:
+    case Point3d:
+      return true;
+    default:
+      // Lists compare equal across their representations (a list of integers
+      // equals an integer list), which hash differently; maps and nulls are
+      // never looked up by equality.
+      return false;
+  }
+}
+
+void InMemoryLabelPropertyIndex::EqualityDirectory::Add(IndexOrderedValuesView values, Vertex *vertex) {
+  auto const hash = HashEntryValues(values);
+  auto &shard = ShardFor(hash);
+  auto guard = std::unique_lock{shard.lock};
+  auto &vertices = shard.vertices[hash];
+  auto const it = std::ranges::find(vertices, vertex, &std::pair<Vertex *, uint64_t>::first);
+  if (it != vertices.end()) {
+    ++it->second;
+  } else {
+    vertices.emplace_back(vertex, 1);
+  }
+}
+
+void InMemoryLabelPropertyIndex::EqualityDirectory::Remove(IndexOrderedValuesView values, Vertex *vertex) {
+  auto const hash = HashEntryValues(values);
+  auto &shard = ShardFor(hash);
+  auto guard = std::unique_lock{shard.lock};
+  auto const by_hash = shard.vertices.find(hash);
+  if (by_hash == shard.vertices.end()) return;
+  auto &vertices = by_hash->second;
+  auto const it = std::ranges::find(vertices, vertex, &std::pair<Vertex *, uint64_t>::first);
+  if (it == vertices.end()) return;
+  if (--it->second != 0) return;
+  // Order within a hash doesn't matter, lookups sort the candidates
+  *it = vertices.back();
+  vertices.pop_back();
+  if (vertices.empty()) shard.vertices.erase(by_hash);
+}
+
+auto InMemoryLabelPropertyIndex::EqualityDirectory::Candidates(IndexOrderedValuesView values) const
+    -> std::vector<Vertex *> {
+  auto const hash = HashEntryValues(values);
+  auto &shard = ShardFor(hash);
+  auto candidates = std::vector<Vertex *>{};
+  {
+    auto guard = std::shared_lock{shard.lock};
+    auto const by_hash = shard.vertices.find(hash);
+    if (by_hash == shard.vertices.end()) return candidates;
+    candidates.reserve(by_hash->second.size());
+    for (auto const &[vertex, _] : by_hash->second) {
+      candidates.push_back(vertex);
+    }
+  }
+  // The same order the skiplist yields vertices with equal values in
+  std::ranges::sort(candidates);
+  return candidates;
+}
+
 template <typename EntryT>
 InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator::Iterator(
-    Iterable *self, typename utils::SkipListDb<EntryT>::Iterator index_iterator)
+    Iterable *self, typename utils::SkipListDb<EntryT>::Iterator index_iterator, std::size_t candidate_pos)
     : self_(self),
       index_iterator_(index_iterator),
+      candidate_pos_(candidate_pos),
       current_vertex_accessor_(nullptr, self_->storage_, nullptr),
       current_vertex_(nullptr) {
   AdvanceUntilValid();
@@ -1143,13 +1271,45 @@ InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator::Iterator(
 template <typename EntryT>
 typename InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator &
 InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator::operator++() {
-  ++index_iterator_;
+  if (self_->lookup_values_) {
+    ++candidate_pos_;
+  } else {
+    ++index_iterator_;
+  }
   AdvanceUntilValid();
   return *this;
 }
 
+template <typename EntryT>
+void InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator::AdvanceCandidatesUntilValid() {
+  auto const &candidates = self_->candidates_;
+  for (; candidate_pos_ != candidates.size(); ++candidate_pos_) {
+    auto *vertex = candidates[candidate_pos_];
+    if (vertex->gid >= self_->max_gid_) continue;
+    // The visible version is checked against the looked up values, which also
+    // rules out vertices that only share the hash of those values.
+    if (CurrentVersionHasLabelProperties(*vertex,
+                                         self_->label_,
+                                         *self_->permutation_helper_,
+                                         self_->lookup_values_->as_view(),
+                                         self_->transaction_,
+                                         self_->view_,
+                                         match_scratch_,
+                                         /*use_cache=*/true,
+                                         self_->decode_values_ ? &visible_values_ : nullptr)) {
+      current_vertex_ = vertex;
+      current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->storage_, self_->transaction_);
+      break;
+    }
+  }
+}
+
 template <typename EntryT>
 void InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator::AdvanceUntilValid() {
+  if (self_->lookup_values_) {
+    AdvanceCandidatesUntilValid();
+    return;
+  }
   constexpr bool is_desc = EntryT::kOrder == IndexOrder::DESC;
   AdvanceUntilValid_(index_iterator_,
                      self_->index_accessor_.end(),
@@ -1165,7 +1325,8 @@ void InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator::AdvanceUntilValid()
                      self_->max_gid_,
                      match_scratch_,
                      /*use_cache=*/true,
-                     /*reverse_iteration=*/is_desc);
+                     /*reverse_iteration=*/is_desc,
+                     self_->decode_values_ ? &visible_values_ : nullptr);
 }
 
 template <typename EntryT>
@@ -1174,7 +1335,8 @@ InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterable(typename utils::SkipListD
                                                        LabelId label, PropertiesPaths const *properties,
                                                        PropertiesPermutationHelper const *permutation_helper,
                                                        std::span<PropertyValueRange const> ranges, View view,
-                                                       Storage *storage, Transaction *transaction, Gid max_gid)
+                                                       Storage *storage, Transaction *transaction, Gid max_gid,
+                                                       EqualityDirectory const *equality_directory)
     : pin_accessor_(std::move(vertices_accessor)),
       index_accessor_(std::move(index_accessor)),
       label_(label),
@@ -1185,11 +1347,27 @@ InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterable(typename utils::SkipListD
       transaction_(transaction),
       max_gid_(max_gid) {
   bounds_valid_ = ValidateBounds(ranges, lower_bound_, upper_bound_);  // NOLINT
+
+  // A lookup by one value on every indexed property is answered from the
+  // equality directory. The vertices are gathered while `pin_accessor_` already
+  // keeps them from being freed.
+  auto const is_equality = [](auto const &bounds) {
+    auto const &[lower, upper] = bounds;
+    return lower && upper && lower->IsInclusive() && upper->IsInclusive() &&
+           EqualityDirectory::IsHashable(lower->value()) && lower->value() == upper->value();
+  };
+  if (equality_directory && bounds_valid_ && lower_bound_.size() == properties->size() &&
+      std::ranges::all_of(std::views::zip(lower_bound_, upper_bound_), is_equality)) {
+    lookup_values_.emplace(lower_bound_ | rv::transform([](auto const &bound) { return bound->value(); }) |
+                           r::to<std::vector>());
+    candidates_ = equality_directory->Candidates(lookup_values_->as_view());
+  }
 }
 
 template <typename EntryT>
 typename InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator InMemoryLabelPropertyIndex::Iterable<EntryT>::begin() {
   if (!bounds_valid_) return {this, index_accessor_.end()};
+  if (lookup_values_) return {this, index_accessor_.end(), 0};
   auto index_iterator = index_accessor_.begin();
   if constexpr (EntryT::kOrder == IndexOrder::DESC) {
     // For DESC index, we seek to the upper bound (highest value), because forward
@@ -1207,7 +1385,7 @@ typename InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator InMemoryLabelPro
 
 template <typename EntryT>
 typename InMemoryLabelPropertyIndex::Iterable<EntryT>::Iterator InMemoryLabelPropertyIndex::Iterable<EntryT>::end() {
-  return {this, index_accessor_.end()};
+  return {this, index_accessor_.end(), candidates_.size()};
 }
 
 uint64_t InMemoryLabelPropertyIndex::ActiveIndices::ApproximateVertexCount(
@@ -1381,7 +1559,8 @@ auto InMemoryLabelPropertyIndex::ActiveIndices::Vertices(LabelId label, std::spa
           view,
           storage,
           transaction,
-          max_gid};
+          max_gid,
+          index_ptr->equality_directory.get()};
 }
 
 template <typename EntryT>
@@ -1495,7 +1674,9 @@ void InMemoryLabelPropertyIndex::ActiveIndices::AbortEntries(AbortableInfo const
           auto acc = index.skiplist.access();
           // NOLINTNEXTLINE(clang-analyzer-core.uninitialized.Assign): to_remove holds fully-constructed pairs.
           for (auto const &[values, vertex] : to_remove) {
-            acc.remove(EntryT{values, vertex, start_timestamp});
+            if (acc.remove(EntryT{values, vertex, start_timestamp}) && index.equality_directory) {
+              index.equality_directory->Remove(values, vertex);
+            }
           }
         });
       }
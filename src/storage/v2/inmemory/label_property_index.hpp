@@ -11,12 +11,16 @@
 
 #pragma once
 
+#include <gflags/gflags.h>
 #include <array>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -34,8 +38,12 @@
 #include "storage/v2/inmemory/indices_mvcc.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/rw_lock.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_bool(storage_label_property_index_hash_lookup);
+
 namespace memgraph::storage {
 
 // Type-erased iterable wrappers the query executor consumes. Forward-declared
@@ -86,18 +94,54 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   explicit InMemoryLabelPropertyIndex(metrics::GaugeHandle gauge = {}) : gauge_{gauge} {}
 
+  /// Hash directory over the entries of one index: for each hash of entry
+  /// values, the vertices holding such an entry together with the number of
+  /// those entries. A lookup by equal values on every indexed property reads its
+  /// candidates here instead of searching the skiplist. Hashes collide, so the
+  /// candidates must still be checked against the looked up values.
+  class EqualityDirectory {
+   public:
+    /// Whether equal values of this type always hash equally, so a lookup by it
+    /// can be answered from the directory.
+    static bool IsHashable(PropertyValue const &value);
+
+    void Add(IndexOrderedValuesView values, Vertex *vertex);
+
+    void Remove(IndexOrderedValuesView values, Vertex *vertex);
+
+    /// Vertices with an entry whose values hash as `values`, ordered by address.
+    auto Candidates(IndexOrderedValuesView values) const -> std::vector<Vertex *>;
+
+   private:
+    static constexpr std::size_t kShards = 64;
+
+    struct Shard {
+      mutable utils::RWSpinLock lock;
+      std::unordered_map<std::size_t, std::vector<std::pair<Vertex *, uint64_t>>> vertices;
+    };
+
+    auto ShardFor(std::size_t hash) const -> Shard & { return shards_[hash % kShards]; }
+
+    mutable std::array<Shard, kShards> shards_;
+  };
+
   template <typename EntryT = Entry<>>
   struct IndividualIndex {
     using EntryType = EntryT;
 
     explicit IndividualIndex(PropertiesPermutationHelper permutations_helper)
-        : permutations_helper(std::move(permutations_helper)), skiplist{} {}
+        : permutations_helper(std::move(permutations_helper)),
+          skiplist{},
+          equality_directory{FLAGS_storage_label_property_index_hash_lookup ? std::make_unique<EqualityDirectory>()
+                                                                            : nullptr} {}
 
     ~IndividualIndex() = default;
     void Publish(uint64_t commit_timestamp, metrics::GaugeHandle gauge);
 
     PropertiesPermutationHelper const permutations_helper;
     utils::SkipListDb<EntryT> skiplist{};
+    // Kept in step with the skiplist, only when hash lookups are enabled.
+    std::unique_ptr<EqualityDirectory> const equality_directory;
     IndexStatus status{};
     metrics::ScopedGauge gauge_{};
   };
@@ -286,32 +330,53 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
              utils::SkipListDb<Vertex>::ConstAccessor vertices_accessor, LabelId label,
              PropertiesPaths const *properties, PropertiesPermutationHelper const *permutation_helper,
              std::span<PropertyValueRange const> ranges, View view, Storage *storage, Transaction *transaction,
-             Gid max_gid);
+             Gid max_gid, EqualityDirectory const *equality_directory = nullptr);
 
     class Iterator {
      public:
-      Iterator(Iterable *self, typename utils::SkipListDb<EntryT>::Iterator index_iterator);
+      Iterator(Iterable *self, typename utils::SkipListDb<EntryT>::Iterator index_iterator,
+               std::size_t candidate_pos = 0);
 
       VertexAccessor const &operator*() const { return current_vertex_accessor_; }
 
-      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      /// The indexed values of the current vertex, in index order. After
+      /// `DecodeValues` these are the values of its visible version. Otherwise
+      /// they are the entry's, which only equal them: an integer equals the
+      /// same whole double.
+      IndexOrderedValuesView values() const {
+        if (self_->decode_values_) return IndexOrderedValuesView{std::span<PropertyValue const>{visible_values_}};
+        return self_->lookup_values_ ? self_->lookup_values_->as_view() : index_iterator_->values.as_view();
+      }
 
-      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+      bool operator==(const Iterator &other) const {
+        return index_iterator_ == other.index_iterator_ && candidate_pos_ == other.candidate_pos_;
+      }
+
+      bool operator!=(const Iterator &other) const { return !(*this == other); }
 
       Iterator &operator++();
 
      private:
       void AdvanceUntilValid();
+      void AdvanceCandidatesUntilValid();
 
       Iterable *self_;
       typename utils::SkipListDb<EntryT>::Iterator index_iterator_;
+      // Position in `candidates_` when the lookup is answered by the equality directory.
+      std::size_t candidate_pos_;
       VertexAccessor current_vertex_accessor_;
       Vertex *current_vertex_;
       // Owned by the iterator rather than by each advance, so one buffer serves the whole sweep.
       // Its width is the index's arity, so it stops growing after the first entry compared.
       std::vector<bool> match_scratch_;
+      // The visible values of the current vertex, in index order, when the iterable decodes them.
+      std::vector<PropertyValue> visible_values_;
     };
 
+    /// Makes the iterators read the visible values of the indexed properties
+    /// while checking each vertex, for `Iterator::values`. Call before `begin`.
+    void DecodeValues() { decode_values_ = true; }
+
     Iterator begin();
     Iterator end();
 
@@ -331,6 +396,12 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     Storage *storage_;
     Transaction *transaction_;
     Gid max_gid_;
+    // Set when every indexed property is looked up by one value and the index
+    // keeps an equality directory: the values, in index order, and the vertices
+    // the directory holds for them.
+    std::optional<IndexOrderedValuesVector> lookup_values_;
+    std::vector<Vertex *> candidates_;
+    bool decode_values_{false};
   };
 
   template <typename EntryT = Entry<>>
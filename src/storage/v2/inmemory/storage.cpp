@@ -15,10 +15,13 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <functional>
+#include <limits>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <system_error>
 #include <unordered_set>
 #include <utility>
@@ -37,6 +40,7 @@
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/edge_direction.hpp"
+#include "storage/v2/edge_type_grouping.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/active_indices_updater.hpp"
 #include "storage/v2/indices/edge_property_index.hpp"
@@ -307,6 +311,50 @@ class DeltaVertexCache {
   std::unordered_map<Delta const *, Vertex *> cache_;
 };
 
+/// The labels the transaction changed (see `LabelChangeLog`), nullopt when they can't be told from its deltas. Has to
+/// run before the commit is visible, while the deltas keep other writers off the objects the transaction changed.
+LabelChangeLog::Labels ChangedLabels(Transaction const &transaction) {
+  auto const *commit_info = transaction.commit_info.get();
+  std::vector<LabelId> changed;
+  for (Delta const &delta : transaction.deltas) {
+    if (delta.action == Delta::Action::ADD_LABEL || delta.action == Delta::Action::REMOVE_LABEL) {
+      changed.push_back(delta.label.value);
+    }
+    // Everything else is found through the newest delta of each object
+    auto const prev = delta.prev.Get();
+    switch (prev.type) {
+      case PreviousPtr::Type::VERTEX: {
+        auto guard = std::shared_lock{prev.vertex->lock};
+        changed.insert(changed.end(), prev.vertex->labels.begin(), prev.vertex->labels.end());
+        break;
+      }
+      case PreviousPtr::Type::EDGE: {
+        // A created or deleted edge also changed both of its vertices, only a changed property is on the edge alone
+        bool changed_vertices = false;
+        for (auto const *current = &delta; current != nullptr && current->commit_info == commit_info;
+             current = current->next.load(std::memory_order_acquire)) {
+          if (current->action == Delta::Action::DELETE_OBJECT || current->action == Delta::Action::RECREATE_OBJECT) {
+            changed_vertices = true;
+            break;
+          }
+        }
+        if (!changed_vertices) return std::nullopt;
+        break;
+      }
+      case PreviousPtr::Type::DELTA:
+        // A delta of another transaction on top of ours hides which object this is
+        if (prev.delta->commit_info != commit_info) return std::nullopt;
+        break;
+      case PreviousPtr::Type::NULL_PTR:
+        return std::nullopt;
+    }
+  }
+  std::ranges::sort(changed);
+  auto const duplicates = std::ranges::unique(changed);
+  changed.erase(duplicates.begin(), duplicates.end());
+  return changed;
+}
+
 };  // namespace
 
 using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
@@ -334,6 +382,18 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
   MG_ASSERT(!config_.salient.items.storage_light_edge || config_.salient.items.properties_on_edges,
             "Light edges require properties on edges (--storage-light-edge implies "
             "--storage-properties-on-edges=true).");
+  // Before recovery, which is the biggest bulk insert of them all
+  if (config_.enable_skiplist_node_pool) {
+    vertices_.EnableNodePool();
+    edges_.EnableNodePool();
+  }
+  if (config_.gc.thread_count > 1) {
+    // The GC thread does a share of every pass itself
+    gc_workers_ = std::make_unique<utils::ThreadPool>(config_.gc.thread_count - 1, [] {
+      utils::ThreadSetName("gc_worker");
+      return utils::ThreadPool::TaskSignature{};
+    });
+  }
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
       config_.durability.snapshot_on_exit || config_.durability.recover_on_startup) {
     // Create the directory initially to crash the database in case of
@@ -442,6 +502,7 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
       CommitTsInfo const new_info{.ldt_ = info->last_durable_timestamp,
                                   .num_committed_txns_ = info->num_committed_txns};
       repl_storage_state_.commit_ts_info_.store(new_info, std::memory_order_release);
+      label_change_log_.Clear();
       spdlog::trace(
           "Recovering last durable timestamp {}. Timestamp recovered to {}. Num committed txns recovered to {}.",
           info->last_durable_timestamp,
@@ -531,6 +592,20 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
     commit_log_.emplace(timestamp_);
   }
 
+  if (config_.durability.wal_group_commit) {
+    wal_group_commit_.emplace(
+        [this] {
+          // Under the engine lock every enqueued ticket has its records either in the current WAL file or in one
+          // that FinalizeWal already synced
+          auto engine_guard = std::unique_lock{engine_lock_};
+          auto const ticket = wal_group_commit_->LastEnqueued();
+          return durability::WalGroupCommit::SyncTarget{.ticket = ticket,
+                                                        .fd = wal_file_ ? wal_file_->DuplicateForSync() : -1};
+        },
+        metric_handles_.wal_group_commit_batch_size,
+        metric_handles_.wal_group_commit_latency_seconds);
+  }
+
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     // TODO: move out of storage have one global gc_runner_
     gc_runner_.SetInterval(config_.gc.interval);
@@ -561,6 +636,8 @@ InMemoryStorage::~InMemoryStorage() {
   // both commit transactions that write to wal_file_, so resetting wal_file_ while
   // they are still running causes a null dereference in HandleDurabilityAndReplicate.
   StopAllBackgroundTasks();
+  // The flusher reads wal_file_; it syncs whatever is still pending before it stops
+  wal_group_commit_.reset();
   if (wal_file_) {
     wal_file_->FinalizeWal();
     wal_file_.reset();
@@ -797,12 +874,13 @@ std::optional<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeInterna
                             to_vertex = to_vertex,
                             &schema_acc,
                             from_state,
-                            to_state]() {
+                            to_state,
+                            grouped = storage_->config_.salient.items.edge_type_grouped_adjacency]() {
     CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge, from_state);
-    from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+    AddEdge(from_vertex->out_edges, {edge_type, to_vertex, edge}, grouped);
 
     CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge, to_state);
-    to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+    AddEdge(to_vertex->in_edges, {edge_type, from_vertex, edge}, grouped);
 
     transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
     transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -1124,6 +1202,14 @@ std::expected<void, StorageManipulationError> InMemoryStorage::InMemoryAccessor:
   auto const repl_prepare_phase_ok =
       HandleDurabilityAndReplicate(durability_commit_timestamp, replicating_txn, commit_args);
 
+  // With WAL group commit the transaction becomes visible in FinalizeCommitPhase as usual, but the commit is only
+  // reported once its WAL records are synced. The flusher needs the engine lock, so the wait has to come after it.
+  auto const wait_for_wal_sync = [&] {
+    if (!wal_group_commit_ticket_) return;
+    if (engine_guard.owns_lock()) engine_guard.unlock();
+    mem_storage->WaitForWalSync(*std::exchange(wal_group_commit_ticket_, std::nullopt));
+  };
+
   // If replica executes this
   bool const replica_write_was_applied =
       commit_args.apply_if_replica_write([&](bool two_phase_commit, uint64_t /*desired_commit_timestamp*/) {
@@ -1136,6 +1222,7 @@ std::expected<void, StorageManipulationError> InMemoryStorage::InMemoryAccessor:
   if (replica_write_was_applied) {
     // If STRICT_SYNC replica with write txn executes this: return because the 2nd phase will be executed once we
     // receive FinalizeCommitRpc.
+    wait_for_wal_sync();
     return {};
   }
 
@@ -1167,7 +1254,7 @@ std::expected<void, StorageManipulationError> InMemoryStorage::InMemoryAccessor:
         // We need to finalize WAL file after running FinalizeCommitPhase because we update there commit value in WAL
 
         if (mem_storage->wal_file_) {
-          mem_storage->FinalizeWalFile();
+          wal_group_commit_ticket_ = mem_storage->FinalizeWalFile();
         }
         // Send to all replicas they can finalize a transaction
         replicating_txn.FinalizeTransaction(
@@ -1189,6 +1276,7 @@ std::expected<void, StorageManipulationError> InMemoryStorage::InMemoryAccessor:
         return {};
       });
   DMG_ASSERT(res, "The commit was not applied!");
+  wait_for_wal_sync();
   return *std::move(res);
 }
 
@@ -1217,6 +1305,8 @@ void InMemoryStorage::InMemoryAccessor::FinalizeCommitPhase(uint64_t const durab
   }
 
   MG_ASSERT(transaction_.commit_info != nullptr, "Invalid database state!");
+  std::optional<LabelChangeLog::Labels> changed_labels;
+  if (mem_storage->label_change_log_.enabled()) changed_labels = ChangedLabels(transaction_);
   transaction_.commit_info->timestamp.store(*commit_timestamp_, std::memory_order_release);
 
   // If the transaction had non-sequential deltas (or another transaction propagated
@@ -1258,12 +1348,19 @@ void InMemoryStorage::InMemoryAccessor::FinalizeCommitPhase(uint64_t const durab
   DMG_ASSERT(durability_commit_timestamp >= prev, "LDT not monotonically increasing");
 #endif
 
-  auto const update_func = [durability_commit_timestamp](CommitTsInfo const &old_ts_info) -> CommitTsInfo {
+  uint64_t previous_durable_timestamp = 0;
+  auto const update_func = [durability_commit_timestamp,
+                            &previous_durable_timestamp](CommitTsInfo const &old_ts_info) -> CommitTsInfo {
+    previous_durable_timestamp = old_ts_info.ldt_;
     return CommitTsInfo{.ldt_ = durability_commit_timestamp,
                         .num_committed_txns_ = old_ts_info.num_committed_txns_ + 1};
   };
   // update main's cached info
   atomic_struct_update<CommitTsInfo>(mem_storage->repl_storage_state_.commit_ts_info_, update_func);
+  if (changed_labels) {
+    mem_storage->label_change_log_.Record(
+        previous_durable_timestamp, durability_commit_timestamp, *std::move(changed_labels));
+  }
 
   // Install the new point index, if needed
   auto point_updater = mem_storage->indices_.MakeUpdater();
@@ -1531,9 +1628,12 @@ void InMemoryStorage::InMemoryAccessor::Abort(ProgressCallback const &on_progres
 
     // Applies each undo delta in the chain, and optionally unlinks the deltas
     // from the vertex head.
+    bool const grouped_adjacency = mem_storage->config_.salient.items.edge_type_grouped_adjacency;
     auto process_vertex_deltas = [&](Vertex *vertex, Delta *start, bool delta_chunk_attached_to_vertex) {
       auto remove_in_edges = absl::flat_hash_set<EdgeRef>{};
       auto remove_out_edges = absl::flat_hash_set<EdgeRef>{};
+      bool readded_in_edges = false;
+      bool readded_out_edges = false;
 
       Delta *current = start;
       while (current != nullptr &&
@@ -1574,6 +1674,7 @@ void InMemoryStorage::InMemoryAccessor::Abort(ProgressCallback const &on_progres
                 current->vertex_edge.edge_type, current->vertex_edge.vertex.Get(), current->vertex_edge.edge};
             DMG_ASSERT(r::find(vertex->in_edges, link) == vertex->in_edges.end(), "Invalid database state!");
             vertex->in_edges.push_back(link);
+            readded_in_edges = true;
             break;
           }
           case Delta::Action::ADD_OUT_EDGE: {
@@ -1581,6 +1682,7 @@ void InMemoryStorage::InMemoryAccessor::Abort(ProgressCallback const &on_progres
                 current->vertex_edge.edge_type, current->vertex_edge.vertex.Get(), current->vertex_edge.edge};
             DMG_ASSERT(r::find(vertex->out_edges, link) == vertex->out_edges.end(), "Invalid database state!");
             vertex->out_edges.push_back(link);
+            readded_out_edges = true;
             // Increment edge count. We only increment the count here because
             // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
             // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -1634,22 +1736,32 @@ void InMemoryStorage::InMemoryAccessor::Abort(ProgressCallback const &on_progres
 
       // bulk remove in_edges
       if (!remove_in_edges.empty()) {
-        auto mid = r::partition(vertex->in_edges, [&](auto const &edge_tuple) {
+        auto const keep = [&](auto const &edge_tuple) {
           return !remove_in_edges.contains(std::get<EdgeRef>(edge_tuple));
-        });
+        };
+        auto mid =
+            grouped_adjacency ? r::stable_partition(vertex->in_edges, keep) : r::partition(vertex->in_edges, keep);
         vertex->in_edges.erase(mid, vertex->in_edges.end());
         vertex->in_edges.shrink_to_fit();
       }
 
       // bulk remove out_edges
       if (!remove_out_edges.empty()) {
-        auto mid = r::partition(vertex->out_edges, [&](auto const &edge_tuple) {
+        auto const keep = [&](auto const &edge_tuple) {
           return !remove_out_edges.contains(std::get<EdgeRef>(edge_tuple));
-        });
+        };
+        auto mid =
+            grouped_adjacency ? r::stable_partition(vertex->out_edges, keep) : r::partition(vertex->out_edges, keep);
         vertex->out_edges.erase(mid, vertex->out_edges.end());
         vertex->out_edges.shrink_to_fit();
       }
 
+      // Re-added edges were appended, put them back into their type runs
+      if (grouped_adjacency) {
+        if (readded_in_edges) GroupEdgesByType(vertex->in_edges);
+        if (readded_out_edges) GroupEdgesByType(vertex->out_edges);
+      }
+
       if (delta_chunk_attached_to_vertex) {
         vertex->SetDelta(current);
         if (current) {
@@ -1854,8 +1966,13 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   }
   DowngradeToReadIfValid();
   if (!mem_label_index
-           ->PopulateIndex(
-               label, in_memory->vertices_.access(), std::nullopt, updater, {}, &transaction_, std::move(cancel_check))
+           ->PopulateIndex(label,
+                           in_memory->vertices_.access(),
+                           in_memory->IndexPopulationParallelInfo(),
+                           updater,
+                           {},
+                           &transaction_,
+                           std::move(cancel_check))
            .has_value()) {
     return std::unexpected{IndexDefinitionCancelationError{}};
   }
@@ -1891,7 +2008,7 @@ auto InMemoryStorage::InMemoryAccessor::CreateIndex(LabelId label, PropertiesPat
            ->PopulateIndex(label,
                            properties,
                            in_memory->vertices_.access(),
-                           std::nullopt,
+                           in_memory->IndexPopulationParallelInfo(),
                            updater,
                            {},
                            order,
@@ -1939,8 +2056,13 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   }
   DowngradeToReadIfValid();
   if (!mem_edge_type_index
-           ->PopulateIndex(
-               edge_type, in_memory->vertices_.access(), updater, {}, &transaction_, std::move(cancel_check))
+           ->PopulateIndex(edge_type,
+                           in_memory->vertices_.access(),
+                           in_memory->IndexPopulationParallelInfo(),
+                           updater,
+                           {},
+                           &transaction_,
+                           std::move(cancel_check))
            .has_value()) {
     return std::unexpected{IndexDefinitionCancelationError{}};
   }
@@ -1974,8 +2096,14 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   }
   DowngradeToReadIfValid();
   if (!mem_edge_type_property_index
-           ->PopulateIndex(
-               edge_type, property, in_memory->vertices_.access(), updater, {}, &transaction_, std::move(cancel_check))
+           ->PopulateIndex(edge_type,
+                           property,
+                           in_memory->vertices_.access(),
+                           in_memory->IndexPopulationParallelInfo(),
+                           updater,
+                           {},
+                           &transaction_,
+                           std::move(cancel_check))
            .has_value()) {
     return std::unexpected{IndexDefinitionCancelationError{}};
   }
@@ -2010,7 +2138,13 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   }
   DowngradeToReadIfValid();
   if (!mem_edge_property_index
-           ->PopulateIndex(property, in_memory->vertices_.access(), updater, {}, &transaction_, std::move(cancel_check))
+           ->PopulateIndex(property,
+                           in_memory->vertices_.access(),
+                           in_memory->IndexPopulationParallelInfo(),
+                           updater,
+                           {},
+                           &transaction_,
+                           std::move(cancel_check))
            .has_value()) {
     return std::unexpected{IndexDefinitionCancelationError{}};
   }
@@ -2040,7 +2174,7 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   if (!mem_vertex_property_index
            ->PopulateIndex(property,
                            in_memory->vertices_.access(),
-                           std::nullopt,
+                           in_memory->IndexPopulationParallelInfo(),
                            updater,
                            {},
                            &transaction_,
@@ -2250,7 +2384,8 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   MG_ASSERT(type() == UNIQUE, "Creating point index requires a unique access to the storage!");
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto &point_index = in_memory->indices_.point_index_;
-  if (!point_index.CreatePointIndex(label, property, in_memory->vertices_.access(), on_progress)) {
+  if (!point_index.CreatePointIndex(
+          label, property, in_memory->vertices_.access(), on_progress, in_memory->IndexPopulationParallelInfo())) {
     return std::unexpected{IndexDefinitionError{}};
   }
   // Defer publication to commit time so concurrent readers don't observe a
@@ -2299,8 +2434,12 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   auto vertices_acc = in_memory->vertices_.access();
   // We don't allow creating vector index on nodes with the same name as vector edge index
   if (vector_edge_index.IndexExists(spec.index_name) ||
-      !vector_index.CreateIndex(
-          spec, vertices_acc, &in_memory->indices_, in_memory->name_id_mapper_.get(), on_progress)) {
+      !vector_index.CreateIndex(spec,
+                                vertices_acc,
+                                &in_memory->indices_,
+                                in_memory->name_id_mapper_.get(),
+                                on_progress,
+                                in_memory->IndexPopulationParallelInfo())) {
     return std::unexpected{IndexDefinitionError{}};
   }
   // Defer publication to commit time so concurrent readers don't observe a
@@ -2377,7 +2516,11 @@ std::expected<void, StorageIndexDefinitionError> InMemoryStorage::InMemoryAccess
   auto vertices_acc = in_memory->vertices_.access();
   // We don't allow creating vector edge index with the same name as vector index on nodes
   if (vector_index.IndexExists(spec.index_name, in_memory->name_id_mapper_.get()) ||
-      !vector_edge_index.CreateIndex(spec, vertices_acc, in_memory->name_id_mapper_.get(), on_progress)) {
+      !vector_edge_index.CreateIndex(spec,
+                                     vertices_acc,
+                                     in_memory->name_id_mapper_.get(),
+                                     on_progress,
+                                     in_memory->IndexPopulationParallelInfo())) {
     return std::unexpected{IndexDefinitionError{}};
   }
   // Defer publication to commit time. See CreateVectorIndex above.
@@ -2600,6 +2743,29 @@ VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, View
   return VerticesIterable(active_indices->Vertices(label, view, storage_, &transaction_));
 }
 
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(std::span<LabelId const> labels, View view) {
+  auto *active_indices = static_cast<InMemoryLabelIndex::ActiveIndices *>(transaction_.active_indices_->label_.get());
+  return VerticesIterable(active_indices->Vertices(labels, view, storage_, &transaction_));
+}
+
+std::optional<uint64_t> InMemoryStorage::InMemoryAccessor::ApproximateVerticesIntersectionCount(
+    std::span<LabelId const> labels) const {
+  auto const &active_indices = *transaction_.active_indices_->label_;
+  if (labels.empty() || !std::ranges::all_of(labels, [&](LabelId label) { return active_indices.IndexReady(label); })) {
+    return std::nullopt;
+  }
+  // Without anything better to go on, the labels are taken to be independent of each other
+  auto const vertex_count = static_cast<double>(std::max<uint64_t>(ApproximateVertexCount(), 1));
+  auto estimate = vertex_count;
+  uint64_t smallest_count = std::numeric_limits<uint64_t>::max();
+  for (auto const label : labels) {
+    auto const count = active_indices.ApproximateVertexCount(label);
+    estimate *= std::min(static_cast<double>(count) / vertex_count, 1.0);
+    smallest_count = std::min(smallest_count, count);
+  }
+  return std::min(static_cast<uint64_t>(std::llround(estimate)), smallest_count);
+}
+
 VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
     LabelId label, std::span<storage::PropertyPath const> properties,
     std::span<storage::PropertyValueRange const> property_ranges, View view, IndexOrder order) {
@@ -2952,6 +3118,8 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
         }
         storage_mode_ = StorageMode::IN_MEMORY_ANALYTICAL;
       });
+      // Analytical writes bypass the commit path that records changes for incremental snapshots
+      snapshot_changes_.Reset();
 
       // Finalize the WAL so the episode leaves a file-level signature: the pre-import file's [from, to]
       // range then ends before the switch-back snapshot's timestamp, which is how GetRecoverySteps
@@ -3013,6 +3181,7 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
                                            return CommitTsInfo{.ldt_ = std::max(old_info.ldt_, ldt),
                                                                .num_committed_txns_ = old_info.num_committed_txns_};
                                          });
+      label_change_log_.Clear();
 
       // The switch-back snapshot is a new durability base, not an increment on the old one: an analytical
       // episode leaves a timestamp hole no WAL can fill, so nothing written before it can be chained onto
@@ -3042,6 +3211,202 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
   }
 }
 
+void InMemoryStorage::UnlinkGCDeltas(GCDeltas &entry, uint64_t oldest_active_start_timestamp, IndexArming &arming,
+                                     BatchedList<Gid> &deleted_vertices, BatchedList<Edge *> &deleted_edges) {
+  auto const *const commit_info_ptr = entry.commit_info_.get();
+
+  // When unlinking a delta which is the first delta in its version chain,
+  // special care has to be taken to avoid the following race condition:
+  //
+  // [Vertex] --> [Delta A]
+  //
+  //    GC thread: Delta A is the first in its chain, it must be unlinked from
+  //               vertex and marked for deletion
+  //    TX thread: Update vertex and add Delta B with Delta A as next
+  //
+  // [Vertex] --> [Delta B] <--> [Delta A]
+  //
+  //    GC thread: Unlink delta from Vertex
+  //
+  // [Vertex] --> (nullptr)
+  //
+  // When processing a delta that is the first one in its chain, we
+  // obtain the corresponding vertex or edge lock, and then verify that this
+  // delta still is the first in its chain.
+  // When processing a delta that is in the middle of the chain we only
+  // process the final delta of the given transaction in that chain. We
+  // determine the owner of the chain (either a vertex or an edge), obtain the
+  // corresponding lock, and then verify that this delta is still in the same
+  // position as it was before taking the lock.
+  //
+  // Even though the delta chain is lock-free (both `next` and `prev`) the
+  // chain should not be modified without taking the lock from the object that
+  // owns the chain (either a vertex or an edge). Modifying the chain without
+  // taking the lock will cause subtle race conditions that will leave the
+  // chain in a broken state.
+  // The chain can be only read without taking any locks.
+
+  auto const arming_scope = arming.for_deltas_of(entry.wrote_properties_on_);
+
+  for (Delta &delta : entry.deltas_) {
+    arming_scope.note(delta);
+    while (true) {
+      auto prev = delta.prev.Get();
+      switch (prev.type) {
+        case PreviousPtr::Type::VERTEX: {
+          Vertex *vertex = prev.vertex;
+          auto vertex_guard = std::unique_lock{vertex->lock};
+          if (vertex->delta() != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
+          }
+          vertex->SetDelta(nullptr);
+          vertex->set_has_uncommitted_non_sequential_deltas(false);
+
+          if (vertex->deleted()) {
+            DMG_ASSERT(delta.action == Delta::Action::RECREATE_OBJECT);
+            deleted_vertices.push_back(vertex->gid);
+          }
+          break;
+        }
+        case PreviousPtr::Type::EDGE: {
+          Edge *edge = prev.edge;
+          auto edge_guard = std::unique_lock{edge->lock};
+          if (edge->delta() != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
+          }
+          edge->SetDelta(nullptr);
+          if (edge->deleted()) {
+            DMG_ASSERT(delta.action == Delta::Action::RECREATE_OBJECT);
+            deleted_edges.push_back(edge);
+          }
+          break;
+        }
+        case PreviousPtr::Type::DELTA: {
+          //              kTransactionInitialId
+          //                     │
+          //                     ▼
+          // ┌───────────────────┬─────────────┐
+          // │     Committed     │ Uncommitted │
+          // ├──────────┬────────┴─────────────┤
+          // │ Inactive │      Active          │
+          // └──────────┴──────────────────────┘
+          //            ▲
+          //            │
+          //  oldest_active_start_timestamp
+
+          if (prev.delta->commit_info == commit_info_ptr) {
+            // The delta that is newer than this one is also a delta from this
+            // transaction. We skip the current delta and will remove it as a
+            // part of the suffix later.
+            break;
+          }
+
+          if (prev.delta->commit_info->timestamp.load() < oldest_active_start_timestamp) {
+            if (IsDeltaNonSequential(*prev.delta)) {
+              // Non-sequential predecessor: readers follow next, so we must
+              // null it to stop traversal into freed memory. We can skip the
+              // lock because we know we are the only potential modifiers,
+              // since:
+              // - the predecessor delta is inactive
+              // - prepends only happen at the chain head
+              // - the GC is serialized via gc_lock_, and within a GC run
+              //   only the worker unlinking this delta writes the
+              //   predecessor's next.
+              // Safe for concurrent readers: all deltas beyond this point are
+              // also inactive (guaranteed by waiting_gc_deltas_), so no
+              // active transaction needs to read past here.
+              prev.delta->next.store(nullptr, std::memory_order_release);
+            }
+            break;
+          }
+
+          // Previous is active (committed or uncommitted). We need to find
+          // the parent object in order to be able to use its lock.
+          auto parent = prev;
+          while (parent.type == PreviousPtr::Type::DELTA) {
+            parent = parent.delta->prev.Get();
+          }
+
+          auto const guard = std::invoke([&] {
+            switch (parent.type) {
+              case PreviousPtr::Type::VERTEX:
+                return std::unique_lock{parent.vertex->lock};
+              case PreviousPtr::Type::EDGE:
+                return std::unique_lock{parent.edge->lock};
+              case PreviousPtr::Type::DELTA:
+              case PreviousPtr::Type::NULL_PTR:
+                LOG_FATAL("Invalid database state!");
+            }
+          });
+          if (delta.prev.Get() != prev) {
+            // Something changed, we could now be the first delta in the
+            // chain.
+            continue;
+          }
+          Delta *prev_delta = prev.delta;
+          prev_delta->next.store(nullptr, std::memory_order_release);
+          break;
+        }
+        case PreviousPtr::Type::NULL_PTR: {
+          LOG_FATAL("Invalid pointer!");
+        }
+      }
+      break;
+    }
+  }
+}
+
+void InMemoryStorage::UnlinkCommittedDeltas(std::span<GCDeltas *const> entries, std::span<uint8_t> unlinked,
+                                            uint64_t oldest_active_start_timestamp,
+                                            BatchedList<Gid> &deleted_vertices, BatchedList<Edge *> &deleted_edges) {
+  // Transactions are independent units of work here: a version chain is only changed under the lock of the object
+  // owning it, so two workers meeting on the same chain serialize the way a worker and a writer do.
+  auto const budget = config_.gc.max_unlink_time;
+  const utils::Timer timer;
+  std::atomic<size_t> next_entry{0};
+  auto const unlink = [&](IndexArming &arming, BatchedList<Gid> &vertices, BatchedList<Edge *> &edges) {
+    while (budget.count() == 0 || timer.Elapsed<std::chrono::milliseconds>() < budget) {
+      auto const i = next_entry.fetch_add(1, std::memory_order_relaxed);
+      if (i >= entries.size()) return;
+      UnlinkGCDeltas(*entries[i], oldest_active_start_timestamp, arming, vertices, edges);
+      unlinked[i] = 1;
+    }
+  };
+
+  auto const workers = GcWorkerCount(entries.size(), kGcTransactionsPerWorker);
+  if (workers == 1) {
+    unlink(cycle_index_arming_, deleted_vertices, deleted_edges);
+    return;
+  }
+
+  struct WorkerOutput {
+    BatchedList<Gid> deleted_vertices;
+    BatchedList<Edge *> deleted_edges;
+  };
+  auto outputs = std::vector<WorkerOutput>(workers - 1);
+  if (gc_worker_index_arming_.size() < workers - 1) gc_worker_index_arming_.resize(workers - 1);
+  for (auto &arming : gc_worker_index_arming_) arming.reset();
+
+  RunGcWorkers(workers, [&](uint64_t worker) {
+    if (worker == 0) {
+      unlink(cycle_index_arming_, deleted_vertices, deleted_edges);
+    } else {
+      auto &output = outputs[worker - 1];
+      unlink(gc_worker_index_arming_[worker - 1], output.deleted_vertices, output.deleted_edges);
+    }
+  });
+
+  for (uint64_t worker = 1; worker < workers; ++worker) {
+    cycle_index_arming_ |= gc_worker_index_arming_[worker - 1];
+    deleted_vertices.splice(outputs[worker - 1].deleted_vertices);
+    deleted_edges.splice(outputs[worker - 1].deleted_edges);
+  }
+}
+
 void InMemoryStorage::CollectGarbage(utils::ResourceLockGuard main_guard, bool periodic) {
   // NOTE: A single call need not handle objects deleted under a different storage mode: SetStorageMode
   // runs GC before any transaction in the new mode can start.
@@ -3193,6 +3558,7 @@ void InMemoryStorage::CollectGarbage(utils::ResourceLockGuard main_guard, bool p
     }
   }
 
+  auto const waiting_count = local_waiting.size();
   if (!local_waiting.empty()) {
     waiting_gc_deltas_.WithLock(
         [&](auto &waiting_list) { waiting_list.splice(waiting_list.begin(), std::move(local_waiting)); });
@@ -3246,173 +3612,41 @@ void InMemoryStorage::CollectGarbage(utils::ResourceLockGuard main_guard, bool p
   auto &cycle_arming = cycle_index_arming_;
   cycle_arming.reset();
 
-  auto const end_linked_undo_buffers = linked_undo_buffers.end();
-  for (auto linked_entry = linked_undo_buffers.begin(); linked_entry != end_linked_undo_buffers;) {
-    auto const *const commit_info_ptr = linked_entry->commit_info_.get();
-
-    // Use unlinkable_timestamp to determine if safe to unlink
-    auto const unlinkable_timestamp = linked_entry->unlinkable_timestamp_;
-
-    // only process those that are no longer active
-    if (unlinkable_timestamp >= oldest_active_start_timestamp) {
-      ++linked_entry;  // can not process, skip
-      continue;        // must continue to next transaction, because committed_transactions_ was not ordered
-    }
-
-    // When unlinking a delta which is the first delta in its version chain,
-    // special care has to be taken to avoid the following race condition:
-    //
-    // [Vertex] --> [Delta A]
-    //
-    //    GC thread: Delta A is the first in its chain, it must be unlinked from
-    //               vertex and marked for deletion
-    //    TX thread: Update vertex and add Delta B with Delta A as next
-    //
-    // [Vertex] --> [Delta B] <--> [Delta A]
-    //
-    //    GC thread: Unlink delta from Vertex
-    //
-    // [Vertex] --> (nullptr)
-    //
-    // When processing a delta that is the first one in its chain, we
-    // obtain the corresponding vertex or edge lock, and then verify that this
-    // delta still is the first in its chain.
-    // When processing a delta that is in the middle of the chain we only
-    // process the final delta of the given transaction in that chain. We
-    // determine the owner of the chain (either a vertex or an edge), obtain the
-    // corresponding lock, and then verify that this delta is still in the same
-    // position as it was before taking the lock.
-    //
-    // Even though the delta chain is lock-free (both `next` and `prev`) the
-    // chain should not be modified without taking the lock from the object that
-    // owns the chain (either a vertex or an edge). Modifying the chain without
-    // taking the lock will cause subtle race conditions that will leave the
-    // chain in a broken state.
-    // The chain can be only read without taking any locks.
-
-    auto const arming_scope = cycle_arming.for_deltas_of(linked_entry->wrote_properties_on_);
-
-    for (Delta &delta : linked_entry->deltas_) {
-      arming_scope.note(delta);
-      while (true) {
-        auto prev = delta.prev.Get();
-        switch (prev.type) {
-          case PreviousPtr::Type::VERTEX: {
-            Vertex *vertex = prev.vertex;
-            auto vertex_guard = std::unique_lock{vertex->lock};
-            if (vertex->delta() != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            vertex->SetDelta(nullptr);
-            vertex->set_has_uncommitted_non_sequential_deltas(false);
-
-            if (vertex->deleted()) {
-              DMG_ASSERT(delta.action == Delta::Action::RECREATE_OBJECT);
-              current_deleted_vertices.push_back(vertex->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::EDGE: {
-            Edge *edge = prev.edge;
-            auto edge_guard = std::unique_lock{edge->lock};
-            if (edge->delta() != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            edge->SetDelta(nullptr);
-            if (edge->deleted()) {
-              DMG_ASSERT(delta.action == Delta::Action::RECREATE_OBJECT);
-              current_deleted_edges.push_back(edge);
-            }
-            break;
-          }
-          case PreviousPtr::Type::DELTA: {
-            //              kTransactionInitialId
-            //                     │
-            //                     ▼
-            // ┌───────────────────┬─────────────┐
-            // │     Committed     │ Uncommitted │
-            // ├──────────┬────────┴─────────────┤
-            // │ Inactive │      Active          │
-            // └──────────┴──────────────────────┘
-            //            ▲
-            //            │
-            //  oldest_active_start_timestamp
-
-            if (prev.delta->commit_info == commit_info_ptr) {
-              // The delta that is newer than this one is also a delta from this
-              // transaction. We skip the current delta and will remove it as a
-              // part of the suffix later.
-              break;
-            }
-
-            if (prev.delta->commit_info->timestamp.load() < oldest_active_start_timestamp) {
-              if (IsDeltaNonSequential(*prev.delta)) {
-                // Non-sequential predecessor: readers follow next, so we must
-                // null it to stop traversal into freed memory. We can skip the
-                // lock because we know we are the only potential modifiers,
-                // since:
-                // - the predecessor delta is inactive
-                // - prepends only happen at the chain head
-                // - the GC is serialized via gc_lock_.
-                // Safe for concurrent readers: all deltas beyond this point are
-                // also inactive (guaranteed by waiting_gc_deltas_), so no
-                // active transaction needs to read past here.
-                prev.delta->next.store(nullptr, std::memory_order_release);
-              }
-              break;
-            }
-
-            // Previous is active (committed or uncommitted). We need to find
-            // the parent object in order to be able to use its lock.
-            auto parent = prev;
-            while (parent.type == PreviousPtr::Type::DELTA) {
-              parent = parent.delta->prev.Get();
-            }
+  const utils::Timer unlink_timer;
+  // Only those that are no longer active can be unlinked. committed_transactions_ is not ordered, so every entry has
+  // to be looked at.
+  auto unlinkable = std::vector<GCDeltas *>{};
+  for (auto &linked_entry : linked_undo_buffers) {
+    if (linked_entry.unlinkable_timestamp_ < oldest_active_start_timestamp) unlinkable.push_back(&linked_entry);
+  }
+  auto unlinked = std::vector<uint8_t>(unlinkable.size(), 0);
+  UnlinkCommittedDeltas(
+      unlinkable, unlinked, oldest_active_start_timestamp, current_deleted_vertices, current_deleted_edges);
 
-            auto const guard = std::invoke([&] {
-              switch (parent.type) {
-                case PreviousPtr::Type::VERTEX:
-                  return std::unique_lock{parent.vertex->lock};
-                case PreviousPtr::Type::EDGE:
-                  return std::unique_lock{parent.edge->lock};
-                case PreviousPtr::Type::DELTA:
-                case PreviousPtr::Type::NULL_PTR:
-                  LOG_FATAL("Invalid database state!");
-              }
-            });
-            if (delta.prev.Get() != prev) {
-              // Something changed, we could now be the first delta in the
-              // chain.
-              continue;
-            }
-            Delta *prev_delta = prev.delta;
-            prev_delta->next.store(nullptr, std::memory_order_release);
-            break;
-          }
-          case PreviousPtr::Type::NULL_PTR: {
-            LOG_FATAL("Invalid pointer!");
-          }
-        }
-        break;
+  // Now unlinked, move to unlinked_undo_buffers. `unlinkable` is in list order, so one walk finds them all.
+  {
+    size_t next_unlinkable = 0;
+    auto const end_linked_undo_buffers = linked_undo_buffers.end();
+    for (auto linked_entry = linked_undo_buffers.begin(); linked_entry != end_linked_undo_buffers;) {
+      auto const to_move = linked_entry;
+      ++linked_entry;  // advanced to next before we move the list node
+      if (next_unlinkable == unlinkable.size() || &*to_move != unlinkable[next_unlinkable]) continue;
+      if (unlinked[next_unlinkable++] != 0) {
+        unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
       }
     }
-
-    // Now unlinked, move to unlinked_undo_buffers
-    auto const to_move = linked_entry;
-    ++linked_entry;  // advanced to next before we move the list node
-    unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
   }
 
+  // Backlog at the end of the pass: what could not be unlinked yet, or not yet even be considered
+  metric_handles_.gc_backlog_transactions.Set(static_cast<double>(linked_undo_buffers.size() + waiting_count));
+
   if (!linked_undo_buffers.empty()) {
     // some were not able to be collected, add them back to committed_transactions_ for the next GC run
     committed_transactions_.WithLock([&linked_undo_buffers](auto &committed_transactions) {
       committed_transactions.splice(committed_transactions.begin(), std::move(linked_undo_buffers));
     });
   }
+  metric_handles_.gc_unlink_latency_seconds.Observe(std::chrono::duration<double>(unlink_timer.Elapsed()).count());
 
   // Index cleanup runs can be expensive, we want to avoid high CPU usage when the GC doesn't have to clean up any
   // indexes.
@@ -3504,6 +3738,7 @@ void InMemoryStorage::CollectGarbage(utils::ResourceLockGuard main_guard, bool p
   }
 
   gc_progress_.SetPhase(GcPhase::DELETE);
+  const utils::Timer retire_timer;
 
   {
     auto guard = std::unique_lock{engine_lock_};
@@ -3621,6 +3856,7 @@ void InMemoryStorage::CollectGarbage(utils::ResourceLockGuard main_guard, bool p
     }
     RetireEdges(analytical_deleted_edges | std::ranges::views::transform(&Edge::gid));
   }
+  metric_handles_.gc_retire_latency_seconds.Observe(std::chrono::duration<double>(retire_timer.Elapsed()).count());
 }
 
 void InMemoryStorage::DrainLightEdgeGraveyard() {
@@ -3728,6 +3964,17 @@ StorageInfo InMemoryStorage::GetInfo() {
   return info;
 }
 
+auto InMemoryStorage::IndexPopulationParallelInfo() const -> std::optional<durability::ParallelizedSchemaCreationInfo> {
+  auto const thread_count = config_.durability.index_population_thread_count;
+  if (thread_count <= 1 || vertices_.size() < kMinVerticesForParallelIndexPopulation) {
+    return std::nullopt;
+  }
+  // No recovery batches: population splits the vertex skip list itself, which stays correct while transactions that
+  // were let in after the downgrade to READ insert vertices.
+  return durability::ParallelizedSchemaCreationInfo{
+      .vertex_recovery_info = {}, .thread_count = thread_count, .arena_pool = db_arena_};
+}
+
 bool InMemoryStorage::InitializeWalFile(std::string_view const epoch_id) {
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL ||
       storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
@@ -3747,9 +3994,11 @@ bool InMemoryStorage::InitializeWalFile(std::string_view const epoch_id) {
   return true;
 }
 
-void InMemoryStorage::FinalizeWalFile() {
-  ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+std::optional<uint64_t> InMemoryStorage::FinalizeWalFile() {
+  std::optional<uint64_t> group_commit_ticket;
+  if (wal_group_commit_) {
+    group_commit_ticket = wal_group_commit_->Enqueue();
+  } else if (++wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
     wal_file_->Sync();
     wal_unsynced_transactions_ = 0;
   }
@@ -3764,6 +4013,12 @@ void InMemoryStorage::FinalizeWalFile() {
     // reading thread EnabledFlushing)
     wal_file_->TryFlushing();
   }
+  return group_commit_ticket;
+}
+
+void InMemoryStorage::WaitForWalSync(uint64_t const ticket) {
+  DMG_ASSERT(wal_group_commit_, "WAL group commit is not enabled!");
+  wal_group_commit_->WaitDurable(ticket);
 }
 
 bool InMemoryStorage::ArchiveSupersededDurabilityFiles(std::filesystem::path const &keep_snapshot) {
@@ -3800,15 +4055,39 @@ bool InMemoryStorage::ArchiveSupersededDurabilityFiles(std::filesystem::path con
       backup_dir = dir / kOldDurabilityDir;
     }
 
-    for (auto const &path : utils::GetFilesFromDir(dir)) {  // already skips the .old sub-directory
-      if (keep && path.filename() == keep->filename()) continue;
+    auto const archive_file = [&](std::filesystem::path const &path, std::filesystem::path const &archive_to) {
       if (!backup_dir) {
         file_retainer_.DeleteFile(path);
-        continue;
+        return;
       }
-      auto const new_path = *backup_dir / path.filename();
+      auto const new_path = archive_to / path.filename();
       spdlog::trace("Archiving durability file {} to {}", path, new_path);
       file_retainer_.RenameFile(path, new_path);
+    };
+
+    for (auto const &path : utils::GetFilesFromDir(dir)) {  // already skips the .old sub-directory
+      if (keep && path.filename() == keep->filename()) continue;
+      if (path.filename() == durability::kIncrementalSnapshotDirectory) {
+        // Every incremental snapshot builds on a full snapshot that is archived here, so the chains go with them.
+        // Moved file by file since the retainer can't copy a directory if one of them is in use.
+        auto const incremental_files = utils::GetFilesFromDir(path);
+        if (incremental_files.empty()) continue;
+        std::optional<std::filesystem::path> incremental_backup_dir;
+        if (backup_dir) {
+          std::error_code ec;
+          incremental_backup_dir = *backup_dir / durability::kIncrementalSnapshotDirectory;
+          std::filesystem::create_directory(*incremental_backup_dir, ec);
+          if (ec) {
+            spdlog::warn("Failed to create backup directory {}. Err: {}", *incremental_backup_dir, ec.message());
+            continue;
+          }
+        }
+        for (auto const &incremental_path : incremental_files) {
+          archive_file(incremental_path, incremental_backup_dir.value_or(path));
+        }
+        continue;
+      }
+      archive_file(path, backup_dir.value_or(dir));
     }
 
     if (backup_dir) {
@@ -3873,6 +4152,11 @@ auto InMemoryStorage::InMemoryAccessor::HandleDurabilityAndReplicate(uint64_t du
     }
   };
 
+  bool const track_snapshot_changes = mem_storage->config_.durability.snapshot_incremental_chain_length != 0;
+  if (track_snapshot_changes && !transaction_.md_deltas.empty()) {
+    mem_storage->snapshot_changes_.InvalidateAt(durability_commit_timestamp);
+  }
+
   // Handle metadata deltas
   for (const auto &md_delta : transaction_.md_deltas) {
     auto const op = ActionToStorageOperation(md_delta.action);
@@ -4327,7 +4611,22 @@ auto InMemoryStorage::InMemoryAccessor::HandleDurabilityAndReplicate(uint64_t du
 
   // Handle MVCC deltas
   if (!transaction_.deltas.empty()) {
+    // Vertices whose snapshot record changes: the owner of each delta, the other end of a created or deleted edge
+    // and the from vertex of an edge whose properties changed (its out edges carry them)
+    std::vector<Gid> changed_vertices;
     append_deltas([&](const Delta &delta, auto *parent, uint64_t durability_commit_timestamp_arg) {
+      if (track_snapshot_changes) {
+        if constexpr (std::is_same_v<decltype(parent), Edge *>) {
+          if (delta.action == Delta::Action::SET_PROPERTY && delta.property.out_vertex) {
+            changed_vertices.push_back(delta.property.out_vertex->gid);
+          }
+        } else {
+          changed_vertices.push_back(parent->gid);
+          if (delta.action == Delta::Action::ADD_OUT_EDGE || delta.action == Delta::Action::REMOVE_OUT_EDGE) {
+            changed_vertices.push_back(delta.vertex_edge.vertex.Get()->gid);
+          }
+        }
+      }
       if constexpr (std::is_same_v<decltype(parent), Edge *>) {
         // Connect the edge to the in-vertex and edge type for faster lookup.
         // NOTE: Invalid values will be sent in case the edge was created in this transaction.
@@ -4355,6 +4654,7 @@ auto InMemoryStorage::InMemoryAccessor::HandleDurabilityAndReplicate(uint64_t du
         commit_args.apply_cb_if_replica_write();
       }
     });
+    mem_storage->snapshot_changes_.Record(changed_vertices, durability_commit_timestamp);
   }
 
   // Add a delta that indicates that the transaction is fully written to the WAL
@@ -4365,7 +4665,7 @@ auto InMemoryStorage::InMemoryAccessor::HandleDurabilityAndReplicate(uint64_t du
   // If main executes this and committing immediately we need to finalize wal file before sending deltas to replicas
   // If replica executes this and committing immediately, it is OK to finalize wal here
   if (!two_phase_commit) {
-    mem_storage->FinalizeWalFile();
+    wal_group_commit_ticket_ = mem_storage->FinalizeWalFile();
   }
 
   // Ships deltas to instances and waits for the reply
@@ -4435,23 +4735,50 @@ std::expected<std::filesystem::path, InMemoryStorage::CreateSnapshotError> InMem
       return std::unexpected{CreateSnapshotError::NothingNewToWrite};
   }
 
+  // Only periodic snapshots extend a chain; the snapshot taken on exit and the ones asked for by the user are full,
+  // so they can be copied around on their own. Light edges live only in the adjacency, which the incremental
+  // snapshot can't rebuild them from.
+  auto const incremental_chain_length = config_.durability.snapshot_incremental_chain_length;
+  bool const track_snapshot_changes =
+      incremental_chain_length != 0 &&
+      config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL &&
+      transaction->storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL &&
+      !config_.salient.items.storage_light_edge;
+  auto const incremental_plan =
+      track_snapshot_changes && trigger == "periodic"
+          ? snapshot_changes_.PlanIncremental(
+                epoch.id(), *transaction->last_durable_ts_, incremental_chain_length, vertices_.size())
+          : std::nullopt;
+
   // At the moment, the only way in which create snapshot can fail is if it got aborted
-  const auto snapshot_path = durability::CreateSnapshot(this,
-                                                        transaction,
-                                                        recovery_.snapshot_directory_,
-                                                        recovery_.wal_directory_,
-                                                        &vertices_,
-                                                        &edges_,
-                                                        storage_uuid,
-                                                        epoch.id(),
-                                                        epochHistory,
-                                                        &file_retainer_,
-                                                        &abort_snapshot_,
-                                                        &snapshot_progress_,
-                                                        trigger);
+  const auto snapshot_path = incremental_plan ? durability::CreateIncrementalSnapshot(this,
+                                                                                      transaction,
+                                                                                      recovery_.snapshot_directory_,
+                                                                                      &vertices_,
+                                                                                      storage_uuid,
+                                                                                      epoch.id(),
+                                                                                      *incremental_plan,
+                                                                                      &file_retainer_,
+                                                                                      &abort_snapshot_)
+                                              : durability::CreateSnapshot(this,
+                                                                           transaction,
+                                                                           recovery_.snapshot_directory_,
+                                                                           recovery_.wal_directory_,
+                                                                           &vertices_,
+                                                                           &edges_,
+                                                                           storage_uuid,
+                                                                           epoch.id(),
+                                                                           epochHistory,
+                                                                           &file_retainer_,
+                                                                           &abort_snapshot_,
+                                                                           &snapshot_progress_,
+                                                                           trigger);
   if (!snapshot_path) {
     return std::unexpected{CreateSnapshotError::AbortSnapshot};
   }
+  if (track_snapshot_changes) {
+    snapshot_changes_.SnapshotWritten(epoch.id(), *transaction->last_durable_ts_, !incremental_plan);
+  }
 
   // Update digest only after the file has been created. Only in transaction because digests are used only in
   // transactional mode
@@ -4587,6 +4914,7 @@ std::expected<void, InMemoryStorage::RecoverSnapshotError> InMemoryStorage::Reco
     edge_id_.store(recovery_info.next_edge_id, std::memory_order_release);
     timestamp_ = std::max(timestamp_, recovery_info.next_timestamp);
     loaded_snapshot_uuid = recovered_snapshot.snapshot_info.uuid;
+    snapshot_changes_.Reset();
 
     auto const update_func = [new_ldt = recovered_snapshot.snapshot_info.durable_timestamp,
                               new_num_committed_txns = recovered_snapshot.snapshot_info.num_committed_txns](
@@ -4594,6 +4922,7 @@ std::expected<void, InMemoryStorage::RecoverSnapshotError> InMemoryStorage::Reco
       return CommitTsInfo{.ldt_ = new_ldt, .num_committed_txns_ = new_num_committed_txns};
     };
     atomic_struct_update<CommitTsInfo>(repl_storage_state_.commit_ts_info_, update_func);
+    label_change_log_.Clear();
 
     // We are the only active transaction, so mark everything up to the next timestamp
     if (timestamp_ > 0) commit_log_->MarkFinishedInRange(0, timestamp_ - 1);
@@ -5314,9 +5643,11 @@ void InMemoryStorage::Clear(std::function<void()> const &on_progress) {
   repl_storage_state_.epoch_.SetEpoch(std::string(utils::UUID{}));
   CommitTsInfo const new_info{.ldt_ = 0, .num_committed_txns_ = 0};
   repl_storage_state_.commit_ts_info_.store(new_info, std::memory_order_release);
+  label_change_log_.Clear();
   repl_storage_state_.history.clear();
 
   last_snapshot_digest_ = std::nullopt;
+  snapshot_changes_.Reset();
 }
 
 bool InMemoryStorage::InMemoryAccessor::PointIndexExists(LabelId label, PropertyId property) const {
@@ -5470,6 +5801,7 @@ void InMemoryStorage::InMemoryAccessor::DropGraph() {
   mem_storage->edges_.clear();
   mem_storage->edge_count_.store(0, std::memory_order_release);
   mem_storage->description_store_.Clear();
+  mem_storage->snapshot_changes_.Reset();
 
   memory::PurgeUnusedMemory();
 }
@@ -11,18 +11,25 @@
 
 #pragma once
 
+#include <algorithm>
 #include <concepts>
 #include <cstdint>
+#include <latch>
 #include <list>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string_view>
 #include <utility>
+#include <vector>
 #include "memory/db_arena_fwd.hpp"
 #include "replication_coordination_glue/role.hpp"
 #include "storage/v2/batched_list.hpp"
 #include "storage/v2/commit_log.hpp"
+#include "storage/v2/durability/incremental_snapshot.hpp"
+#include "storage/v2/durability/recovery_type.hpp"
+#include "storage/v2/durability/wal_group_commit.hpp"
 #include "storage/v2/edge_metadata_index.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/gc_status.hpp"
@@ -52,6 +59,8 @@
 #include "utils/resource_lock.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread.hpp"
+#include "utils/thread_pool.hpp"
 
 import memgraph.utils.aws;
 
@@ -213,6 +222,8 @@ class InMemoryStorage final : public Storage {
 
     VerticesIterable Vertices(LabelId label, View view) override;
 
+    VerticesIterable Vertices(std::span<LabelId const> labels, View view) override;
+
     VerticesIterable Vertices(LabelId label, std::span<storage::PropertyPath const> properties,
                               std::span<storage::PropertyValueRange const> property_ranges, View view,
                               IndexOrder order) override;
@@ -367,6 +378,8 @@ class InMemoryStorage final : public Storage {
       return transaction_.active_indices_->point_->ApproximatePointCount(label, property);
     }
 
+    std::optional<uint64_t> ApproximateVerticesIntersectionCount(std::span<LabelId const> labels) const override;
+
     std::optional<uint64_t> ApproximateVerticesVectorCount(std::string_view index_name) const override {
       return transaction_.active_indices_->vector_->ApproximateNodesVectorCount(index_name);
     }
@@ -784,6 +797,8 @@ class InMemoryStorage final : public Storage {
     // Bookkeeping
     durability::WalTxnDataPos wal_txn_positions_;
     bool needs_wal_update_{false};
+    // Set while the commit still has to wait for the WAL group commit to sync its records
+    std::optional<uint64_t> wal_group_commit_ticket_;
   };
 
   using Storage::Access;
@@ -899,19 +914,61 @@ class InMemoryStorage final : public Storage {
   template <std::ranges::input_range TRange>
     requires std::same_as<std::ranges::range_value_t<TRange>, Gid>
   void RetireVertices(TRange &&gids) {
-    auto acc = vertices_.access();
-    for (auto const gid : gids) {
-      MG_ASSERT(acc.remove(gid), "Invalid database state!");
-    }
+    RetireObjects(vertices_, std::forward<TRange>(gids));
   }
 
   template <std::ranges::input_range TRange>
     requires std::same_as<std::ranges::range_value_t<TRange>, Gid>
   void RetireEdges(TRange &&gids) {
-    auto acc = edges_.access();
-    for (auto const gid : gids) {
-      MG_ASSERT(acc.remove(gid), "Invalid database state!");
+    RetireObjects(edges_, std::forward<TRange>(gids));
+  }
+
+  // The skip list takes concurrent removals, so a large batch is split between the GC workers, each removing its
+  // share through an accessor of its own.
+  template <typename TObject, std::ranges::input_range TRange>
+  void RetireObjects(utils::SkipListDb<TObject> &store, TRange &&gids) {
+    auto const remove_all = [&store](auto &&range) {
+      auto acc = store.access();
+      for (auto const gid : range) {
+        MG_ASSERT(acc.remove(gid), "Invalid database state!");
+      }
+    };
+    if (config_.gc.thread_count <= 1) {
+      remove_all(gids);
+      return;
     }
+    auto const all = std::forward<TRange>(gids) | std::ranges::to<std::vector>();
+    auto const workers = GcWorkerCount(all.size(), kGcObjectsPerWorker);
+    RunGcWorkers(workers, [&](uint64_t worker) {
+      auto const begin = all.size() * worker / workers;
+      auto const end = all.size() * (worker + 1) / workers;
+      remove_all(std::span{all}.subspan(begin, end - begin));
+    });
+  }
+
+  // Below these a GC pass keeps its work on one thread; starting more would cost more than it saves
+  static constexpr uint64_t kGcTransactionsPerWorker = 64;
+  static constexpr uint64_t kGcObjectsPerWorker = 4096;
+
+  // How many workers `items` units of GC work are worth, given that each should get at least `min_items_per_worker`
+  [[nodiscard]] uint64_t GcWorkerCount(uint64_t items, uint64_t min_items_per_worker) const {
+    return std::clamp<uint64_t>(items / min_items_per_worker, 1, std::max<uint64_t>(config_.gc.thread_count, 1));
+  }
+
+  // Runs `work(worker)` for every worker below `workers`: worker 0 on the calling thread, the others on the GC worker
+  // pool. Returns once all of them are done.
+  template <typename TWork>
+  void RunGcWorkers(uint64_t workers, TWork const &work) {
+    std::latch done{static_cast<std::ptrdiff_t>(workers - 1)};
+    for (uint64_t worker = 1; worker < workers; ++worker) {
+      gc_workers_->AddTask([this, &work, &done, worker] {
+        const memory::DbArenaScope db_arena_scope{db_arena_};
+        work(worker);
+        done.count_down();
+      });
+    }
+    work(0);
+    done.wait();
   }
 
   // Light edges are not skip-list nodes, so retiring one hands it to the graveyard drain. The
@@ -923,8 +980,17 @@ class InMemoryStorage final : public Storage {
     light_edge_graveyard_.WithLock([&](auto &graveyard) { graveyard.emplace_back(guard_epoch, std::move(edges)); });
   }
 
+  // Below this many vertices an index created on the live graph is populated on the creating thread
+  static constexpr uint64_t kMinVerticesForParallelIndexPopulation = 100'000;
+
+  // How an index created on the live graph is populated; nullopt keeps population on the creating thread
+  [[nodiscard]] auto IndexPopulationParallelInfo() const -> std::optional<durability::ParallelizedSchemaCreationInfo>;
+
   bool InitializeWalFile(std::string_view epoch_id);
-  void FinalizeWalFile();
+  // Returns the ticket to wait for (once the engine lock is released) when the WAL group commit syncs the records.
+  std::optional<uint64_t> FinalizeWalFile();
+  // Blocks until the WAL group commit synced `ticket`; must not be called while holding the engine lock.
+  void WaitForWalSync(uint64_t ticket);
 
   // Archives every durability file superseded by `keep_snapshot` into a `.old` sub-directory of its own
   // directory, or deletes it when --storage-backup-dir-enabled=false. Leaves `keep_snapshot` as the only
@@ -1037,6 +1103,8 @@ class InMemoryStorage final : public Storage {
 
   memory::ArenaAwareUniquePtr<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Engaged with `Config::Durability::wal_group_commit`, in which case it syncs the WAL instead of the counter above.
+  std::optional<durability::WalGroupCommit> wal_group_commit_;
 
   utils::FileRetainer file_retainer_;
 
@@ -1052,6 +1120,10 @@ class InMemoryStorage final : public Storage {
   utils::Scheduler gc_runner_;
   std::mutex gc_lock_;
 
+  // Threads a collection pass hands its parallel work to, next to the GC thread itself; only there with more than one
+  // GC thread configured.
+  std::unique_ptr<utils::ThreadPool> gc_workers_;
+
   // GC run-state for SHOW TRANSACTIONS; see GcProgress.
   GcProgress gc_progress_;
 
@@ -1076,6 +1148,18 @@ class InMemoryStorage final : public Storage {
     PropertyWriteTargets wrote_properties_on_{};  //!< what this transaction set properties on
   };
 
+  // Unlinks the deltas of one committed transaction from their version chains. Safe to run for several transactions
+  // at once: objects that end up collectable go to the given lists, what the deltas say about the indexes to
+  // `arming`.
+  void UnlinkGCDeltas(GCDeltas &entry, uint64_t oldest_active_start_timestamp, IndexArming &arming,
+                      BatchedList<Gid> &deleted_vertices, BatchedList<Edge *> &deleted_edges);
+
+  // Unlinks `entries` on up to `Config::Gc::thread_count` workers, within `Config::Gc::max_unlink_time`. Sets
+  // `unlinked[i]` for every entry it got to; the rest are left for the next pass.
+  void UnlinkCommittedDeltas(std::span<GCDeltas *const> entries, std::span<uint8_t> unlinked,
+                             uint64_t oldest_active_start_timestamp, BatchedList<Gid> &deleted_vertices,
+                             BatchedList<Edge *> &deleted_edges);
+
   utils::Synchronized<std::list<GCDeltas, memory::DbAwareAllocator<GCDeltas>>, utils::SpinLock>
       committed_transactions_{};
 
@@ -1116,6 +1200,10 @@ class InMemoryStorage final : public Storage {
   // it has grown, so a cycle does not pay to grow them again. Serialized the same way.
   IndexArming cycle_index_arming_;
 
+  // The same for the GC workers other than the collecting thread itself, one each, merged into the above after the
+  // walk.
+  std::vector<IndexArming> gc_worker_index_arming_;
+
   // Flags to inform CollectGarbage that it needs to do the more expensive full scans
   std::atomic<bool> gc_full_scan_vertices_delete_ = false;
   std::atomic<bool> gc_full_scan_edges_delete_ = false;
@@ -1138,6 +1226,9 @@ class InMemoryStorage final : public Storage {
 
   std::optional<SnapshotDigest> last_snapshot_digest_;
 
+  // Only fed while `Config::Durability::snapshot_incremental_chain_length` is set
+  durability::SnapshotChangeTracker snapshot_changes_;
+
   AsyncIndexer async_indexer_;
 
   mutable utils::Synchronized<std::unordered_map<LabelId, uint64_t, std::hash<LabelId>, std::equal_to<LabelId>,
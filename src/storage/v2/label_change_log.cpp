@@ -0,0 +1,53 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/label_change_log.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace memgraph::storage {
+
+void LabelChangeLog::Record(uint64_t const previous_timestamp, uint64_t const timestamp, Labels labels) {
+  auto guard = std::lock_guard{lock_};
+  auto [it, inserted] = commits_.try_emplace(previous_timestamp, Commit{.timestamp = timestamp, .labels = {}});
+  // Two commits from the same timestamp can't both be followed, so nothing is known past it
+  it->second.labels = inserted ? std::move(labels) : std::nullopt;
+  while (commits_.size() > capacity_) {
+    commits_.erase(commits_.begin());
+  }
+}
+
+void LabelChangeLog::Clear() {
+  auto guard = std::lock_guard{lock_};
+  commits_.clear();
+}
+
+auto LabelChangeLog::ChangedBetween(uint64_t const from, uint64_t const to) const -> Labels {
+  std::vector<LabelId> changed;
+  {
+    auto guard = std::lock_guard{lock_};
+    auto current = from;
+    while (current < to) {
+      auto const it = commits_.find(current);
+      if (it == commits_.end() || !it->second.labels) return std::nullopt;
+      changed.insert(changed.end(), it->second.labels->begin(), it->second.labels->end());
+      current = it->second.timestamp;
+    }
+    if (current != to) return std::nullopt;
+  }
+  std::ranges::sort(changed);
+  auto const duplicates = std::ranges::unique(changed);
+  changed.erase(duplicates.begin(), duplicates.end());
+  return changed;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,79 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file label_change_log.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::storage {
+
+/// The labels changed by each of the recent commits, so that whatever was read from vertices with other labels at one
+/// committed snapshot is known to still hold at a later one.
+///
+/// A commit changes a label when it changes a vertex which has or had the label: its labels, its properties, its edges
+/// or whether it exists. Commits are chained by the last durable timestamp they move from and to, so a timestamp that
+/// moved without a recorded commit (recovery, a switch of the storage mode) breaks the chain and nothing is known past
+/// it. Only the newest `capacity` commits are kept.
+///
+/// Commits are only recorded once the log is enabled. This class is thread-safe.
+class LabelChangeLog final {
+ public:
+  /// Sorted, without duplicates. Nullopt stands for any label.
+  using Labels = std::optional<std::vector<LabelId>>;
+
+  static constexpr std::size_t kDefaultCapacity = 4096;
+
+  explicit LabelChangeLog(std::size_t capacity = kDefaultCapacity) : capacity_(capacity) {}
+
+  LabelChangeLog(const LabelChangeLog &) = delete;
+  LabelChangeLog &operator=(const LabelChangeLog &) = delete;
+  LabelChangeLog(LabelChangeLog &&) = delete;
+  LabelChangeLog &operator=(LabelChangeLog &&) = delete;
+
+  ~LabelChangeLog() = default;
+
+  void Enable() { enabled_.store(true, std::memory_order_release); }
+
+  bool enabled() const { return enabled_.load(std::memory_order_acquire); }
+
+  /// Records that the commit which moved the last durable timestamp from `previous_timestamp` to `timestamp` changed
+  /// `labels`.
+  void Record(uint64_t previous_timestamp, uint64_t timestamp, Labels labels);
+
+  /// Forgets all commits, called whenever the last durable timestamp is set without a commit.
+  void Clear();
+
+  /// The labels changed by the commits after `from` up to and including `to`, nullopt when not all of them are known.
+  Labels ChangedBetween(uint64_t from, uint64_t to) const;
+
+ private:
+  struct Commit {
+    uint64_t timestamp;
+    Labels labels;
+  };
+
+  std::size_t capacity_;
+  std::atomic<bool> enabled_{false};
+  mutable std::mutex lock_;
+  // Keyed by the timestamp the commit moved from
+  std::map<uint64_t, Commit> commits_;
+};
+
+}  // namespace memgraph::storage
@@ -2462,6 +2462,205 @@ auto GetDecodedBuffer(std::array<uint8_t, 12> const &buffer) -> DecodedBufferCon
   }
 }
 
+// Stores with many properties are prefixed with a sparse offset index, so that looking up a single property does not
+// have to skip over every property ordered before it. The index is encoded as follows:
+//   * metadata; type is `kOffsetIndexType` (not a valid property type); id size is the size of the indexed property
+//     IDs; payload size is the size of the entry count and of the offsets
+//   * encoded entry count
+//   * entries for every `kOffsetIndexStride`-th property, in property ID order
+//     + encoded property ID
+//     + encoded offset of the property, relative to the first property after the index
+// Only uncompressed external buffers ever hold an index, and only with at least `kOffsetIndexMinProperties`
+// properties; below that a linear scan is as fast. A compressed buffer is decompressed whole for every read, so writers
+// try compression first and index only the buffers it leaves alone. Everything that reads properties starts behind the
+// index (see `PropertiesReader`), so the encoding of the properties themselves is unchanged. Writers drop the index,
+// update the properties as before and add it back; when only a value changes, the offsets of the entries are shifted
+// instead of indexing the properties again. The index lives only in memory: `StringBuffer` leaves it out and
+// `SetBuffer` rebuilds it, so the buffers stored on disk keep the index-less layout.
+constexpr uint8_t kOffsetIndexType = 0xf0;
+static_assert(kOffsetIndexType > static_cast<uint8_t>(Type::VECTOR), "The offset index type must not be a value type");
+constexpr uint32_t kOffsetIndexMinProperties = 16;
+constexpr uint32_t kOffsetIndexStride = 4;
+
+struct OffsetIndexLayout {
+  Size id_size;
+  Size offset_size;
+  uint32_t count;
+  uint32_t entries_begin;
+
+  uint32_t EntrySize() const { return SizeToByteSize(id_size) + SizeToByteSize(offset_size); }
+
+  uint32_t IndexSize() const { return entries_begin + (count * EntrySize()); }
+};
+
+std::optional<OffsetIndexLayout> ReadOffsetIndexLayout(std::span<uint8_t const> view) {
+  if (view.empty() || (view[0] & kMaskType) != kOffsetIndexType) return std::nullopt;
+  Reader reader(view.data(), view.size_bytes());
+  auto metadata = reader.ReadMetadata();
+  auto count = reader.ReadUint(metadata->payload_size);
+  MG_ASSERT(count, "Corrupt property storage");
+  return OffsetIndexLayout{.id_size = metadata->id_size,
+                           .offset_size = metadata->payload_size,
+                           .count = static_cast<uint32_t>(*count),
+                           .entries_begin = reader.GetPosition()};
+}
+
+struct OffsetIndexEntry {
+  uint64_t property_id;
+  uint32_t offset;
+};
+
+std::vector<OffsetIndexEntry> ReadOffsetIndexEntries(std::span<uint8_t const> view) {
+  auto const layout = ReadOffsetIndexLayout(view);
+  if (!layout) return {};
+  std::vector<OffsetIndexEntry> entries;
+  entries.reserve(layout->count);
+  Reader reader(view.data() + layout->entries_begin, layout->IndexSize() - layout->entries_begin);
+  for (uint32_t i = 0; i < layout->count; ++i) {
+    auto property_id = reader.ReadUint(layout->id_size);
+    auto offset = reader.ReadUint(layout->offset_size);
+    MG_ASSERT(property_id && offset, "Corrupt property storage");
+    entries.push_back({.property_id = *property_id, .offset = static_cast<uint32_t>(*offset)});
+  }
+  return entries;
+}
+
+// Reader over the properties in `view`, behind the offset index if there is one. With `seek_to` and an index, the
+// reader starts at the last indexed property that is not ordered after `seek_to` instead of at the first one; the
+// usual linear search then covers at most `kOffsetIndexStride` properties.
+Reader PropertiesReader(std::span<uint8_t const> view, std::optional<PropertyId> seek_to = std::nullopt) {
+  auto const layout = ReadOffsetIndexLayout(view);
+  if (!layout) return {view.data(), static_cast<uint32_t>(view.size_bytes())};
+
+  auto const index_size = layout->IndexSize();
+  Reader reader(view.data() + index_size, view.size_bytes() - index_size);
+  if (!seek_to) return reader;
+
+  Reader entries(view.data() + layout->entries_begin, index_size - layout->entries_begin);
+  auto const entry_size = layout->EntrySize();
+  auto const entry_property_id = [&](uint32_t entry) {
+    entries.SetPosition(entry * entry_size);
+    return entries.ReadUint(layout->id_size).value_or(0);
+  };
+  // Find the first entry ordered after the seeked property
+  uint32_t first = 0;
+  uint32_t last = layout->count;
+  while (first < last) {
+    auto const mid = first + ((last - first) / 2);
+    if (entry_property_id(mid) <= seek_to->AsUint()) {
+      first = mid + 1;
+    } else {
+      last = mid;
+    }
+  }
+  if (first != 0) {
+    entries.SetPosition(((first - 1) * entry_size) + SizeToByteSize(layout->id_size));
+    reader.SetPosition(entries.ReadUint(layout->offset_size).value_or(0));
+  }
+  return reader;
+}
+
+// Removes the offset index (if any) from `view` in place. The properties move to the front and the freed tail is
+// zeroed, which leaves a tombstone behind the last property.
+void DropOffsetIndex(std::span<uint8_t> view) {
+  auto const layout = ReadOffsetIndexLayout(view);
+  if (!layout) return;
+  auto const index_size = layout->IndexSize();
+  memmove(view.data(), view.data() + index_size, view.size_bytes() - index_size);
+  memset(view.data() + view.size_bytes() - index_size, 0, index_size);
+}
+
+[[nodiscard]] std::optional<uint64_t> SkipAnyProperty(Reader *reader) {
+  auto metadata = reader->ReadMetadata();
+  if (!metadata) return std::nullopt;
+  auto property_id = reader->ReadUint(metadata->id_size);
+  if (!property_id) return std::nullopt;
+  if (!SkipPropertyValue(reader, metadata->type, metadata->payload_size)) return std::nullopt;
+  return property_id;
+}
+
+bool WriteUintOfSize(Writer *writer, uint64_t value, Size size) {
+  switch (size) {
+    case Size::INT8:
+      return writer->InternalWriteInt<uint8_t>(value);
+    case Size::INT16:
+      return writer->InternalWriteInt<uint16_t>(value);
+    case Size::INT32:
+      return writer->InternalWriteInt<uint32_t>(value);
+    case Size::INT64:
+      return writer->InternalWriteInt<uint64_t>(value);
+  }
+  return false;
+}
+
+// Prefixes the properties of an index-less external buffer, which end at `properties_end`, with an offset index made
+// of `entries`. The slack of the buffer is reused when the index fits into it; otherwise the properties move to a
+// larger buffer.
+void WriteOffsetIndex(std::array<uint8_t, 12> &buffer, DecodedBuffer &buffer_info,
+                      std::span<OffsetIndexEntry const> entries, uint32_t properties_end) {
+  if (buffer_info.storage_mode != BufferMode::BUFFER || entries.empty()) return;
+  auto const view = buffer_info.view;
+
+  auto const offset_size = *Writer::UIntSize(properties_end);
+  OffsetIndexLayout const layout{.id_size = *Writer::UIntSize(entries.back().property_id),  // sorted
+                                 .offset_size = offset_size,
+                                 .count = static_cast<uint32_t>(entries.size()),
+                                 .entries_begin = 1 + SizeToByteSize(offset_size)};
+  auto const index_size = layout.IndexSize();
+  auto const new_size = index_size + properties_end;
+
+  auto target = buffer_info;
+  if (new_size > view.size_bytes()) {
+    target = SetupExternalBuffer(new_size);
+    memcpy(target.view.data() + index_size, view.data(), properties_end);
+  } else {
+    memmove(view.data() + index_size, view.data(), properties_end);
+  }
+
+  Writer writer(target.view.data(), target.view.size_bytes());
+  writer.WriteMetadata()->Set(
+      {.type = static_cast<Type>(kOffsetIndexType), .id_size = layout.id_size, .payload_size = layout.offset_size});
+  WriteUintOfSize(&writer, layout.count, layout.offset_size);
+  for (auto const &entry : entries) {
+    WriteUintOfSize(&writer, entry.property_id, layout.id_size);
+    WriteUintOfSize(&writer, entry.offset, layout.offset_size);
+  }
+  DMG_ASSERT(writer.Written() == index_size, "Offset index size mismatch");
+
+  // We need to recreate the tombstone (if possible).
+  Writer tombstone_writer(target.view.data() + new_size, target.view.size_bytes() - new_size);
+  if (auto metadata = tombstone_writer.WriteMetadata()) {
+    metadata->Set({Type::EMPTY});
+  }
+
+  if (target.view.data() != view.data()) {
+    SetSizeData(buffer, target.view.size_bytes(), target.view.data());
+    FreeMemory(buffer_info);
+    buffer_info = target;
+  }
+}
+
+// Indexes the properties of an index-less external buffer, if there are enough of them.
+void AddOffsetIndex(std::array<uint8_t, 12> &buffer, DecodedBuffer &buffer_info) {
+  if (buffer_info.storage_mode != BufferMode::BUFFER) return;
+  auto const view = buffer_info.view;
+
+  std::vector<OffsetIndexEntry> entries;
+  uint32_t property_count = 0;
+  uint32_t properties_end = 0;
+  Reader reader(view.data(), view.size_bytes());
+  while (true) {
+    auto const offset = reader.GetPosition();
+    auto const property_id = SkipAnyProperty(&reader);
+    if (!property_id) break;
+    if (property_count++ % kOffsetIndexStride == 0) entries.push_back({.property_id = *property_id, .offset = offset});
+    properties_end = reader.GetPosition();
+  }
+  if (property_count < kOffsetIndexMinProperties) return;
+
+  WriteOffsetIndex(buffer, buffer_info, entries, properties_end);
+}
+
 }  // namespace
 
 PropertyStore::PropertyStore() = default;
@@ -2491,15 +2690,14 @@ PropertyStore::~PropertyStore() {
 }
 
 template <typename Func>
-auto PropertyStore::WithReader(Func &&func) const {
+auto PropertyStore::WithReader(Func &&func, std::optional<PropertyId> seek_to) const {
   auto buffer_info = GetDecodedBuffer(buffer_);
   if (buffer_info.storage_mode == BufferMode::COMPRESSED) {
     auto decompressed_buffer = DecompressBuffer(buffer_info);
-    auto view = decompressed_buffer->view();
-    Reader reader(view.data(), view.size_bytes());
+    auto reader = PropertiesReader(decompressed_buffer->view(), seek_to);
     return std::forward<Func>(func)(reader);
   }
-  Reader reader(buffer_info.view.data(), buffer_info.view.size_bytes());
+  auto reader = PropertiesReader(buffer_info.view, seek_to);
   return std::forward<Func>(func)(reader);
 }
 
@@ -2546,7 +2744,7 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     if (FindSpecificProperty(&reader, property, value) != ExpectedPropertyStatus::EQUAL) return {};
     return value;
   };
-  return WithReader(get_property);
+  return WithReader(get_property, property);
 }
 
 template <typename T>
@@ -2565,7 +2763,7 @@ ExtendedPropertyType PropertyStore::GetExtendedPropertyType(PropertyId property)
     if (FindSpecificExtendedPropertyType(&reader, property, type) != ExpectedPropertyStatus::EQUAL) return {};
     return type;
   };
-  return WithReader(get_property_type);
+  return WithReader(get_property_type, property);
 }
 
 uint32_t PropertyStore::PropertySize(PropertyId property) const {
@@ -2574,14 +2772,14 @@ uint32_t PropertyStore::PropertySize(PropertyId property) const {
     if (FindSpecificPropertySize(&reader, property, property_size) != ExpectedPropertyStatus::EQUAL) return 0;
     return property_size;
   };
-  return WithReader(get_property_size);
+  return WithReader(get_property_size, property);
 }
 
 bool PropertyStore::HasProperty(PropertyId property) const {
   auto property_exists = [&](Reader &reader) -> uint32_t {
     return ExistsSpecificProperty(&reader, property) == ExpectedPropertyStatus::EQUAL;
   };
-  return WithReader(property_exists);
+  return WithReader(property_exists, property);
 }
 
 bool PropertyStore::HasAllProperties(const std::set<PropertyId> &properties) const {
@@ -2718,7 +2916,7 @@ bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &va
     if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
     return prop_reader.GetPosition() == property_size;
   };
-  return WithReader(property_equal);
+  return WithReader(property_equal, property);
 }
 
 void PropertyStore::ArePropertiesEqual(std::span<PropertyPath const> ordered_properties,
@@ -2837,6 +3035,10 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
   auto buffer_info = GetDecodedBuffer(buffer_);
 
   bool existed = false;
+  // When only the value of a property changes, the offset index is updated in place instead of being rebuilt
+  bool value_replaced = false;
+  std::vector<OffsetIndexEntry> index_entries;
+  uint32_t properties_end = 0;
   if (buffer_info.storage_mode == BufferMode::EMPTY) {
     if (!value.IsNull()) {
       // We don't have a data buffer. Setup on for writting
@@ -2875,6 +3077,10 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
       return buffer_info.view;
     });
 
+    // Positions below are relative to the first property; the index is added back once the update is done.
+    index_entries = ReadOffsetIndexEntries(current_view);
+    DropOffsetIndex(current_view);
+
     auto reader = Reader(current_view.data(), current_view.size_bytes());
     auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
     existed = info.property_size != 0;
@@ -2948,10 +3154,27 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (metadata) {
       metadata->Set({Type::EMPTY});
     }
+
+    value_replaced = existed && !value.IsNull();
+    properties_end = new_size;
+    if (value_replaced) {
+      // The same properties are indexed; only the ones after the updated property move
+      for (auto &entry : index_entries) {
+        if (entry.offset > info.property_begin) entry.offset = entry.offset - info.property_size + property_size;
+      }
+    }
   }
 
   if (FLAGS_storage_property_store_compression_enabled) {
     CompressBuffer(buffer_, buffer_info);
+    buffer_info = GetDecodedBuffer(buffer_);
+  }
+
+  // Neither adds an index to a compressed buffer
+  if (value_replaced && !index_entries.empty()) {
+    WriteOffsetIndex(buffer_, buffer_info, index_entries, properties_end);
+  } else {
+    AddOffsetIndex(buffer_, buffer_info);
   }
 
   return !existed;
@@ -2976,7 +3199,7 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
     property_size = writer.Written();
   }
 
-  auto const buffer_info = SetupBuffer(buffer_, property_size);
+  auto buffer_info = SetupBuffer(buffer_, property_size);
   auto view = buffer_info.view;
 
   // Encode the property into the data buffer.
@@ -3003,8 +3226,11 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
 
   if (FLAGS_storage_property_store_compression_enabled) {
     CompressBuffer(buffer_, buffer_info);
+    buffer_info = GetDecodedBuffer(buffer_);
   }
 
+  AddOffsetIndex(buffer_, buffer_info);
+
   return true;
 }
 
@@ -3060,7 +3286,17 @@ bool PropertyStore::ClearProperties() {
 
 std::string PropertyStore::StringBuffer() const {
   auto buffer_info = GetDecodedBuffer(buffer_);
-  return {buffer_info.view.begin(), buffer_info.view.end()};
+  // Compression and the offset index are not part of the stored layout
+  if (buffer_info.storage_mode == BufferMode::COMPRESSED) {
+    auto const decompressed_buffer = DecompressBuffer(buffer_info);
+    auto const view = decompressed_buffer->view();
+    return {view.begin(), view.end()};
+  }
+  auto view = buffer_info.view;
+  if (buffer_info.storage_mode == BufferMode::BUFFER) {
+    if (auto const layout = ReadOffsetIndexLayout(view)) view = view.subspan(layout->IndexSize());
+  }
+  return {view.begin(), view.end()};
 }
 
 void PropertyStore::SetBuffer(const std::string_view buffer) {
@@ -3079,6 +3315,13 @@ void PropertyStore::SetBuffer(const std::string_view buffer) {
   // Make buffer perminant
   if (buffer_info.storage_mode == BufferMode::BUFFER) {
     SetSizeData(buffer_, view.size_bytes(), view.data());
+    // Stored buffers are neither compressed nor carry the offset index (see `StringBuffer`)
+    DropOffsetIndex(view);
+    if (FLAGS_storage_property_store_compression_enabled) {
+      CompressBuffer(buffer_, buffer_info);
+      buffer_info = GetDecodedBuffer(buffer_);
+    }
+    AddOffsetIndex(buffer_, buffer_info);
   }
 }
 
@@ -3138,7 +3381,7 @@ std::optional<PropertyValue> PropertyStore::GetPropertyOfTypes(PropertyId proper
     return std::nullopt;
   };
 
-  return WithReader(get_properties);
+  return WithReader(get_properties, property);
 }
 
 auto PropertyStore::PropertiesMatchTypes(TypeConstraintsValidator const &constraint) const
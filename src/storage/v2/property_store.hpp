@@ -57,7 +57,8 @@ class PropertyStore {
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(log(n)) for stores large enough to carry an offset
+  /// index and O(n) otherwise.
   /// @throw std::bad_alloc
   PropertyValue GetProperty(PropertyId property) const;
 
@@ -74,11 +75,13 @@ class PropertyStore {
 
   /// Returns the size of the encoded property in bytes.
   /// Returns 0 if the property does not exist.
-  /// The time complexity of this function is O(n).
+  /// The time complexity of this function is O(log(n)) with an offset index
+  /// and O(n) otherwise.
   uint32_t PropertySize(PropertyId property) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(log(n)) with an offset index and O(n)
+  /// otherwise.
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether all properties in the set `properties` exist in the store. The time
@@ -106,7 +109,7 @@ class PropertyStore {
   /// Checks whether the property `property` is equal to the specified value
   /// `value`. This function doesn't perform any memory allocations while
   /// performing the equality check. The time complexity of this function is
-  /// O(n).
+  /// O(log(n)) with an offset index and O(n) otherwise.
   bool IsPropertyEqual(PropertyId property, const PropertyValue &value) const;
 
   /// Checks whether the properties `ordered_properties` are equal to the
@@ -177,10 +180,12 @@ class PropertyStore {
   /// @throw std::bad_alloc
   bool ClearProperties();
 
-  /// Return property buffer as a string
+  /// Return property buffer as a string, decompressed and without the
+  /// in-memory offset index
   std::string StringBuffer() const;
 
-  /// Sets buffer
+  /// Sets buffer, as returned by `StringBuffer`. It is compressed again when
+  /// compression is enabled.
   void SetBuffer(std::string_view buffer);
 
   auto PropertiesMatchTypes(TypeConstraintsValidator const &constraint) const
@@ -190,8 +195,10 @@ class PropertyStore {
   template <typename TContainer>
   bool DoInitProperties(const TContainer &properties);
 
+  /// Runs `func` with a reader over the stored properties. With `seek_to`, the reader may start past the properties
+  /// ordered before it (see the offset index in property_store.cpp).
   template <typename Func>
-  auto WithReader(Func &&func) const;
+  auto WithReader(Func &&func, std::optional<PropertyId> seek_to = std::nullopt) const;
 
   std::array<uint8_t, sizeof(uint32_t) + sizeof(uint8_t *)> buffer_{};
 };
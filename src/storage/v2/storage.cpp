@@ -557,12 +557,15 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
     if (!PrepareForWrite(&transaction_, vertex_ptr)) return std::unexpected{Error::SERIALIZATION_ERROR};
     MG_ASSERT(!vertex_ptr->deleted(), "Invalid database state!");
 
-    auto mid = std::partition(
-        edges_attached_to_vertex->begin(), edges_attached_to_vertex->end(), [this, &set_for_erasure](auto &edge) {
-          auto const &[edge_type, opposing_vertex, edge_ref] = edge;
-          auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
-          return !set_for_erasure.contains(edge_gid);
-        });
+    auto const keep = [this, &set_for_erasure](auto &edge) {
+      auto const &[edge_type, opposing_vertex, edge_ref] = edge;
+      auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
+      return !set_for_erasure.contains(edge_gid);
+    };
+    // Grouped adjacency lists must keep their edge type runs, see edge_type_grouping.hpp
+    auto mid = storage_->config_.salient.items.edge_type_grouped_adjacency
+                   ? std::stable_partition(edges_attached_to_vertex->begin(), edges_attached_to_vertex->end(), keep)
+                   : std::partition(edges_attached_to_vertex->begin(), edges_attached_to_vertex->end(), keep);
 
     // Process edges one-by-one to ensure MVCC checks happen with locks held.
     // Deltas are created per edge, but erasing edges from the vector happens at
@@ -34,6 +34,7 @@
 #include "storage/v2/indices/text_index.hpp"
 #include "storage/v2/indices/text_index_utils.hpp"
 #include "storage/v2/isolation_level.hpp"
+#include "storage/v2/label_change_log.hpp"
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/replication_client.hpp"
 #include "storage/v2/replication/replication_storage_state.hpp"
@@ -431,6 +432,9 @@ class Storage {
   // TODO: make non-public
   ReplicationStorageState repl_storage_state_;
 
+  // Labels changed by the recent commits, recorded once enabled by the result cache
+  LabelChangeLog label_change_log_;
+
   // Main storage lock.
   // Accessors take a shared lock when starting, so it is possible to block
   // creation of new accessors by taking a unique lock. This is used when doing
@@ -589,6 +593,9 @@ class Accessor {
 
   virtual VerticesIterable Vertices(LabelId label, View view) = 0;
 
+  /// Vertices with all of `labels`, every one of which needs a label index.
+  virtual VerticesIterable Vertices(std::span<LabelId const> labels, View view) = 0;
+
   virtual VerticesIterable Vertices(LabelId label, std::span<storage::PropertyPath const> properties,
                                     std::span<storage::PropertyValueRange const> property_ranges, View view,
                                     IndexOrder order = IndexOrder::ASC) = 0;
@@ -712,6 +719,9 @@ class Accessor {
 
   virtual std::optional<uint64_t> ApproximateVerticesPointCount(LabelId label, PropertyId property) const = 0;
 
+  /// nullopt when the storage can't scan the label indices of `labels` together.
+  virtual std::optional<uint64_t> ApproximateVerticesIntersectionCount(std::span<LabelId const> labels) const = 0;
+
   virtual std::optional<uint64_t> ApproximateVerticesVectorCount(std::string_view index_name) const = 0;
 
   virtual std::optional<uint64_t> ApproximateEdgesVectorCount(std::string_view index_name) const = 0;
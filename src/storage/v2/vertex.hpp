@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <optional>
 #include <tuple>
 
 #include "storage/v2/delta.hpp"
@@ -58,6 +59,24 @@ struct Vertex {
 
   void set_has_uncommitted_non_sequential_deltas(bool b) { delta_.Set<kNonSeqDeltasBit>(b ? 1 : 0); }
 
+  struct Header {
+    Delta *delta;
+    bool deleted;
+    bool has_uncommitted_non_sequential_deltas;
+  };
+
+  /// Reads `delta()`, `deleted()` and `has_uncommitted_non_sequential_deltas()` without taking `lock`. Returns nothing
+  /// if a writer held `lock` meanwhile, in which case they have to be read under `lock` instead.
+  std::optional<Header> TryReadHeader() const {
+    auto const version = lock.try_optimistic_read();
+    if (!version) return std::nullopt;
+    auto const header = delta_.Load();
+    if (!lock.validate_optimistic_read(*version)) return std::nullopt;
+    return Header{.delta = header.GetPtr(),
+                  .deleted = header.Get<kDeletedBit>() != 0,
+                  .has_uncommitted_non_sequential_deltas = header.Get<kNonSeqDeltasBit>() != 0};
+  }
+
  private:
   static constexpr int kDeletedBit = 0;
   static constexpr int kNonSeqDeltasBit = 1;
@@ -19,6 +19,7 @@
 #include "storage/v2/edge.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edge_direction.hpp"
+#include "storage/v2/edge_type_grouping.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indexed_property_decoder.hpp"
 #include "storage/v2/mvcc.hpp"
@@ -113,7 +114,12 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
   bool deleted = false;
   Delta *delta = nullptr;
   VertexReadLock read_lock(vertex);
-  {
+  // Without uncommitted non-sequential deltas the lock would only be held for reading the header, which can be done
+  // optimistically, sparing hot vertices the contended writes to the lock word.
+  if (auto const header = vertex->TryReadHeader(); header && !header->has_uncommitted_non_sequential_deltas) {
+    deleted = header->deleted;
+    delta = header->delta;
+  } else {
     auto const guard = read_lock.AcquireLock();
     deleted = vertex->deleted();
     delta = vertex->delta();
@@ -1222,6 +1228,22 @@ int64_t VertexAccessor::HandleExpansionsWithEdgeTypes(edge_store &result_edges,
   if (edges.empty()) return 0;
 
   uint64_t expanded_count = 0;
+  // A hops limit is charged for every edge a vertex has, whatever its type, so the same query stops at the same point
+  // with or without the grouped layout; such expansions take the full scan below.
+  if (!edge_types.empty() && storage_->config_.salient.items.edge_type_grouped_adjacency &&
+      !transaction_->IsDiskStorage() && !(hops_limit && hops_limit->IsUsed())) {
+    // Grouped layout: visit only the runs of the requested edge types
+    for (auto it = edge_types.begin(); it != edge_types.end(); ++it) {
+      if (std::find(edge_types.begin(), it, *it) != it) continue;
+      for (const auto &[edge_type, vertex, edge] : EdgesOfType(edges, *it)) {
+        expanded_count++;
+        if (destination && vertex != destination->vertex_) continue;
+        result_edges.emplace_back(edge_type, vertex, edge);
+      }
+    }
+    return static_cast<int64_t>(expanded_count);
+  }
+
   for (const auto &[edge_type, vertex, edge] : edges) {
     if (hops_limit && hops_limit->IsUsed()) {
       auto available_hops = hops_limit->IncrementHopsCount();
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <optional>
 #include <variant>
 
 #include "storage/v2/all_vertices_iterable.hpp"
@@ -29,8 +30,9 @@ class VerticesIterable final {
   using Desc2Iterable = InMemoryLabelPropertyIndex::Iterable<InMemoryLabelPropertyIndex::DescEntry<2>>;
   using VertexPropertyIterable = InMemoryVertexPropertyIndex::Iterable;
 
-  using Data = std::variant<AllVerticesIterable, InMemoryLabelIndex::Iterable, AscIterable, DescIterable, Asc1Iterable,
-                            Desc1Iterable, Asc2Iterable, Desc2Iterable, VertexPropertyIterable>;
+  using Data = std::variant<AllVerticesIterable, InMemoryLabelIndex::Iterable, InMemoryLabelIndex::IntersectionIterable,
+                            AscIterable, DescIterable, Asc1Iterable, Desc1Iterable, Asc2Iterable, Desc2Iterable,
+                            VertexPropertyIterable>;
 
   Data data_;
 
@@ -39,6 +41,8 @@ class VerticesIterable final {
 
   explicit VerticesIterable(InMemoryLabelIndex::Iterable v) : data_(std::move(v)) {}
 
+  explicit VerticesIterable(InMemoryLabelIndex::IntersectionIterable v) : data_(std::move(v)) {}
+
   explicit VerticesIterable(AscIterable v) : data_(std::move(v)) {}
 
   explicit VerticesIterable(DescIterable v) : data_(std::move(v)) {}
@@ -63,9 +67,10 @@ class VerticesIterable final {
 
   class Iterator final {
     using Data =
-        std::variant<AllVerticesIterable::Iterator, InMemoryLabelIndex::Iterable::Iterator, AscIterable::Iterator,
-                     DescIterable::Iterator, Asc1Iterable::Iterator, Desc1Iterable::Iterator, Asc2Iterable::Iterator,
-                     Desc2Iterable::Iterator, VertexPropertyIterable::Iterator>;
+        std::variant<AllVerticesIterable::Iterator, InMemoryLabelIndex::Iterable::Iterator,
+                     InMemoryLabelIndex::IntersectionIterable::Iterator, AscIterable::Iterator, DescIterable::Iterator,
+                     Asc1Iterable::Iterator, Desc1Iterable::Iterator, Asc2Iterable::Iterator, Desc2Iterable::Iterator,
+                     VertexPropertyIterable::Iterator>;
 
     Data data_;
 
@@ -77,6 +82,8 @@ class VerticesIterable final {
 
     explicit Iterator(InMemoryLabelIndex::Iterable::Iterator it) : data_(std::move(it)) {}
 
+    explicit Iterator(InMemoryLabelIndex::IntersectionIterable::Iterator it) : data_(std::move(it)) {}
+
     explicit Iterator(AscIterable::Iterator it) : data_(std::move(it)) {}
 
     explicit Iterator(DescIterable::Iterator it) : data_(std::move(it)) {}
@@ -103,6 +110,19 @@ class VerticesIterable final {
       return std::visit([](auto const &it) -> value_type const & { return *it; }, data_);
     }
 
+    /// The indexed values of the current vertex when it comes from a label-property index, in index order.
+    std::optional<IndexOrderedValuesView> IndexValues() const {
+      return std::visit(
+          [](auto const &it) -> std::optional<IndexOrderedValuesView> {
+            if constexpr (requires { it.values(); }) {
+              return it.values();
+            } else {
+              return std::nullopt;
+            }
+          },
+          data_);
+    }
+
     Iterator &operator++() {
       std::visit([](auto &it) { ++it; }, data_);
       return *this;
@@ -111,6 +131,16 @@ class VerticesIterable final {
     bool operator==(const Iterator &other) const = default;
   };
 
+  /// Makes `Iterator::IndexValues` hold the visible values of the current vertex rather than the index entry's,
+  /// which only equal them. Call before `begin`.
+  void DecodeIndexValues() {
+    std::visit(
+        [](auto &v) {
+          if constexpr (requires { v.DecodeValues(); }) v.DecodeValues();
+        },
+        data_);
+  }
+
   Iterator begin() {
     return std::visit([](auto &v) -> Iterator { return Iterator(v.begin()); }, data_);
   }
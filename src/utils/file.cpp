@@ -734,6 +734,8 @@ void OutputFile::TryFlushing() {
   }
 }
 
+void OutputFile::Flush() { FlushBuffer(); }
+
 NonConcurrentOutputFile::~NonConcurrentOutputFile() {
   if (IsOpen()) Close();
 }
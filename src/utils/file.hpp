@@ -306,6 +306,11 @@ class OutputFile {
   /// Try flushing the internal buffer.
   void TryFlushing();
 
+  /// Writes the internal buffer to the file without syncing it, waiting for
+  /// flushing to be enabled if needed. On failure and misuse it crashes the
+  /// program.
+  void Flush();
+
   /// Get the internal buffer with its current size.
   std::pair<const uint8_t *, size_t> CurrentBuffer() const;
 
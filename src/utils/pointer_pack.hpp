@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 
 namespace memgraph::utils {
@@ -19,6 +20,10 @@ namespace memgraph::utils {
 /// into the low bits of the pointer value. The pointed-to type must be aligned
 /// so that the low @p NumFlagBits are naturally zero (e.g. 8-byte alignment
 /// gives 3 free bits).
+///
+/// The packed word is only ever accessed with relaxed atomic loads and stores, so that a reader may take a consistent
+/// copy of pointer and flags with `Load` while a writer updates them (see `utils::RWSpinLock::try_optimistic_read`).
+/// They compile to plain moves.
 template <typename T, int NumFlagBits>
   requires(alignof(T) >= (1U << NumFlagBits))
 class PointerPack {
@@ -34,15 +39,27 @@ class PointerPack {
   explicit PointerPack(T *ptr, uintptr_t flags = 0)
       : storage_(reinterpret_cast<uintptr_t>(ptr) | (flags & kFlagsMask)) {}
 
-  T *GetPtr() const { return reinterpret_cast<T *>(storage_ & kPtrMask); }
+  PointerPack(PointerPack const &other) noexcept : storage_(other.load()) {}
 
-  void SetPtr(T *ptr) { storage_ = reinterpret_cast<uintptr_t>(ptr) | (storage_ & kFlagsMask); }
+  PointerPack &operator=(PointerPack const &other) noexcept {
+    store(other.load());
+    return *this;
+  }
+
+  ~PointerPack() = default;
+
+  /// Pointer and flags read at once.
+  PointerPack Load() const { return PointerPack{load()}; }
+
+  T *GetPtr() const { return reinterpret_cast<T *>(load() & kPtrMask); }
+
+  void SetPtr(T *ptr) { store(reinterpret_cast<uintptr_t>(ptr) | (load() & kFlagsMask)); }
 
   /// Extracts the bit field at position @p Pos with @p Size bits.
   template <int Pos, int Size = 1>
   uintptr_t Get() const {
     static_assert(Pos >= 0 && Size > 0 && Pos + Size <= NumFlagBits);
-    return (storage_ >> Pos) & ((1UL << Size) - 1);
+    return (load() >> Pos) & ((1UL << Size) - 1);
   }
 
   /// Sets the bit field at position @p Pos with @p Size bits to @p value.
@@ -50,7 +67,7 @@ class PointerPack {
   void Set(uintptr_t value) {
     static_assert(Pos >= 0 && Size > 0 && Pos + Size <= NumFlagBits);
     const uintptr_t field_mask = ((1UL << Size) - 1) << Pos;
-    storage_ = (storage_ & ~field_mask) | ((value << Pos) & field_mask);
+    store((load() & ~field_mask) | ((value << Pos) & field_mask));
   }
 
   operator T *() const { return GetPtr(); }  // NOLINT(google-explicit-constructor)
@@ -59,6 +76,13 @@ class PointerPack {
     SetPtr(ptr);
     return *this;
   }
+
+ private:
+  explicit PointerPack(uintptr_t storage) : storage_(storage) {}
+
+  uintptr_t load() const { return std::atomic_ref{storage_}.load(std::memory_order_relaxed); }
+
+  void store(uintptr_t value) { std::atomic_ref{storage_}.store(value, std::memory_order_relaxed); }
 };
 
 }  // namespace memgraph::utils
@@ -396,6 +396,16 @@ void TaskCollection::WaitOrSteal() {
   Wait();
 }
 
+bool TaskCollection::Claim(size_t index) {
+  auto &task = tasks_[index];
+  auto expected = Task::State::IDLE;
+  if (!task.state_->compare_exchange_strong(expected, Task::State::FINISHED, std::memory_order_acq_rel)) {
+    return false;  // A worker already picked it up
+  }
+  task.state_->notify_one();  // Notify waiting threads
+  return true;
+}
+
 }  // namespace memgraph::utils
 
 template void memgraph::utils::PriorityThreadPool::Worker::operator()<memgraph::utils::Priority::LOW>(
@@ -112,6 +112,10 @@ class TaskCollection {
 
   void WaitOrSteal();
 
+  // Takes a task no worker has picked up yet away from the pool, so the caller can do its work instead. The task is
+  // marked as finished without running. Returns false if a worker already picked it up.
+  bool Claim(size_t index);
+
   size_t Size() const { return tasks_.size(); }
 
  private:
@@ -220,6 +224,8 @@ class CollectionScheduler {
     pool_ = nullptr;
   }
 
+  bool Claim(size_t index) { return collection_ && collection_->Claim(index); }
+
   void WaitOrSteal() {
     if (collection_) collection_->WaitOrSteal();
     collection_.reset();
@@ -50,6 +50,7 @@ void QueryMemoryTracker::TrackFree(size_t size) {
 
 // NOTE: Currently the transaction tracker does not limit the memory usage of the query.
 void QueryMemoryTracker::SetQueryLimit(size_t size) {
+  query_limit_ = size;
   if (size == memgraph::memory::UNLIMITED_MEMORY) {
     transaction_tracker_.ResetLimit();
     return;
@@ -63,6 +64,11 @@ void QueryMemoryTracker::SetQueryLimit(size_t size) {
 
 int64_t QueryMemoryTracker::Amount() const { return transaction_tracker_.Amount(); }
 
+int64_t QueryMemoryTracker::RemainingQueryMemory() const {
+  if (query_limit_ == memgraph::memory::UNLIMITED_MEMORY) return 0;
+  return transaction_tracker_.HardLimit() - transaction_tracker_.Amount();
+}
+
 void QueryMemoryTracker::StopProcTracking() { GetProcTracker() = nullptr; }
 
 void QueryMemoryTracker::CreateOrSetProcTracker(int64_t procedure_id, size_t limit) {
@@ -34,6 +34,7 @@ class QueryMemoryTracker {
 
   QueryMemoryTracker(QueryMemoryTracker &&other) noexcept
       : transaction_tracker_(std::move(other.transaction_tracker_)),
+        query_limit_(std::exchange(other.query_limit_, 0)),
         proc_memory_trackers_(std::move(other.proc_memory_trackers_)) {}
 
   QueryMemoryTracker(const QueryMemoryTracker &other) = delete;
@@ -55,6 +56,12 @@ class QueryMemoryTracker {
   // Currently tracked memory
   int64_t Amount() const;
 
+  // Limit set for the current query, 0 when unlimited
+  size_t QueryLimit() const { return query_limit_; }
+
+  // Memory the current query can still allocate, only meaningful with a query limit
+  int64_t RemainingQueryMemory() const;
+
   // Create a new or get existing procedure tracker
   void CreateOrSetProcTracker(int64_t, size_t);
 
@@ -64,6 +71,7 @@ class QueryMemoryTracker {
  private:
   // MemoryTracker is thread-safe via atomics. Default-constructed state means "no limit".
   memgraph::utils::MemoryTracker transaction_tracker_;
+  size_t query_limit_{0};
 
   // Procedure setup is not thread safe, but MemoryTracker is thread-safe via atomics.
   std::unordered_map<int64_t, memgraph::utils::MemoryTracker> proc_memory_trackers_;
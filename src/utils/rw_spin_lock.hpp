@@ -12,6 +12,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <optional>
 
 #include "utils/yielder.hpp"
 
@@ -20,10 +21,12 @@ namespace memgraph::utils {
  * A reader/writer spin lock.
  * Stores in a uint32_t,
  * 0x0000'0001 - is the write bit
- * rest of the bits hold the count for the number of current readers.
+ * 0x0000'FFFE - hold the count for the number of current readers.
+ * 0xFFFF'0000 - hold the version, bumped by every unlock()
  * The lock is friendly to writers.
  * - writer lock() will wait for all readers to leave unlock_shared()
  * - new reader lock_shared() will wait until writer has unlock()
+ * Readers of a few words can also skip the lock altogether, seqlock style, see try_optimistic_read().
  **/
 struct RWSpinLock {
   RWSpinLock() = default;
@@ -40,8 +43,10 @@ struct RWSpinLock {
       // optimistic: assume we will be granted the lock
       auto const phase1 = std::atomic_ref{lock_status_}.fetch_or(UNIQUE_LOCKED, std::memory_order_acq_rel);
       // check: we were granted UNIQUE_LOCK and no current readers
-      if (phase1 == 0) [[likely]]
+      if ((phase1 & LOCKED_MASK) == 0) [[likely]] {
+        order_after_lock();
         return;
+      }
       // check: we were granted UNIQUE_LOCK, but need to wait for readers
       if ((phase1 & UNIQUE_LOCKED) != UNIQUE_LOCKED) [[likely]]
         break;
@@ -62,17 +67,26 @@ struct RWSpinLock {
     while (true) {
       auto const phase3 = std::atomic_ref{lock_status_}.load(std::memory_order_acquire);
       // check: all readers have gone (leaving only the UNIQUE_LOCKED bit set)
-      if (phase3 == UNIQUE_LOCKED) return;
+      if ((phase3 & LOCKED_MASK) == UNIQUE_LOCKED) {
+        order_after_lock();
+        return;
+      }
       maybe_yield();
     }
   }
 
   bool try_lock() {
-    status_t unlocked = 0;
-    return std::atomic_ref{lock_status_}.compare_exchange_strong(unlocked, UNIQUE_LOCKED, std::memory_order_acq_rel);
+    status_t unlocked = std::atomic_ref{lock_status_}.load(std::memory_order_relaxed) & VERSION_MASK;
+    if (!std::atomic_ref{lock_status_}.compare_exchange_strong(
+            unlocked, unlocked | UNIQUE_LOCKED, std::memory_order_acq_rel)) {
+      return false;
+    }
+    order_after_lock();
+    return true;
   }
 
-  void unlock() { std::atomic_ref{lock_status_}.fetch_and(~UNIQUE_LOCKED, std::memory_order_release); }
+  // Clears the UNIQUE_LOCKED bit (which we hold) and bumps the version in one go; the version wraps around
+  void unlock() { std::atomic_ref{lock_status_}.fetch_add(VERSION - UNIQUE_LOCKED, std::memory_order_release); }
 
   void lock_shared() {
     while (true) {
@@ -107,7 +121,27 @@ struct RWSpinLock {
 
   void unlock_shared() { std::atomic_ref{lock_status_}.fetch_sub(READER, std::memory_order_release); }
 
-  bool is_locked() const { return std::atomic_ref{lock_status_}.load(std::memory_order_acquire) != 0; }
+  bool is_locked() const {
+    return (std::atomic_ref{lock_status_}.load(std::memory_order_acquire) & LOCKED_MASK) != 0;
+  }
+
+  /// Starts an optimistic read: the protected data may be read without holding the lock and is consistent if
+  /// validate_optimistic_read() passes afterwards. Returns nothing while a writer holds the lock. Only data read with
+  /// (relaxed) atomic loads may be read this way, and only data that cannot be freed under the reader; anything behind
+  /// pointers the writer may reallocate has to stay under lock_shared().
+  std::optional<uint32_t> try_optimistic_read() const {
+    auto const status = std::atomic_ref{lock_status_}.load(std::memory_order_acquire);
+    if ((status & UNIQUE_LOCKED) != 0) return std::nullopt;
+    return status & VERSION_MASK;
+  }
+
+  /// Whether no writer took the lock since try_optimistic_read() returned `version`. A wrap-around of the version
+  /// would take 65536 writers within a single read of a few words.
+  bool validate_optimistic_read(uint32_t version) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto const status = std::atomic_ref{lock_status_}.load(std::memory_order_relaxed);
+    return (status & (VERSION_MASK | UNIQUE_LOCKED)) == version;
+  }
 
  private:
   using status_t = uint32_t;
@@ -115,8 +149,16 @@ struct RWSpinLock {
   enum FLAGS : status_t {
     UNIQUE_LOCKED = 1,
     READER = 2,
+    VERSION = 1U << 16U,
   };
 
+  static constexpr status_t VERSION_MASK = ~(VERSION - 1);
+  static constexpr status_t LOCKED_MASK = VERSION - 1;
+
+  // The writer's stores to the protected data must not become visible before its UNIQUE_LOCKED bit, or an optimistic
+  // reader could see them and still validate. The acquire half of taking the lock doesn't order them on its own.
+  static void order_after_lock() { std::atomic_thread_fence(std::memory_order_release); }
+
   // TODO: ATM not atomic, just used via atomic_ref, because the type needs to be movable into skip_list
   //       fix the design flaw and then make RWSpinLock a non-copy/non-move type
   status_t lock_status_ = 0;
@@ -28,6 +28,7 @@
 #include <new>
 #include <optional>
 #include <random>
+#include <sched.h>
 #include <utility>
 #include <vector>
 
@@ -246,6 +247,178 @@ constexpr uint64_t ExpectedSizeAtLayer(const uint64_t N, const uint8_t k) {
   return N >> power;
 }
 
+/// Recycles the nodes of a skip list, so that an insert, which allocates its node while holding the locks of the
+/// node's predecessors, does not go to the allocator for every node. Opt-in per list, see `SkipList::EnableNodePool`.
+///
+/// Only nodes up to `kPooledHeights` high are pooled, which is all but one in 2^kPooledHeights of them; the rest are
+/// allocated as before. Pooled nodes are carved out of slabs, so a bulk insert asks the allocator for memory once per
+/// slab rather than once per node, and a freed node is kept for a later insert instead of being handed back.
+///
+/// Free nodes and the slab being carved are kept per CPU. A thread takes from the shard of the CPU it runs on, so
+/// concurrent inserts rarely meet on a lock, and memory tends to be reused on the CPU (and so the NUMA node) that
+/// touched it last. Nodes are freed by whoever collects the list rather than by the inserting threads, so a shard
+/// holding more free nodes than it needs hands a batch over to the depot of its NUMA node, which is where shards
+/// that run dry look first.
+///
+/// Slabs go back to the allocator only when the pool is released or destroyed, with none of its nodes in use.
+template <typename TObj, typename Alloc>
+class SkipListNodePool final {
+  using TNode = SkipListNode<TObj>;
+
+ public:
+  static constexpr uint8_t kPooledHeights = 4;
+
+  explicit SkipListNodePool(Alloc alloc) noexcept : alloc_(alloc) {}
+
+  SkipListNodePool(const SkipListNodePool &) = delete;
+  SkipListNodePool &operator=(const SkipListNodePool &) = delete;
+  SkipListNodePool(SkipListNodePool &&) = delete;
+  SkipListNodePool &operator=(SkipListNodePool &&) = delete;
+
+  ~SkipListNodePool() { Release(); }
+
+  static bool Pools(uint8_t height) { return height <= kPooledHeights; }
+
+  /// Memory for a node of the given height, which has to be pooled.
+  void *Allocate(uint8_t height) {
+    auto const cls = height - 1;
+    auto [shard, depot] = Local();
+    auto guard = std::lock_guard{shard.lock};
+    auto &free = shard.free[cls];
+    if (free.head == nullptr) {
+      auto depot_guard = std::lock_guard{depot.lock};
+      MoveBatch(depot.free[cls], free);
+    }
+    if (auto *node = free.Pop()) return node;
+    return Carve(shard, kClassBytes[cls]);
+  }
+
+  /// Takes back the memory of a node of the given height, which has to be pooled.
+  void Deallocate(void *node, uint8_t height) noexcept {
+    auto const cls = height - 1;
+    auto [shard, depot] = Local();
+    auto guard = std::lock_guard{shard.lock};
+    auto &free = shard.free[cls];
+    free.Push(node);
+    if (free.count >= 2 * kBatch) {
+      auto depot_guard = std::lock_guard{depot.lock};
+      MoveBatch(free, depot.free[cls]);
+    }
+  }
+
+  /// Hands all slabs back to the allocator. Only valid once every node taken from the pool has been given back.
+  void Release() noexcept {
+    for (auto &shard : shards_) {
+      shard.free = {};
+      shard.slab_next = nullptr;
+      shard.slab_end = nullptr;
+    }
+    for (auto &depot : depots_) {
+      depot.free = {};
+    }
+    auto guard = std::lock_guard{slabs_lock_};
+    for (auto *slab : slabs_) {
+      detail::deallocate_bytes(alloc_, slab, kSlabBytes, kAlign);
+    }
+    slabs_.clear();
+  }
+
+ private:
+  static constexpr size_t kAlign = SkipListNodeAlign<TObj>();
+  // Same reasoning as `BatchedList::kBatchBytes`: the smallest allocation jemalloc serves from its large size classes
+  static constexpr size_t kSlabBytes = 16UL * 1024UL;
+  // Nodes moved between a shard and its depot at once
+  static constexpr size_t kBatch = 64;
+  static constexpr size_t kShards = 64;
+  static constexpr size_t kNumaNodes = 8;
+
+  static constexpr auto kClassBytes = [] {
+    std::array<size_t, kPooledHeights> bytes{};
+    for (size_t height = 1; height <= kPooledHeights; ++height) {
+      auto const node_bytes = sizeof(TNode) + height * sizeof(std::atomic<TNode *>);
+      bytes[height - 1] = (node_bytes + kAlign - 1) / kAlign * kAlign;
+    }
+    return bytes;
+  }();
+  static_assert(kClassBytes.back() <= kSlabBytes, "A slab has to fit at least one node of every pooled height!");
+
+  // Free nodes are linked through their own memory
+  struct FreeList {
+    struct Link {
+      Link *next;
+    };
+
+    void Push(void *node) noexcept {
+      head = new (node) Link{head};
+      ++count;
+    }
+
+    void *Pop() noexcept {
+      if (head == nullptr) return nullptr;
+      auto *link = head;
+      head = link->next;
+      --count;
+      return link;
+    }
+
+    Link *head{nullptr};
+    size_t count{0};
+  };
+
+  struct alignas(64) Shard {
+    std::mutex lock;
+    std::array<FreeList, kPooledHeights> free{};
+    std::byte *slab_next{nullptr};
+    std::byte *slab_end{nullptr};
+  };
+
+  struct alignas(64) Depot {
+    std::mutex lock;
+    std::array<FreeList, kPooledHeights> free{};
+  };
+
+  static void MoveBatch(FreeList &from, FreeList &to) noexcept {
+    for (size_t i = 0; i < kBatch && from.head != nullptr; ++i) {
+      to.Push(from.Pop());
+    }
+  }
+
+  std::pair<Shard &, Depot &> Local() {
+    unsigned cpu = 0;
+    unsigned numa_node = 0;
+    if (getcpu(&cpu, &numa_node) != 0) {
+      cpu = 0;
+      numa_node = 0;
+    }
+    return {shards_[cpu % kShards], depots_[numa_node % kNumaNodes]};
+  }
+
+  void *Carve(Shard &shard, size_t bytes) {
+    if (static_cast<size_t>(shard.slab_end - shard.slab_next) < bytes) {
+      auto *slab = static_cast<std::byte *>(detail::allocate_bytes(alloc_, kSlabBytes, kAlign));
+      try {
+        auto guard = std::lock_guard{slabs_lock_};
+        slabs_.push_back(slab);
+      } catch (...) {
+        detail::deallocate_bytes(alloc_, slab, kSlabBytes, kAlign);
+        throw;
+      }
+      // What is left of the previous slab is too small for this node; it stays unused until the slab is released
+      shard.slab_next = slab;
+      shard.slab_end = slab + kSlabBytes;
+    }
+    auto *node = shard.slab_next;
+    shard.slab_next += bytes;
+    return node;
+  }
+
+  [[no_unique_address]] Alloc alloc_;
+  std::array<Shard, kShards> shards_;
+  std::array<Depot, kNumaNodes> depots_;
+  SpinLock slabs_lock_;
+  std::vector<std::byte *> slabs_;
+};
+
 /// The skip list doesn't have built-in reclamation of removed nodes (objects).
 /// This class handles all operations necessary to remove the nodes safely.
 ///
@@ -267,6 +440,7 @@ class SkipListGc final {
   using TNode = SkipListNode<TObj>;
   using TDeleted = std::pair<uint64_t, TNode *>;
   using TLocalStack = Stack<TDeleted, kSkipListGcStackSize>;
+  using NodePool = SkipListNodePool<TObj, Alloc>;
 
   static constexpr uint64_t kIdsInField = sizeof(uint64_t) * 8;
   static constexpr uint64_t kIdsInBlock = kSkipListGcBlockSize * kIdsInField;
@@ -320,6 +494,34 @@ class SkipListGc final {
 
   Alloc get_allocator() const noexcept { return alloc_; }
 
+  void EnableNodePool() { node_pool_ = std::make_shared<NodePool>(alloc_); }
+
+  /// Lets this take nodes from the same pool as `other`, so that either can free the nodes of the other.
+  void ShareNodePool(SkipListGc const &other) noexcept { node_pool_ = other.node_pool_; }
+
+  /// Hands the pooled memory back unless another list shares the pool. Only valid once all nodes have been freed.
+  void ReleaseNodePool() noexcept {
+    if (node_pool_ && node_pool_.use_count() == 1) node_pool_->Release();
+  }
+
+  void *AllocateNode(uint8_t height) {
+    if (node_pool_ && NodePool::Pools(height)) return node_pool_->Allocate(height);
+    return detail::allocate_bytes(
+        alloc_, sizeof(TNode) + height * sizeof(std::atomic<TNode *>), SkipListNodeAlign<TObj>());
+  }
+
+  /// Destroys the node and frees its memory.
+  void FreeNode(TNode *node) noexcept {
+    auto const height = node->height;
+    auto const bytes = SkipListNodeSize(*node);
+    node->~TNode();
+    if (node_pool_ && NodePool::Pools(height)) {
+      node_pool_->Deallocate(node, height);
+    } else {
+      detail::deallocate_bytes(alloc_, node, bytes, SkipListNodeAlign<TObj>());
+    }
+  }
+
   SkipListGc(const SkipListGc &) = delete;
   SkipListGc &operator=(const SkipListGc &) = delete;
   SkipListGc(SkipListGc &&other) = delete;
@@ -435,11 +637,7 @@ class SkipListGc final {
       tail = next;
     }
     deleted_.EraseIf([live_horizon](const TDeleted &item) { return item.first < live_horizon; },
-                     [this](const TDeleted &item) {
-                       size_t bytes = SkipListNodeSize(*item.second);
-                       item.second->~TNode();
-                       detail::deallocate_bytes(alloc_, item.second, bytes, SkipListNodeAlign<TObj>());
-                     });
+                     [this](const TDeleted &item) { FreeNode(item.second); });
   }
 
   void Clear() {
@@ -459,9 +657,7 @@ class SkipListGc final {
       std::optional<TDeleted> item;
       std::unique_lock guard(lock_);
       while ((item = deleted_.Pop())) {
-        size_t bytes = SkipListNodeSize(*item->second);
-        item->second->~TNode();
-        detail::deallocate_bytes(alloc_, item->second, bytes, SkipListNodeAlign<TObj>());
+        FreeNode(item->second);
       }
     }
 
@@ -480,6 +676,8 @@ class SkipListGc final {
   std::atomic<Block *> tail_{nullptr};
   uint64_t last_id_{0};
   TLocalStack deleted_;
+  // Shared only by lists moved from one another
+  std::shared_ptr<NodePool> node_pool_;
 #ifndef NDEBUG
   std::atomic<uint64_t> alive_accessors_{0};
 #endif
@@ -882,6 +1080,88 @@ class SkipList final : detail::SkipListNode_base {
     SamplingIterator end_;
   };
 
+  /// A run of objects in strictly ascending order that is built bottom-up: every appended node is chained behind the
+  /// last node of each of its layers, so building the run needs neither searching nor locking. `Accessor::splice` then
+  /// links the whole run into the list at once. Meant for bulk loads of data that is already sorted, such as snapshot
+  /// recovery; runs covering disjoint key ranges can be built and spliced concurrently. Nodes that never made it into
+  /// the list are freed together with the run.
+  class SortedRun final {
+   private:
+    friend class SkipList;
+
+    explicit SortedRun(SkipList *skiplist) : skiplist_(skiplist) {}
+
+   public:
+    SortedRun(const SortedRun &) = delete;
+    SortedRun &operator=(const SortedRun &) = delete;
+
+    SortedRun(SortedRun &&other) noexcept
+        : skiplist_(other.skiplist_),
+          firsts_(other.firsts_),
+          lasts_(other.lasts_),
+          height_(other.height_),
+          size_(other.size_) {
+      other.Reset();
+    }
+
+    SortedRun &operator=(SortedRun &&other) = delete;
+
+    ~SortedRun() {
+      TNode *curr = firsts_[0];
+      while (curr != nullptr) {
+        TNode *succ = curr->nexts[0].load(std::memory_order_relaxed);
+        skiplist_->gc_.FreeNode(curr);
+        curr = succ;
+      }
+    }
+
+    /// Appends an object, which has to be larger than every object appended so far. The returned reference stays
+    /// valid after the run is spliced into the list.
+    template <typename TObjUniv>
+    TObj &push_back(TObjUniv &&object) {
+      DMG_ASSERT(size_ == 0 || lasts_[0]->obj < object, "Objects have to be appended to a SortedRun in order!");
+      auto const height = gen_height();
+      auto alloc = skiplist_->gc_.get_allocator();
+      auto *node = reinterpret_cast<TNode *>(skiplist_->gc_.AllocateNode(height));
+      using TNodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<TNode>;
+      TNodeAlloc node_allocator(alloc);
+      std::allocator_traits<TNodeAlloc>::construct(node_allocator, node, height, std::forward<TObjUniv>(object));
+
+      // Nothing else sees the run before it is spliced, which publishes it with release stores
+      for (int layer = 0; layer < height; ++layer) {
+        node->nexts[layer].store(nullptr, std::memory_order_relaxed);
+        if (lasts_[layer] == nullptr) {
+          firsts_[layer] = node;
+        } else {
+          lasts_[layer]->nexts[layer].store(node, std::memory_order_relaxed);
+        }
+        lasts_[layer] = node;
+      }
+      node->fully_linked.store(true, std::memory_order_relaxed);
+      height_ = std::max<int>(height_, height);
+      ++size_;
+      return node->obj;
+    }
+
+    uint64_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+   private:
+    void Reset() noexcept {
+      firsts_ = {};
+      lasts_ = {};
+      height_ = 0;
+      size_ = 0;
+    }
+
+    SkipList *skiplist_;
+    std::array<TNode *, kSkipListMaxHeight> firsts_{};
+    std::array<TNode *, kSkipListMaxHeight> lasts_{};
+    int height_{0};
+    uint64_t size_{0};
+  };
+
   class Accessor final {
    private:
     friend class SkipList;
@@ -975,6 +1255,15 @@ class SkipList final : detail::SkipListNode_base {
     ///         bool indicates whether the item was inserted into the list
     std::pair<Iterator, bool> insert(TObj &&object) { return skiplist_->insert(std::move(object)); }
 
+    /// Starts a run of objects in ascending order that can later be spliced into the list, see `SortedRun`.
+    SortedRun sorted_run() { return SortedRun{skiplist_}; }
+
+    /// Links all objects of the run into the list. The run has to belong to this list. Nothing is spliced if the
+    /// list already holds an object within the key range of the run, which is left untouched then.
+    ///
+    /// @return bool indicating whether the run was spliced into the list
+    bool splice(SortedRun &run) { return skiplist_->splice(run); }
+
     /// Checks whether the key exists in the list.
     ///
     /// @return bool indicating whether the item exists
@@ -1214,19 +1503,20 @@ class SkipList final : detail::SkipListNode_base {
   }
 
   SkipList(SkipList &&other) noexcept : head_(other.head_), gc_(other.gc_.get_allocator()), size_(other.size_.load()) {
+    gc_.ShareNodePool(other.gc_);
     other.head_ = nullptr;
   }
 
   SkipList &operator=(SkipList &&other) noexcept {
-    auto alloc = gc_.get_allocator();
     TNode *head = head_;
     while (head != nullptr) {
       TNode *succ = head->nexts[0].load(std::memory_order_acquire);
-      size_t bytes = SkipListNodeSize(*head);
-      head->~TNode();
-      detail::deallocate_bytes(alloc, head, bytes, SkipListNodeAlign<TObj>());
+      gc_.FreeNode(head);
       head = succ;
     }
+    // Nodes collected so far are freed through the pool they came from, before switching to the pool of `other`
+    gc_.Clear();
+    gc_.ShareNodePool(other.gc_);
     head_ = other.head_;
     size_ = other.size_.load();
     other.head_ = nullptr;
@@ -1273,14 +1563,11 @@ class SkipList final : detail::SkipListNode_base {
     auto const alive = gc_.AliveAccessors();
     DMG_ASSERT(alive == 0, "SkipList::clear() called with {} live accessor(s)", alive);
 #endif
-    auto alloc = gc_.get_allocator();
     TNode *curr = head_->nexts[0].load(std::memory_order_acquire);
     uint64_t destroyed = 0;
     while (curr != nullptr) {
       TNode *succ = curr->nexts[0].load(std::memory_order_acquire);
-      size_t bytes = SkipListNodeSize(*curr);
-      curr->~TNode();
-      detail::deallocate_bytes(alloc, curr, bytes, SkipListNodeAlign<TObj>());
+      gc_.FreeNode(curr);
       curr = succ;
       // Mask first so the common path is an increment and a predicted-not-taken branch.
       if (((++destroyed & kClearProgressMask) == 0) && on_progress) on_progress();
@@ -1290,10 +1577,17 @@ class SkipList final : detail::SkipListNode_base {
     }
     size_ = 0;
     gc_.Clear();
+    gc_.ReleaseNodePool();
   }
 
   void run_gc() { gc_.Run(); }
 
+  /// Makes the list take its nodes from a `SkipListNodePool`. Has to be called before anything is inserted.
+  void EnableNodePool() {
+    DMG_ASSERT(size() == 0, "The node pool has to be enabled on an empty SkipList!");
+    gc_.EnableNodePool();
+  }
+
  private:
   template <GCPolicy policy = GCPolicy::Random, typename TKey>
   int find_node(const TKey &key, std::array<TNode *, kSkipListMaxHeight> &preds,
@@ -1388,9 +1682,8 @@ class SkipList final : detail::SkipListNode_base {
 
         if (!valid) continue;
 
-        size_t node_bytes = sizeof(TNode) + top_layer * sizeof(std::atomic<TNode *>);
         auto alloc = gc_.get_allocator();
-        void *raw = detail::allocate_bytes(alloc, node_bytes, SkipListNodeAlign<TObj>());
+        void *raw = gc_.AllocateNode(top_layer);
         new_node = reinterpret_cast<TNode *>(raw);
 
         // Construct through allocator traits so it propagates if needed.
@@ -1415,6 +1708,65 @@ class SkipList final : detail::SkipListNode_base {
     }
   }
 
+  // Same protocol as `insert`, with the whole run taking the place of a single node as tall as its tallest node
+  bool splice(SortedRun &run) {
+    DMG_ASSERT(run.skiplist_ == this, "Splicing a SortedRun into a SkipList it doesn't belong to!");
+    if (run.empty()) return true;
+    TObj const &first = run.firsts_[0]->obj;
+    TObj const &last = run.lasts_[0]->obj;
+    std::array<TNode *, kSkipListMaxHeight> preds{};
+    std::array<TNode *, kSkipListMaxHeight> succs{};
+    while (true) {
+      find_node(first, preds, succs);
+      // Every node is on the bottom layer, so a free bottom gap means the run fits between preds and succs on all
+      // layers
+      if (TNode *succ = succs[0]; succ != nullptr && !(last < succ->obj)) {
+        if (!succ->marked.load(std::memory_order_acquire)) return false;
+        continue;
+      }
+
+      {
+        TNode *previous_locked = nullptr;
+        bool valid = true;
+
+        auto locked_count = 0;
+        TNode *locked[kSkipListMaxHeight];
+        auto guard = OnScopeExit{[&] {
+          for (auto i = 0; i != locked_count; ++i) {
+            locked[i]->lock.unlock();
+          }
+        }};
+
+        for (int layer = 0; valid && (layer < run.height_); ++layer) {
+          TNode *pred = preds[layer];
+          TNode *succ = succs[layer];
+          if (pred != previous_locked) {
+            pred->lock.lock();
+            locked[locked_count] = pred;
+            ++locked_count;
+            previous_locked = pred;
+          }
+          valid = !pred->marked.load(std::memory_order_acquire) &&
+                  pred->nexts[layer].load(std::memory_order_acquire) == succ &&
+                  (succ == nullptr || !succ->marked.load(std::memory_order_acquire));
+        }
+
+        if (!valid) continue;
+
+        for (int layer = 0; layer < run.height_; ++layer) {
+          run.lasts_[layer]->nexts[layer].store(succs[layer], std::memory_order_release);
+        }
+        for (int layer = 0; layer < run.height_; ++layer) {
+          preds[layer]->nexts[layer].store(run.firsts_[layer], std::memory_order_release);
+        }
+      }
+
+      size_.fetch_add(run.size_, std::memory_order_acq_rel);
+      run.Reset();
+      return true;
+    }
+  }
+
   template <typename TKey>
   SkipListNode<TObj> *find_(const TKey &key) const {
     std::array<TNode *, kSkipListMaxHeight> preds{};
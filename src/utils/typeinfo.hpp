@@ -65,6 +65,7 @@ enum class TypeId : uint64_t {
   EXPAND,
   EXPANSION_LAMBDA,
   EXPAND_VARIABLE,
+  EXPAND_INTERSECT,
   CONSTRUCT_NAMED_PATH,
   FILTER,
   PRODUCE,
@@ -107,6 +108,8 @@ enum class TypeId : uint64_t {
   AGGREGATE_PARALLEL,
   PARALLEL_MERGE,
   ORDERBY_PARALLEL,
+  PRODUCE_PARALLEL,
+  SCAN_ALL_BY_LABEL_INTERSECTION,
 
   // Replication
   // NOTE: these NEED to be stable in the 2000+ range (see rpc version)
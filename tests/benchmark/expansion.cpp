@@ -11,6 +11,7 @@
 
 #include <benchmark/benchmark.h>
 #include <memory>
+#include <vector>
 
 #include "communication/result_stream_faker.hpp"
 #include "query/auth_checker.hpp"
@@ -288,6 +289,124 @@ BENCHMARK_REGISTER_F(KShortestMultiRowBenchFixture, KShortestMultiRowFiltered)
     ->Arg(4)
     ->Unit(benchmark::kMillisecond);
 
+// A `side` x `side` grid with varied edge weights, searched from one corner to the opposite one.
+class WShortestBenchFixture : public benchmark::Fixture {
+ protected:
+  std::optional<memgraph::system::System> system;
+  std::optional<memgraph::query::AllowEverythingAuthChecker> auth_checker;
+  std::optional<memgraph::query::InterpreterContext> interpreter_context;
+  std::optional<memgraph::query::Interpreter> interpreter;
+  std::optional<memgraph::utils::Gatekeeper<memgraph::dbms::Database>> db_gk;
+  std::optional<memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock>>
+      repl_state;
+
+  void SetUp(const benchmark::State &state) override {
+    repl_state.emplace(std::nullopt);
+    memgraph::storage::Config config{};
+    config.durability.storage_directory = data_directory;
+    config.disk.main_storage_directory = data_directory / "disk";
+    db_gk.emplace(std::move(config));
+    auto db_acc_opt = db_gk->access();
+    MG_ASSERT(db_acc_opt, "Failed to access db");
+    auto &db_acc = *db_acc_opt;
+
+    system.emplace();
+    auth_checker.emplace();
+    interpreter_context.emplace(memgraph::query::InterpreterConfig{},
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                &repl_state.value(),
+                                *system,
+                                nullptr
+#ifdef MG_ENTERPRISE
+                                ,
+                                nullptr,
+                                nullptr
+#endif
+    );
+
+    auto source_label = db_acc->storage()->NameToLabel("Source");
+    auto target_label = db_acc->storage()->NameToLabel("Target");
+
+    {
+      auto dba = db_acc->Access(memgraph::storage::WRITE);
+      auto edge_type = dba->NameToEdgeType("edge_type");
+      auto weight_property = dba->NameToProperty("w");
+      auto const side = state.range(0);
+      std::vector<memgraph::storage::VertexAccessor> grid;
+      grid.reserve(side * side);
+      for (int64_t i = 0; i < side * side; ++i) grid.push_back(dba->CreateVertex());
+
+      auto connect = [&](int64_t from, int64_t to) {
+        auto edge = dba->CreateEdge(&grid[from], &grid[to], edge_type);
+        MG_ASSERT(edge.has_value());
+        MG_ASSERT(edge->SetProperty(weight_property, memgraph::storage::PropertyValue(1 + (from * 7 + to * 13) % 10))
+                      .has_value());
+      };
+      for (int64_t row = 0; row < side; ++row) {
+        for (int64_t column = 0; column < side; ++column) {
+          auto const at = row * side + column;
+          if (column + 1 < side) connect(at, at + 1);
+          if (row + 1 < side) connect(at, at + side);
+        }
+      }
+      MG_ASSERT(grid.front().AddLabel(source_label).has_value());
+      MG_ASSERT(grid.back().AddLabel(target_label).has_value());
+      MG_ASSERT(dba->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+    }
+
+    for (auto label : {source_label, target_label}) {
+      auto unique_acc = db_acc->UniqueAccess();
+      MG_ASSERT(unique_acc->CreateIndex(label).has_value());
+      MG_ASSERT(unique_acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+    }
+
+    interpreter.emplace(&*interpreter_context, std::move(db_acc));
+    interpreter->SetUser(auth_checker->GenQueryUser(std::nullopt, {}));
+  }
+
+  void TearDown(const benchmark::State &) override {
+    interpreter = std::nullopt;
+    interpreter_context = std::nullopt;
+    db_gk.reset();
+    auth_checker.reset();
+    system.reset();
+    std::filesystem::remove_all(data_directory);
+  }
+
+  void RunQuery(benchmark::State &state, const char *query) {
+    while (state.KeepRunning()) {
+      ResultStreamFaker results(interpreter->current_db_.db_acc_->get()->storage());
+      interpreter->Prepare(query, memgraph::query::no_params_fn, {});
+      interpreter->PullAll(&results);
+    }
+  }
+};
+
+// Bound destination and no filter lambda, so the search runs from both ends.
+BENCHMARK_DEFINE_F(WShortestBenchFixture, WShortest)(benchmark::State &state) {
+  RunQuery(state,
+           "MATCH (s:Source), (t:Target) WITH s, t MATCH (s)-[*WSHORTEST (r, n | r.w) total]-(t) RETURN total");
+}
+
+BENCHMARK_REGISTER_F(WShortestBenchFixture, WShortest)
+    ->RangeMultiplier(2)
+    ->Range(32, 256)
+    ->Unit(benchmark::kMillisecond);
+
+// The always-true lambda keeps the search on the source's side: the single-sided baseline for `WShortest`.
+BENCHMARK_DEFINE_F(WShortestBenchFixture, WShortestFromSource)(benchmark::State &state) {
+  RunQuery(state,
+           "MATCH (s:Source), (t:Target) WITH s, t MATCH (s)-[*WSHORTEST (r, n | r.w) total (r, n | true)]-(t) "
+           "RETURN total");
+}
+
+BENCHMARK_REGISTER_F(WShortestBenchFixture, WShortestFromSource)
+    ->RangeMultiplier(2)
+    ->Range(32, 256)
+    ->Unit(benchmark::kMillisecond);
+
 int main(int argc, char **argv) {
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
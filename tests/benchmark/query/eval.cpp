@@ -13,6 +13,7 @@
 
 #include "query/context.hpp"
 #include "query/db_accessor.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/interpreter.hpp"
 #include "storage/v2/inmemory/storage.hpp"
@@ -95,4 +96,108 @@ BENCHMARK_TEMPLATE(AdditionOperator, NewDeleteResource)->Range(1024, 1U << 15U)-
 
 BENCHMARK_TEMPLATE(AdditionOperator, MonotonicBufferResource)->Range(1024, 1U << 15U)->Unit(benchmark::kMicrosecond);
 
+// `n.age > $age AND n.name = 'name'` evaluated for a node per row, with the ExpressionEvaluator or in its compiled form
+template <bool compiled>
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyFilter(benchmark::State &state) {
+  memgraph::query::AstStorage ast;
+  memgraph::query::SymbolTable symbol_table;
+  MonotonicBufferResource memory;
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  auto storage_dba = db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto vertex = dba.InsertVertex();
+  MG_ASSERT(vertex.SetProperty(dba.NameToProperty("age"), memgraph::storage::PropertyValue(42)));
+  MG_ASSERT(vertex.SetProperty(dba.NameToProperty("name"), memgraph::storage::PropertyValue("name")));
+  dba.AdvanceCommand();
+
+  auto symbol = symbol_table.CreateSymbol("n", true);
+  auto property = [&](const std::string &name) {
+    auto *identifier = ast.Create<memgraph::query::Identifier>("n")->MapTo(symbol);
+    return ast.Create<memgraph::query::PropertyLookup>(identifier, ast.GetPropertyIx(name));
+  };
+  memgraph::query::Expression *expr = ast.Create<memgraph::query::AndOperator>(
+      ast.Create<memgraph::query::GreaterOperator>(property("age"), ast.Create<memgraph::query::ParameterLookup>(0)),
+      ast.Create<memgraph::query::EqualOperator>(property("name"),
+                                                 ast.Create<memgraph::query::PrimitiveLiteral>("name")));
+
+  memgraph::query::Frame frame(symbol_table.max_position(), memory.get());
+  frame.GetFrameWriter(nullptr, memory.get()).Write(symbol, memgraph::query::TypedValue(vertex));
+  memgraph::query::ExecutionContext ctx;
+  ctx.db_accessor = &dba;
+  ctx.symbol_table = symbol_table;
+  ctx.evaluation_context = memgraph::query::EvaluationContext{memory.get()};
+  ctx.evaluation_context.properties = memgraph::query::NamesToProperties(ast.properties_, &dba);
+  ctx.evaluation_context.parameters.Add(0, memgraph::storage::ExternalPropertyValue(18));
+  memgraph::query::ExpressionEvaluator evaluator(&frame, ctx, memgraph::storage::View::OLD);
+
+  auto compiled_filter = memgraph::query::CompiledFilter::Compile(expr);
+  memgraph::utils::pmr::vector<memgraph::query::TypedValue> operands(memory.get());
+  compiled_filter->BindOperands(ctx.evaluation_context, &operands);
+  while (state.KeepRunning()) {
+    if constexpr (compiled) {
+      benchmark::DoNotOptimize(compiled_filter->Evaluate(frame, evaluator, operands));
+    } else {
+      benchmark::DoNotOptimize(expr->Accept(evaluator));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(PropertyFilter, false);
+
+BENCHMARK_TEMPLATE(PropertyFilter, true);
+
+// `RETURN n, n.age, n.name` projected for a node per row, with the ExpressionEvaluator or in its compiled form
+template <bool compiled>
+// NOLINTNEXTLINE(google-runtime-references)
+static void Projection(benchmark::State &state) {
+  memgraph::query::AstStorage ast;
+  memgraph::query::SymbolTable symbol_table;
+  MonotonicBufferResource memory;
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  auto storage_dba = db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto vertex = dba.InsertVertex();
+  MG_ASSERT(vertex.SetProperty(dba.NameToProperty("age"), memgraph::storage::PropertyValue(42)));
+  MG_ASSERT(vertex.SetProperty(dba.NameToProperty("name"), memgraph::storage::PropertyValue("name")));
+  dba.AdvanceCommand();
+
+  auto symbol = symbol_table.CreateSymbol("n", true);
+  auto identifier = [&] { return ast.Create<memgraph::query::Identifier>("n")->MapTo(symbol); };
+  auto named = [&](const std::string &name, memgraph::query::Expression *expression) {
+    return ast.Create<memgraph::query::NamedExpression>(name, expression)
+        ->MapTo(symbol_table.CreateSymbol(name + "_output", true));
+  };
+  std::vector<memgraph::query::NamedExpression *> named_expressions{
+      named("n", identifier()),
+      named("age", ast.Create<memgraph::query::PropertyLookup>(identifier(), ast.GetPropertyIx("age"))),
+      named("name", ast.Create<memgraph::query::PropertyLookup>(identifier(), ast.GetPropertyIx("name")))};
+
+  memgraph::query::Frame frame(symbol_table.max_position(), memory.get());
+  frame.GetFrameWriter(nullptr, memory.get()).Write(symbol, memgraph::query::TypedValue(vertex));
+  memgraph::query::ExecutionContext ctx;
+  ctx.db_accessor = &dba;
+  ctx.symbol_table = symbol_table;
+  ctx.evaluation_context = memgraph::query::EvaluationContext{memory.get()};
+  ctx.evaluation_context.properties = memgraph::query::NamesToProperties(ast.properties_, &dba);
+  memgraph::query::ExpressionEvaluator evaluator(&frame, ctx, memgraph::storage::View::OLD);
+
+  auto compiled_projection = memgraph::query::CompiledProjection::Compile(named_expressions, symbol_table);
+  while (state.KeepRunning()) {
+    if constexpr (compiled) {
+      benchmark::DoNotOptimize(compiled_projection->Project(frame, evaluator, nullptr));
+    } else {
+      for (auto *named_expression : named_expressions) {
+        benchmark::DoNotOptimize(named_expression->Accept(evaluator));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(Projection, false);
+
+BENCHMARK_TEMPLATE(Projection, true);
+
 BENCHMARK_MAIN();
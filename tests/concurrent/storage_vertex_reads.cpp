@@ -0,0 +1,146 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Readers hammering a few hot vertices and their edges while a writer keeps modifying them. The visibility checks read
+// the vertex and edge headers optimistically, so this is mainly a workload to run under a sanitizer; the throughput
+// printed per reader count shows how reads scale on the machine at hand.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/view.hpp"
+#include "tests/test_commit_args_helper.hpp"
+#include "utils/thread.hpp"
+
+using memgraph::storage::Config;
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::View;
+
+namespace {
+
+constexpr uint64_t kHotVertices = 4;
+constexpr auto kRoundDuration = std::chrono::milliseconds(500);
+
+}  // namespace
+
+TEST(Storage, HotVertexReadsUnderWriter) {
+  Config config{};
+  config.salient.items.properties_on_edges = true;
+  auto store = std::make_unique<InMemoryStorage>(config);
+
+  auto const base = store->NameToLabel("Base");
+  auto const toggled = store->NameToLabel("Toggled");
+  auto const edge_type = store->NameToEdgeType("E");
+
+  // Every hot vertex has the base label and one out edge to the next one, committed before any reader starts
+  std::vector<Gid> gids;
+  {
+    auto acc = store->Access(memgraph::storage::WRITE);
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    for (uint64_t i = 0; i < kHotVertices; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(vertex.AddLabel(base).has_value());
+      gids.push_back(vertex.Gid());
+      vertices.push_back(vertex);
+    }
+    for (uint64_t i = 0; i < kHotVertices; ++i) {
+      ASSERT_TRUE(acc->CreateEdge(&vertices[i], &vertices[(i + 1) % kHotVertices], edge_type).has_value());
+    }
+    ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+
+  for (uint64_t const num_readers : {1, 2, 4, 8}) {
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> reads{0};
+
+    // Commits label changes and aborts detach deletes, so the readers see headers with both committed and
+    // uncommitted deltas and the deleted bit flipping back and forth
+    std::jthread writer([&] {
+      memgraph::utils::ThreadSetName("writer");
+      uint64_t round = 0;
+      while (!done.load(std::memory_order_acquire)) {
+        auto const gid = gids[round % kHotVertices];
+        {
+          auto acc = store->Access(memgraph::storage::WRITE);
+          auto vertex = acc->FindVertex(gid, View::OLD);
+          ASSERT_TRUE(vertex);
+          auto const add = (round / kHotVertices) % 2 == 0;
+          auto const changed = add ? vertex->AddLabel(toggled) : vertex->RemoveLabel(toggled);
+          ASSERT_TRUE(changed.has_value());
+          ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+        }
+        {
+          auto acc = store->Access(memgraph::storage::WRITE);
+          auto vertex = acc->FindVertex(gid, View::OLD);
+          ASSERT_TRUE(vertex);
+          ASSERT_TRUE(acc->DetachDeleteVertex(&*vertex).has_value());
+          acc->Abort();
+        }
+        ++round;
+      }
+    });
+
+    std::vector<std::jthread> readers;
+    readers.reserve(num_readers);
+    for (uint64_t i = 0; i < num_readers; ++i) {
+      readers.emplace_back([&, num = i] {
+        memgraph::utils::ThreadSetName(fmt::format("reader{}", num));
+        uint64_t local_reads = 0;
+        while (!done.load(std::memory_order_acquire)) {
+          auto acc = store->Access(memgraph::storage::READ);
+          for (auto const gid : gids) {
+            auto vertex = acc->FindVertex(gid, View::OLD);
+            ASSERT_TRUE(vertex);
+            auto const has_base = vertex->HasLabel(base, View::OLD);
+            ASSERT_TRUE(has_base.has_value());
+            ASSERT_TRUE(*has_base);
+            auto const out_edges = vertex->OutEdges(View::OLD);
+            ASSERT_TRUE(out_edges.has_value());
+            ASSERT_EQ(out_edges->edges.size(), 1);
+            ASSERT_TRUE(out_edges->edges[0].IsVisible(View::OLD));
+            ++local_reads;
+          }
+          acc->Abort();
+        }
+        reads.fetch_add(local_reads, std::memory_order_relaxed);
+      });
+    }
+
+    std::this_thread::sleep_for(kRoundDuration);
+    done.store(true, std::memory_order_release);
+    readers.clear();
+    writer.join();
+
+    auto const seconds = std::chrono::duration<double>(kRoundDuration).count();
+    fmt::print("{} readers: {:.0f} vertex reads/s ({:.0f} per reader)\n", num_readers, reads.load() / seconds,
+               reads.load() / seconds / num_readers);
+    ASSERT_GT(reads.load(), 0);
+  }
+
+  // Nothing the writer did sticks apart from the label changes
+  auto acc = store->Access(memgraph::storage::READ);
+  for (auto const gid : gids) {
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    auto const out_edges = vertex->OutEdges(View::OLD);
+    ASSERT_TRUE(out_edges.has_value());
+    ASSERT_EQ(out_edges->edges.size(), 1);
+  }
+}
@@ -189,6 +189,21 @@ startup_config_dict = {
         "false",
         "Controls whether edges are stored as lightweight objects in order to reduce memory footprint; implies --storage-properties-on-edges.",
     ),
+    "storage_edge_type_grouped_adjacency": (
+        "false",
+        "false",
+        "Controls whether vertex adjacency lists are kept grouped by edge type, so expansions filtered by edge type only visit the matching edges. Makes edge creation and deletion on high-degree vertices more expensive.",
+    ),
+    "storage_label_property_index_hash_lookup": (
+        "false",
+        "false",
+        "Keep a hash directory next to every label-property index created from now on, so that lookups by equal values on all of the indexed properties don't search the ordered index.",
+    ),
+    "storage_skiplist_node_pool_enabled": (
+        "false",
+        "false",
+        "Controls whether vertices and edges are allocated from per-CPU pools of slabs, which speeds up bulk creation on many cores. Pooled memory is reused for new objects but only released when the database is cleared or dropped.",
+    ),
     "storage_property_store_compression_enabled": (
         "false",
         "false",
@@ -240,6 +255,12 @@ startup_config_dict = {
         "If set to true, properties backed by a vector index are omitted when a whole node or relationship is returned. They remain accessible via explicit property access.",
     ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_thread_count": ("1", "1", "The number of threads used by the storage garbage collector."),
+    "storage_gc_max_unlink_ms": (
+        "0",
+        "0",
+        "Upper bound (in milliseconds) on the time a garbage collection run spends unlinking deltas; the rest is left for the next run. 0 means no bound.",
+    ),
     "storage_python_gc_cycle_sec": ("180", "180", "Storage python full garbage collection interval (in seconds)."),
     "storage_items_per_batch": (
         "1000000",
@@ -269,6 +290,11 @@ startup_config_dict = {
         "Set to true to free the memory sooner on an instance that syncs a replica once.",
     ),
     "storage_recovery_thread_count": ("12", "12", "The number of threads used to recover persisted data from disk."),
+    "storage_index_population_thread_count": (
+        "1",
+        "1",
+        "The number of threads used to populate an index created on a running database, by CREATE INDEX or automatic index creation. 1 populates on the creating thread.",
+    ),
     "storage_snapshot_interval_sec": (
         "300",
         "300",
@@ -286,6 +312,11 @@ startup_config_dict = {
         "If true, a database that fails to recover on startup comes up in a broken state instead of crashing the process. Broken databases reject queries until recovered via RECOVER SNAPSHOT.",
     ),
     "storage_snapshot_retention_count": ("3", "3", "The number of snapshots that should always be kept."),
+    "storage_snapshot_incremental_chain_length": (
+        "0",
+        "0",
+        "The number of incremental snapshots written after a full one before the next full snapshot. An incremental snapshot only contains the vertices and edges changed since the previous snapshot. Requires storage_wal_enabled. Set to 0 to always write full snapshots.",
+    ),
     "storage_wal_enabled": (
         "false",
         "true",
@@ -296,6 +327,11 @@ startup_config_dict = {
         "100000",
         "Issue a 'fsync' call after this amount of transactions are written to the WAL file. Set to 1 for fully synchronous operation.",
     ),
+    "storage_wal_group_commit": (
+        "false",
+        "false",
+        "Acknowledge a commit only once its WAL records are synced to disk, sharing one 'fdatasync' between all concurrently committing transactions. When enabled, storage_wal_file_flush_every_n_tx is ignored.",
+    ),
     "storage_mode": (
         "IN_MEMORY_TRANSACTIONAL",
         "IN_MEMORY_TRANSACTIONAL",
@@ -329,6 +365,11 @@ startup_config_dict = {
         "1000",
         "Maximum number of parsed query ASTs to cache (0 disables the cache).",
     ),
+    "query_result_cache_max_memory_mb": (
+        "0",
+        "0",
+        "Maximum memory in MiB taken by cached results of read-only queries, per database (0 disables the cache).",
+    ),
     "query_vertex_count_to_expand_existing": (
         "10",
         "10",
@@ -357,6 +398,11 @@ startup_config_dict = {
         "",
         "The path to mappings that describes aliases to callables in cypher queries in the form of key-value pairs in a json file. With this option query module procedures that do not exist in memgraph can be mapped to ones that exist.",
     ),
+    "query_spill_to_disk": (
+        "true",
+        "true",
+        "When a query with a memory limit gets close to it, ORDER BY, aggregations, DISTINCT and hash joins move the rows they collected to temporary files under data_directory instead of failing the query.",
+    ),
     "delta_chain_cache_threshold": (
         "128",
         "128",
@@ -463,6 +463,44 @@ class TestParallelIndexFallback:
             pytest.skip("Vector index creation failed")
 
 
+class TestParallelHashJoin:
+    """
+    Test suite for hash joins whose hashtable is shared by the parallel branches.
+    Every branch probes the same hashtable with its own chunk of the right side,
+    so the table must stay alive until the last branch is done with it.
+    """
+
+    @pytest.fixture
+    def join_db(self, memgraph):
+        """Database with enough left rows for the hashtable to be built on the worker pool."""
+        setup_large_db(memgraph, element_count=20000)
+        return memgraph
+
+    def test_hash_join(self, join_db):
+        """Test that every right row finds its match in the shared hashtable."""
+        verify_parallel_matches_serial(join_db, "MATCH (a:A), (b:B) WHERE a.p = b.p RETURN a.p, b.p")
+
+    def test_hash_join_aggregated(self, join_db):
+        """Test an aggregation over the probe results of all branches."""
+        result = join_db.fetch_all(pq("MATCH (a:A), (b:B) WHERE a.p = b.p RETURN count(*) AS c, sum(b.p) AS s"))
+        assert result == [{"c": 20000, "s": 20000 * 20001 // 2}]
+
+    def test_hash_join_no_matches(self, join_db):
+        """Test probing a hashtable that has no matching join values."""
+        verify_parallel_matches_serial(join_db, "MATCH (a:A), (b:B) WHERE a.p = b.p + 100000 RETURN a.p, b.p")
+
+    def test_hash_join_limit(self, join_db):
+        """Test that branches stopped by LIMIT leave the hashtable to the ones still probing."""
+        base_query = "MATCH (a:A), (b:B) WHERE a.p = b.p RETURN b.p ORDER BY b.p"
+        verify_parallel_matches_serial(join_db, f"{base_query} LIMIT 100", order_matters=True)
+
+    def test_hash_join_repeated(self, join_db):
+        """Test that the hashtable is built again for every execution."""
+        query = "MATCH (a:A), (b:B) WHERE a.p = b.p AND a.p <= 1000 RETURN count(*) AS c"
+        for _ in range(5):
+            assert join_db.fetch_all(pq(query)) == [{"c": 1000}]
+
+
 class TestParallelIsolation:
     """
     Tests for isolation correctness with parallel execution.
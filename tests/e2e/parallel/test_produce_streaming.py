@@ -0,0 +1,122 @@
+# Copyright 2026 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+"""
+Tests for streaming the results of a parallel Produce.
+
+The branches of a parallel Produce stream their rows to the thread pulling the
+results while they run, so these tests cover:
+    - Results pulled in several PULL n requests
+    - A Limit above the Produce stopping the branches early
+    - A branch failing while the others are still streaming
+
+All queries use USING PARALLEL EXECUTION hint via the pq() wrapper.
+"""
+
+import sys
+
+import pytest
+from common import get_query_summary, pq, setup_large_db
+from neo4j.exceptions import *
+
+ELEMENT_COUNT = 5000
+
+
+@pytest.fixture
+def streaming_db(memgraph):
+    """Database with enough rows for every branch to fill its share of the stream."""
+    setup_large_db(memgraph, element_count=ELEMENT_COUNT)
+    return memgraph
+
+
+class TestStreamingPulls:
+    """Test results pulled in several PULL n requests."""
+
+    @pytest.mark.parametrize("fetch_size", [1, 10, 1000])
+    def test_all_rows_across_pulls(self, streaming_db, fetch_size):
+        """Every row should be streamed exactly once, whatever the size of the pulls."""
+        with streaming_db.get_driver() as driver:
+            with driver.session(fetch_size=fetch_size) as session:
+                result = session.run(pq("MATCH (n:A) RETURN n.p AS p"))
+                values = [record["p"] for record in result]
+
+        assert sorted(values) == list(range(1, ELEMENT_COUNT + 1))
+
+    def test_discard_after_partial_pull(self, streaming_db):
+        """Discarding the rest of the results should stop the branches, leaving the session usable."""
+        with streaming_db.get_driver() as driver:
+            with driver.session(fetch_size=10) as session:
+                result = session.run(pq("MATCH (n:A) RETURN n.p AS p"))
+                first = [record["p"] for _, record in zip(range(10), result)]
+                result.consume()
+
+                count = session.run(pq("MATCH (n:A) RETURN count(n) AS c")).single()["c"]
+
+        assert len(first) == 10
+        assert count == ELEMENT_COUNT
+
+
+class TestStreamingLimit:
+    """Test a Limit stopping the branches before they streamed all of their rows."""
+
+    @pytest.mark.parametrize("limit", [0, 1, 10, 1000])
+    def test_limit(self, streaming_db, limit):
+        """Limit should return exactly the requested number of distinct rows."""
+        result = streaming_db.fetch_all(pq(f"MATCH (n:A) RETURN n.p AS p LIMIT {limit}"))
+        values = [record["p"] for record in result]
+
+        assert len(values) == limit
+        assert len(set(values)) == limit
+        assert all(1 <= value <= ELEMENT_COUNT for value in values)
+
+    def test_limit_counts_hops_of_all_branches(self, streaming_db):
+        """Hops of the branches stopped by the Limit should still be in the summary."""
+        with streaming_db.get_driver() as driver:
+            summary = get_query_summary(driver, pq("MATCH (a:A)-[:E]->(b:B) RETURN b.p AS p LIMIT 1000"))
+
+        assert summary["number_of_hops"] >= 1000
+
+    def test_limit_repeated(self, streaming_db):
+        """The branches stopped by a Limit shouldn't leak into the next query."""
+        for _ in range(10):
+            result = streaming_db.fetch_all(pq("MATCH (n:A) RETURN n.p AS p LIMIT 10"))
+            assert len(result) == 10
+
+
+class TestStreamingExceptions:
+    """Test a branch failing while the others are streaming their rows."""
+
+    @pytest.mark.parametrize("failing_value", [1, ELEMENT_COUNT // 2, ELEMENT_COUNT])
+    def test_failing_branch(self, streaming_db, failing_value):
+        """The error of any branch should fail the query."""
+        with pytest.raises((DatabaseError, ClientError, TransientError)):
+            streaming_db.fetch_all(pq(f"MATCH (n:A) RETURN n.p / (n.p - {failing_value}) AS result"))
+
+    def test_failing_branch_across_pulls(self, streaming_db):
+        """The error should be reported even if it happens after some rows were already pulled."""
+        with streaming_db.get_driver() as driver:
+            with driver.session(fetch_size=10) as session:
+                with pytest.raises((DatabaseError, ClientError, TransientError)):
+                    result = session.run(pq(f"MATCH (n:A) RETURN n.p / (n.p - {ELEMENT_COUNT}) AS result"))
+                    for _ in result:
+                        pass
+
+    def test_usable_after_failure(self, streaming_db):
+        """A failed query shouldn't leave branches behind."""
+        with pytest.raises((DatabaseError, ClientError, TransientError)):
+            streaming_db.fetch_all(pq(f"MATCH (n:A) RETURN n.p / (n.p - {ELEMENT_COUNT}) AS result"))
+
+        result = streaming_db.fetch_all(pq("MATCH (n:A) RETURN count(n) AS c"))
+        assert result == [{"c": ELEMENT_COUNT}]
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main([__file__, "-rA", "-v"]))
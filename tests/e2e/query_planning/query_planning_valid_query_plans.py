@@ -24,9 +24,8 @@ def test_valid_plan_generation(memgraph):
         " |\\ ",
         " | * Produce {i_2}",
         " | * EdgeUniquenessFilter {anon11, anon10 : anon13}",
-        " | * Expand (anon12)<-[anon13]-(hyc_1)",
         " | * EdgeUniquenessFilter {anon10 : anon11}",
-        " | * Expand (i)-[anon11]-(anon12)",
+        " | * ExpandIntersect (i)-[anon11]-(anon12)<-[anon13]-(hyc_1)",
         " | * Expand (d_4)-[anon10]->(i)",
         " | * Produce {d_4, hyc_1}",
         " | * Once",
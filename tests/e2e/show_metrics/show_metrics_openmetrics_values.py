@@ -116,6 +116,7 @@ EXPECTED_OPENMETRICS_PER_DB_FAMILIES = {
     "transient_errors_total",
     "unreleased_delta_objects",
     "gc_index_sweeps_total",
+    "gc_backlog_transactions",
     # QueryType
     "read_queries_total",
     "write_queries_total",
@@ -133,6 +134,10 @@ EXPECTED_OPENMETRICS_PER_DB_FAMILIES = {
     "snapshot_recovery_latency_seconds",
     "gc_latency_seconds",
     "gc_skiplist_cleanup_latency_seconds",
+    "gc_unlink_latency_seconds",
+    "gc_retire_latency_seconds",
+    "wal_group_commit_batch_size",
+    "wal_group_commit_latency_seconds",
 }
 
 
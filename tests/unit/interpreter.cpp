@@ -1187,6 +1187,124 @@ TYPED_TEST(InterpreterTest, ExplainQueryWithParams) {
   EXPECT_EQ(this->AstCacheSize(), 2U);
 }
 
+TYPED_TEST(InterpreterTest, ResultCache) {
+  // Results are cached only on in-memory storage.
+  if constexpr (std::is_same_v<TypeParam, memgraph::storage::DiskStorage>) {
+    return;
+  }
+
+  auto *result_cache = this->db->result_cache();
+  result_cache->WithLock([](auto &cache) { cache = memgraph::query::ResultCache{1U << 20U}; });
+  this->db->storage()->label_change_log_.Enable();
+  auto const cache_size = [&] { return result_cache->WithLock([](auto &cache) { return cache.size(); }); };
+  auto const values = [](const auto &stream) {
+    std::vector<int64_t> values;
+    for (const auto &row : stream.GetResults()) values.push_back(row.front().ValueInt());
+    return values;
+  };
+  const std::string query = "MATCH (n:A) WHERE n.x >= $min RETURN n.x ORDER BY n.x";
+
+  this->Interpret("CREATE (:A {x: 1}), (:A {x: 2})");
+  EXPECT_EQ(values(this->Interpret(query, {{"min", memgraph::storage::ExternalPropertyValue(1)}})),
+            (std::vector<int64_t>{1, 2}));
+  EXPECT_EQ(cache_size(), 1U);
+  EXPECT_EQ(values(this->Interpret(query, {{"min", memgraph::storage::ExternalPropertyValue(1)}})),
+            (std::vector<int64_t>{1, 2}));
+  EXPECT_EQ(cache_size(), 1U);
+  // Equal parameters of other types are other keys
+  EXPECT_EQ(values(this->Interpret(query, {{"min", memgraph::storage::ExternalPropertyValue(2.0)}})),
+            (std::vector<int64_t>{2}));
+  EXPECT_EQ(cache_size(), 2U);
+
+  // Graph elements, impure functions and explicit transactions aren't cached
+  this->Interpret("MATCH (n:A) RETURN n");
+  this->Interpret("MATCH (n:A) RETURN n.x + rand()");
+  this->Interpret("BEGIN");
+  this->Interpret("MATCH (n:A) RETURN count(n)");
+  this->Interpret("COMMIT");
+  EXPECT_EQ(cache_size(), 2U);
+
+  // A commit which changed a label the query reads drops its results once they are looked up
+  this->Interpret("CREATE (:A {x: 3})");
+  EXPECT_EQ(values(this->Interpret(query, {{"min", memgraph::storage::ExternalPropertyValue(1)}})),
+            (std::vector<int64_t>{1, 2, 3}));
+  EXPECT_EQ(cache_size(), 2U);
+  EXPECT_EQ(values(this->Interpret(query, {{"min", memgraph::storage::ExternalPropertyValue(2.0)}})),
+            (std::vector<int64_t>{2, 3}));
+  EXPECT_EQ(cache_size(), 2U);
+
+  // Results which don't fit are streamed, but not cached
+  result_cache->WithLock([](auto &cache) { cache = memgraph::query::ResultCache{1}; });
+  EXPECT_EQ(values(this->Interpret(query, {{"min", memgraph::storage::ExternalPropertyValue(1)}})),
+            (std::vector<int64_t>{1, 2, 3}));
+  EXPECT_EQ(cache_size(), 0U);
+}
+
+TYPED_TEST(InterpreterTest, ResultCacheKeepsResultsOfUntouchedLabels) {
+  // Results are cached only on in-memory storage.
+  if constexpr (std::is_same_v<TypeParam, memgraph::storage::DiskStorage>) {
+    return;
+  }
+
+  this->db->result_cache()->WithLock([](auto &cache) { cache = memgraph::query::ResultCache{1U << 20U}; });
+  this->db->storage()->label_change_log_.Enable();
+  auto const rows = [](const auto &stream) {
+    std::vector<std::pair<int64_t, int64_t>> rows;
+    for (const auto &row : stream.GetResults()) rows.emplace_back(row[0].ValueInt(), row[1].ValueInt());
+    return rows;
+  };
+  // Cached results are returned without expanding any edge
+  auto const hops = [](const auto &stream) { return stream.GetSummary().at("number_of_hops").ValueInt(); };
+  const std::string query = "MATCH (a:A)-->(b:B) RETURN a.x, b.y";
+
+  this->Interpret("CREATE (:A {x: 1})-[:R]->(:B {y: 1}), (:C {z: 1})");
+  {
+    auto stream = this->Interpret(query);
+    EXPECT_EQ(rows(stream), (std::vector<std::pair<int64_t, int64_t>>{{1, 1}}));
+    EXPECT_GT(hops(stream), 0);
+  }
+  EXPECT_EQ(hops(this->Interpret(query)), 0);
+
+  // Commits which changed neither :A nor :B nodes keep the results
+  this->Interpret("MATCH (c:C) SET c.z = 2");
+  this->Interpret("CREATE (:C {z: 3})");
+  {
+    auto stream = this->Interpret(query);
+    EXPECT_EQ(rows(stream), (std::vector<std::pair<int64_t, int64_t>>{{1, 1}}));
+    EXPECT_EQ(hops(stream), 0);
+  }
+
+  // A changed property of a node which the query expands to drops them
+  this->Interpret("MATCH (b:B) SET b.y = 2");
+  {
+    auto stream = this->Interpret(query);
+    EXPECT_EQ(rows(stream), (std::vector<std::pair<int64_t, int64_t>>{{1, 2}}));
+    EXPECT_GT(hops(stream), 0);
+  }
+  EXPECT_EQ(hops(this->Interpret(query)), 0);
+
+  // So does a new edge of a node the query scans, even if it leads to a node of another label
+  this->Interpret("MATCH (a:A), (c:C {z: 2}) CREATE (a)-[:R]->(c)");
+  {
+    auto stream = this->Interpret(query);
+    EXPECT_EQ(rows(stream), (std::vector<std::pair<int64_t, int64_t>>{{1, 2}}));
+    EXPECT_GT(hops(stream), 0);
+  }
+
+  // And a label added to a node which had none of them
+  this->Interpret("MATCH (c:C {z: 2}) SET c:B, c.y = 3");
+  {
+    auto stream = this->Interpret(query + " ORDER BY b.y");
+    EXPECT_EQ(rows(stream), (std::vector<std::pair<int64_t, int64_t>>{{1, 2}, {1, 3}}));
+  }
+
+  // A query which scans all nodes may read any label, so any commit drops its results
+  const std::string count_query = "MATCH (n) RETURN count(n), count(n)";
+  EXPECT_EQ(rows(this->Interpret(count_query)), (std::vector<std::pair<int64_t, int64_t>>{{4, 4}}));
+  this->Interpret("CREATE (:D)");
+  EXPECT_EQ(rows(this->Interpret(count_query)), (std::vector<std::pair<int64_t, int64_t>>{{5, 5}}));
+}
+
 TYPED_TEST(InterpreterTest, ProfileQuery) {
   EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
   EXPECT_EQ(this->AstCacheSize(), 0U);
@@ -0,0 +1,159 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "query/context.hpp"
+#include "query/db_accessor.hpp"
+#include "query/exceptions.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/compiled_expression.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/interpret/frame.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+using namespace memgraph::query;
+
+namespace {
+
+class CompiledExpressionTest : public ::testing::Test {
+ protected:
+  CompiledExpressionTest() : storage_dba(db->Access(memgraph::storage::WRITE)), dba(storage_dba.get()) {
+    auto vertex = dba.InsertVertex();
+    EXPECT_TRUE(vertex.SetProperty(dba.NameToProperty("age"), memgraph::storage::PropertyValue(30)));
+    EXPECT_TRUE(vertex.SetProperty(dba.NameToProperty("score"), memgraph::storage::PropertyValue(2.5)));
+    EXPECT_TRUE(vertex.SetProperty(dba.NameToProperty("name"), memgraph::storage::PropertyValue("x")));
+    EXPECT_TRUE(vertex.SetProperty(dba.NameToProperty("flag"), memgraph::storage::PropertyValue(true)));
+    dba.AdvanceCommand();
+    n_symbol = symbol_table.CreateSymbol("n", true);
+    frame.GetFrameWriter(nullptr, ctx.memory).Write(n_symbol, TypedValue(vertex));
+    ctx.parameters.Add(0, memgraph::storage::ExternalPropertyValue(2.5));
+  }
+
+  Expression *Property(const std::string &name) {
+    auto *identifier = storage.Create<Identifier>("n");
+    identifier->MapTo(n_symbol);
+    return storage.Create<PropertyLookup>(identifier, storage.GetPropertyIx(name));
+  }
+
+  template <class TValue>
+  Expression *Literal(TValue value) {
+    return storage.Create<PrimitiveLiteral>(value);
+  }
+
+  // The result of evaluating `expression` as a filter with the ExpressionEvaluator
+  bool Evaluate(Expression *expression) {
+    ctx.properties = NamesToProperties(storage.properties_, &dba);
+    auto value = expression->Accept(evaluator);
+    return value.IsBool() && value.ValueBool();
+  }
+
+  std::optional<bool> EvaluateCompiled(Expression *expression) {
+    ctx.properties = NamesToProperties(storage.properties_, &dba);
+    auto compiled = CompiledFilter::Compile(expression);
+    EXPECT_NE(compiled, nullptr);
+    if (!compiled) return std::nullopt;
+    memgraph::utils::pmr::vector<TypedValue> operands(ctx.memory);
+    compiled->BindOperands(ctx, &operands);
+    return compiled->Evaluate(frame, evaluator, operands);
+  }
+
+  void ExpectSameResult(Expression *expression) {
+    auto compiled = EvaluateCompiled(expression);
+    ASSERT_TRUE(compiled);
+    EXPECT_EQ(*compiled, Evaluate(expression));
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> db{std::make_unique<memgraph::storage::InMemoryStorage>()};
+  std::unique_ptr<memgraph::storage::Storage::Accessor> storage_dba;
+  DbAccessor dba;
+  AstStorage storage;
+  ExecutionContext execution_context{.db_accessor = &dba};
+  EvaluationContext &ctx = execution_context.evaluation_context;
+  SymbolTable &symbol_table = execution_context.symbol_table;
+  Symbol n_symbol;
+  Frame frame{16};
+  ExpressionEvaluator evaluator{&frame, execution_context, memgraph::storage::View::OLD};
+};
+
+TEST_F(CompiledExpressionTest, ComparisonsMatchEvaluator) {
+  ExpectSameResult(storage.Create<GreaterOperator>(Property("age"), Literal(20)));
+  ExpectSameResult(storage.Create<LessOperator>(Literal(20), Property("age")));
+  ExpectSameResult(storage.Create<EqualOperator>(Property("age"), Literal(30.0)));
+  ExpectSameResult(storage.Create<NotEqualOperator>(Property("age"), Literal(30)));
+  ExpectSameResult(storage.Create<GreaterEqualOperator>(Property("score"), storage.Create<ParameterLookup>(0)));
+  ExpectSameResult(storage.Create<LessEqualOperator>(Property("name"), Literal("y")));
+  ExpectSameResult(storage.Create<LessOperator>(Property("name"), Literal(5)));
+  ExpectSameResult(storage.Create<EqualOperator>(Property("flag"), Literal(true)));
+  ExpectSameResult(storage.Create<EqualOperator>(Property("missing"), Literal(1)));
+}
+
+TEST_F(CompiledExpressionTest, ConjunctionsMatchEvaluator) {
+  ExpectSameResult(storage.Create<AndOperator>(storage.Create<GreaterOperator>(Property("age"), Literal(20)),
+                                               storage.Create<EqualOperator>(Property("name"), Literal("x"))));
+  ExpectSameResult(storage.Create<AndOperator>(storage.Create<EqualOperator>(Property("missing"), Literal(1)),
+                                               storage.Create<EqualOperator>(Property("age"), Literal(30))));
+  ExpectSameResult(storage.Create<AndOperator>(storage.Create<EqualOperator>(Property("age"), Literal(31)),
+                                               storage.Create<EqualOperator>(Property("name"), Literal("x"))));
+}
+
+TEST_F(CompiledExpressionTest, InvalidComparisonThrows) {
+  auto *expression = storage.Create<LessOperator>(Property("flag"), Literal(1));
+  EXPECT_THROW(Evaluate(expression), QueryRuntimeException);
+  EXPECT_THROW(EvaluateCompiled(expression), QueryRuntimeException);
+}
+
+TEST_F(CompiledExpressionTest, OtherShapesArentCompiled) {
+  EXPECT_EQ(CompiledFilter::Compile(storage.Create<OrOperator>(
+                storage.Create<GreaterOperator>(Property("age"), Literal(20)),
+                storage.Create<EqualOperator>(Property("name"), Literal("x")))),
+            nullptr);
+  EXPECT_EQ(CompiledFilter::Compile(storage.Create<GreaterOperator>(
+                storage.Create<AdditionOperator>(Property("age"), Literal(1)), Literal(20))),
+            nullptr);
+  EXPECT_EQ(CompiledFilter::Compile(storage.Create<EqualOperator>(Property("age"), Property("score"))), nullptr);
+}
+
+TEST_F(CompiledExpressionTest, NonGraphObjectLeftToEvaluator) {
+  frame.GetFrameWriter(nullptr, ctx.memory).Write(n_symbol, TypedValue(std::map<std::string, TypedValue>{}));
+  EXPECT_EQ(EvaluateCompiled(storage.Create<EqualOperator>(Property("age"), Literal(30))), std::nullopt);
+}
+
+TEST_F(CompiledExpressionTest, Projection) {
+  auto *identifier = storage.Create<Identifier>("n");
+  identifier->MapTo(n_symbol);
+  std::vector<NamedExpression *> named_expressions{storage.Create<NamedExpression>("n", identifier),
+                                                   storage.Create<NamedExpression>("age", Property("age")),
+                                                   storage.Create<NamedExpression>("missing", Property("missing"))};
+  std::vector<Symbol> outputs;
+  for (auto *named_expression : named_expressions) {
+    outputs.push_back(symbol_table.CreateSymbol(named_expression->name_, true));
+    named_expression->MapTo(outputs.back());
+  }
+  ctx.properties = NamesToProperties(storage.properties_, &dba);
+
+  auto compiled = CompiledProjection::Compile(named_expressions, symbol_table);
+  ASSERT_NE(compiled, nullptr);
+  ASSERT_TRUE(compiled->Project(frame, evaluator, nullptr));
+  EXPECT_EQ(frame[outputs[0]].ValueVertex(), frame[n_symbol].ValueVertex());
+  EXPECT_EQ(frame[outputs[1]].ValueInt(), 30);
+  EXPECT_TRUE(frame[outputs[2]].IsNull());
+
+  std::vector<NamedExpression *> computed{
+      storage.Create<NamedExpression>("sum", storage.Create<AdditionOperator>(Property("age"), Literal(1)))};
+  EXPECT_EQ(CompiledProjection::Compile(computed, symbol_table), nullptr);
+}
+
+}  // namespace
@@ -282,6 +282,47 @@ TEST_F(QueryCostEstimator, ScanAllByLabelPropertiesComposite_EstimateCostWhenOpC
   }
 }
 
+TEST_F(QueryCostEstimator, ScanAllByLabelPropertiesComposite_EstimateFirstPropertyFromValueDistribution) {
+  AddVertices(100, 30, 20);
+  auto const properties = std::vector{ms::PropertyPath{prop_c}, ms::PropertyPath{prop_a}, ms::PropertyPath{prop_b}};
+  storage_dba->get()->SetIndexStats(
+      label,
+      properties,
+      ms::LabelPropertyIndexStats{.count = 20,
+                                  .distinct_values_count = 5,
+                                  .statistic = 0.0,
+                                  .avg_group_size = 4.0,
+                                  .avg_degree = 0.0,
+                                  .most_common_values = {{std::hash<ms::PropertyValue>{}(ms::PropertyValue(12)), 8}},
+                                  .other_values_count = 12,
+                                  .other_distinct_values_count = 4,
+                                  .histogram_bounds = {0.0, 10.0, 20.0},
+                                  .histogram_count = 20});
+  auto unknown = std::make_optional(
+      memgraph::utils::MakeBoundInclusive(static_cast<Expression *>(storage_.Create<UnaryPlusOperator>(Literal(1)))));
+  auto scan_first = [&](ExpressionRange first) {
+    MakeOp<ScanAllByLabelProperties>(nullptr,
+                                     NextSymbol(),
+                                     label,
+                                     properties,
+                                     std::vector{std::move(first),
+                                                 ExpressionRange::Range(unknown, unknown),
+                                                 ExpressionRange::Range(unknown, unknown)});
+  };
+
+  // A most common value
+  scan_first(ExpressionRange::Range(InclusiveBound(Literal(12)), InclusiveBound(Literal(12))));
+  EXPECT_COST(8 * CardParam::kFilter * CostParam::kScanAllByLabelProperties);
+
+  // Any other value is as common as the rest of them on average
+  scan_first(ExpressionRange::Range(InclusiveBound(Literal(13)), InclusiveBound(Literal(13))));
+  EXPECT_COST(3 * CardParam::kFilter * CostParam::kScanAllByLabelProperties);
+
+  // A quarter of the histogram lies above 15
+  scan_first(ExpressionRange::Range(InclusiveBound(Literal(15)), std::nullopt));
+  EXPECT_COST(5 * CardParam::kFilter * CostParam::kScanAllByLabelProperties);
+}
+
 TEST_F(QueryCostEstimator, ScanAllByLabelPropertiesCompositeNested) {
   AddVertices(100, 30, 20);
   for (auto *const_val : {Literal(12), Parameter(12)}) {
@@ -893,6 +893,122 @@ TYPED_TEST(TestPlanner, ParallelExecutionOrderByAfterWrite) {
             ExpectOrderBy());
 }
 
+TYPED_TEST(TestPlanner, ParallelExecutionHashJoin) {
+  LicenseWrapper license_wrapper;
+  // Test USING PARALLEL EXECUTION MATCH (n:A), (m:B) WHERE n.p = m.p RETURN count(m)
+  FakeDbAccessor dba;
+  auto label_a = dba.Label("A");
+  auto label_b = dba.Label("B");
+  auto prop_p = dba.Property("p");
+  auto count_agg = COUNT(IDENT("m"), false);
+  auto *query = PARALLEL_QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n", "A")), PATTERN(NODE("m", "B"))),
+                   WHERE(EQ(PROPERTY_LOOKUP(dba, "n", prop_p), PROPERTY_LOOKUP(dba, "m", prop_p))),
+                   RETURN(NEXPR("count", count_agg))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+
+  // Larger left side, each branch builds the hashtable from its chunk of it and probes the whole right side
+  {
+    dba.SetIndexCount(label_a, 1000);
+    dba.SetIndexCount(label_b, 10);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    std::list<BaseOpChecker *> left_hash_join_ops{
+        new ExpectScanParallelByLabel(), new ExpectParallelMerge(), new ExpectScanChunk()};
+    std::list<BaseOpChecker *> right_hash_join_ops{new ExpectScanAllByLabel()};
+    CheckPlan(planner.plan(),
+              symbol_table,
+              ExpectHashJoin(left_hash_join_ops, right_hash_join_ops),
+              ExpectAggregate({count_agg}, {}),
+              ExpectAggregateParallel(),
+              ExpectProduce());
+    DeleteListContent(&left_hash_join_ops);
+    DeleteListContent(&right_hash_join_ops);
+  }
+
+  // Larger right side, the branches probe one hashtable built from the whole left side with their chunk of the right
+  // side
+  {
+    dba.SetIndexCount(label_a, 10);
+    dba.SetIndexCount(label_b, 1000);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    std::list<BaseOpChecker *> left_hash_join_ops{new ExpectScanAllByLabel()};
+    std::list<BaseOpChecker *> right_hash_join_ops{
+        new ExpectScanParallelByLabel(), new ExpectParallelMerge(), new ExpectScanChunk()};
+    CheckPlan(planner.plan(),
+              symbol_table,
+              ExpectHashJoin(left_hash_join_ops, right_hash_join_ops),
+              ExpectAggregate({count_agg}, {}),
+              ExpectAggregateParallel(),
+              ExpectProduce());
+    DeleteListContent(&left_hash_join_ops);
+    DeleteListContent(&right_hash_join_ops);
+  }
+}
+
+// ============================================================================
+// PRODUCE PARALLEL TESTS
+// ============================================================================
+
+TYPED_TEST(TestPlanner, ParallelExecutionExpandFilterProduce) {
+  LicenseWrapper license_wrapper;
+  // Test USING PARALLEL EXECUTION MATCH (n)-[e]->(m) WHERE m.p < 100 RETURN n, m
+  FakeDbAccessor dba;
+  auto prop_p = dba.Property("p");
+  auto *query = PARALLEL_QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("e", Direction::OUT), NODE("m"))),
+                                            WHERE(LESS(PROPERTY_LOOKUP(dba, "m", prop_p), LITERAL(100))),
+                                            RETURN("n", "m")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  CheckPlan(planner.plan(),
+            symbol_table,
+            ExpectScanParallel(),
+            ExpectParallelMerge(),
+            ExpectScanChunk(),
+            ExpectExpand(),
+            ExpectFilter(),
+            ExpectProduce(),
+            ExpectProduceParallel());
+}
+
+TYPED_TEST(TestPlanner, ParallelExecutionMultiHopProduceWithLimit) {
+  LicenseWrapper license_wrapper;
+  // Test USING PARALLEL EXECUTION MATCH (a)-[e1]->(b)-[e2]->(c) RETURN a, c LIMIT 10
+  // LIMIT stays on top and stops pulling the merged stream
+  FakeDbAccessor dba;
+  auto *query = PARALLEL_QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("a"), EDGE("e1", Direction::OUT), NODE("b"), EDGE("e2", Direction::OUT), NODE("c"))),
+      RETURN(IDENT("a"), AS("a"), IDENT("c"), AS("c"), LIMIT(LITERAL(10)))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  CheckPlan(planner.plan(),
+            symbol_table,
+            ExpectScanParallel(),
+            ExpectParallelMerge(),
+            ExpectScanChunk(),
+            ExpectExpand(),
+            ExpectExpand(),
+            ExpectEdgeUniquenessFilter(),
+            ExpectProduce(),
+            ExpectProduceParallel(),
+            ExpectLimit());
+}
+
+TYPED_TEST(TestPlanner, ParallelExecutionProduceAfterWrite) {
+  LicenseWrapper license_wrapper;
+  // Test USING PARALLEL EXECUTION MATCH (n) SET n:A RETURN n
+  FakeDbAccessor dba;
+  auto *n = IDENT("n");
+  auto *query = PARALLEL_QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), SET("n", {"A"}), RETURN(n, AS("n"))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto acc = ExpectAccumulate({symbol_table.at(*n)});
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  // Expect serial plan because SET inhibits parallelization (path not read-only)
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectSetLabels(), acc, ExpectProduce());
+}
+
 }  // namespace
 
 #endif
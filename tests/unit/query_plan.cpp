@@ -33,7 +33,9 @@
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/planner.hpp"
+#include "query/plan/preprocess.hpp"
 #include "query/plan/rewrite/balanced_union.hpp"
+#include "query/plan/rewrite/index_only_scan.hpp"
 #include "query/plan/used_index_checker.hpp"
 
 #include "query_common.hpp"
@@ -441,6 +443,28 @@ TYPED_TEST(TestPlanner, MatchMultiPatternSameExpandStart) {
                        ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, MatchTriangle) {
+  // Test MATCH (a) -[e1]-> (b) -[e2]-> (c) -[e3]-> (a) RETURN a
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("a"),
+                                                 EDGE("e1", memgraph::query::EdgeAtom::Direction::OUT),
+                                                 NODE("b"),
+                                                 EDGE("e2", memgraph::query::EdgeAtom::Direction::OUT),
+                                                 NODE("c"),
+                                                 EDGE("e3", memgraph::query::EdgeAtom::Direction::OUT),
+                                                 NODE("a"))),
+                                   RETURN("a")));
+  // The expansion to `c` and the one closing the cycle are fused, and the
+  // uniqueness filter between them moves above.
+  CheckPlan<TypeParam>(query,
+                       this->storage,
+                       ExpectScanAll(),
+                       ExpectExpand(),
+                       ExpectExpandIntersect(),
+                       ExpectEdgeUniquenessFilter(),
+                       ExpectEdgeUniquenessFilter(),
+                       ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MultiMatch) {
   // Test MATCH (n) -[r]- (m) MATCH (j) -[e]- (i) -[f]- (h) RETURN n
   FakeDbAccessor dba;
@@ -4929,6 +4953,51 @@ TYPED_TEST(TestPlanner, LabelExpressionCombination) {
   CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, LabelIndexIntersection) {
+  // Test MATCH (n) WHERE n:Label1:Label2:Label3 RETURN n
+  FakeDbAccessor dba;
+  auto label1_id = dba.Label("Label1");
+  auto label2_id = dba.Label("Label2");
+  [[maybe_unused]] auto label3_id = dba.Label("Label3");
+
+  // Label3 isn't indexed, so it is left to the filter
+  dba.SetIndexCount(label1_id, 100);
+  dba.SetIndexCount(label2_id, 50);
+
+  auto make_query = [&]() {
+    auto labels_ix = std::vector<memgraph::query::LabelIx>{
+        this->storage.GetLabelIx("Label1"), this->storage.GetLabelIx("Label2"), this->storage.GetLabelIx("Label3")};
+    return QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), WHERE(LABELS_TEST(IDENT("n"), labels_ix)), RETURN("n")));
+  };
+
+  {
+    // Without an estimate of the intersection the smallest index is scanned
+    auto *query = make_query();
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(label2_id), ExpectFilter(), ExpectProduce());
+  }
+  {
+    // Most of the smallest index has the other label as well
+    dba.SetLabelIntersectionCount(40);
+    auto *query = make_query();
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(label2_id), ExpectFilter(), ExpectProduce());
+  }
+  {
+    dba.SetLabelIntersectionCount(5);
+    auto *query = make_query();
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(),
+              symbol_table,
+              ExpectScanAllByLabelIntersection({label1_id, label2_id}),
+              ExpectFilter(),
+              ExpectProduce());
+  }
+}
+
 TYPED_TEST(TestPlanner, ORLabelExpressionUsingIndexCombination) {
   // Test MATCH (n:Label1|Label2) WHERE n.prop = 1 RETURN n
   FakeDbAccessor dba;
@@ -7114,4 +7183,172 @@ TYPED_TEST(TestPlanner, PreferCompositeIndexOverSinglePropertyIndex) {
             ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, IndexOnlyScanFilterAndProduce) {
+  // Test MATCH (n :label) WHERE n.property > 42 AND n.property <> 50 RETURN n.property AS p, n.other AS o
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  auto other = PROPERTY_PAIR(dba, "other");
+  dba.SetIndexCount(label, property.second, 1);
+  auto *n_prop = PROPERTY_LOOKUP(dba, "n", property);
+  auto *as_p = NEXPR("p", n_prop);
+  auto *as_o = NEXPR("o", PROPERTY_LOOKUP(dba, "n", other));
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(AND(GREATER(PROPERTY_LOOKUP(dba, "n", property), LITERAL(42)),
+                                             NEQ(PROPERTY_LOOKUP(dba, "n", property), LITERAL(50)))),
+                                   RETURN(as_p, as_o)));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  auto *scan = FindOpOfType<ScanAllByLabelProperties>(&planner.plan());
+  ASSERT_TRUE(scan);
+  ASSERT_EQ(scan->index_value_symbols_.size(), 1);
+  ASSERT_TRUE(scan->index_value_symbols_[0]);
+  auto const &value_symbol = *scan->index_value_symbols_[0];
+
+  // n.property <> 50 is left in the Filter
+  auto *filter = FindOpOfType<Filter>(&planner.plan());
+  ASSERT_TRUE(filter);
+  UsedSymbolsCollector filter_symbols(symbol_table);
+  filter->expression_->Accept(filter_symbols);
+  EXPECT_TRUE(filter_symbols.symbols_.contains(value_symbol));
+
+  auto *produce = FindOpOfType<Produce>(&planner.plan());
+  ASSERT_TRUE(produce);
+  ASSERT_EQ(produce->named_expressions_.size(), 2);
+  auto *p_value = dynamic_cast<memgraph::query::Identifier *>(produce->named_expressions_[0]->expression_);
+  ASSERT_TRUE(p_value);
+  EXPECT_EQ(p_value->symbol_pos_, value_symbol.position());
+  // Not indexed
+  EXPECT_TRUE(dynamic_cast<memgraph::query::PropertyLookup *>(produce->named_expressions_[1]->expression_));
+  // The query's own AST is shared by all candidate plans, so the rewritten expressions are clones
+  EXPECT_NE(produce->named_expressions_[0], as_p);
+  EXPECT_EQ(as_p->expression_, n_prop);
+}
+
+TYPED_TEST(TestPlanner, IndexOnlyScanSkipsNestedPaths) {
+  // Test MATCH (n :label) RETURN n.outer AS o, n.outer.inner AS i, scanning the index on :label(outer.inner)
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto outer = dba.Property("outer");
+  auto inner = dba.Property("inner");
+  SymbolTable symbol_table;
+  auto n = symbol_table.CreateSymbol("n", true);
+  auto scan = std::make_shared<ScanAllByLabelProperties>(
+      nullptr, n, label, std::vector{ms::PropertyPath{outer, inner}}, std::vector{ExpressionRange::IsNotNull()});
+  auto *as_o =
+      NEXPR("o", PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n), outer))->MapTo(symbol_table.CreateSymbol("o", true));
+  auto *as_i = NEXPR("i", PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n), std::vector{outer, inner}))
+                   ->MapTo(symbol_table.CreateSymbol("i", true));
+  std::unique_ptr<LogicalOperator> plan =
+      std::make_unique<Produce>(scan, std::vector<memgraph::query::NamedExpression *>{as_o, as_i});
+
+  plan = RewriteIndexOnlyScan(std::move(plan), &symbol_table, &this->storage, &dba);
+
+  // Nested values are read through the whole map, so neither lookup gets the value from the entry
+  EXPECT_TRUE(scan->index_value_symbols_.empty());
+  auto &produce = dynamic_cast<Produce &>(*plan);
+  EXPECT_EQ(produce.named_expressions_[0], as_o);
+  EXPECT_EQ(produce.named_expressions_[1], as_i);
+}
+
+TYPED_TEST(TestPlanner, IndexOnlyScanSkipsPatternFilters) {
+  // Test MATCH (n :label) WHERE n.property > 42 AND exists((n)-[]-()) RETURN n.property AS p
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  dba.SetIndexCount(label, property.second, 1);
+  auto *n_prop = PROPERTY_LOOKUP(dba, "n", property);
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(AND(GREATER(PROPERTY_LOOKUP(dba, "n", property), LITERAL(42)),
+                EXISTS(PATTERN(NODE("n"),
+                               EDGE("edge", memgraph::query::EdgeAtom::Direction::BOTH, {}, false),
+                               NODE("m", std::nullopt, false))))),
+      RETURN(NEXPR("p", n_prop))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  // The pattern filter runs its own branch over the vertex, so the chain to the scan stops at it
+  auto *filter = FindOpOfType<Filter>(&planner.plan());
+  ASSERT_TRUE(filter);
+  EXPECT_FALSE(filter->pattern_filters_.empty());
+  auto *scan = FindOpOfType<ScanAllByLabelProperties>(&planner.plan());
+  ASSERT_TRUE(scan);
+  EXPECT_TRUE(scan->index_value_symbols_.empty());
+  auto *produce = FindOpOfType<Produce>(&planner.plan());
+  ASSERT_TRUE(produce);
+  EXPECT_EQ(produce->named_expressions_[0]->expression_, n_prop);
+}
+
+TYPED_TEST(TestPlanner, IndexOnlyScanSkipsWriteQueries) {
+  // Test MATCH (n :label) WHERE n.property > 42 SET n.other = 1 RETURN n.property AS p
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  auto other = PROPERTY_PAIR(dba, "other");
+  dba.SetIndexCount(label, property.second, 1);
+  auto *n_prop = PROPERTY_LOOKUP(dba, "n", property);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(GREATER(PROPERTY_LOOKUP(dba, "n", property), LITERAL(42))),
+                                   SET(PROPERTY_LOOKUP(dba, "n", other), LITERAL(1)),
+                                   RETURN(NEXPR("p", n_prop))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  // The graph can change between the scan and the operators reading the vertex
+  auto *scan = FindOpOfType<ScanAllByLabelProperties>(&planner.plan());
+  ASSERT_TRUE(scan);
+  EXPECT_TRUE(scan->index_value_symbols_.empty());
+  auto *produce = FindOpOfType<Produce>(&planner.plan());
+  ASSERT_TRUE(produce);
+  EXPECT_EQ(produce->named_expressions_[0]->expression_, n_prop);
+}
+
+TYPED_TEST(TestPlanner, IndexOnlyScanSkipsParallelPlans) {
+  // Test USING PARALLEL EXECUTION MATCH (n :label) WHERE n.property > 42 RETURN n.property AS p
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  dba.SetIndexCount(label, property.second, 1);
+  auto *n_prop = PROPERTY_LOOKUP(dba, "n", property);
+  auto *query = PARALLEL_QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                            WHERE(GREATER(PROPERTY_LOOKUP(dba, "n", property), LITERAL(42))),
+                                            RETURN(NEXPR("p", n_prop))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  if (auto *scan = FindOpOfType<ScanAllByLabelProperties>(&planner.plan())) {
+    EXPECT_TRUE(scan->index_value_symbols_.empty());
+  }
+  auto *produce = FindOpOfType<Produce>(&planner.plan());
+  ASSERT_TRUE(produce);
+  EXPECT_EQ(produce->named_expressions_[0]->expression_, n_prop);
+}
+
+TYPED_TEST(TestPlanner, IndexOnlyScanStopsAtOrderBy) {
+  // Test MATCH (n :label) WHERE n.property > 42 WITH n ORDER BY n.other RETURN n.property AS p
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  auto other = PROPERTY_PAIR(dba, "other");
+  dba.SetIndexCount(label, property.second, 1);
+  auto *n_prop = PROPERTY_LOOKUP(dba, "n", property);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(GREATER(PROPERTY_LOOKUP(dba, "n", property), LITERAL(42))),
+                                   WITH("n", ORDER_BY(PROPERTY_LOOKUP(dba, "n", other))),
+                                   RETURN(NEXPR("p", n_prop))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  // OrderBy passes on only its output symbols, so the RETURN above it still reads the vertex
+  ASSERT_TRUE(FindOpOfType<OrderBy>(&planner.plan()));
+  auto *produce = FindOpOfType<Produce>(&planner.plan());
+  ASSERT_TRUE(produce);
+  EXPECT_EQ(produce->named_expressions_[0]->expression_, n_prop);
+  auto *scan = FindOpOfType<ScanAllByLabelProperties>(&planner.plan());
+  ASSERT_TRUE(scan);
+  EXPECT_TRUE(scan->index_value_symbols_.empty());
+}
+
 }  // namespace
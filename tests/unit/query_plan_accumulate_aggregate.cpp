@@ -378,6 +378,64 @@ TYPED_TEST(QueryPlanTest, AggregateGroupByValues) {
       group_by_tvals.begin(), group_by_tvals.end() - 2, result_group_bys.begin(), TypedValue::BoolEqual{}));
 }
 
+TYPED_TEST(QueryPlanTest, AggregateBatchedInput) {
+  // MATCH (n)-[r]->(m) WHERE n.x < 50 WITH n.x AS x RETURN count(x), sum(x)
+  // The input of the aggregation is pulled in batches, which has to give the same result as pulling it row by row
+  // (as PROFILE does), also when expanding a vertex spans several batches
+  static constexpr int kNumVertices = 100;
+  static constexpr int kDegree = 30;
+
+  auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto prop = dba.NameToProperty("x");
+  auto edge_type = dba.NameToEdgeType("T");
+  std::vector<memgraph::query::VertexAccessor> vertices;
+  for (int i = 0; i < kNumVertices; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i)).has_value());
+    vertices.push_back(vertex);
+  }
+  for (int i = 0; i < kNumVertices; ++i) {
+    for (int j = 1; j <= kDegree; ++j) {
+      ASSERT_TRUE(dba.InsertEdge(&vertices[i], &vertices[(i + j) % kNumVertices], edge_type).has_value());
+    }
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto r_m = MakeExpand(this->storage,
+                        symbol_table,
+                        n.op_,
+                        n.sym_,
+                        "r",
+                        EdgeAtom::Direction::OUT,
+                        {},
+                        "m",
+                        false,
+                        memgraph::storage::View::OLD);
+  auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+  auto filter = std::make_shared<Filter>(
+      r_m.op_, std::vector<std::shared_ptr<LogicalOperator>>{}, LESS(n_p, LITERAL(kNumVertices / 2)));
+  auto x_sym = symbol_table.CreateSymbol("x", true);
+  auto with = MakeProduce(filter, NEXPR("x", n_p)->MapTo(x_sym));
+  auto x = IDENT("x")->MapTo(x_sym);
+  auto produce = this->MakeAggregationProduce(
+      with, symbol_table, {x, x}, {Aggregation::Op::COUNT, Aggregation::Op::SUM}, {}, {}, false);
+
+  int64_t expected_sum = 0;
+  for (int i = 0; i < kNumVertices / 2; ++i) expected_sum += int64_t{i} * kDegree;
+  for (bool const profile : {false, true}) {
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    context.is_profile_query = profile;
+    auto results = CollectProduce(*produce, &context);
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results[0].size(), 2);
+    EXPECT_EQ(results[0][0].ValueInt(), kNumVertices / 2 * kDegree);
+    EXPECT_EQ(results[0][1].ValueInt(), expected_sum);
+  }
+}
+
 TYPED_TEST(QueryPlanTest, AggregateMultipleGroupBy) {
   // in this test we have 3 different properties that have different values
   // for different records and assert that we get the correct combination
@@ -26,6 +26,7 @@
 #include "query/context.hpp"
 #include "query/exceptions.hpp"
 #include "query/plan/operator.hpp"
+#include "query/plan/rewrite/top_k.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 
@@ -283,6 +284,63 @@ TYPED_TEST(QueryPlanTest, OrderByMultiple) {
   }
 }
 
+TYPED_TEST(QueryPlanTest, OrderByTopK) {
+  auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  auto prop = dba.NameToProperty("prop");
+
+  // 200 vertices sharing 50 values, four each, created in random order
+  const int N = 200;
+  std::vector<int> values;
+  for (int i = 0; i < N; ++i) values.push_back(i % 50);
+  std::random_device rd;
+  std::mt19937 g(rd());
+  std::shuffle(values.begin(), values.end(), g);
+  for (auto value : values) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(value)).has_value());
+  }
+  dba.AdvanceCommand();
+
+  // MATCH (n) RETURN n.prop ORDER BY n.prop DESC SKIP skip LIMIT limit
+  auto check = [&](int skip, int limit) {
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+    auto order_by = std::make_shared<plan::OrderBy>(
+        n.op_, std::vector<SortItem>{{Ordering::DESC, n_p}}, std::vector<Symbol>{n.sym_});
+    auto skip_op = std::make_shared<plan::Skip>(order_by, LITERAL(skip));
+    auto limit_op = std::make_shared<plan::Limit>(skip_op, LITERAL(limit));
+    plan::impl::TopKRewriter<memgraph::query::DbAccessor> rewriter{&symbol_table, &this->storage, &dba};
+    limit_op->Accept(rewriter);
+    ASSERT_NE(order_by->limit_, nullptr);
+    ASSERT_NE(order_by->skip_, nullptr);
+
+    auto n_p_ne = NEXPR("n.prop", n_p)->MapTo(symbol_table.CreateSymbol("n.prop", true));
+    auto produce = MakeProduce(limit_op, n_p_ne);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    const int expected_size = std::clamp(N - skip, 0, limit);
+    ASSERT_EQ(results.size(), expected_size);
+    for (int i = 0; i < expected_size; ++i) {
+      ASSERT_EQ(results[i][0].type(), TypedValue::Type::Int);
+      EXPECT_EQ(results[i][0].ValueInt(), 49 - (skip + i) / 4);
+    }
+  };
+  check(7, 13);
+  check(0, 1);
+  check(150, 1000);
+  check(300, 5);
+
+  // A bound that has to be evaluated isn't copied onto the OrderBy
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto order_by = std::make_shared<plan::OrderBy>(
+      n.op_, std::vector<SortItem>{{Ordering::ASC, IDENT("n")->MapTo(n.sym_)}}, std::vector<Symbol>{n.sym_});
+  auto limit_op = std::make_shared<plan::Limit>(order_by, ADD(LITERAL(1), LITERAL(2)));
+  plan::impl::TopKRewriter<memgraph::query::DbAccessor> rewriter{&symbol_table, &this->storage, &dba};
+  limit_op->Accept(rewriter);
+  EXPECT_EQ(order_by->limit_, nullptr);
+}
+
 TYPED_TEST(QueryPlanTest, OrderByExceptions) {
   auto storage_dba = this->db->Access(memgraph::storage::WRITE);
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -114,6 +114,7 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(Delete);
   PRE_VISIT(ScanAll);
   PRE_VISIT(ScanAllByLabel);
+  PRE_VISIT(ScanAllByLabelIntersection);
   PRE_VISIT(ScanAllByLabelProperties);
   PRE_VISIT(ScanAllByEdgeType);
   PRE_VISIT(ScanAllByEdgeTypeProperty);
@@ -127,6 +128,7 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(ScanAllById);
   PRE_VISIT(Expand);
   PRE_VISIT(ExpandVariable);
+  PRE_VISIT(ExpandIntersect);
   PRE_VISIT(ConstructNamedPath);
   PRE_VISIT(EmptyResult);
   PRE_VISIT(Produce);
@@ -215,6 +217,7 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
 
   PRE_VISIT(AggregateParallel);
   PRE_VISIT(OrderByParallel);
+  PRE_VISIT(ProduceParallel);
   PRE_VISIT(ParallelMerge);
   PRE_VISIT(ScanParallel);
   PRE_VISIT(ScanParallelByLabel);
@@ -294,6 +297,7 @@ class ExpectScanAllById : public OpChecker<ScanAllById> {
 };
 
 using ExpectExpand = OpChecker<Expand>;
+using ExpectExpandIntersect = OpChecker<ExpandIntersect>;
 using ExpectConstructNamedPath = OpChecker<ConstructNamedPath>;
 using ExpectProduce = OpChecker<Produce>;
 
@@ -347,6 +351,7 @@ using ExpectSetNestedProperty = OpChecker<SetNestedProperty>;
 using ExpectRemoveNestedProperty = OpChecker<RemoveNestedProperty>;
 using ExpectAggregateParallel = OpChecker<AggregateParallel>;
 using ExpectOrderByParallel = OpChecker<OrderByParallel>;
+using ExpectProduceParallel = OpChecker<ProduceParallel>;
 using ExpectParallelMerge = OpChecker<ParallelMerge>;
 using ExpectScanParallel = OpChecker<ScanParallel>;
 using ExpectScanParallelByLabel = OpChecker<ScanParallelByLabel>;
@@ -621,6 +626,19 @@ class ExpectScanAllByLabel : public OpChecker<ScanAllByLabel> {
   std::optional<memgraph::storage::LabelId> label_;
 };
 
+class ExpectScanAllByLabelIntersection : public OpChecker<ScanAllByLabelIntersection> {
+ public:
+  explicit ExpectScanAllByLabelIntersection(std::vector<memgraph::storage::LabelId> labels)
+      : labels_(std::move(labels)) {}
+
+  void ExpectOp(ScanAllByLabelIntersection &scan_all, const SymbolTable &) override {
+    EXPECT_THAT(scan_all.labels_, testing::UnorderedElementsAreArray(labels_));
+  }
+
+ private:
+  std::vector<memgraph::storage::LabelId> labels_;
+};
+
 class ExpectScanAllByLabelProperties : public OpChecker<ScanAllByLabelProperties> {
  public:
   ExpectScanAllByLabelProperties(memgraph::storage::LabelId label,
@@ -1013,6 +1031,11 @@ class FakeDbAccessor {
     return std::nullopt;
   }
 
+  std::optional<uint64_t> VerticesIntersectionCount(std::span<storage::LabelId const> labels) const {
+    if (!std::ranges::all_of(labels, [&](auto const label) { return LabelIndexReady(label); })) return std::nullopt;
+    return label_intersection_count_;
+  }
+
   int64_t EdgesCount() const {
     int64_t count = 0;
     for (const auto &index : edge_type_index_) {
@@ -1181,6 +1204,9 @@ class FakeDbAccessor {
     vertex_property_index_[property] = count;
   }
 
+  // Like on disk, label indices can't be intersected until this is set
+  void SetLabelIntersectionCount(uint64_t count) { label_intersection_count_ = count; }
+
   memgraph::storage::LabelId NameToLabel(const std::string &name) {
     auto found = labels_.find(name);
     if (found != labels_.end()) return found->second;
@@ -1255,6 +1281,7 @@ class FakeDbAccessor {
       edge_type_property_index_;
   std::unordered_map<memgraph::storage::PropertyId, int64_t> edge_property_index_;
   std::unordered_map<memgraph::storage::PropertyId, int64_t> vertex_property_index_;
+  std::optional<uint64_t> label_intersection_count_;
 };
 
 }  // namespace memgraph::query::plan
@@ -14,8 +14,11 @@
 #include "query_plan_common.hpp"
 
 #include <iterator>
+#include <map>
 #include <memory>
 #include <optional>
+#include <set>
+#include <tuple>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -37,11 +40,13 @@
 #include "query/exceptions.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/plan/operator.hpp"
+#include "query/plan/rewrite/expand_intersect.hpp"
 #include "query/virtual_edge.hpp"
 #include "query/virtual_node.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "tests/test_commit_args_helper.hpp"
+#include "utils/priority_thread_pool.hpp"
 #include "utils/synchronized.hpp"
 
 using namespace memgraph::query;
@@ -2021,10 +2026,10 @@ class QueryPlanExpandWeightedShortestPath : public testing::Test {
 
   // defines and performs a weighted shortest expansion with the given
   // params returns a vector of pairs. each pair is (vector-of-edges,
-  // vertex)
+  // vertex). the weight is the edge's `prop` unless `weight` is given
   auto ExpandWShortest(EdgeAtom::Direction direction, std::optional<int> max_depth, Expression *where,
                        std::optional<int> node_id = 0, ScanAllTuple *existing_node_input = nullptr,
-                       memgraph::auth::User *user = nullptr) {
+                       memgraph::auth::User *user = nullptr, Expression *weight = nullptr) {
     // scan the nodes optionally filtering on property value
     auto n = MakeScanAll(storage, symbol_table, "n", existing_node_input ? existing_node_input->op_ : nullptr);
     auto last_op = n.op_;
@@ -2053,7 +2058,9 @@ class QueryPlanExpandWeightedShortestPath : public testing::Test {
                                          max_depth ? LITERAL(max_depth.value()) : nullptr,
                                          existing_node_input != nullptr,
                                          ExpansionLambda{filter_edge, filter_node, where},
-                                         ExpansionLambda{weight_edge, weight_node, PROPERTY_LOOKUP(dba, ident_e, prop)},
+                                         ExpansionLambda{weight_edge,
+                                                         weight_node,
+                                                         weight ? weight : PROPERTY_LOOKUP(dba, ident_e, prop)},
                                          total_weight,
                                          nullptr);
 
@@ -2224,6 +2231,114 @@ TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExistingNode) {
   }
 }
 
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExistingNodeFromSource) {
+  // the search from v[0] ends in the bound v[4], with only the cheapest path to it
+  auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+  n0.op_ = std::make_shared<Filter>(n0.op_,
+                                    std::vector<std::shared_ptr<LogicalOperator>>{},
+                                    EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(4)));
+
+  auto results = this->ExpandWShortest(EdgeAtom::Direction::BOTH, 1000, LITERAL(true), 0, &n0);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(this->GetProp(results[0].vertex), 4);
+  EXPECT_EQ(results[0].total_weight, 9);
+  ASSERT_EQ(results[0].path.size(), 3);
+  EXPECT_EQ(results[0].path[0], this->e.at({0, 2}));
+  EXPECT_EQ(results[0].path[1], this->e.at({2, 3}));
+  EXPECT_EQ(results[0].path[2], this->e.at({3, 4}));
+}
+
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExpressionWeight) {
+  // weights that aren't just a property of the edge are evaluated with the lambda's symbols on the frame
+  {
+    auto ident_e = IDENT("e");
+    ident_e->MapTo(this->weight_edge);
+    auto double_weight = ADD(PROPERTY_LOOKUP(this->dba, ident_e, this->prop),
+                             PROPERTY_LOOKUP(this->dba, ident_e, this->prop));
+    auto results = this->ExpandWShortest(
+        EdgeAtom::Direction::BOTH, 1000, LITERAL(true), 0, nullptr, nullptr, double_weight);
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(this->GetProp(results[0].vertex), 2);
+    EXPECT_EQ(results[0].total_weight, 6);
+    EXPECT_EQ(this->GetProp(results[1].vertex), 1);
+    EXPECT_EQ(results[1].total_weight, 10);
+    EXPECT_EQ(this->GetProp(results[2].vertex), 3);
+    EXPECT_EQ(results[2].total_weight, 12);
+    EXPECT_EQ(this->GetProp(results[3].vertex), 4);
+    EXPECT_EQ(results[3].total_weight, 18);
+  }
+  {
+    // the property of the node expanded to, not of the edge; the source's own weight of 0.5 starts every path
+    auto ident_v = IDENT("v");
+    ident_v->MapTo(this->weight_node);
+    auto node_weight = ADD(PROPERTY_LOOKUP(this->dba, ident_v, this->prop), LITERAL(0.5));
+    auto results = this->ExpandWShortest(
+        EdgeAtom::Direction::BOTH, 1000, LITERAL(true), 0, nullptr, nullptr, node_weight);
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(this->GetProp(results[0].vertex), 1);
+    EXPECT_EQ(results[0].total_weight, 2);
+    EXPECT_EQ(this->GetProp(results[1].vertex), 2);
+    EXPECT_EQ(results[1].total_weight, 3);
+    EXPECT_EQ(this->GetProp(results[2].vertex), 4);
+    EXPECT_EQ(results[2].total_weight, 5);
+    EXPECT_EQ(this->GetProp(results[3].vertex), 3);
+    EXPECT_EQ(results[3].total_weight, 6.5);
+  }
+}
+
+// Without a filter lambda or an upper bound, the search for a path to a bound destination runs from both ends
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, BidirectionalExistingNode) {
+  auto expand_to = [this](int target, EdgeAtom::Direction direction) {
+    auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+    n0.op_ = std::make_shared<Filter>(
+        n0.op_,
+        std::vector<std::shared_ptr<LogicalOperator>>{},
+        EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(target)));
+    return this->ExpandWShortest(direction, std::nullopt, nullptr, 0, &n0);
+  };
+
+  {
+    auto results = expand_to(4, EdgeAtom::Direction::BOTH);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(this->GetProp(results[0].vertex), 4);
+    EXPECT_EQ(results[0].total_weight, 9);
+    ASSERT_EQ(results[0].path.size(), 3);
+    EXPECT_EQ(results[0].path[0], this->e.at({0, 2}));
+    EXPECT_EQ(results[0].path[1], this->e.at({2, 3}));
+    EXPECT_EQ(results[0].path[2], this->e.at({3, 4}));
+  }
+  {
+    auto results = expand_to(4, EdgeAtom::Direction::IN);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0].total_weight, 12);
+    ASSERT_EQ(results[0].path.size(), 1);
+    EXPECT_EQ(results[0].path[0], this->e.at({4, 0}));
+  }
+  // paths never end in their source
+  EXPECT_TRUE(expand_to(0, EdgeAtom::Direction::BOTH).empty());
+}
+
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, BidirectionalMatchesSingleSided) {
+  auto ident_v = IDENT("v");
+  ident_v->MapTo(this->weight_node);
+  auto node_weight = ADD(PROPERTY_LOOKUP(this->dba, ident_v, this->prop), LITERAL(0.5));
+  for (auto direction : {EdgeAtom::Direction::OUT, EdgeAtom::Direction::IN, EdgeAtom::Direction::BOTH}) {
+    for (auto *weight : {static_cast<Expression *>(nullptr), node_weight}) {
+      // a filter lambda and an upper bound keep the search on the source's side
+      auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+      auto single_sided = this->ExpandWShortest(direction, 1000, LITERAL(true), std::nullopt, &n0, nullptr, weight);
+      auto m0 = MakeScanAll(this->storage, this->symbol_table, "m0");
+      auto bidirectional = this->ExpandWShortest(direction, std::nullopt, nullptr, std::nullopt, &m0, nullptr, weight);
+      ASSERT_EQ(single_sided.size(), bidirectional.size());
+      for (size_t i = 0; i < single_sided.size(); ++i) {
+        EXPECT_EQ(single_sided[i].vertex, bidirectional[i].vertex);
+        EXPECT_EQ(single_sided[i].total_weight, bidirectional[i].total_weight);
+        EXPECT_EQ(single_sided[i].path.size(), bidirectional[i].path.size());
+      }
+    }
+  }
+}
+
 TYPED_TEST(QueryPlanExpandWeightedShortestPath, UpperBound) {
   {
     auto results = this->ExpandWShortest(EdgeAtom::Direction::BOTH, std::nullopt, LITERAL(true));
@@ -2494,10 +2609,10 @@ class QueryPlanExpandAllShortestPaths : public testing::Test {
 
   // defines and performs an all shortest paths expansion with the given
   // params returns a vector of pairs. each pair is (vector-of-edges,
-  // vertex)
+  // vertex). the weight is the edge's `prop` unless `weight` is given
   auto ExpandAllShortest(EdgeAtom::Direction direction, std::optional<int> max_depth, Expression *where,
                          std::optional<int> node_id = 0, ScanAllTuple *existing_node_input = nullptr,
-                         const memgraph::auth::User *user = nullptr) {
+                         const memgraph::auth::User *user = nullptr, Expression *weight = nullptr) {
     // scan the nodes optionally filtering on property value
     auto n = MakeScanAll(storage, symbol_table, "n", existing_node_input ? existing_node_input->op_ : nullptr);
     auto last_op = n.op_;
@@ -2526,7 +2641,9 @@ class QueryPlanExpandAllShortestPaths : public testing::Test {
                                          max_depth ? LITERAL(max_depth.value()) : nullptr,
                                          existing_node_input != nullptr,
                                          ExpansionLambda{filter_edge, filter_node, where},
-                                         ExpansionLambda{weight_edge, weight_node, PROPERTY_LOOKUP(dba, ident_e, prop)},
+                                         ExpansionLambda{weight_edge,
+                                                         weight_node,
+                                                         weight ? weight : PROPERTY_LOOKUP(dba, ident_e, prop)},
                                          total_weight,
                                          nullptr);
 
@@ -2679,6 +2796,90 @@ TYPED_TEST(QueryPlanExpandAllShortestPaths, Where) {
   }
 }
 
+TYPED_TEST(QueryPlanExpandAllShortestPaths, ExistingNodeFromSource) {
+  // the search from v[0] ends in the bound v[4], with only the cheapest path to it
+  auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+  n0.op_ = std::make_shared<Filter>(n0.op_,
+                                    std::vector<std::shared_ptr<LogicalOperator>>{},
+                                    EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(4)));
+
+  auto results = this->ExpandAllShortest(EdgeAtom::Direction::BOTH, 1000, LITERAL(true), 0, &n0);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(this->GetProp(results[0].vertex), 4);
+  EXPECT_EQ(results[0].total_weight, 9);
+  ASSERT_EQ(results[0].path.size(), 3);
+  EXPECT_EQ(results[0].path[0], this->e.at({0, 2}));
+  EXPECT_EQ(results[0].path[1], this->e.at({2, 3}));
+  EXPECT_EQ(results[0].path[2], this->e.at({3, 4}));
+}
+
+// Uses graph from Basic test, with double edge 2->-3 and 3->-4, so 4 paths of weight 9 end in v[4]
+TYPED_TEST(QueryPlanExpandAllShortestPaths, ExistingNodeEqualCostPaths) {
+  ASSERT_TRUE(this->dba.InsertEdge(&this->v[2], &this->v[3], this->edge_type)
+                  ->SetProperty(this->prop.second, memgraph::storage::PropertyValue(3))
+                  .has_value());
+  ASSERT_TRUE(this->dba.InsertEdge(&this->v[3], &this->v[4], this->edge_type)
+                  ->SetProperty(this->prop.second, memgraph::storage::PropertyValue(3))
+                  .has_value());
+  this->dba.AdvanceCommand();
+
+  auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+  n0.op_ = std::make_shared<Filter>(n0.op_,
+                                    std::vector<std::shared_ptr<LogicalOperator>>{},
+                                    EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(4)));
+
+  // stopping the search once the target is reached must still find all of the paths as cheap as the first one
+  auto results = this->ExpandAllShortest(EdgeAtom::Direction::BOTH, 1000, LITERAL(true), 0, &n0);
+  ASSERT_EQ(results.size(), 4);
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(this->GetProp(results[i].vertex), 4);
+    EXPECT_EQ(results[i].total_weight, 9);
+    ASSERT_EQ(results[i].path.size(), 3);
+    EXPECT_EQ(results[i].path[0], this->e.at({0, 2}));
+    for (size_t j = 0; j < i; ++j) EXPECT_TRUE(results[i].path != results[j].path) << i << " " << j;
+  }
+}
+
+TYPED_TEST(QueryPlanExpandAllShortestPaths, ExpressionWeight) {
+  // weights that aren't just a property of the edge are evaluated with the lambda's symbols on the frame
+  {
+    auto ident_e = IDENT("e");
+    ident_e->MapTo(this->weight_edge);
+    auto double_weight = ADD(PROPERTY_LOOKUP(this->dba, ident_e, this->prop),
+                             PROPERTY_LOOKUP(this->dba, ident_e, this->prop));
+    auto results = this->ExpandAllShortest(
+        EdgeAtom::Direction::BOTH, 1000, LITERAL(true), 0, nullptr, nullptr, double_weight);
+    std::sort(results.begin(), results.end(), compareResultType<TypeParam>);
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(this->GetProp(results[0].vertex), 2);
+    EXPECT_EQ(results[0].total_weight, 6);
+    EXPECT_EQ(this->GetProp(results[1].vertex), 1);
+    EXPECT_EQ(results[1].total_weight, 10);
+    EXPECT_EQ(this->GetProp(results[2].vertex), 3);
+    EXPECT_EQ(results[2].total_weight, 12);
+    EXPECT_EQ(this->GetProp(results[3].vertex), 4);
+    EXPECT_EQ(results[3].total_weight, 18);
+  }
+  {
+    // the property of the node expanded to, not of the edge; the source's own weight of 0.5 starts every path
+    auto ident_v = IDENT("v");
+    ident_v->MapTo(this->weight_node);
+    auto node_weight = ADD(PROPERTY_LOOKUP(this->dba, ident_v, this->prop), LITERAL(0.5));
+    auto results = this->ExpandAllShortest(
+        EdgeAtom::Direction::BOTH, 1000, LITERAL(true), 0, nullptr, nullptr, node_weight);
+    std::sort(results.begin(), results.end(), compareResultType<TypeParam>);
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(this->GetProp(results[0].vertex), 1);
+    EXPECT_EQ(results[0].total_weight, 2);
+    EXPECT_EQ(this->GetProp(results[1].vertex), 2);
+    EXPECT_EQ(results[1].total_weight, 3);
+    EXPECT_EQ(this->GetProp(results[2].vertex), 4);
+    EXPECT_EQ(results[2].total_weight, 5);
+    EXPECT_EQ(this->GetProp(results[3].vertex), 3);
+    EXPECT_EQ(results[3].total_weight, 6.5);
+  }
+}
+
 TYPED_TEST(QueryPlanExpandAllShortestPaths, UpperBound) {
   {
     auto results = this->ExpandAllShortest(EdgeAtom::Direction::BOTH, std::nullopt, LITERAL(true));
@@ -3317,6 +3518,297 @@ TYPED_TEST(QueryPlan, EdgeUniquenessFilter) {
   EXPECT_EQ(1, check_expand_results(true));
 }
 
+TYPED_TEST(QueryPlan, ExpandIntersect) {
+  auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // make a graph with the triangles (v0)->(v1)->(v2)->(v0) and (v0)->(v1)->(v3)->(v0), a parallel edge (v1)->(v2), a
+  // recursive edge (v0)->(v0) and an edge (v3)->(v4) that closes nothing
+  std::vector<memgraph::query::VertexAccessor> vertices;
+  for (int i = 0; i < 5; ++i) vertices.push_back(dba.InsertVertex());
+  auto edge_type = dba.NameToEdgeType("edge_type");
+  std::vector<std::pair<int, int>> const edges{{0, 1}, {1, 2}, {1, 2}, {2, 0}, {1, 3}, {3, 0}, {0, 0}, {3, 4}};
+  for (auto [from, to] : edges) {
+    ASSERT_TRUE(dba.InsertEdge(&vertices[from], &vertices[to], edge_type).has_value());
+  }
+  dba.AdvanceCommand();
+
+  // MATCH (n1)-[r1]-(n2)-[r2]-(n3)-[r3]-(n1) RETURN r1, r2, r3
+  auto match_cycle = [&](EdgeAtom::Direction d1, EdgeAtom::Direction d2, EdgeAtom::Direction d3, bool intersect) {
+    SymbolTable symbol_table;
+    auto n1 = MakeScanAll(this->storage, symbol_table, "n1");
+    auto r1_n2 = MakeExpand(
+        this->storage, symbol_table, n1.op_, n1.sym_, "r1", d1, {}, "n2", false, memgraph::storage::View::OLD);
+    auto r2_n3 = MakeExpand(this->storage,
+                            symbol_table,
+                            r1_n2.op_,
+                            r1_n2.node_sym_,
+                            "r2",
+                            d2,
+                            {},
+                            "n3",
+                            false,
+                            memgraph::storage::View::OLD);
+    std::shared_ptr<LogicalOperator> last_op =
+        std::make_shared<EdgeUniquenessFilter>(r2_n3.op_, r2_n3.edge_sym_, std::vector<Symbol>{r1_n2.edge_sym_});
+    auto r3_sym = symbol_table.CreateSymbol("r3", true);
+    last_op = std::make_shared<Expand>(
+        last_op, r2_n3.node_sym_, n1.sym_, r3_sym, d3, std::vector<memgraph::storage::EdgeTypeId>{}, true,
+        memgraph::storage::View::OLD);
+    last_op = std::make_shared<EdgeUniquenessFilter>(
+        last_op, r3_sym, std::vector<Symbol>{r1_n2.edge_sym_, r2_n3.edge_sym_});
+    if (intersect) {
+      memgraph::query::plan::impl::ExpandIntersectRewriter rewriter;
+      last_op->Accept(rewriter);
+      rewriter.Rewrite();
+      EXPECT_EQ(last_op->input()->input()->GetTypeInfo(), ExpandIntersect::kType);
+    }
+
+    auto output = [&](const std::string &name, const Symbol &symbol) {
+      return NEXPR(name, IDENT(name)->MapTo(symbol))
+          ->MapTo(symbol_table.CreateSymbol("named_expression_" + name, true));
+    };
+    auto produce =
+        MakeProduce(last_op, output("r1", r1_n2.edge_sym_), output("r2", r2_n3.edge_sym_), output("r3", r3_sym));
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    std::multiset<std::tuple<int64_t, int64_t, int64_t>> cycles;
+    for (const auto &row : CollectProduce(*produce, &context)) {
+      cycles.emplace(row[0].ValueEdge().Gid().AsInt(), row[1].ValueEdge().Gid().AsInt(),
+                     row[2].ValueEdge().Gid().AsInt());
+    }
+    return cycles;
+  };
+
+  using Direction = EdgeAtom::Direction;
+  EXPECT_EQ(match_cycle(Direction::OUT, Direction::OUT, Direction::OUT, true).size(), 9);
+  for (auto d1 : {Direction::IN, Direction::OUT, Direction::BOTH}) {
+    for (auto d2 : {Direction::IN, Direction::OUT, Direction::BOTH}) {
+      for (auto d3 : {Direction::IN, Direction::OUT, Direction::BOTH}) {
+        EXPECT_EQ(match_cycle(d1, d2, d3, false), match_cycle(d1, d2, d3, true));
+      }
+    }
+  }
+}
+
+TYPED_TEST(QueryPlan, STShortestPathOnWorkerPool) {
+  if (std::is_same_v<TypeParam, memgraph::storage::DiskStorage>) {
+    GTEST_SKIP() << "Parallel execution is not supported for on-disk storage";
+  }
+  auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // make a graph where the source has 5000 out-neighbours and the sink 6000 in-neighbours, with a few edges between
+  // the two groups, so the search has to expand a frontier large enough to be read on the worker pool
+  auto edge_type = dba.NameToEdgeType("edge_type");
+  auto source = dba.InsertVertex();
+  auto sink = dba.InsertVertex();
+  std::vector<memgraph::query::VertexAccessor> from_source;
+  std::vector<memgraph::query::VertexAccessor> to_sink;
+  for (int i = 0; i < 5000; ++i) {
+    from_source.push_back(dba.InsertVertex());
+    ASSERT_TRUE(dba.InsertEdge(&source, &from_source.back(), edge_type).has_value());
+  }
+  for (int i = 0; i < 6000; ++i) {
+    to_sink.push_back(dba.InsertVertex());
+    ASSERT_TRUE(dba.InsertEdge(&to_sink.back(), &sink, edge_type).has_value());
+  }
+  for (auto i : {10, 2500, 4999}) {
+    ASSERT_TRUE(dba.InsertEdge(&from_source[i], &to_sink[i], edge_type).has_value());
+  }
+  // isolated vertices keep the frontier a small part of the graph, so it is expanded top-down
+  for (int i = 0; i < 70000; ++i) dba.InsertVertex();
+  dba.AdvanceCommand();
+  dba.SetParallelExecution();
+
+  memgraph::utils::PriorityThreadPool worker_pool{4, 1};
+  auto shortest_path = [&](bool on_worker_pool) {
+    SymbolTable symbol_table;
+    auto source_sym = symbol_table.CreateSymbol("source", true);
+    auto sink_sym = symbol_table.CreateSymbol("sink", true);
+    auto edge_sym = symbol_table.CreateSymbol("edges", true);
+    ExpansionLambda filter_lambda{.inner_edge_symbol = symbol_table.CreateSymbol("inner_edge", false),
+                                  .inner_node_symbol = symbol_table.CreateSymbol("inner_node", false)};
+    auto bfs = std::make_shared<ExpandVariable>(std::make_shared<Once>(),
+                                                source_sym,
+                                                sink_sym,
+                                                edge_sym,
+                                                EdgeAtom::Type::BREADTH_FIRST,
+                                                EdgeAtom::Direction::OUT,
+                                                std::vector<memgraph::storage::EdgeTypeId>{},
+                                                false,
+                                                nullptr,
+                                                nullptr,
+                                                true,
+                                                filter_lambda,
+                                                std::nullopt,
+                                                std::nullopt,
+                                                nullptr);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    if (on_worker_pool) {
+      context.parallel_execution = 4;
+      context.worker_pool = &worker_pool;
+    }
+    Frame frame(symbol_table.max_position());
+    auto frame_writer = frame.GetFrameWriter(nullptr, context.evaluation_context.memory);
+    frame_writer.Write(source_sym, TypedValue(source));
+    frame_writer.Write(sink_sym, TypedValue(sink));
+    auto cursor = bfs->MakeCursor(memgraph::utils::NewDeleteResource(), TestMetricHandles());
+    std::vector<memgraph::query::EdgeAccessor> edges;
+    EXPECT_TRUE(cursor->Pull(frame, context));
+    for (const auto &edge : frame[edge_sym].ValueList()) edges.push_back(edge.ValueEdge());
+    EXPECT_FALSE(cursor->Pull(frame, context));
+    return edges;
+  };
+
+  auto const path = shortest_path(true);
+  ASSERT_EQ(path.size(), 3);
+  EXPECT_EQ(path.front().From(), source);
+  EXPECT_EQ(path.back().To(), sink);
+  EXPECT_EQ(path, shortest_path(false));
+  worker_pool.ShutDown();
+}
+
+TYPED_TEST(QueryPlan, STShortestPathBottomUp) {
+  auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // the source has 2000 out-neighbours and the sink 2000 in-neighbours, so the third step of the search has a
+  // frontier larger than the rest of the graph and is expanded bottom-up
+  auto edge_type = dba.NameToEdgeType("edge_type");
+  auto source = dba.InsertVertex();
+  auto sink = dba.InsertVertex();
+  std::vector<memgraph::query::VertexAccessor> from_source;
+  std::vector<memgraph::query::VertexAccessor> to_sink;
+  for (int i = 0; i < 2000; ++i) {
+    from_source.push_back(dba.InsertVertex());
+    ASSERT_TRUE(dba.InsertEdge(&source, &from_source.back(), edge_type).has_value());
+  }
+  for (int i = 0; i < 2000; ++i) {
+    to_sink.push_back(dba.InsertVertex());
+    ASSERT_TRUE(dba.InsertEdge(&to_sink.back(), &sink, edge_type).has_value());
+  }
+  for (auto i : {10, 1000, 1999}) {
+    ASSERT_TRUE(dba.InsertEdge(&from_source[i], &to_sink[i], edge_type).has_value());
+  }
+  dba.AdvanceCommand();
+
+  auto shortest_path = [&](bool top_down) {
+    SymbolTable symbol_table;
+    auto source_sym = symbol_table.CreateSymbol("source", true);
+    auto sink_sym = symbol_table.CreateSymbol("sink", true);
+    auto edge_sym = symbol_table.CreateSymbol("edges", true);
+    ExpansionLambda filter_lambda{.inner_edge_symbol = symbol_table.CreateSymbol("inner_edge", false),
+                                  .inner_node_symbol = symbol_table.CreateSymbol("inner_node", false)};
+    auto bfs = std::make_shared<ExpandVariable>(std::make_shared<Once>(),
+                                                source_sym,
+                                                sink_sym,
+                                                edge_sym,
+                                                EdgeAtom::Type::BREADTH_FIRST,
+                                                EdgeAtom::Direction::OUT,
+                                                std::vector<memgraph::storage::EdgeTypeId>{},
+                                                false,
+                                                nullptr,
+                                                nullptr,
+                                                true,
+                                                filter_lambda,
+                                                std::nullopt,
+                                                std::nullopt,
+                                                nullptr);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    // hops are only counted top-down, so any hops limit keeps the search from switching
+    if (top_down) context.hops_limit = memgraph::query::HopsLimit{1'000'000'000};
+    Frame frame(symbol_table.max_position());
+    auto frame_writer = frame.GetFrameWriter(nullptr, context.evaluation_context.memory);
+    frame_writer.Write(source_sym, TypedValue(source));
+    frame_writer.Write(sink_sym, TypedValue(sink));
+    auto cursor = bfs->MakeCursor(memgraph::utils::NewDeleteResource(), TestMetricHandles());
+    std::vector<memgraph::query::EdgeAccessor> edges;
+    EXPECT_TRUE(cursor->Pull(frame, context));
+    for (const auto &edge : frame[edge_sym].ValueList()) edges.push_back(edge.ValueEdge());
+    EXPECT_FALSE(cursor->Pull(frame, context));
+    return edges;
+  };
+
+  auto const path = shortest_path(false);
+  ASSERT_EQ(path.size(), 3);
+  EXPECT_EQ(path[0].From(), source);
+  EXPECT_EQ(path[1].From(), path[0].To());
+  EXPECT_EQ(path[2].From(), path[1].To());
+  EXPECT_EQ(path[2].To(), sink);
+  EXPECT_EQ(shortest_path(true).size(), 3);
+}
+
+TYPED_TEST(QueryPlan, SingleSourceShortestPathBottomUp) {
+  auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // the source leads to 2000 vertices which each lead on to one more, so the second level is most of the graph and
+  // is expanded bottom-up; the filter lambda keeps half of that level
+  auto edge_type = dba.NameToEdgeType("edge_type");
+  auto prop = PROPERTY_PAIR(dba, "p");
+  auto source = dba.InsertVertex();
+  for (int i = 0; i < 2000; ++i) {
+    auto middle = dba.InsertVertex();
+    auto last = dba.InsertVertex();
+    ASSERT_TRUE(middle.SetProperty(prop.second, memgraph::storage::PropertyValue(0)).has_value());
+    ASSERT_TRUE(last.SetProperty(prop.second, memgraph::storage::PropertyValue(i)).has_value());
+    ASSERT_TRUE(dba.InsertEdge(&source, &middle, edge_type).has_value());
+    ASSERT_TRUE(dba.InsertEdge(&middle, &last, edge_type).has_value());
+  }
+  dba.AdvanceCommand();
+
+  auto reached = [&](bool top_down) {
+    SymbolTable symbol_table;
+    auto source_sym = symbol_table.CreateSymbol("source", true);
+    auto node_sym = symbol_table.CreateSymbol("node", true);
+    auto edge_sym = symbol_table.CreateSymbol("edges", true);
+    auto inner_node_sym = symbol_table.CreateSymbol("inner_node", false);
+    ExpansionLambda filter_lambda{
+        .inner_edge_symbol = symbol_table.CreateSymbol("inner_edge", false),
+        .inner_node_symbol = inner_node_sym,
+        .expression = LESS(PROPERTY_LOOKUP(dba, IDENT("inner_node")->MapTo(inner_node_sym), prop), LITERAL(1000))};
+    auto bfs = std::make_shared<ExpandVariable>(std::make_shared<Once>(),
+                                                source_sym,
+                                                node_sym,
+                                                edge_sym,
+                                                EdgeAtom::Type::BREADTH_FIRST,
+                                                EdgeAtom::Direction::OUT,
+                                                std::vector<memgraph::storage::EdgeTypeId>{},
+                                                false,
+                                                nullptr,
+                                                nullptr,
+                                                false,
+                                                filter_lambda,
+                                                std::nullopt,
+                                                std::nullopt,
+                                                nullptr);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    if (top_down) context.hops_limit = memgraph::query::HopsLimit{1'000'000'000};
+    Frame frame(symbol_table.max_position());
+    frame.GetFrameWriter(nullptr, context.evaluation_context.memory).Write(source_sym, TypedValue(source));
+    auto cursor = bfs->MakeCursor(memgraph::utils::NewDeleteResource(), TestMetricHandles());
+    std::map<memgraph::storage::Gid, size_t> depths;
+    while (cursor->Pull(frame, context)) {
+      auto const &edges = frame[edge_sym].ValueList();
+      auto vertex = source;
+      for (const auto &edge : edges) {
+        EXPECT_EQ(edge.ValueEdge().From(), vertex);
+        vertex = edge.ValueEdge().To();
+      }
+      EXPECT_EQ(vertex, frame[node_sym].ValueVertex());
+      EXPECT_TRUE(depths.emplace(vertex.Gid(), edges.size()).second);
+    }
+    return depths;
+  };
+
+  auto const bottom_up = reached(false);
+  ASSERT_EQ(bottom_up.size(), 3000);
+  size_t second_level = 0;
+  for (const auto &[gid, depth] : bottom_up) second_level += depth == 2 ? 1 : 0;
+  EXPECT_EQ(second_level, 1000);
+  EXPECT_EQ(bottom_up, reached(true));
+}
+
 TYPED_TEST(QueryPlan, Distinct) {
   // test queries like
   // UNWIND [1, 2, 3, 3] AS x RETURN DISTINCT x
@@ -3577,6 +4069,95 @@ TYPED_TEST(QueryPlan, ScanAllByLabelPropertyEqualityNoError) {
   EXPECT_TRUE(eq(value, TypedValue(42)));
 }
 
+TYPED_TEST(QueryPlan, ScanAllByLabelPropertyIndexValues) {
+  auto label = this->db->NameToLabel("label");
+  auto prop = this->db->NameToProperty("prop");
+  memgraph::storage::Gid number_gid;
+  memgraph::storage::Gid list_gid;
+  auto list_of = [](auto value) {
+    return memgraph::storage::PropertyValue(
+        std::vector<memgraph::storage::PropertyValue>{memgraph::storage::PropertyValue(value)});
+  };
+  {
+    auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+    memgraph::query::DbAccessor dba(storage_dba.get());
+    auto string_vertex = dba.InsertVertex();
+    ASSERT_TRUE(string_vertex.AddLabel(label).has_value());
+    ASSERT_TRUE(string_vertex.SetProperty(prop, memgraph::storage::PropertyValue("a")).has_value());
+    auto number_vertex = dba.InsertVertex();
+    ASSERT_TRUE(number_vertex.AddLabel(label).has_value());
+    ASSERT_TRUE(number_vertex.SetProperty(prop, memgraph::storage::PropertyValue(1.0)).has_value());
+    number_gid = number_vertex.Gid();
+    auto list_vertex = dba.InsertVertex();
+    ASSERT_TRUE(list_vertex.AddLabel(label).has_value());
+    ASSERT_TRUE(list_vertex.SetProperty(prop, list_of(2.0)).has_value());
+    list_gid = list_vertex.Gid();
+    ASSERT_TRUE(dba.Commit(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+  {
+    auto unique_acc = this->db->UniqueAccess();
+    [[maybe_unused]] auto _ = unique_acc->CreateIndex(label, {prop});
+    ASSERT_TRUE(unique_acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+  {
+    // The entries of 1.0 and [2.0] equal the new values, so they stay in the index
+    auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+    memgraph::query::DbAccessor dba(storage_dba.get());
+    auto number_vertex = dba.FindVertex(number_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(number_vertex);
+    ASSERT_TRUE(number_vertex->SetProperty(prop, memgraph::storage::PropertyValue(1)).has_value());
+    auto list_vertex = dba.FindVertex(list_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(list_vertex);
+    ASSERT_TRUE(list_vertex->SetProperty(prop, list_of(2)).has_value());
+    ASSERT_TRUE(dba.Commit(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+
+  auto storage_dba = this->db->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto run_scan_all = [&](ScanAllTuple scan_all, SymbolTable &symbol_table) {
+    // RETURN n.prop, read from the index entry
+    auto value_symbol = symbol_table.CreateAnonymousSymbol();
+    std::static_pointer_cast<ScanAllByLabelProperties>(scan_all.op_)->index_value_symbols_ = {value_symbol};
+    auto output = NEXPR("n.prop", IDENT("n.prop")->MapTo(value_symbol))->MapTo(symbol_table.CreateSymbol("r", true));
+    auto produce = MakeProduce(scan_all.op_, output);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    return CollectProduce(*produce, &context);
+  };
+
+  {
+    SymbolTable symbol_table;
+    auto results = run_scan_all(
+        MakeScanAllByLabelPropertyValue(this->storage, symbol_table, "n", label, prop, LITERAL("a")), symbol_table);
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_TRUE(results[0][0].IsString());
+    EXPECT_EQ(results[0][0].ValueString(), "a");
+  }
+  {
+    SymbolTable symbol_table;
+    auto results = run_scan_all(MakeScanAllByLabelPropertyRange(this->storage,
+                                                                symbol_table,
+                                                                "n",
+                                                                label,
+                                                                prop,
+                                                                Bound{LITERAL(0), Bound::Type::INCLUSIVE},
+                                                                Bound{LITERAL(2), Bound::Type::INCLUSIVE}),
+                                symbol_table);
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_TRUE(results[0][0].IsInt());
+    EXPECT_EQ(results[0][0].ValueInt(), 1);
+  }
+  {
+    SymbolTable symbol_table;
+    auto results = run_scan_all(
+        MakeScanAllByLabelPropertyValue(this->storage, symbol_table, "n", label, prop, LIST(LITERAL(2))), symbol_table);
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_TRUE(results[0][0].IsList());
+    ASSERT_EQ(results[0][0].ValueList().size(), 1);
+    ASSERT_TRUE(results[0][0].ValueList()[0].IsInt());
+    EXPECT_EQ(results[0][0].ValueList()[0].ValueInt(), 2);
+  }
+}
+
 TYPED_TEST(QueryPlan, ScanAllByLabelPropertyValueError) {
   auto label = this->db->NameToLabel("label");
   auto prop = this->db->NameToProperty("prop");
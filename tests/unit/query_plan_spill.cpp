@@ -0,0 +1,292 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "flags/general.hpp"
+#include "query/db_accessor.hpp"
+#include "query/path.hpp"
+#include "query/plan/spill.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/temporal.hpp"
+
+#include "query_plan_common.hpp"
+
+using memgraph::query::TypedValue;
+using memgraph::query::plan::SpillFile;
+
+class QueryPlanSpillTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    previous_data_directory_ = FLAGS_data_directory;
+    FLAGS_data_directory = data_directory_.string();
+  }
+
+  void TearDown() override {
+    FLAGS_data_directory = previous_data_directory_;
+    std::filesystem::remove_all(data_directory_);
+  }
+
+  /// Puts the query under a memory limit of which only an eighth is left, so the operators spill from their first
+  /// row on.
+  static void ExhaustQueryMemory(memgraph::query::DbAccessor &dba) {
+    constexpr size_t kLimit = 64UL * 1024 * 1024;
+    auto &tracker = dba.GetTransactionMemoryTracker();
+    tracker.SetQueryLimit(kLimit);
+    ASSERT_TRUE(tracker.TrackAlloc(kLimit / 8 * 7));
+  }
+
+  Expression *IntList(const std::vector<int> &values) {
+    std::vector<Expression *> elements;
+    elements.reserve(values.size());
+    for (auto value : values) elements.push_back(LITERAL(value));
+    return storage.Create<ListLiteral>(std::move(elements));
+  }
+
+  /// Spill files are created only once an operator spills, and removed with its cursor.
+  bool Spilled() const { return std::filesystem::exists(data_directory_ / "query_spill"); }
+  bool SpillFilesRemoved() const { return std::filesystem::is_empty(data_directory_ / "query_spill"); }
+
+  std::filesystem::path data_directory_{std::filesystem::temp_directory_path() / "MG_tests_unit_query_plan_spill"};
+  std::string previous_data_directory_;
+  std::unique_ptr<memgraph::storage::Storage> db_{std::make_unique<memgraph::storage::InMemoryStorage>()};
+  AstStorage storage;
+};
+
+TEST_F(QueryPlanSpillTest, ValuesRoundTrip) {
+  auto storage_dba = db_->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto v1 = dba.InsertVertex();
+  auto v2 = dba.InsertVertex();
+  auto edge = *dba.InsertEdge(&v1, &v2, dba.NameToEdgeType("T"));
+  dba.AdvanceCommand();
+
+  std::vector<TypedValue> written{
+      TypedValue(),
+      TypedValue(true),
+      TypedValue(42),
+      TypedValue(2.5),
+      TypedValue("string"),
+      TypedValue(std::vector<TypedValue>{TypedValue(1), TypedValue("two"), TypedValue(v1)}),
+      TypedValue(std::map<std::string, TypedValue>{{"a", TypedValue(1)}, {"b", TypedValue(edge)}}),
+      TypedValue(memgraph::utils::Date(memgraph::utils::DateParameters{2024, 2, 29})),
+      TypedValue(v2),
+      TypedValue(edge),
+      TypedValue(memgraph::query::Path(v1, edge, v2)),
+  };
+
+  SpillFile file;
+  file.Write(written);
+  file.Write(std::vector<TypedValue>{TypedValue(7)});
+  EXPECT_GT(file.FinishWriting(), 0);
+  EXPECT_EQ(file.rows(), 2);
+
+  memgraph::utils::pmr::vector<TypedValue> row(memgraph::utils::NewDeleteResource());
+  ASSERT_TRUE(file.Read(&row, &dba));
+  ASSERT_EQ(row.size(), written.size());
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_TRUE(TypedValue::BoolEqual{}(row[i], written[i])) << i;
+  }
+  EXPECT_EQ(row[8].ValueVertex(), v2);
+  EXPECT_EQ(row[9].ValueEdge(), edge);
+  const auto &path = row[10].ValuePath();
+  ASSERT_EQ(path.edges().size(), 1);
+  EXPECT_EQ(path.vertices()[0], v1);
+  EXPECT_EQ(path.edges()[0], edge);
+  EXPECT_EQ(path.vertices()[1], v2);
+
+  ASSERT_TRUE(file.Read(&row, &dba));
+  ASSERT_EQ(row.size(), 1);
+  EXPECT_EQ(row[0].ValueInt(), 7);
+  EXPECT_FALSE(file.Read(&row, &dba));
+}
+
+TEST_F(QueryPlanSpillTest, FileRemovedWithObject) {
+  auto spill_directory = data_directory_ / "query_spill";
+  {
+    SpillFile file;
+    file.Write(std::vector<TypedValue>{TypedValue(1)});
+    file.FinishWriting();
+    EXPECT_FALSE(std::filesystem::is_empty(spill_directory));
+  }
+  EXPECT_TRUE(std::filesystem::is_empty(spill_directory));
+}
+
+TEST_F(QueryPlanSpillTest, UnsupportedValueThrows) {
+  SpillFile file;
+  auto function = TypedValue(std::function<void(TypedValue *)>([](TypedValue *) {}));
+  EXPECT_THROW(file.Write(std::vector<TypedValue>{function}), memgraph::query::QueryRuntimeException);
+}
+
+TEST_F(QueryPlanSpillTest, OrderByMergesRuns) {
+  auto storage_dba = db_->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto p1 = dba.NameToProperty("p1");
+  auto p2 = dba.NameToProperty("p2");
+  // Every row is spilled to a run of its own, so the runs get merged into one every 16 runs and the remaining 5 are
+  // merged while pulled
+  const int N = 200;
+  for (int i = 0; i < N; ++i) {
+    auto v = dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(p1, memgraph::storage::PropertyValue((i * 37) % 50)).has_value());
+    ASSERT_TRUE(v.SetProperty(p2, memgraph::storage::PropertyValue((i * 37) % N)).has_value());
+  }
+  dba.AdvanceCommand();
+  ExhaustQueryMemory(dba);
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_p1 = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), p1);
+  auto n_p2 = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), p2);
+  auto order_by = std::make_shared<plan::OrderBy>(
+      n.op_, std::vector<SortItem>{{Ordering::ASC, n_p1}, {Ordering::DESC, n_p2}}, std::vector<Symbol>{n.sym_});
+  auto n_p1_ne = NEXPR("n.p1", n_p1)->MapTo(symbol_table.CreateSymbol("n.p1", true));
+  auto n_p2_ne = NEXPR("n.p2", n_p2)->MapTo(symbol_table.CreateSymbol("n.p2", true));
+  auto produce = MakeProduce(order_by, n_p1_ne, n_p2_ne);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+
+  EXPECT_TRUE(Spilled());
+  EXPECT_TRUE(SpillFilesRemoved());
+  ASSERT_EQ(results.size(), N);
+  for (int i = 0; i < N; ++i) {
+    // p2 takes every value once, the 4 of them with the same p1 come in descending order
+    EXPECT_EQ(results[i][0].ValueInt(), i / 4) << i;
+    EXPECT_EQ(results[i][1].ValueInt(), (i / 4) + (3 - (i % 4)) * 50) << i;
+  }
+}
+
+TEST_F(QueryPlanSpillTest, AggregateAcrossPartitions) {
+  auto storage_dba = db_->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto group = dba.NameToProperty("group");
+  auto value = dba.NameToProperty("value");
+  // Only the group of the first row is aggregated in memory, the others are spilled to their partitions
+  const int N = 1000;
+  const int kGroups = 97;
+  std::map<int64_t, std::pair<int64_t, int64_t>> expected;
+  for (int i = 0; i < N; ++i) {
+    auto v = dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(group, memgraph::storage::PropertyValue(i % kGroups)).has_value());
+    ASSERT_TRUE(v.SetProperty(value, memgraph::storage::PropertyValue(i)).has_value());
+    expected[i % kGroups].first += i;
+    ++expected[i % kGroups].second;
+  }
+  dba.AdvanceCommand();
+  ExhaustQueryMemory(dba);
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_group = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), group);
+  auto n_value = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), value);
+  auto sum_sym = symbol_table.CreateSymbol("sum", true);
+  auto count_sym = symbol_table.CreateSymbol("count", true);
+  auto aggregate = std::make_shared<Aggregate>(
+      n.op_,
+      std::vector<Aggregate::Element>{{n_value, nullptr, Aggregation::Op::SUM, sum_sym},
+                                      {n_value, nullptr, Aggregation::Op::COUNT, count_sym}},
+      std::vector<Expression *>{n_group},
+      std::vector<Symbol>{n.sym_});
+  auto sum_ne = NEXPR("sum", IDENT("sum")->MapTo(sum_sym))->MapTo(symbol_table.CreateSymbol("sum_out", true));
+  auto count_ne = NEXPR("count", IDENT("count")->MapTo(count_sym))->MapTo(symbol_table.CreateSymbol("count_out", true));
+  auto group_ne = NEXPR("group", n_group)->MapTo(symbol_table.CreateSymbol("group_out", true));
+  auto produce = MakeProduce(aggregate, sum_ne, count_ne, group_ne);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+
+  EXPECT_TRUE(Spilled());
+  EXPECT_TRUE(SpillFilesRemoved());
+  std::map<int64_t, std::pair<int64_t, int64_t>> aggregated;
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 3);
+    EXPECT_TRUE(aggregated.emplace(row[2].ValueInt(), std::make_pair(row[0].ValueInt(), row[1].ValueInt())).second)
+        << "group " << row[2].ValueInt() << " aggregated more than once";
+  }
+  EXPECT_EQ(aggregated, expected);
+}
+
+TEST_F(QueryPlanSpillTest, DistinctAcrossPartitions) {
+  auto storage_dba = db_->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  ExhaustQueryMemory(dba);
+
+  // Only the first value is let through right away, the others are deduplicated in their partitions
+  const int kDistinct = 97;
+  std::vector<int> values;
+  for (int i = 0; i < 1000; ++i) values.push_back((i * 13) % kDistinct);
+
+  SymbolTable symbol_table;
+  auto x = MakeUnwind(symbol_table, "x", nullptr, IntList(values));
+  auto distinct = std::make_shared<Distinct>(x.op_, std::vector<Symbol>{x.sym_});
+  auto x_ne = NEXPR("x", IDENT("x")->MapTo(x.sym_))->MapTo(symbol_table.CreateSymbol("x_out", true));
+  auto produce = MakeProduce(distinct, x_ne);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+
+  EXPECT_TRUE(Spilled());
+  EXPECT_TRUE(SpillFilesRemoved());
+  ASSERT_EQ(results.size(), kDistinct);
+  EXPECT_EQ(results[0][0].ValueInt(), 0);
+  std::vector<int64_t> distinct_values;
+  for (const auto &row : results) distinct_values.push_back(row[0].ValueInt());
+  std::ranges::sort(distinct_values);
+  for (int i = 0; i < kDistinct; ++i) EXPECT_EQ(distinct_values[i], i);
+}
+
+TEST_F(QueryPlanSpillTest, HashJoinAcrossPartitions) {
+  auto storage_dba = db_->Access(memgraph::storage::WRITE);
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  ExhaustQueryMemory(dba);
+
+  // The left side is built into partitions after its first value; every left value is there 3 times, and half of the
+  // right values join none
+  std::vector<int> left_values;
+  for (int i = 0; i < 300; ++i) left_values.push_back(i % 100);
+  std::vector<int> right_values;
+  for (int i = 0; i < 200; ++i) right_values.push_back(i);
+
+  SymbolTable symbol_table;
+  auto x = MakeUnwind(symbol_table, "x", nullptr, IntList(left_values));
+  auto y = MakeUnwind(symbol_table, "y", nullptr, IntList(right_values));
+  auto hash_join = std::make_shared<HashJoin>(x.op_, std::vector<Symbol>{x.sym_}, y.op_, std::vector<Symbol>{y.sym_},
+                                              EQ(IDENT("x")->MapTo(x.sym_), IDENT("y")->MapTo(y.sym_)));
+  auto produce = MakeProduce(hash_join,
+                             NEXPR("x", IDENT("x")->MapTo(x.sym_))->MapTo(symbol_table.CreateSymbol("x_out", true)),
+                             NEXPR("y", IDENT("y")->MapTo(y.sym_))->MapTo(symbol_table.CreateSymbol("y_out", true)));
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+
+  EXPECT_TRUE(Spilled());
+  EXPECT_TRUE(SpillFilesRemoved());
+  ASSERT_EQ(results.size(), left_values.size());
+  std::map<int64_t, int> joined;
+  for (const auto &row : results) {
+    ASSERT_EQ(row[0].ValueInt(), row[1].ValueInt());
+    ++joined[row[0].ValueInt()];
+  }
+  ASSERT_EQ(joined.size(), 100);
+  for (const auto &[value, count] : joined) {
+    EXPECT_LT(value, 100);
+    EXPECT_EQ(count, 3) << value;
+  }
+}
+
+TEST(QueryPlanSpillPartition, InRange) {
+  for (size_t hash : {size_t{0}, size_t{1}, size_t{12345}, ~size_t{0}}) {
+    EXPECT_LT(memgraph::query::plan::SpillPartition(hash), memgraph::query::plan::kSpillPartitions);
+  }
+}
@@ -9,7 +9,10 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <atomic>
 #include <optional>
+#include <thread>
 #include <vector>
 
 #include <fmt/format.h>
@@ -1046,3 +1049,158 @@ TEST(SkipListGc, ReclaimBlockedByAccessorAliveAtRemoveTime) {
   EXPECT_GT(r.deallocs.load(), 0U)
       << "Releasing the last blocking accessor should unblock reclamation on the next run_gc.";
 }
+
+// A pooled list asks the allocator for slabs rather than nodes, reuses freed nodes and hands everything back once
+// destroyed.
+TEST(SkipListNodePool, CarvesNodesFromSlabsAndReusesThem) {
+  constexpr int64_t kElements = 10000;
+  CountingResource r;
+  {
+    memgraph::utils::SkipList<int64_t> list{&r};
+    list.EnableNodePool();
+    {
+      auto acc = list.access();
+      for (int64_t i = 0; i < kElements; ++i) ASSERT_TRUE(acc.insert(i).second);
+    }
+    auto const allocs_after_insert = r.allocs.load();
+    ASSERT_LT(allocs_after_insert, kElements / 10);
+
+    {
+      auto acc = list.access();
+      for (int64_t i = 0; i < kElements; ++i) ASSERT_TRUE(acc.remove(i));
+    }
+    list.run_gc();
+    {
+      auto acc = list.access();
+      for (int64_t i = 0; i < kElements; ++i) ASSERT_TRUE(acc.insert(i).second);
+      ASSERT_EQ(std::distance(acc.begin(), acc.end()), kElements);
+    }
+    // Only the nodes too tall for the pool (about one in 16) went to the allocator again
+    ASSERT_LT(r.allocs.load() - allocs_after_insert, kElements / 10);
+  }
+  ASSERT_EQ(r.bytes_in_use.load(), 0);
+}
+
+TEST(SkipListNodePool, ClearHandsSlabsBack) {
+  CountingResource r;
+  memgraph::utils::SkipList<int64_t> list{&r};
+  list.EnableNodePool();
+  auto const empty_bytes = r.bytes_in_use.load();
+  {
+    auto acc = list.access();
+    for (int64_t i = 0; i < 1000; ++i) acc.insert(i);
+  }
+  ASSERT_GT(r.bytes_in_use.load(), empty_bytes);
+  list.clear();
+  ASSERT_EQ(r.bytes_in_use.load(), empty_bytes);
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.insert(1).second);
+    ASSERT_TRUE(acc.contains(1));
+  }
+}
+
+TEST(SkipListNodePool, ConcurrentInsertRemove) {
+  constexpr int kThreads = 4;
+  constexpr int64_t kPerThread = 20000;
+  memgraph::utils::SkipList<int64_t> list;
+  list.EnableNodePool();
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&list, t] {
+        for (int round = 0; round < 3; ++round) {
+          {
+            auto acc = list.access();
+            for (int64_t i = 0; i < kPerThread; ++i) acc.insert(i * kThreads + t);
+          }
+          {
+            auto acc = list.access();
+            for (int64_t i = 0; i < kPerThread; i += 2) ASSERT_TRUE(acc.remove(i * kThreads + t));
+          }
+          list.run_gc();
+        }
+      });
+    }
+  }
+  ASSERT_EQ(list.size(), kThreads * kPerThread / 2);
+  auto acc = list.access();
+  int64_t expected = 0;
+  for (auto const value : acc) {
+    // Every thread removed its even rounds, leaving the keys whose index is odd
+    while ((expected / kThreads) % 2 == 0) ++expected;
+    ASSERT_EQ(value, expected++);
+  }
+}
+
+TEST(SkipListSortedRun, SplicesIntoGaps) {
+  memgraph::utils::SkipList<int64_t> list;
+  auto acc = list.access();
+  for (int64_t i = 0; i < 100; i += 10) ASSERT_TRUE(acc.insert(i).second);
+
+  auto run = acc.sorted_run();
+  for (int64_t i = 41; i < 50; ++i) ASSERT_EQ(run.push_back(i), i);
+  ASSERT_EQ(run.size(), 9);
+  ASSERT_TRUE(acc.splice(run));
+  ASSERT_TRUE(run.empty());
+
+  auto tail = acc.sorted_run();
+  for (int64_t i = 1000; i < 2000; ++i) tail.push_back(i);
+  ASSERT_TRUE(acc.splice(tail));
+
+  ASSERT_EQ(acc.size(), 10 + 9 + 1000);
+  std::vector<int64_t> expected;
+  for (int64_t i = 0; i < 100; i += 10) {
+    expected.push_back(i);
+    if (i == 40) {
+      for (int64_t j = 41; j < 50; ++j) expected.push_back(j);
+    }
+  }
+  for (int64_t i = 1000; i < 2000; ++i) expected.push_back(i);
+  ASSERT_TRUE(std::ranges::equal(acc, expected));
+  for (auto const value : expected) ASSERT_TRUE(acc.contains(value));
+  ASSERT_TRUE(acc.remove(45));
+  ASSERT_FALSE(acc.contains(45));
+}
+
+TEST(SkipListSortedRun, RejectsOverlapAndFreesLeftovers) {
+  CountingResource r;
+  {
+    memgraph::utils::SkipList<int64_t> list{&r};
+    auto acc = list.access();
+    ASSERT_TRUE(acc.insert(50).second);
+    auto run = acc.sorted_run();
+    for (int64_t i = 0; i < 100; ++i) run.push_back(i);
+    ASSERT_FALSE(acc.splice(run));
+    ASSERT_EQ(run.size(), 100);
+    ASSERT_EQ(acc.size(), 1);
+  }
+  ASSERT_EQ(r.bytes_in_use.load(), 0);
+}
+
+TEST(SkipListSortedRun, ConcurrentSplicesOfDisjointRuns) {
+  constexpr int kThreads = 4;
+  constexpr int64_t kRuns = 50;
+  constexpr int64_t kRunSize = 1000;
+  memgraph::utils::SkipList<int64_t> list;
+  std::atomic<int64_t> next_run{0};
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&] {
+        auto acc = list.access();
+        for (auto run_index = next_run++; run_index < kRuns; run_index = next_run++) {
+          auto run = acc.sorted_run();
+          for (int64_t i = 0; i < kRunSize; ++i) run.push_back(run_index * kRunSize + i);
+          ASSERT_TRUE(acc.splice(run));
+        }
+      });
+    }
+  }
+  auto acc = list.access();
+  ASSERT_EQ(acc.size(), kRuns * kRunSize);
+  int64_t expected = 0;
+  for (auto const value : acc) ASSERT_EQ(value, expected++);
+  ASSERT_EQ(expected, kRuns * kRunSize);
+  ASSERT_EQ(acc.estimate_count(kRunSize, 1), 1);
+}
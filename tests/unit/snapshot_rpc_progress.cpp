@@ -565,6 +565,36 @@ TEST_F(SnapshotRpcProgressTest, TestPointIndexSingleThreadedVertices) {
   ASSERT_TRUE(point_idx.CreatePointIndex(label, prop, vertices.access(), on_progress));
 }
 
+TEST_F(SnapshotRpcProgressTest, TestPointIndexMultiThreadedVertices) {
+  PointIndexStorage point_idx;
+
+  auto label = LabelId::FromUint(1);
+  auto prop = PropertyId::FromUint(1);
+  auto vertices = memgraph::utils::SkipListDb<Vertex>();
+  const std::vector<std::pair<PropertyId, PropertyValue>> prop_data{
+      {prop, PropertyValue{Point2d{CoordinateReferenceSystem::Cartesian_2d, 1.0, 2.0}}},
+  };
+  {
+    auto acc = vertices.access();
+    for (uint32_t i = 1; i <= 64; i++) {
+      auto vertex = Vertex{Gid::FromUint(i), nullptr};
+      vertex.properties.InitProperties(prop_data);
+      vertex.labels.emplace_back(label);
+      auto [_, inserted] = acc.insert(std::move(vertex));
+      ASSERT_TRUE(inserted);
+    }
+  }
+
+  // No recovery batches, as for an index created on a running database
+  auto par_schema_info = ParallelizedSchemaCreationInfo{.vertex_recovery_info = {}, .thread_count = 2};
+
+  auto mocked_observer = std::make_shared<MockedSnapshotObserver>();
+  ProgressCallback on_progress = [mocked_observer] { mocked_observer->Update(); };
+  EXPECT_CALL(*mocked_observer, Update()).Times(64);
+  InitActiveIndicesStore();
+  ASSERT_TRUE(point_idx.CreatePointIndex(label, prop, vertices.access(), on_progress, par_schema_info));
+}
+
 TEST_F(SnapshotRpcProgressTest, TestVectorIndexSingleThreadedNoVertices) {
   VectorIndex vector_idx;
 
@@ -629,6 +659,48 @@ TEST_F(SnapshotRpcProgressTest, TestVectorIndexSingleThreadedVertices) {
       vector_idx.CreateIndex(spec, vertices_acc, &storage.indices_, storage.name_id_mapper_.get(), on_progress));
 }
 
+TEST_F(SnapshotRpcProgressTest, TestVectorIndexMultiThreadedVertices) {
+  VectorIndex vector_idx;
+
+  auto label = LabelId::FromUint(1);
+  auto prop = PropertyId::FromUint(1);
+
+  auto spec = VectorIndexSpec{.index_name = "vector_idx",
+                              .label_filter = VectorLabelFilter{VectorMatchMode::SINGLE, {label}},
+                              .property = prop,
+                              .metric_kind = metric,
+                              .dimension = kDimension,
+                              .resize_coefficient = resize_coefficient,
+                              .capacity = kCapacity,
+                              .scalar_kind = kScalarKind};
+
+  auto vertices = memgraph::utils::SkipListDb<Vertex>();
+  auto vertices_acc = vertices.access();
+
+  const std::vector<std::pair<PropertyId, PropertyValue>> prop_data{
+      std::pair{prop, PropertyValue{std::vector<PropertyValue>{PropertyValue(1.0), PropertyValue(1.0)}}}};
+
+  {
+    auto acc = vertices.access();
+    for (uint32_t i = 1; i <= 64; i++) {
+      auto vertex = Vertex{Gid::FromUint(i), nullptr};
+      vertex.labels.emplace_back(label);
+      vertex.properties.InitProperties(prop_data);
+      auto [_, inserted] = acc.insert(std::move(vertex));
+      ASSERT_TRUE(inserted);
+    }
+  }
+
+  // No recovery batches, as for an index created on a running database
+  auto par_schema_info = ParallelizedSchemaCreationInfo{.vertex_recovery_info = {}, .thread_count = 2};
+
+  auto mocked_observer = std::make_shared<MockedSnapshotObserver>();
+  ProgressCallback on_progress = [mocked_observer] { mocked_observer->Update(); };
+  EXPECT_CALL(*mocked_observer, Update()).Times(64);
+  ASSERT_TRUE(vector_idx.CreateIndex(
+      spec, vertices_acc, &storage.indices_, storage.name_id_mapper_.get(), on_progress, par_schema_info));
+}
+
 TEST_F(SnapshotRpcProgressTest, TestExistenceConstraintsSingleThreadedNoVertices) {
   auto label = LabelId::FromUint(1);
   auto prop = PropertyId::FromUint(1);
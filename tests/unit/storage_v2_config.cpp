@@ -45,3 +45,21 @@ TEST(StorageV2Config, BackCompatMissingKey) {
   EXPECT_NO_THROW(from_json(j, result));
   EXPECT_FALSE(result.storage_light_edge);
 }
+
+TEST(StorageV2Config, EdgeTypeGroupedAdjacencyRoundTrip) {
+  SalientConfig::Items items{};
+  EXPECT_FALSE(items.edge_type_grouped_adjacency);
+  items.edge_type_grouped_adjacency = true;
+
+  nlohmann::json j;
+  to_json(j, items);
+
+  SalientConfig::Items result{};
+  from_json(j, result);
+  EXPECT_TRUE(result.edge_type_grouped_adjacency);
+
+  j.erase("edge_type_grouped_adjacency");
+  SalientConfig::Items back_compat{};
+  EXPECT_NO_THROW(from_json(j, back_compat));
+  EXPECT_FALSE(back_compat.edge_type_grouped_adjacency);
+}
@@ -75,6 +75,20 @@ using namespace std::string_literals;
 
 namespace {
 
+// Carries a value distribution, so recovery has to bring back the most common values and the histogram too
+memgraph::storage::LabelPropertyIndexStats ExtendedLabelPropertyIndexStats() {
+  return {.count = 456'798,
+          .distinct_values_count = 312'345,
+          .statistic = 12312312.2,
+          .avg_group_size = 123123.2,
+          .avg_degree = 67876.9,
+          .most_common_values = {{1'234'567'890'123, 1'000}, {42, 900}},
+          .other_values_count = 454'898,
+          .other_distinct_values_count = 312'343,
+          .histogram_bounds = {-12.5, 0.0, 3.25, 1e10},
+          .histogram_count = 400'000};
+}
+
 template <typename TRep, typename TPeriod>
 std::chrono::milliseconds operator+(const memgraph::utils::SchedulerInterval &si,
                                     const std::chrono::duration<TRep, TPeriod> &dur) {
@@ -459,7 +473,7 @@ class DurabilityTest : public ::testing::TestWithParam<DurabilityParam> {
       auto acc = store->Access(memgraph::storage::WRITE);
       acc->SetIndexStats(label_indexed,
                          std::array{memgraph::storage::PropertyPath{property_count}},
-                         memgraph::storage::LabelPropertyIndexStats{456'798, 312'345, 12312312.2, 123123.2, 67876.9});
+                         ExtendedLabelPropertyIndexStats());
       ASSERT_TRUE(acc->GetIndexStats(label_indexed, std::array{memgraph::storage::PropertyPath{property_count}}));
       ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
     }
@@ -805,7 +819,7 @@ class DurabilityTest : public ::testing::TestWithParam<DurabilityParam> {
           check_label_property_stats(
               extended_label_indexed,
               memgraph::storage::PropertyPath{property_count},
-              memgraph::storage::LabelPropertyIndexStats{456'798, 312'345, 12312312.2, 123123.2, 67876.9});
+              ExtendedLabelPropertyIndexStats());
           break;
         }
         case DatasetType::ONLY_BASE_WITH_EXTENDED_INDICES_AND_CONSTRAINTS:
@@ -826,7 +840,7 @@ class DurabilityTest : public ::testing::TestWithParam<DurabilityParam> {
           check_label_property_stats(
               extended_label_indexed,
               memgraph::storage::PropertyPath{property_count},
-              memgraph::storage::LabelPropertyIndexStats{456'798, 312'345, 12312312.2, 123123.2, 67876.9});
+              ExtendedLabelPropertyIndexStats());
           break;
         }
       }
@@ -2761,6 +2775,133 @@ TEST_P(DurabilityTest, StorageModeSwitchBackArchivesSupersededFilesAndRestartsWa
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotIncrementalChain) {
+  if (GetParam().light_edge) GTEST_SKIP() << "Incremental snapshots don't support light edges";
+  static constexpr uint64_t kNumVertices = 20;
+
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .snapshot_wal_mode =
+                         memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                     .snapshot_interval = memgraph::utils::SchedulerInterval{std::chrono::minutes(20)},
+                     .snapshot_incremental_chain_length = 3},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+
+  std::vector<memgraph::storage::Gid> gids;
+  memgraph::storage::Gid new_vertex_gid;
+  {
+    memgraph::dbms::Database db{config};
+    const memgraph::memory::DbArenaScope arena_scope{&db.Arena()};
+    auto *mem_storage = static_cast<memgraph::storage::InMemoryStorage *>(db.storage());
+    auto const label = mem_storage->NameToLabel("Label");
+    auto const other_label = mem_storage->NameToLabel("Other");
+    auto const property = mem_storage->NameToProperty("property");
+    auto const edge_type = mem_storage->NameToEdgeType("EDGE");
+
+    // A path of vertices, written by a full snapshot that starts the chain
+    {
+      auto acc = db.Access(memgraph::storage::WRITE);
+      std::vector<memgraph::storage::VertexAccessor> vertices;
+      for (uint64_t i = 0; i < kNumVertices; ++i) {
+        auto vertex = acc->CreateVertex();
+        ASSERT_TRUE(vertex.AddLabel(label).has_value());
+        gids.push_back(vertex.Gid());
+        vertices.push_back(vertex);
+      }
+      for (uint64_t i = 0; i + 1 < kNumVertices; ++i) {
+        ASSERT_TRUE(acc->CreateEdge(&vertices[i], &vertices[i + 1], edge_type).has_value());
+      }
+      ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+    }
+    auto const full = mem_storage->CreateSnapshot();
+    ASSERT_TRUE(full.has_value());
+    ASSERT_EQ(full->parent_path(), storage_directory / memgraph::storage::durability::kSnapshotDirectory);
+
+    // A property, a deleted vertex and a new one with an edge go into the incremental snapshot
+    {
+      auto acc = db.Access(memgraph::storage::WRITE);
+      auto first = acc->FindVertex(gids[0], memgraph::storage::View::OLD);
+      ASSERT_TRUE(first);
+      ASSERT_TRUE(first->SetProperty(property, memgraph::storage::PropertyValue(42)).has_value());
+      if (GetParam().properties_on_edges) {
+        auto out_edges = first->OutEdges(memgraph::storage::View::OLD);
+        ASSERT_TRUE(out_edges.has_value());
+        ASSERT_EQ(out_edges->edges.size(), 1);
+        ASSERT_TRUE(out_edges->edges[0].SetProperty(property, memgraph::storage::PropertyValue(7)).has_value());
+      }
+      auto last = acc->FindVertex(gids.back(), memgraph::storage::View::OLD);
+      ASSERT_TRUE(last);
+      ASSERT_TRUE(acc->DetachDeleteVertex(&*last).has_value());
+      auto second = acc->FindVertex(gids[1], memgraph::storage::View::OLD);
+      ASSERT_TRUE(second);
+      auto vertex = acc->CreateVertex();
+      new_vertex_gid = vertex.Gid();
+      ASSERT_TRUE(acc->CreateEdge(&*second, &vertex, edge_type).has_value());
+      ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+    }
+    auto const incremental = mem_storage->CreateSnapshot();
+    ASSERT_TRUE(incremental.has_value());
+    ASSERT_EQ(incremental->parent_path(), storage_directory / memgraph::storage::durability::kSnapshotDirectory /
+                                              memgraph::storage::durability::kIncrementalSnapshotDirectory);
+    ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+    // Only in the WAL, replayed on top of the chain
+    {
+      auto acc = db.Access(memgraph::storage::WRITE);
+      auto vertex = acc->FindVertex(gids[2], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_TRUE(vertex->AddLabel(other_label).has_value());
+      ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+    }
+  }
+
+  memgraph::storage::Config recovery_config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::dbms::Database db{recovery_config};
+  const memgraph::memory::DbArenaScope arena_scope{&db.Arena()};
+  auto *mem_storage = db.storage();
+  auto const label = mem_storage->NameToLabel("Label");
+  auto const other_label = mem_storage->NameToLabel("Other");
+  auto const property = mem_storage->NameToProperty("property");
+  auto acc = db.Access(memgraph::storage::READ);
+  ASSERT_EQ(CountVertices(*acc, memgraph::storage::View::OLD), kNumVertices);
+  ASSERT_FALSE(acc->FindVertex(gids.back(), memgraph::storage::View::OLD));
+
+  auto first = acc->FindVertex(gids[0], memgraph::storage::View::OLD);
+  ASSERT_TRUE(first);
+  ASSERT_EQ(*first->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(42));
+  auto first_out = first->OutEdges(memgraph::storage::View::OLD);
+  ASSERT_TRUE(first_out.has_value());
+  ASSERT_EQ(first_out->edges.size(), 1);
+  if (GetParam().properties_on_edges) {
+    ASSERT_EQ(*first_out->edges[0].GetProperty(property, memgraph::storage::View::OLD),
+              memgraph::storage::PropertyValue(7));
+  }
+
+  auto second = acc->FindVertex(gids[1], memgraph::storage::View::OLD);
+  ASSERT_TRUE(second);
+  auto second_out = second->OutEdges(memgraph::storage::View::OLD);
+  ASSERT_TRUE(second_out.has_value());
+  ASSERT_EQ(second_out->edges.size(), 2);
+  auto new_vertex = acc->FindVertex(new_vertex_gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(new_vertex);
+  ASSERT_EQ(*new_vertex->InDegree(memgraph::storage::View::OLD), 1);
+  ASSERT_FALSE(*new_vertex->HasLabel(label, memgraph::storage::View::OLD));
+
+  auto before_last = acc->FindVertex(gids[kNumVertices - 2], memgraph::storage::View::OLD);
+  ASSERT_TRUE(before_last);
+  ASSERT_EQ(*before_last->OutDegree(memgraph::storage::View::OLD), 0);
+
+  auto third = acc->FindVertex(gids[2], memgraph::storage::View::OLD);
+  ASSERT_TRUE(third);
+  ASSERT_TRUE(*third->HasLabel(other_label, memgraph::storage::View::OLD));
+  ASSERT_TRUE(*third->HasLabel(label, memgraph::storage::View::OLD));
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalAppendToExisting) {
   // Create WALs.
@@ -0,0 +1,207 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string_view>
+
+#include "query/hops_limit.hpp"
+#include "storage/v2/config.hpp"
+#include "storage/v2/edge_type_grouping.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/storage.hpp"
+#include "tests/test_commit_args_helper.hpp"
+
+using namespace memgraph::storage;
+
+namespace {
+
+auto MakeGroupedStorage() -> std::unique_ptr<Storage> {
+  return std::make_unique<InMemoryStorage>(Config{.salient = {.items = {.edge_type_grouped_adjacency = true}}});
+}
+
+bool IsGrouped(Edges const &edges) { return std::is_sorted(edges.begin(), edges.end(), EdgeTypeLess{}); }
+
+// On a grouped adjacency list a typed expansion only visits the run of its type, so the expanded count equals the
+// number of matching edges; a broken grouping shows up as a missing or partial run.
+void ExpectTypedOutDegree(Storage *store, Gid gid, std::string_view type, size_t expected) {
+  auto acc = store->Access(READ);
+  auto vertex = acc->FindVertex(gid, View::OLD);
+  ASSERT_TRUE(vertex);
+  auto const edge_type = acc->NameToEdgeType(type);
+  auto const res = vertex->OutEdges(View::OLD, {edge_type});
+  ASSERT_TRUE(res.has_value());
+  EXPECT_EQ(res->edges.size(), expected);
+  EXPECT_EQ(res->expanded_count, expected);
+  for (auto const &edge : res->edges) EXPECT_EQ(edge.EdgeType(), edge_type);
+}
+
+}  // namespace
+
+TEST(EdgeTypeGrouping, AddAndRemoveKeepRuns) {
+  Edges edges;
+  auto const a = EdgeTypeId::FromUint(1);
+  auto const b = EdgeTypeId::FromUint(2);
+  auto const c = EdgeTypeId::FromUint(3);
+  for (uint64_t i = 0; i < 12; ++i) {
+    auto const type = i % 3 == 0 ? c : (i % 3 == 1 ? a : b);
+    AddEdge(edges, {type, nullptr, EdgeRef{Gid::FromUint(i)}}, true);
+    ASSERT_TRUE(IsGrouped(edges));
+  }
+  ASSERT_EQ(EdgesOfType(edges, a).size(), 4);
+  ASSERT_EQ(EdgesOfType(edges, b).size(), 4);
+  ASSERT_EQ(EdgesOfType(edges, c).size(), 4);
+  ASSERT_TRUE(EdgesOfType(edges, EdgeTypeId::FromUint(4)).empty());
+
+  // Insertion order is kept inside a run
+  auto const run = EdgesOfType(edges, a);
+  ASSERT_TRUE(std::is_sorted(run.begin(), run.end(), [](auto const &lhs, auto const &rhs) {
+    return std::get<kEdgeRefPos>(lhs).gid < std::get<kEdgeRefPos>(rhs).gid;
+  }));
+
+  RemoveEdge(edges, edges.begin() + 1, true);
+  RemoveEdge(edges, edges.begin() + 5, true);
+  ASSERT_EQ(edges.size(), 10);
+  ASSERT_TRUE(IsGrouped(edges));
+}
+
+TEST(EdgeTypeGrouping, GroupEdgesByTypeIsStable) {
+  Edges edges;
+  for (uint64_t i = 0; i < 10; ++i) {
+    AddEdge(edges, {EdgeTypeId::FromUint(10 - i % 2), nullptr, EdgeRef{Gid::FromUint(i)}}, false);
+  }
+  ASSERT_FALSE(IsGrouped(edges));
+  GroupEdgesByType(edges);
+  ASSERT_TRUE(IsGrouped(edges));
+  auto const run = EdgesOfType(edges, EdgeTypeId::FromUint(9));
+  ASSERT_EQ(run.size(), 5);
+  ASSERT_EQ(std::get<kEdgeRefPos>(run.front()).gid, Gid::FromUint(1));
+  ASSERT_EQ(std::get<kEdgeRefPos>(run.back()).gid, Gid::FromUint(9));
+}
+
+TEST(EdgeTypeGrouping, TypedExpansionOnGroupedStorage) {
+  auto store = MakeGroupedStorage();
+  Gid hub_gid;
+  {
+    auto acc = store->Access(WRITE);
+    auto hub = acc->CreateVertex();
+    hub_gid = hub.Gid();
+    auto const et1 = acc->NameToEdgeType("A");
+    auto const et2 = acc->NameToEdgeType("B");
+    auto const et3 = acc->NameToEdgeType("C");
+    for (int i = 0; i < 30; ++i) {
+      auto other = acc->CreateVertex();
+      auto const type = i % 3 == 0 ? et3 : (i % 3 == 1 ? et1 : et2);
+      ASSERT_TRUE(acc->CreateEdge(&hub, &other, type).has_value());
+      ASSERT_TRUE(acc->CreateEdge(&other, &hub, type).has_value());
+    }
+    ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+  ExpectTypedOutDegree(store.get(), hub_gid, "A", 10);
+  ExpectTypedOutDegree(store.get(), hub_gid, "B", 10);
+  ExpectTypedOutDegree(store.get(), hub_gid, "C", 10);
+
+  {
+    auto acc = store->Access(READ);
+    auto hub = acc->FindVertex(hub_gid, View::OLD);
+    ASSERT_TRUE(hub);
+    auto const et1 = acc->NameToEdgeType("A");
+    auto const et3 = acc->NameToEdgeType("C");
+    // Duplicated types in the filter must not duplicate the result
+    auto const in = hub->InEdges(View::OLD, {et3, et1, et3});
+    ASSERT_TRUE(in.has_value());
+    ASSERT_EQ(in->edges.size(), 20);
+  }
+}
+
+// A hops limit is charged for every edge of the vertex, as it is without the grouped layout, so a typed expansion under
+// a limit costs the same hops whether the layout is enabled or not.
+TEST(EdgeTypeGrouping, HopsLimitCountsEveryEdge) {
+  auto store = MakeGroupedStorage();
+  Gid hub_gid;
+  {
+    auto acc = store->Access(WRITE);
+    auto hub = acc->CreateVertex();
+    hub_gid = hub.Gid();
+    auto const et1 = acc->NameToEdgeType("A");
+    auto const et2 = acc->NameToEdgeType("B");
+    for (int i = 0; i < 12; ++i) {
+      auto other = acc->CreateVertex();
+      ASSERT_TRUE(acc->CreateEdge(&hub, &other, i % 4 == 0 ? et1 : et2).has_value());
+    }
+    ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+
+  auto acc = store->Access(READ);
+  auto hub = acc->FindVertex(hub_gid, View::OLD);
+  ASSERT_TRUE(hub);
+  auto const et1 = acc->NameToEdgeType("A");
+  {
+    auto hops_limit = memgraph::query::HopsLimit{100};
+    auto const res = hub->OutEdges(View::OLD, {et1}, nullptr, &hops_limit);
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->edges.size(), 3);
+    EXPECT_EQ(res->expanded_count, 12);
+    EXPECT_FALSE(hops_limit.IsLimitReached());
+  }
+  {
+    // Stops after five edges, as the full scan would, not after five edges of the requested type
+    auto hops_limit = memgraph::query::HopsLimit{5};
+    auto const res = hub->OutEdges(View::OLD, {et1}, nullptr, &hops_limit);
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->expanded_count, 5);
+    EXPECT_TRUE(hops_limit.IsLimitReached());
+  }
+}
+
+TEST(EdgeTypeGrouping, AbortAndDeleteKeepGrouping) {
+  auto store = MakeGroupedStorage();
+  Gid hub_gid;
+  {
+    auto acc = store->Access(WRITE);
+    auto hub = acc->CreateVertex();
+    hub_gid = hub.Gid();
+    for (int i = 0; i < 20; ++i) {
+      auto other = acc->CreateVertex();
+      ASSERT_TRUE(acc->CreateEdge(&hub, &other, acc->NameToEdgeType(i % 2 ? "A" : "B")).has_value());
+    }
+    ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+
+  // Delete every third edge and abort: the re-added edges must land back in their runs
+  {
+    auto acc = store->Access(WRITE);
+    auto hub = acc->FindVertex(hub_gid, View::OLD);
+    ASSERT_TRUE(hub);
+    auto edges = hub->OutEdges(View::OLD)->edges;
+    for (size_t i = 0; i < edges.size(); i += 3) {
+      ASSERT_TRUE(acc->DeleteEdge(&edges[i]).has_value());
+    }
+    acc->Abort();
+  }
+  ExpectTypedOutDegree(store.get(), hub_gid, "A", 10);
+  ExpectTypedOutDegree(store.get(), hub_gid, "B", 10);
+
+  // Committed deletes keep the grouping as well
+  {
+    auto acc = store->Access(WRITE);
+    auto hub = acc->FindVertex(hub_gid, View::OLD);
+    ASSERT_TRUE(hub);
+    auto edges = hub->OutEdges(View::OLD, {acc->NameToEdgeType("A")})->edges;
+    ASSERT_EQ(edges.size(), 10);
+    ASSERT_TRUE(acc->DeleteEdge(&edges[3]).has_value());
+    ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+  ExpectTypedOutDegree(store.get(), hub_gid, "A", 9);
+  ExpectTypedOutDegree(store.get(), hub_gid, "B", 10);
+}
@@ -1796,3 +1796,86 @@ TEST(StorageV2Gc, ConcurrentDeleteAndGcUAFSmoke) {
     EXPECT_EQ(vf->OutEdges(ms::View::OLD)->edges.size(), 0);
   }
 }
+
+// Enough committed transactions and deleted objects for a pass to split both the unlinking and the retiring between
+// workers. Every transaction also writes to one shared vertex, so the workers keep meeting on the same version chain.
+TEST(StorageV2Gc, ParallelCollectionRetiresEverything) {
+  constexpr int kTransactions = 1000;
+  constexpr int kVerticesPerTransaction = 10;
+
+  auto store = std::make_unique<ms::InMemoryStorage>(ms::Config{.gc = {.type = ms::Config::Gc::Type::PERIODIC,
+                                                                       .interval = std::chrono::hours(1),
+                                                                       .thread_count = 4}});
+  auto const property = store->NameToProperty("p");
+
+  ms::Gid shared_gid{};
+  {
+    auto acc = store->Access(ms::WRITE);
+    shared_gid = acc->CreateVertex().Gid();
+    ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+  }
+
+  auto const run_transactions = [&](auto const &body) {
+    for (int i = 0; i < kTransactions; ++i) {
+      auto acc = store->Access(ms::WRITE);
+      auto shared = acc->FindVertex(shared_gid, ms::View::OLD);
+      ASSERT_TRUE(shared.has_value());
+      ASSERT_TRUE(shared->SetProperty(property, ms::PropertyValue(i)).has_value());
+      body(*acc);
+      ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+    }
+  };
+
+  run_transactions([&](ms::Storage::Accessor &acc) {
+    auto const edge_type = acc.NameToEdgeType("E");
+    auto from = acc.CreateVertex();
+    for (int j = 1; j < kVerticesPerTransaction; ++j) {
+      auto to = acc.CreateVertex();
+      ASSERT_TRUE(acc.CreateEdge(&from, &to, edge_type).has_value());
+    }
+  });
+  store->FreeMemory({}, false);
+  ASSERT_EQ(store->VertexStoreSize(), 1 + (kTransactions * kVerticesPerTransaction));
+  ASSERT_EQ(store->EdgeStoreSize(), kTransactions * (kVerticesPerTransaction - 1));
+
+  // Deletes the vertices in creation order, a star per transaction
+  auto next_gid = shared_gid.AsUint() + 1;
+  run_transactions([&](ms::Storage::Accessor &acc) {
+    for (int j = 0; j < kVerticesPerTransaction; ++j) {
+      auto vertex = acc.FindVertex(ms::Gid::FromUint(next_gid++), ms::View::OLD);
+      ASSERT_TRUE(vertex.has_value());
+      ASSERT_TRUE(acc.DetachDeleteVertex(&*vertex).has_value());
+    }
+  });
+
+  {
+    auto main_guard = UniqueGuard(store->main_lock_);
+    store->FreeMemory(std::move(main_guard), false);
+  }
+  EXPECT_EQ(store->VertexStoreSize(), 1);
+  EXPECT_EQ(store->EdgeStoreSize(), 0);
+
+  auto acc = store->Access(ms::READ);
+  auto shared = acc->FindVertex(shared_gid, ms::View::OLD);
+  ASSERT_TRUE(shared.has_value());
+  EXPECT_EQ(*shared->GetProperty(property, ms::View::OLD), ms::PropertyValue(kTransactions - 1));
+}
+
+TEST_F(StorageV2GcMetricsTest, BacklogCountsTransactionsLeftLinked) {
+  constexpr int kTransactions = 5;
+
+  {
+    // An older transaction still sees the state before the commits below, so their deltas stay linked
+    auto reader = storage->Access(memgraph::storage::READ);
+    for (int i = 0; i < kTransactions; ++i) {
+      auto acc = storage->Access(memgraph::storage::WRITE);
+      acc->CreateVertex();
+      ASSERT_TRUE(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()).has_value());
+    }
+    storage->FreeMemory();
+    EXPECT_EQ(kTransactions, handles().gc_backlog_transactions.Value());
+  }
+
+  storage->FreeMemory();
+  EXPECT_EQ(0, handles().gc_backlog_transactions.Value());
+}
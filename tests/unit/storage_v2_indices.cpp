@@ -28,6 +28,7 @@
 #include "storage_test_utils.hpp"
 #include "tests/test_commit_args_helper.hpp"
 #include "tests/unit/ddl_abort_helpers.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/rocksdb_serialization.hpp"
 
 // NOLINTNEXTLINE(google-build-using-namespace)
@@ -564,6 +565,48 @@ TYPED_TEST(IndexTest, LabelIndexCountEstimate) {
   }
 }
 
+TYPED_TEST(IndexTest, LabelIndexIntersection) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto acc = this->CreateIndexAccessor();
+      EXPECT_FALSE(!acc->CreateIndex(this->label1).has_value());
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()));
+    }
+    {
+      auto acc = this->CreateIndexAccessor();
+      EXPECT_FALSE(!acc->CreateIndex(this->label2).has_value());
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()));
+    }
+
+    std::array const labels{this->label1, this->label2};
+    {
+      auto acc = this->storage->Access(memgraph::storage::WRITE);
+      for (int i = 0; i < 12; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        if (i % 2 == 0) ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        if (i % 3 == 0) ASSERT_NO_ERROR(vertex.AddLabel(this->label2));
+      }
+      EXPECT_THAT(this->GetIds(acc->Vertices(labels, View::NEW), View::NEW), UnorderedElementsAre(0, 6));
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()));
+    }
+    {
+      auto acc = this->storage->Access(memgraph::storage::WRITE);
+      EXPECT_THAT(this->GetIds(acc->Vertices(labels, View::OLD)), UnorderedElementsAre(0, 6));
+      // 12 vertices, 6 with label1 and 4 with label2
+      EXPECT_EQ(acc->ApproximateVerticesIntersectionCount(labels), 2);
+
+      // The index entry stays after the label is removed, the vertex doesn't
+      for (auto vertex : acc->Vertices(View::OLD)) {
+        if (vertex.GetProperty(this->prop_id, View::OLD)->ValueInt() == 6) {
+          ASSERT_NO_ERROR(vertex.RemoveLabel(this->label2));
+        }
+      }
+      EXPECT_THAT(this->GetIds(acc->Vertices(labels, View::OLD)), UnorderedElementsAre(0, 6));
+      EXPECT_THAT(this->GetIds(acc->Vertices(labels, View::NEW), View::NEW), UnorderedElementsAre(0));
+    }
+  }
+}
+
 TYPED_TEST(IndexTest, LabelIndexDeletedVertex) {
   if constexpr ((std::is_same_v<TypeParam, memgraph::storage::DiskStorage>)) {
     {
@@ -1461,6 +1504,60 @@ TYPED_TEST(IndexTest, LabelPropertyIndexTransactionalIsolation) {
       UnorderedElementsAre(0, 1, 2, 3, 4));
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyIndexHashLookup) {
+  if constexpr (std::is_same_v<TypeParam, memgraph::storage::DiskStorage>) {
+    GTEST_SKIP() << "The equality directory is kept only by in-memory indices";
+  }
+  FLAGS_storage_label_property_index_hash_lookup = true;
+  memgraph::utils::OnScopeExit reset_flag([] { FLAGS_storage_label_property_index_hash_lookup = false; });
+
+  {
+    auto acc = this->CreateIndexAccessor();
+    ASSERT_TRUE(acc->CreateIndex(this->label1, {PropertyPath{this->prop_val}}).has_value());
+    ASSERT_NO_ERROR(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()));
+  }
+
+  auto const lookup = [&](auto *acc, PropertyValue value, View view) {
+    return this->GetIds(
+        acc->Vertices(this->label1, std::array{PropertyPath{this->prop_val}}, std::array{pvr::Equal(value)}, view),
+        view);
+  };
+
+  {
+    auto acc = this->storage->Access(memgraph::storage::WRITE);
+    for (int i = 0; i < 5; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i % 2)));
+    }
+    auto vertex = this->CreateVertex(acc.get());
+    ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+    ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(1.0)));
+
+    EXPECT_THAT(lookup(acc.get(), PropertyValue(1), View::NEW), UnorderedElementsAre(1, 3, 5));
+    ASSERT_NO_ERROR(acc->PrepareForCommitPhase(memgraph::tests::MakeMainCommitArgs()));
+  }
+
+  auto acc_before = this->storage->Access(memgraph::storage::WRITE);
+  {
+    auto acc = this->storage->Access(memgraph::storage::WRITE);
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(2)));
+    }
+    EXPECT_THAT(lookup(acc.get(), PropertyValue(0), View::OLD), UnorderedElementsAre(0, 2, 4));
+    EXPECT_THAT(lookup(acc.get(), PropertyValue(0), View::NEW), IsEmpty());
+    EXPECT_THAT(lookup(acc.get(), PropertyValue(2), View::NEW), UnorderedElementsAre(0, 1, 2, 3, 4, 5));
+    acc->Abort();
+  }
+
+  auto acc = this->storage->Access(memgraph::storage::WRITE);
+  EXPECT_THAT(lookup(acc.get(), PropertyValue(2), View::NEW), IsEmpty());
+  EXPECT_THAT(lookup(acc.get(), PropertyValue(0), View::NEW), UnorderedElementsAre(0, 2, 4));
+  EXPECT_THAT(lookup(acc_before.get(), PropertyValue(1.0), View::OLD), UnorderedElementsAre(1, 3, 5));
+  EXPECT_THAT(lookup(acc.get(), PropertyValue("1"), View::NEW), IsEmpty());
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(IndexTest, LabelPropertyIndexFiltering) {
   // We insert vertices with values:
@@ -14,7 +14,9 @@
 
 #include <gflags/gflags.h>
 #include <limits>
+#include <map>
 #include <random>
+#include <string>
 #include <vector>
 
 #include "storage/v2/id_types.hpp"
@@ -2168,6 +2170,141 @@ TEST(PropertyStore, DecodeExpectedPropertyType) {
   }
 }
 
+TEST(PropertyStore, ManyPropertiesLookup) {
+  // Enough properties for the store to carry an offset index; every other id is left out to test misses in between
+  auto const value_of = [](int id) -> PropertyValue {
+    switch (id % 3) {
+      case 0:
+        return PropertyValue(id);
+      case 1:
+        return PropertyValue(std::string(static_cast<size_t>(id), 'x'));
+      default:
+        return PropertyValue(std::vector<PropertyValue>{PropertyValue(id), PropertyValue(id * 0.5)});
+    }
+  };
+  constexpr int kMaxId = 240;
+
+  PropertyStore store;
+  for (int id = 2; id <= kMaxId; id += 2) {
+    ASSERT_TRUE(store.SetProperty(PropertyId::FromInt(id), value_of(id)));
+  }
+
+  auto const check = [&](auto const &is_present) {
+    for (int id = 0; id <= kMaxId + 1; ++id) {
+      auto const prop = PropertyId::FromInt(id);
+      if (is_present(id)) {
+        ASSERT_EQ(store.GetProperty(prop), value_of(id)) << id;
+        ASSERT_TRUE(store.HasProperty(prop)) << id;
+        ASSERT_TRUE(store.IsPropertyEqual(prop, value_of(id))) << id;
+        ASSERT_FALSE(store.IsPropertyEqual(prop, PropertyValue())) << id;
+        ASSERT_GT(store.PropertySize(prop), 0) << id;
+      } else {
+        ASSERT_TRUE(store.GetProperty(prop).IsNull()) << id;
+        ASSERT_FALSE(store.HasProperty(prop)) << id;
+        ASSERT_TRUE(store.IsPropertyEqual(prop, PropertyValue())) << id;
+        ASSERT_EQ(store.PropertySize(prop), 0) << id;
+      }
+    }
+  };
+  check([](int id) { return id >= 2 && id % 2 == 0; });
+  ASSERT_EQ(store.Properties().size(), kMaxId / 2);
+
+  // Updates in the middle change the offsets of everything behind them
+  ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(100), PropertyValue(std::string(1000, 'y'))));
+  ASSERT_EQ(store.GetProperty(PropertyId::FromInt(100)), PropertyValue(std::string(1000, 'y')));
+  ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(100), value_of(100)));
+
+  // Values growing and shrinking everywhere shift the indexed offsets in place
+  for (int round = 0; round < 3; ++round) {
+    for (int id = 2; id <= kMaxId; id += 2) {
+      auto const size = static_cast<size_t>(((id * 7) + (round * 13)) % 300);
+      ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(id), PropertyValue(std::string(size, 'z'))));
+    }
+    for (int id = 2; id <= kMaxId; id += 2) {
+      auto const size = static_cast<size_t>(((id * 7) + (round * 13)) % 300);
+      ASSERT_EQ(store.GetProperty(PropertyId::FromInt(id)), PropertyValue(std::string(size, 'z'))) << id;
+      ASSERT_FALSE(store.HasProperty(PropertyId::FromInt(id + 1))) << id;
+    }
+  }
+  for (int id = 2; id <= kMaxId; id += 2) {
+    ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(id), value_of(id)));
+  }
+  check([](int id) { return id >= 2 && id % 2 == 0; });
+
+  // Removing properties until the index is dropped again
+  for (int id = 2; id <= kMaxId; id += 2) {
+    if (id % 8 != 0) ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(id), PropertyValue()));
+  }
+  check([](int id) { return id >= 8 && id % 8 == 0; });
+  for (int id = 8; id <= kMaxId; id += 8) {
+    if (id > 64) ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(id), PropertyValue()));
+  }
+  check([](int id) { return id >= 8 && id <= 64 && id % 8 == 0; });
+}
+
+TEST(PropertyStore, ManyPropertiesInitAndBuffer) {
+  std::map<PropertyId, PropertyValue> data;
+  for (int id = 1; id <= 100; ++id) {
+    data.emplace(PropertyId::FromInt(id * 1000), PropertyValue(id));
+  }
+  PropertyStore store;
+  ASSERT_TRUE(store.InitProperties(data));
+  ASSERT_EQ(store.Properties(), data);
+  ASSERT_EQ(store.GetProperty(PropertyId::FromInt(77000)), PropertyValue(77));
+  ASSERT_TRUE(store.GetProperty(PropertyId::FromInt(77001)).IsNull());
+  ASSERT_FALSE(store.HasProperty(PropertyId::FromInt(101000)));
+
+  // The serialized buffer leaves the in-memory index out and reads back the same
+  auto const buffer = store.StringBuffer();
+  ASSERT_FALSE(buffer.empty());
+  ASSERT_NE(static_cast<uint8_t>(buffer[0]) & 0xf0, 0xf0);
+  auto copy = PropertyStore::CreateFromBuffer(buffer);
+  ASSERT_EQ(copy.Properties(), data);
+  ASSERT_EQ(copy.GetProperty(PropertyId::FromInt(50000)), PropertyValue(50));
+  ASSERT_EQ(copy.StringBuffer(), buffer);
+
+  std::vector<PropertyPath> paths{PropertyPath{PropertyId::FromInt(3000)}, PropertyPath{PropertyId::FromInt(3001)},
+                                  PropertyPath{PropertyId::FromInt(99000)}};
+  auto const values = store.ExtractPropertyValuesMissingAsNull(paths);
+  ASSERT_EQ(values, (std::vector<PropertyValue>{PropertyValue(3), PropertyValue(), PropertyValue(99)}));
+}
+
+TEST(PropertyStore, ManyPropertiesCompressedRoundTrip) {
+  // Restores FLAGS_storage_property_store_compression_enabled on scope exit so other tests are not affected.
+  struct RestoreCompressionGuard {
+    bool saved = FLAGS_storage_property_store_compression_enabled;
+    ~RestoreCompressionGuard() { FLAGS_storage_property_store_compression_enabled = saved; }
+  } guard;
+  FLAGS_storage_property_store_compression_enabled = true;
+
+  std::map<PropertyId, PropertyValue> data;
+  for (int id = 1; id <= 100; ++id) {
+    data.emplace(PropertyId::FromInt(id), PropertyValue(std::string(32, 'a')));
+  }
+  PropertyStore store;
+  ASSERT_TRUE(store.InitProperties(data));
+  ASSERT_EQ(store.Properties(), data);
+
+  // The serialized buffer is neither compressed nor indexed and reads back the same
+  auto const buffer = store.StringBuffer();
+  ASSERT_FALSE(buffer.empty());
+  ASSERT_EQ(buffer.size() % 8, 0);
+  ASSERT_NE(static_cast<uint8_t>(buffer[0]) & 0xf0, 0xf0);
+  auto copy = PropertyStore::CreateFromBuffer(buffer);
+  ASSERT_EQ(copy.Properties(), data);
+  ASSERT_EQ(copy.GetProperty(PropertyId::FromInt(50)), PropertyValue(std::string(32, 'a')));
+  ASSERT_EQ(copy.StringBuffer(), buffer);
+
+  // Updates after the round trip keep both the compressed and the serialized forms consistent
+  ASSERT_FALSE(copy.SetProperty(PropertyId::FromInt(50), PropertyValue(50)));
+  ASSERT_TRUE(copy.SetProperty(PropertyId::FromInt(101), PropertyValue(std::string(32, 'b'))));
+  data[PropertyId::FromInt(50)] = PropertyValue(50);
+  data[PropertyId::FromInt(101)] = PropertyValue(std::string(32, 'b'));
+  ASSERT_EQ(copy.Properties(), data);
+  ASSERT_EQ(copy.GetProperty(PropertyId::FromInt(50)), PropertyValue(50));
+  ASSERT_EQ(PropertyStore::CreateFromBuffer(copy.StringBuffer()).Properties(), data);
+}
+
 //==============================================================================
 
 int main(int argc, char **argv) {
@@ -69,6 +69,11 @@ ParallelizedSchemaCreationInfo ParallelInfo() {
       .thread_count = 2};
 }
 
+// No batches, as for an index created on a live database: the workers split the vertex skip list into chunks.
+ParallelizedSchemaCreationInfo ChunkedParallelInfo() {
+  return ParallelizedSchemaCreationInfo{.vertex_recovery_info = {}, .thread_count = 2};
+}
+
 auto AlwaysCancel() -> memgraph::storage::CheckCancelFunction {
   return [] { return true; };
 }
@@ -209,6 +214,29 @@ TEST_F(SchemaCancellationTest, LabelIndexParallelPopulationCompletesWithoutCance
   EXPECT_TRUE(res.has_value());
 }
 
+TEST_F(SchemaCancellationTest, LabelIndexChunkedParallelPopulationCancels) {
+  InMemoryLabelIndex label_idx;
+  auto updater = ActiveIndicesUpdater{active_indices_store_};
+  ASSERT_TRUE(label_idx.RegisterIndex(label_, updater));
+
+  auto par_info = ChunkedParallelInfo();
+  auto res = label_idx.PopulateIndex(label_, vertices_.access(), par_info, updater, {}, nullptr, AlwaysCancel());
+  ASSERT_FALSE(res.has_value());
+  EXPECT_EQ(res.error(), memgraph::storage::IndexPopulateError::Cancellation);
+}
+
+TEST_F(SchemaCancellationTest, LabelIndexChunkedParallelPopulationIndexesEveryVertex) {
+  InMemoryLabelIndex label_idx;
+  auto updater = ActiveIndicesUpdater{active_indices_store_};
+  ASSERT_TRUE(label_idx.RegisterIndex(label_, updater));
+
+  auto par_info = ChunkedParallelInfo();
+  auto res = label_idx.PopulateIndex(
+      label_, vertices_.access(), par_info, updater, {}, nullptr, memgraph::storage::neverCancel);
+  ASSERT_TRUE(res.has_value());
+  EXPECT_EQ(label_idx.GetActiveIndices()->ApproximateVertexCount(label_), kVertexCount);
+}
+
 // A committed DROP hands the evicted constraint to GC instead of freeing its skiplist inline. Reclamation must wait
 // until nothing else references it, since a reader holding a pre-DROP ActiveConstraints snapshot can still be
 // iterating that skiplist.
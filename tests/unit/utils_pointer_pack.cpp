@@ -182,3 +182,14 @@ TEST_F(PointerPackTest, SingleBitPack) {
   EXPECT_EQ(pp.Get<0>(), 0u);
   EXPECT_EQ(pp.GetPtr(), &a);
 }
+
+TEST_F(PointerPackTest, LoadCopiesPointerAndFlags) {
+  PointerPack<Dummy, 2> pp(&a, 0b10);
+  auto const copy = pp.Load();
+
+  pp.SetPtr(&b);
+  pp.Set<0>(1);
+  EXPECT_EQ(copy.GetPtr(), &a);
+  EXPECT_EQ(copy.Get<0>(), 0u);
+  EXPECT_EQ(copy.Get<1>(), 1u);
+}
@@ -451,6 +451,29 @@ TEST(TaskCollection, MultipleExecutionsPrevented) {
   ASSERT_EQ(task.state_->load(), memgraph::utils::TaskCollection::Task::State::FINISHED);
 }
 
+TEST(TaskCollection, Claim) {
+  using namespace memgraph;
+  memgraph::utils::TaskCollection collection;
+
+  std::atomic<int> execution_count{0};
+  collection.AddTask([&execution_count](auto) { execution_count.fetch_add(1); });
+  collection.AddTask([&execution_count](auto) { execution_count.fetch_add(1); });
+
+  // Task picked up by a worker can't be claimed
+  auto wrapped_task = collection.WrapTask(0);
+  wrapped_task(utils::Priority::LOW);
+  ASSERT_FALSE(collection.Claim(0));
+
+  // Claimed task never runs and doesn't block waiting
+  ASSERT_TRUE(collection.Claim(1));
+  ASSERT_FALSE(collection.Claim(1));
+  ASSERT_EQ(collection[1].state_->load(), memgraph::utils::TaskCollection::Task::State::FINISHED);
+  collection.WrapTask(1)(utils::Priority::LOW);
+  collection.WaitOrSteal();
+
+  ASSERT_EQ(execution_count.load(), 1);
+}
+
 TEST(TaskCollection, LargeTaskSet) {
   using namespace memgraph;
   memgraph::utils::PriorityThreadPool pool{8, 2};
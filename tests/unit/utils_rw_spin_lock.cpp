@@ -0,0 +1,119 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/rw_spin_lock.hpp"
+
+using memgraph::utils::RWSpinLock;
+
+TEST(RWSpinLock, OptimisticReadValidatesWithoutWriters) {
+  RWSpinLock lock;
+  auto const version = lock.try_optimistic_read();
+  ASSERT_TRUE(version.has_value());
+  EXPECT_TRUE(lock.validate_optimistic_read(*version));
+
+  // Readers don't invalidate an optimistic read
+  {
+    auto guard = std::shared_lock{lock};
+    EXPECT_TRUE(lock.try_optimistic_read().has_value());
+    EXPECT_TRUE(lock.validate_optimistic_read(*version));
+  }
+  EXPECT_FALSE(lock.is_locked());
+}
+
+TEST(RWSpinLock, WriterInvalidatesOptimisticRead) {
+  RWSpinLock lock;
+  auto const version = lock.try_optimistic_read();
+  ASSERT_TRUE(version.has_value());
+
+  {
+    auto guard = std::unique_lock{lock};
+    EXPECT_FALSE(lock.try_optimistic_read().has_value());
+    EXPECT_FALSE(lock.validate_optimistic_read(*version));
+  }
+  EXPECT_FALSE(lock.is_locked());
+  EXPECT_FALSE(lock.validate_optimistic_read(*version));
+
+  auto const next = lock.try_optimistic_read();
+  ASSERT_TRUE(next.has_value());
+  EXPECT_NE(*next, *version);
+  EXPECT_TRUE(lock.validate_optimistic_read(*next));
+}
+
+TEST(RWSpinLock, TryLockAfterVersionBumps) {
+  RWSpinLock lock;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(lock.try_lock());
+    EXPECT_FALSE(lock.try_lock());
+    EXPECT_FALSE(lock.try_lock_shared());
+    lock.unlock();
+  }
+  ASSERT_TRUE(lock.try_lock_shared());
+  EXPECT_FALSE(lock.try_lock());
+  lock.unlock_shared();
+  EXPECT_FALSE(lock.is_locked());
+}
+
+TEST(RWSpinLock, VersionWrapsAround) {
+  RWSpinLock lock;
+  auto const version = lock.try_optimistic_read();
+  ASSERT_TRUE(version.has_value());
+  for (int i = 0; i < (1 << 16); ++i) {
+    lock.lock();
+    lock.unlock();
+  }
+  EXPECT_EQ(lock.try_optimistic_read(), version);
+  EXPECT_FALSE(lock.is_locked());
+}
+
+// Writers keep both words equal; a validated optimistic read must never see them apart.
+TEST(RWSpinLock, OptimisticReadsSeeConsistentState) {
+  constexpr int kReaders = 3;
+  constexpr uint64_t kWrites = 100'000;
+
+  RWSpinLock lock;
+  uint64_t first = 0;
+  uint64_t second = 0;
+  std::atomic<bool> done{false};
+
+  std::vector<std::jthread> readers;
+  for (int i = 0; i < kReaders; ++i) {
+    readers.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire)) {
+        auto const version = lock.try_optimistic_read();
+        if (!version) continue;
+        auto const a = std::atomic_ref{first}.load(std::memory_order_relaxed);
+        auto const b = std::atomic_ref{second}.load(std::memory_order_relaxed);
+        if (!lock.validate_optimistic_read(*version)) continue;
+        ASSERT_EQ(a, b);
+      }
+    });
+  }
+
+  for (uint64_t i = 1; i <= kWrites; ++i) {
+    auto guard = std::unique_lock{lock};
+    std::atomic_ref{first}.store(i, std::memory_order_relaxed);
+    std::atomic_ref{second}.store(i, std::memory_order_relaxed);
+  }
+  done.store(true, std::memory_order_release);
+  readers.clear();
+
+  EXPECT_EQ(first, kWrites);
+  EXPECT_FALSE(lock.is_locked());
+}